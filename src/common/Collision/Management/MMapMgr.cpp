@@ -66,6 +66,15 @@ namespace MMAP
     }
 
     bool MMapMgr::LoadTile(dtNavMesh* navMesh, uint32 mapId, int32 x, int32 y)
+    {
+        MMapTileData tile;
+        if (!ReadTile(mapId, x, y, tile))
+            return false;
+
+        return AddTile(navMesh, mapId, x, y, tile);
+    }
+
+    bool MMapMgr::ReadTile(uint32 mapId, int32 x, int32 y, MMapTileData& tile)
     {
         // load this tile :: mmaps/MMMXXYY.mmtile
         std::string fileName = Acore::StringFormat(TILE_FILE_NAME_FORMAT, sConfigMgr->GetOption<std::string>("DataDir", "."), mapId, x, y);
@@ -93,41 +102,50 @@ namespace MMAP
             return false;
         }
 
-        unsigned char* data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
-        ASSERT(data);
+        tile.Data.reset((unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM));
+        ASSERT(tile.Data);
+        tile.Size = int32(fileHeader.size);
 
-        std::size_t result = fread(data, fileHeader.size, 1, file);
+        std::size_t result = fread(tile.Data.get(), fileHeader.size, 1, file);
+        fclose(file);
         if (!result)
         {
             LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
-            fclose(file);
+            tile.Data.reset();
+            tile.Size = 0;
             return false;
         }
 
-        fclose(file);
+        return true;
+    }
+
+    bool MMapMgr::AddTile(dtNavMesh* navMesh, uint32 mapId, int32 x, int32 y, MMapTileData& tile)
+    {
+        if (!tile.Data)
+            return false;
 
         dtTileRef tileRef = 0;
 
         // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-        if (dtStatusSucceed(navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
+        if (dtStatusSucceed(navMesh->addTile(tile.Data.get(), tile.Size, DT_TILE_FREE_DATA, 0, &tileRef)))
         {
-            dtMeshHeader* header = (dtMeshHeader*)data;
+            dtMeshHeader* header = (dtMeshHeader*)tile.Data.release();
             LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:03}[{:02},{:02}] into {:03}[{:02},{:02}]", mapId, x, y, mapId, header->x, header->y);
             return true;
         }
 
         LOG_ERROR("maps", "MMAP:loadMap: Could not load {:03}{:02}{:02}.mmtile into navmesh", mapId, x, y);
-        dtFree(data);
+        tile.Data.reset();
         return false;
     }
 
-    ManagedNavMeshQuery MMapMgr::CreateNavMeshQuery(dtNavMesh* navMesh)
+    ManagedNavMeshQuery MMapMgr::CreateNavMeshQuery(dtNavMesh const* navMesh, int32 maxNodes)
     {
         // allocate mesh query
         dtNavMeshQuery* query = dtAllocNavMeshQuery();
         ASSERT(query);
 
-        if (dtStatusFailed(query->init(navMesh, 1024)))
+        if (dtStatusFailed(query->init(navMesh, maxNodes)))
         {
             dtFreeNavMeshQuery(query);
             return nullptr;
@@ -60,6 +60,33 @@ namespace MMAP
 
     using ManagedNavMeshQuery = std::unique_ptr<dtNavMeshQuery, NavMeshQueryDeleter>;
 
+    static constexpr int32 DEFAULT_NAV_MESH_QUERY_NODES = 1024;
+
+    // Kind of search a nav mesh query serves, every kind has its own node budget
+    enum class NavMeshQueryType : uint8
+    {
+        Default,
+        Chase,      // chase and follow
+        Flee,
+        Roam,       // random movement
+        PointMove,  // point movement and charges
+        Waypoint,   // path segments between waypoints
+
+        Max
+    };
+
+    struct TileDataDeleter
+    {
+        void operator()(unsigned char* data) noexcept { dtFree(data); }
+    };
+
+    // Raw .mmtile contents read from disk but not yet added to a nav mesh
+    struct MMapTileData
+    {
+        std::unique_ptr<unsigned char, TileDataDeleter> Data;
+        int32 Size = 0;
+    };
+
     class MMapMgr
     {
     public:
@@ -68,7 +95,11 @@ namespace MMAP
 
         static std::shared_ptr<dtNavMesh> LoadNavMesh(uint32 mapId);
         static bool LoadTile(dtNavMesh* navMesh, uint32 mapId, int32 x, int32 y);
-        static ManagedNavMeshQuery CreateNavMeshQuery(dtNavMesh* navMesh);
+        // LoadTile split in two: ReadTile only touches the file and is safe on any thread,
+        // AddTile modifies the nav mesh and must run on the thread owning it
+        static bool ReadTile(uint32 mapId, int32 x, int32 y, MMapTileData& tile);
+        static bool AddTile(dtNavMesh* navMesh, uint32 mapId, int32 x, int32 y, MMapTileData& tile);
+        static ManagedNavMeshQuery CreateNavMeshQuery(dtNavMesh const* navMesh, int32 maxNodes = DEFAULT_NAV_MESH_QUERY_NODES);
 
     private:
         static uint32 packTileID(int32 x, int32 y);
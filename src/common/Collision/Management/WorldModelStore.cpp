@@ -20,24 +20,28 @@
 
 std::shared_ptr<VMAP::WorldModel> WorldModelStore::AcquireModelInstance(std::string const& basepath, std::string const& filename, uint32 flags/* Only used when creating the model */)
 {
-    //! Critical section, thread safe access
-    std::lock_guard<std::mutex> lock(_lock);
-
-    ModelFileMap::iterator model = _loadedModels.find(filename);
-    if (model == _loadedModels.end())
     {
-        std::shared_ptr<VMAP::WorldModel> worldmodel = std::make_shared<VMAP::WorldModel>();
-        LOG_DEBUG("maps", "WorldModelStore: loading file '{}{}'", basepath, filename);
-        if (!worldmodel->readFile(basepath + filename + ".vmo"))
-        {
-            LOG_ERROR("maps", "WorldModelStore: could not load '{}{}.vmo'", basepath, filename);
-            return nullptr;
-        }
+        //! Critical section, thread safe access
+        std::lock_guard<std::mutex> lock(_lock);
 
-        worldmodel->Flags = flags;
+        ModelFileMap::iterator model = _loadedModels.find(filename);
+        if (model != _loadedModels.end())
+            return model->second;
+    }
 
-        model = _loadedModels.insert(std::pair<std::string, std::shared_ptr<VMAP::WorldModel>>(filename, worldmodel)).first;
+    // The file is read without holding the lock, models are also preloaded from terrain prefetch threads
+    // and a map thread must not wait for an unrelated model to come off the disk
+    std::shared_ptr<VMAP::WorldModel> worldmodel = std::make_shared<VMAP::WorldModel>();
+    LOG_DEBUG("maps", "WorldModelStore: loading file '{}{}'", basepath, filename);
+    if (!worldmodel->readFile(basepath + filename + ".vmo"))
+    {
+        LOG_ERROR("maps", "WorldModelStore: could not load '{}{}.vmo'", basepath, filename);
+        return nullptr;
     }
 
-    return model->second;
+    worldmodel->Flags = flags;
+
+    // if another thread loaded the same model in the meantime keep the first one
+    std::lock_guard<std::mutex> lock(_lock);
+    return _loadedModels.emplace(filename, std::move(worldmodel)).first->second;
 }
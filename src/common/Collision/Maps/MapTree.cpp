@@ -319,6 +319,33 @@ namespace VMAP
 
     //=========================================================
 
+    void StaticMapTree::PreloadTileModels(std::string const& basePath, uint32 mapID, uint32 tileX, uint32 tileY)
+    {
+        std::string tilefile = basePath + getTileFileName(mapID, tileX, tileY);
+        FILE* tf = fopen(tilefile.c_str(), "rb");
+        if (!tf)
+            return;
+
+        char chunk[8];
+        uint32 numSpawns = 0;
+        if (readChunk(tf, chunk, VMAP_MAGIC, 8) && fread(&numSpawns, sizeof(uint32), 1, tf) == 1)
+        {
+            for (uint32 i = 0; i < numSpawns; ++i)
+            {
+                ModelSpawn spawn;
+                uint32 referencedVal;
+                if (!ModelSpawn::readFromFile(tf, spawn) || fread(&referencedVal, sizeof(uint32), 1, tf) != 1)
+                    break;
+
+                sWorldModelStore->AcquireModelInstance(basePath, spawn.name, spawn.flags);
+            }
+        }
+
+        fclose(tf);
+    }
+
+    //=========================================================
+
     bool StaticMapTree::LoadMapTile(uint32 tileX, uint32 tileY)
     {
         if (!iIsTiled)
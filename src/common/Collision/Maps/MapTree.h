@@ -70,6 +70,9 @@ namespace VMAP
         static uint32 packTileID(uint32 tileX, uint32 tileY) { return tileX << 16 | tileY; }
         static void unpackTileID(uint32 ID, uint32& tileX, uint32& tileY) { tileX = ID >> 16; tileY = ID & 0xFF; }
         static LoadResult CanLoadMap(std::string const& basePath, uint32 mapID, uint32 tileX, uint32 tileY);
+        // Reads the models referenced by a tile into the WorldModelStore without touching any tree,
+        // so a later LoadMapTile only has to link already loaded models. Safe to call from any thread.
+        static void PreloadTileModels(std::string const& basePath, uint32 mapID, uint32 tileX, uint32 tileY);
 
         StaticMapTree(uint32 mapID, std::string const& basePath);
         ~StaticMapTree();
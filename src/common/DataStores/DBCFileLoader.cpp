@@ -23,65 +23,45 @@ DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), s
 
 bool DBCFileLoader::Load(char const* filename, char const* fmt)
 {
-    uint32 header;
-    if (data)
-    {
-        delete [] data;
-        data = nullptr;
-    }
+    data = nullptr;
+    stringTable = nullptr;
+    delete[] fieldsOffset;
+    fieldsOffset = nullptr;
 
-    FILE* f = fopen(filename, "rb");
-    if (!f)
+    // mapped copy on write, some stores fix up their records in place after loading
+    file = std::make_unique<MappedFile>();
+    if (!file->Open(filename, MappedFile::Access::CopyOnWrite))
     {
         return false;
     }
 
-    if (fread(&header, 4, 1, f) != 1)                        // Number of records
+    uint32 header[5];                                       // 'WDBC', records, fields, record size, string size
+    if (file->GetSize() < sizeof(header))
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(header);
-
-    if (header != 0x43424457)                                //'WDBC'
+    memcpy(header, file->GetData(), sizeof(header));
+    for (uint32& value : header)
     {
-        fclose(f);
-        return false;
+        EndianConvert(value);
     }
 
-    if (fread(&recordCount, 4, 1, f) != 1)                   // Number of records
+    if (header[0] != 0x43424457)                            //'WDBC'
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(recordCount);
+    recordCount = header[1];
+    fieldCount = header[2];
+    recordSize = header[3];
+    stringSize = header[4];
 
-    if (fread(&fieldCount, 4, 1, f) != 1)                    // Number of fields
+    if (!fieldCount || uint64(recordSize) * recordCount + stringSize > file->GetSize() - sizeof(header))
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(fieldCount);
-
-    if (fread(&recordSize, 4, 1, f) != 1)                    // Size of a record
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(recordSize);
-
-    if (fread(&stringSize, 4, 1, f) != 1)                    // String size
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(stringSize);
-
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
 
@@ -98,27 +78,24 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
         }
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
+    data = file->GetWritableData() + sizeof(header);
     stringTable = data + recordSize * recordCount;
 
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
-
     return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
-
     delete[] fieldsOffset;
 }
 
+std::unique_ptr<MappedFile> DBCFileLoader::ReleaseFile()
+{
+    data = nullptr;
+    stringTable = nullptr;
+    return std::move(file);
+}
+
 DBCFileLoader::Record DBCFileLoader::getRecord(std::size_t id)
 {
     ASSERT(data);
@@ -173,6 +150,29 @@ uint32 DBCFileLoader::GetFormatRecordSize(char const* format, int32* index_pos)
     return recordsize;
 }
 
+bool DBCFileLoader::HasNativeLayout(char const* format) const
+{
+#if ACORE_ENDIAN == ACORE_BIGENDIAN
+    (void)format;
+    return false;
+#else
+    if (strlen(format) != fieldCount || recordSize != fieldCount * sizeof(uint32))
+    {
+        return false;
+    }
+
+    for (uint32 x = 0; x < fieldCount; ++x)
+    {
+        if (format[x] != FT_INT && format[x] != FT_IND && format[x] != FT_FLOAT)
+        {
+            return false;
+        }
+    }
+
+    return true;
+#endif
+}
+
 char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**& indexTable)
 {
     /*
@@ -220,6 +220,18 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
         indexTable = new ptr[recordCount];
     }
 
+    // records laid out like the structure are used in place
+    if (HasNativeLayout(format))
+    {
+        char* dataTable = reinterpret_cast<char*>(data);
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            indexTable[i >= 0 ? getRecord(y).getUInt(i) : y] = &dataTable[y * recordSize];
+        }
+
+        return dataTable;
+    }
+
     char* dataTable = new char[recordCount * recordsize];
 
     uint32 offset = 0;
@@ -273,16 +285,14 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
     return dataTable;
 }
 
-char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
+void DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
 {
-    if (strlen(format) != fieldCount)
+    if (!dataTable || strlen(format) != fieldCount)
     {
-        return nullptr;
+        return;
     }
 
-    char* stringPool = new char[stringSize];
-    memcpy(stringPool, stringTable, stringSize);
-
+    // strings point into the mapped string block
     uint32 offset = 0;
 
     for (uint32 y = 0; y < recordCount; ++y)
@@ -307,8 +317,7 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
                     char** slot = (char**)(&dataTable[offset]);
                     if (!*slot || !** slot)
                     {
-                        char const* st = getRecord(y).getString(x);
-                        *slot = stringPool + (st - (char const*)stringTable);
+                        *slot = const_cast<char*>(getRecord(y).getString(x));
                     }
                     offset += sizeof(char*);
                     break;
@@ -326,6 +335,4 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
             }
         }
     }
-
-    return stringPool;
 }
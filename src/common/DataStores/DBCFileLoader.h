@@ -20,7 +20,9 @@
 
 #include "Define.h"
 #include "Errors.h"
+#include "MappedFile.h"
 #include "Utilities/ByteConverter.h"
+#include <memory>
 
 enum DbcFieldFormat
 {
@@ -92,16 +94,22 @@ public:
     [[nodiscard]] uint32 GetCols() const { return fieldCount; }
     [[nodiscard]] uint32 GetOffset(std::size_t id) const { return (fieldsOffset != nullptr && id < fieldCount) ? fieldsOffset[id] : 0; }
     [[nodiscard]] bool IsLoaded() const { return data != nullptr; }
+    // True if the records can be used in place: only 4 byte fields and all of them used
+    [[nodiscard]] bool HasNativeLayout(char const* fmt) const;
     char* AutoProduceData(char const* fmt, uint32& count, char**& indexTable);
-    char* AutoProduceStrings(char const* fmt, char* dataTable);
+    void AutoProduceStrings(char const* fmt, char* dataTable);
     static uint32 GetFormatRecordSize(char const* format, int32* index_pos = nullptr);
 
+    // Records used in place and produced strings point into the mapped file, its new owner must keep it open
+    std::unique_ptr<MappedFile> ReleaseFile();
+
 private:
     uint32 recordSize;
     uint32 recordCount;
     uint32 fieldCount;
     uint32 stringSize;
     uint32* fieldsOffset;
+    std::unique_ptr<MappedFile> file;
     unsigned char* data;
     unsigned char* stringTable;
 
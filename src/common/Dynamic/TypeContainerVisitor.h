@@ -116,6 +116,8 @@ public:
         VisitorHelper(i_visitor, c);
     }
 
+    VISITOR& GetVisitor() { return i_visitor; }
+
 private:
     VISITOR& i_visitor;
 };
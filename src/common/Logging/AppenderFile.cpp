@@ -98,7 +98,6 @@ void AppenderFile::_write(LogMessage const* message)
         }
 
         fprintf(file, "%s%s\n", message->prefix.c_str(), message->text.c_str());
-        fflush(file);
         _fileSize += uint64(message->Size());
         fclose(file);
 
@@ -115,10 +114,17 @@ void AppenderFile::_write(LogMessage const* message)
     }
 
     fprintf(logfile, "%s%s\n", message->prefix.c_str(), message->text.c_str());
-    fflush(logfile);
     _fileSize += uint64(message->Size());
 }
 
+void AppenderFile::flush()
+{
+    if (logfile)
+    {
+        fflush(logfile);
+    }
+}
+
 FILE* AppenderFile::OpenFile(std::string const& filename, std::string const& mode, bool backup)
 {
     std::string fullName(_logDir + filename);
@@ -0,0 +1,309 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AsyncLogWriter.h"
+#include "LogMessage.h"
+#include "LogRingBuffer.h"
+#include "Timer.h"
+#include <cstddef>
+#include <limits>
+
+namespace
+{
+    struct RecordHeader
+    {
+        uint32 Size;
+        uint8 Level;
+        uint8 Padding;
+        uint16 TypeLength;
+        uint32 FormatLength;
+        uint32 Param1Length;
+        uint64 Sequence;
+        int64 Time;
+        Acore::Impl::AsyncLog::Formatter Format; // nullptr if the message was formatted by the caller
+    };
+
+    // Upper bound of records written per drain pass so Suspend() cannot be starved by busy producers
+    constexpr std::size_t MaxRecordsPerDrain = 65536;
+    constexpr Milliseconds IdleWait = 10ms;
+    constexpr Seconds DroppedReportInterval = 1s;
+}
+
+struct AsyncLogWriter::ThreadBuffer
+{
+    explicit ThreadBuffer(std::size_t size) : Ring(size), Dropped(0) { }
+
+    LogRingBuffer Ring;
+    std::atomic<uint64> Dropped;
+};
+
+std::atomic<uint64> AsyncLogWriter::_nextWriterId(1);
+
+AsyncLogWriter::AsyncLogWriter(std::size_t bufferSize, WriteFn write, FlushFn flush) :
+    _id(_nextWriterId++), _bufferSize(bufferSize), _write(std::move(write)), _flush(std::move(flush)),
+    _sequence(0), _retiredDropped(0), _reportedDropped(0), _stopped(false)
+{
+    _thread = std::thread(&AsyncLogWriter::Run, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter()
+{
+    Stop();
+}
+
+void AsyncLogWriter::WriteText(LogLevel level, std::string const& type, std::string_view text, std::string_view param1 /*= {}*/)
+{
+    if (BeginRecord(level, type, text, param1, 0, nullptr))
+        EndRecord();
+    else if (IsStopped())
+        WriteSynchronous(level, type, text, param1);
+}
+
+void AsyncLogWriter::WriteSynchronous(LogLevel level, std::string_view type, std::string_view text, std::string_view param1 /*= {}*/)
+{
+    std::lock_guard<std::mutex> guard(_drainLock);
+    LogMessage message(level, std::string(type), text, param1);
+    _write(&message);
+    _flush();
+}
+
+AsyncLogWriter::ThreadBuffer* AsyncLogWriter::GetThreadBuffer()
+{
+    struct Slot
+    {
+        uint64 WriterId = 0;
+        std::shared_ptr<ThreadBuffer> Buffer;
+    };
+
+    // The writer keeps its own reference, so a buffer outlives the thread until it has been drained
+    thread_local Slot slot;
+    if (slot.WriterId != _id)
+    {
+        std::shared_ptr<ThreadBuffer> buffer = std::make_shared<ThreadBuffer>(_bufferSize);
+        {
+            std::lock_guard<std::mutex> guard(_buffersLock);
+            _buffers.push_back(buffer);
+        }
+
+        slot.Buffer = std::move(buffer);
+        slot.WriterId = _id;
+    }
+
+    return slot.Buffer.get();
+}
+
+uint8* AsyncLogWriter::BeginRecord(LogLevel level, std::string_view type, std::string_view format, std::string_view param1, std::size_t argsSize, Acore::Impl::AsyncLog::Formatter formatter)
+{
+    if (_stopped.load(std::memory_order_relaxed))
+        return nullptr;
+
+    ThreadBuffer* buffer = GetThreadBuffer();
+
+    std::size_t const size = (sizeof(RecordHeader) + type.size() + format.size() + param1.size() + argsSize + 7) & ~std::size_t(7);
+    uint8* out = nullptr;
+    if (size <= buffer->Ring.GetCapacity() / 2 && type.size() <= std::numeric_limits<uint16>::max())
+        out = buffer->Ring.Reserve(size);
+
+    if (!out)
+    {
+        buffer->Dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    RecordHeader header;
+    header.Size = uint32(size);
+    header.Level = uint8(level);
+    header.Padding = 0;
+    header.TypeLength = uint16(type.size());
+    header.FormatLength = uint32(format.size());
+    header.Param1Length = uint32(param1.size());
+    header.Sequence = _sequence.fetch_add(1, std::memory_order_relaxed);
+    header.Time = GetEpochTime().count();
+    header.Format = formatter;
+
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+    std::memcpy(out, type.data(), type.size());
+    out += type.size();
+    std::memcpy(out, format.data(), format.size());
+    out += format.size();
+    std::memcpy(out, param1.data(), param1.size());
+    return out + param1.size();
+}
+
+void AsyncLogWriter::EndRecord()
+{
+    GetThreadBuffer()->Ring.Commit();
+
+    // A record committed after the final drain of Stop() is written out by its producer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (IsStopped())
+    {
+        std::lock_guard<std::mutex> guard(_drainLock);
+        while (Drain()) { }
+    }
+}
+
+std::unique_lock<std::mutex> AsyncLogWriter::Suspend()
+{
+    std::unique_lock<std::mutex> lock(_drainLock);
+    Drain();
+    return lock;
+}
+
+void AsyncLogWriter::Stop()
+{
+    if (_stopped.exchange(true))
+        return;
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    {
+        std::lock_guard<std::mutex> guard(_wakeLock);
+    }
+    _wake.notify_all();
+
+    if (_thread.joinable())
+        _thread.join();
+
+    std::lock_guard<std::mutex> guard(_drainLock);
+    while (Drain()) { }
+    ReportDropped();
+}
+
+uint64 AsyncLogWriter::GetDroppedCount() const
+{
+    std::lock_guard<std::mutex> guard(_buffersLock);
+    uint64 dropped = _retiredDropped;
+    for (std::shared_ptr<ThreadBuffer> const& buffer : _buffers)
+        dropped += buffer->Dropped.load(std::memory_order_relaxed);
+
+    return dropped;
+}
+
+void AsyncLogWriter::Run()
+{
+    auto nextDroppedReport = std::chrono::steady_clock::now();
+    while (!_stopped.load(std::memory_order_acquire))
+    {
+        std::size_t written;
+        {
+            std::lock_guard<std::mutex> guard(_drainLock);
+            written = Drain();
+
+            if (std::chrono::steady_clock::now() >= nextDroppedReport)
+            {
+                ReportDropped();
+                nextDroppedReport = std::chrono::steady_clock::now() + DroppedReportInterval;
+            }
+        }
+
+        if (!written)
+        {
+            std::unique_lock<std::mutex> lock(_wakeLock);
+            _wake.wait_for(lock, IdleWait, [this] { return _stopped.load(std::memory_order_acquire); });
+        }
+    }
+}
+
+std::size_t AsyncLogWriter::Drain()
+{
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> guard(_buffersLock);
+        buffers = _buffers;
+    }
+
+    std::vector<uint8 const*> heads(buffers.size());
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+        heads[i] = buffers[i]->Ring.Peek();
+
+    std::size_t written = 0;
+    while (written < MaxRecordsPerDrain)
+    {
+        // Merge the per thread rings back into call order
+        std::size_t next = buffers.size();
+        uint64 nextSequence = std::numeric_limits<uint64>::max();
+        for (std::size_t i = 0; i < buffers.size(); ++i)
+        {
+            if (!heads[i])
+                continue;
+
+            uint64 sequence;
+            std::memcpy(&sequence, heads[i] + offsetof(RecordHeader, Sequence), sizeof(sequence));
+            if (sequence <= nextSequence)
+            {
+                next = i;
+                nextSequence = sequence;
+            }
+        }
+
+        if (next == buffers.size())
+            break;
+
+        RecordHeader header;
+        std::memcpy(&header, heads[next], sizeof(header));
+
+        char const* data = reinterpret_cast<char const*>(heads[next] + sizeof(header));
+        std::string_view type(data, header.TypeLength);
+        std::string_view format(data + header.TypeLength, header.FormatLength);
+        std::string_view param1(data + header.TypeLength + header.FormatLength, header.Param1Length);
+        uint8 const* args = heads[next] + sizeof(header) + header.TypeLength + header.FormatLength + header.Param1Length;
+
+        {
+            LogMessage message(LogLevel(header.Level), std::string(type), header.Format ? header.Format(format, args) : std::string(format), param1);
+            message.mtime = Seconds(header.Time);
+            _write(&message);
+        }
+
+        buffers[next]->Ring.Release();
+        heads[next] = buffers[next]->Ring.Peek();
+        ++written;
+    }
+
+    if (written)
+        _flush();
+
+    buffers.clear();
+
+    // Forget buffers of threads that have exited once everything they queued is written
+    std::lock_guard<std::mutex> guard(_buffersLock);
+    std::erase_if(_buffers, [this](std::shared_ptr<ThreadBuffer> const& buffer)
+    {
+        if (buffer.use_count() > 1 || !buffer->Ring.IsEmpty())
+            return false;
+
+        _retiredDropped += buffer->Dropped.load(std::memory_order_relaxed);
+        return true;
+    });
+
+    return written;
+}
+
+void AsyncLogWriter::ReportDropped()
+{
+    uint64 dropped = GetDroppedCount();
+    if (dropped <= _reportedDropped)
+        return;
+
+    LogMessage message(LOG_LEVEL_WARN, "server", Acore::StringFormat("Log: {} messages dropped because the asynchronous log buffers were full ({} dropped in total). Consider raising Log.Async.BufferSize.",
+        dropped - _reportedDropped, dropped));
+    _write(&message);
+    _flush();
+
+    _reportedDropped = dropped;
+}
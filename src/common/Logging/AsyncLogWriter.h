@@ -0,0 +1,209 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AsyncLogWriter_h__
+#define AsyncLogWriter_h__
+
+#include "Define.h"
+#include "LogCommon.h"
+#include "StringFormat.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+class LogRingBuffer;
+struct LogMessage;
+
+namespace Acore::Impl::AsyncLog
+{
+    // Arguments that can be captured as raw bytes and formatted later on the writer thread.
+    // Anything else (custom formatters that may read shared state, pointers to
+    // short lived objects, ...) makes the whole message fall back to eager formatting.
+    template<typename T, typename = void>
+    struct ArgTraits
+    {
+        static constexpr bool Deferrable = false;
+    };
+
+    template<typename T>
+    struct ArgTraits<T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+    {
+        static constexpr bool Deferrable = true;
+        using Stored = T;
+
+        static std::size_t Size(T const&) { return sizeof(T); }
+
+        static uint8* Store(uint8* out, T const& value)
+        {
+            std::memcpy(out, &value, sizeof(T));
+            return out + sizeof(T);
+        }
+
+        static T Load(uint8 const*& in)
+        {
+            T value;
+            std::memcpy(&value, in, sizeof(T));
+            in += sizeof(T);
+            return value;
+        }
+    };
+
+    struct StringArgTraits
+    {
+        static constexpr bool Deferrable = true;
+        using Stored = std::string_view;
+
+        static std::size_t Size(std::string_view value) { return sizeof(uint32) + value.size(); }
+
+        static uint8* Store(uint8* out, std::string_view value)
+        {
+            uint32 length = uint32(value.size());
+            std::memcpy(out, &length, sizeof(length));
+            if (length)
+                std::memcpy(out + sizeof(length), value.data(), length);
+            return out + sizeof(length) + length;
+        }
+
+        static std::string_view Load(uint8 const*& in)
+        {
+            uint32 length;
+            std::memcpy(&length, in, sizeof(length));
+            std::string_view value(reinterpret_cast<char const*>(in + sizeof(length)), length);
+            in += sizeof(length) + length;
+            return value;
+        }
+    };
+
+    template<> struct ArgTraits<std::string> : StringArgTraits { };
+    template<> struct ArgTraits<std::string_view> : StringArgTraits { };
+
+    template<typename T>
+    struct ArgTraits<T*, std::enable_if_t<std::is_same_v<std::remove_cv_t<T>, char>>> : StringArgTraits
+    {
+        static std::size_t Size(char const* value) { return StringArgTraits::Size(value ? value : ""); }
+        static uint8* Store(uint8* out, char const* value) { return StringArgTraits::Store(out, value ? value : ""); }
+    };
+
+    template<typename... Args>
+    inline constexpr bool IsDeferrable = (ArgTraits<std::decay_t<Args>>::Deferrable && ...);
+
+    using Formatter = std::string(*)(std::string_view format, uint8 const* args);
+
+    template<typename... Args>
+    std::string Format(std::string_view format, [[maybe_unused]] uint8 const* args)
+    {
+        // Braced initialization guarantees left to right evaluation of the loads
+        std::tuple<typename ArgTraits<Args>::Stored...> values{ ArgTraits<Args>::Load(args)... };
+        return std::apply([format](auto const&... value) { return Acore::StringFormat(format, value...); }, values);
+    }
+}
+
+/**
+ * Asynchronous logging backend.
+ *
+ * Every producing thread owns a lock-free ring buffer. A log call only copies
+ * the format string and the raw argument bytes into that ring; a background
+ * thread merges the rings in call order, formats the messages and hands them
+ * to the appenders, flushing them once per batch instead of once per message.
+ * Messages that do not fit into a full ring are dropped and counted.
+ */
+class AsyncLogWriter
+{
+public:
+    using WriteFn = std::function<void(LogMessage*)>;
+    using FlushFn = std::function<void()>;
+
+    AsyncLogWriter(std::size_t bufferSize, WriteFn write, FlushFn flush);
+    ~AsyncLogWriter();
+
+    AsyncLogWriter(AsyncLogWriter const&) = delete;
+    AsyncLogWriter& operator=(AsyncLogWriter const&) = delete;
+
+    template<typename... Args>
+    void Write(LogLevel level, std::string const& type, Acore::FormatStringView format, Args const&... args)
+    {
+        static_assert(Acore::Impl::AsyncLog::IsDeferrable<Args...>);
+
+        std::size_t const argsSize = (std::size_t(0) + ... + Acore::Impl::AsyncLog::ArgTraits<std::decay_t<Args>>::Size(args));
+        uint8* out = BeginRecord(level, type, { format.data(), format.size() }, {}, argsSize, &Acore::Impl::AsyncLog::Format<std::decay_t<Args>...>);
+        if (!out)
+        {
+            if (IsStopped())
+                WriteSynchronous(level, type, Acore::StringFormat(format, args...));
+
+            return;
+        }
+
+        ((out = Acore::Impl::AsyncLog::ArgTraits<std::decay_t<Args>>::Store(out, args)), ...);
+        EndRecord();
+    }
+
+    /// Queues an already formatted message
+    void WriteText(LogLevel level, std::string const& type, std::string_view text, std::string_view param1 = {});
+
+    /// Writes out everything queued so far and blocks the writer thread until the returned lock is released
+    [[nodiscard]] std::unique_lock<std::mutex> Suspend();
+
+    /// Writes out everything queued so far and stops the writer thread; later messages are written synchronously by the caller
+    void Stop();
+
+    [[nodiscard]] uint64 GetDroppedCount() const;
+
+private:
+    struct ThreadBuffer;
+
+    uint8* BeginRecord(LogLevel level, std::string_view type, std::string_view format, std::string_view param1, std::size_t argsSize, Acore::Impl::AsyncLog::Formatter formatter);
+    void EndRecord();
+    ThreadBuffer* GetThreadBuffer();
+
+    [[nodiscard]] bool IsStopped() const { return _stopped.load(std::memory_order_acquire); }
+    void WriteSynchronous(LogLevel level, std::string_view type, std::string_view text, std::string_view param1 = {});
+
+    void Run();
+    std::size_t Drain();
+    void ReportDropped();
+
+    static std::atomic<uint64> _nextWriterId;
+
+    uint64 const _id;
+    std::size_t const _bufferSize;
+    WriteFn _write;
+    FlushFn _flush;
+
+    std::atomic<uint64> _sequence;
+
+    mutable std::mutex _buffersLock;
+    std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+    uint64 _retiredDropped;
+    uint64 _reportedDropped;
+
+    std::mutex _drainLock;
+    std::mutex _wakeLock;
+    std::condition_variable _wake;
+    std::atomic<bool> _stopped;
+    std::thread _thread;
+};
+
+#endif // AsyncLogWriter_h__
@@ -20,18 +20,15 @@
 #include "AppenderFile.h"
 #include "Config.h"
 #include "Errors.h"
-#include "IoContext.h"
 #include "LogMessage.h"
-#include "LogOperation.h"
 #include "Logger.h"
-#include "Strand.h"
 #include "StringConvert.h"
 #include "Timer.h"
 #include "Tokenize.h"
 #include <chrono>
 #include <memory>
 
-Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL)
+Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL), _async(false)
 {
     m_logsTimestamp = "_" + GetTimestampStr();
     RegisterAppender<AppenderConsole>();
@@ -40,6 +37,7 @@ Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL)
 
 Log::~Log()
 {
+    SetSynchronous();
     Close();
 }
 
@@ -233,25 +231,51 @@ void Log::RegisterAppender(uint8 index, AppenderCreatorFn appenderCreateFn)
 
 void Log::_outMessage(std::string const& filter, LogLevel level, std::string_view message)
 {
+    if (_async.load(std::memory_order_relaxed))
+    {
+        _asyncWriter->WriteText(level, filter, message);
+        return;
+    }
+
     write(std::make_unique<LogMessage>(level, filter, message));
 }
 
 void Log::_outCommand(std::string_view message, std::string_view param1)
 {
-    write(std::make_unique<LogMessage>(LOG_LEVEL_INFO, "commands.gm", message, param1));
+    static std::string const type = "commands.gm";
+    if (_async.load(std::memory_order_relaxed))
+    {
+        _asyncWriter->WriteText(LOG_LEVEL_INFO, type, message, param1);
+        return;
+    }
+
+    write(std::make_unique<LogMessage>(LOG_LEVEL_INFO, type, message, param1));
 }
 
 void Log::write(std::unique_ptr<LogMessage>&& msg) const
 {
-    Logger const* logger = GetLoggerByType(msg->type);
+    if (Logger const* logger = GetLoggerByType(msg->type))
+    {
+        logger->write(msg.get());
+        logger->flush();
+    }
+}
 
-    if (_ioContext)
+void Log::writeAsync(LogMessage* msg) const
+{
+    // Called from the writer thread, appenders are flushed once per batch
+    if (Logger const* logger = GetLoggerByType(msg->type))
     {
-        std::shared_ptr<LogOperation> logOperation = std::make_shared<LogOperation>(logger, std::move(msg));
-        Acore::Asio::post(*_ioContext, Acore::Asio::bind_executor(*_strand, [logOperation]() { logOperation->call(); }));
+        logger->write(msg);
+    }
+}
+
+void Log::flushAppenders()
+{
+    for (std::pair<uint8 const, std::unique_ptr<Appender>>& appender : appenders)
+    {
+        appender.second->flush();
     }
-    else
-        logger->write(msg.get());
 }
 
 Logger const* Log::GetLoggerByType(std::string const& type) const
@@ -367,25 +391,39 @@ Log* Log::instance()
     return &instance;
 }
 
-void Log::Initialize(Acore::Asio::IoContext* ioContext)
+void Log::Initialize(bool async /*= false*/)
 {
-    if (ioContext)
+    LoadFromConfig();
+
+    if (async && !_asyncWriter)
     {
-        _ioContext = ioContext;
-        _strand = std::make_unique<Acore::Asio::Strand>(*ioContext);
+        std::size_t bufferSize = std::size_t(sConfigMgr->GetOption<uint32>("Log.Async.BufferSize", 1024)) * 1024;
+        _asyncWriter = std::make_unique<AsyncLogWriter>(bufferSize,
+            [this](LogMessage* msg) { writeAsync(msg); },
+            [this]() { flushAppenders(); });
+        _async = true;
     }
-
-    LoadFromConfig();
 }
 
 void Log::SetSynchronous()
 {
-    _strand.reset();
-    _ioContext = nullptr;
+    // Writes out everything still queued, the writer itself stays alive for threads that already passed the check
+    _async = false;
+    if (_asyncWriter)
+    {
+        _asyncWriter->Stop();
+    }
 }
 
 void Log::LoadFromConfig()
 {
+    // Appenders are about to be destroyed, keep the writer thread away from them
+    std::unique_lock<std::mutex> suspendGuard;
+    if (_asyncWriter)
+    {
+        suspendGuard = _asyncWriter->Suspend();
+    }
+
     Close();
 
     highestLogLevel = LOG_LEVEL_FATAL;
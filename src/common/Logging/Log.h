@@ -18,10 +18,11 @@
 #ifndef _LOG_H__
 #define _LOG_H__
 
-#include "IoContext.h"
+#include "AsyncLogWriter.h"
 #include "Define.h"
 #include "LogCommon.h"
 #include "StringFormat.h"
+#include <atomic>
 #include <unordered_map>
 #include <vector>
 #include <memory>
@@ -30,12 +31,6 @@ class Appender;
 class Logger;
 struct LogMessage;
 
-namespace Acore::Asio
-{
-    class IoContext;
-    class Strand;
-}
-
 #define LOGGER_ROOT "root"
 
 typedef Appender*(*AppenderCreatorFn)(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& extraArgs);
@@ -61,7 +56,7 @@ private:
 public:
     static Log* instance();
 
-    void Initialize(Acore::Asio::IoContext* ioContext = nullptr);
+    void Initialize(bool async = false);
     void SetSynchronous();  // Not threadsafe - should only be called from main() after all threads are joined
     void LoadFromConfig();
     void Close();
@@ -71,6 +66,16 @@ public:
     template<typename... Args>
     inline void outMessage(std::string const& filter, LogLevel const level, Acore::FormatStringView fmt, Args&&... args)
     {
+        // Formatting is deferred to the writer thread when all arguments can be copied as raw bytes
+        if constexpr (Acore::Impl::AsyncLog::IsDeferrable<Args...>)
+        {
+            if (_async.load(std::memory_order_relaxed))
+            {
+                _asyncWriter->Write(level, filter, fmt, args...);
+                return;
+            }
+        }
+
         _outMessage(filter, level, Acore::StringFormat(fmt, std::forward<Args>(args)...));
     }
 
@@ -95,10 +100,13 @@ public:
 
     [[nodiscard]] std::string const& GetLogsDir() const { return m_logsDir; }
     [[nodiscard]] std::string const& GetLogsTimestamp() const { return m_logsTimestamp; }
+    [[nodiscard]] uint64 GetDroppedMessageCount() const { return _asyncWriter ? _asyncWriter->GetDroppedCount() : 0; }
 
 private:
     static std::string GetTimestampStr();
     void write(std::unique_ptr<LogMessage>&& msg) const;
+    void writeAsync(LogMessage* msg) const;
+    void flushAppenders();
 
     [[nodiscard]] Logger const* GetLoggerByType(std::string const& type) const;
     Appender* GetAppenderByName(std::string_view name);
@@ -120,8 +128,8 @@ private:
     std::string m_logsDir;
     std::string m_logsTimestamp;
 
-    Acore::Asio::IoContext* _ioContext;
-    std::unique_ptr<Acore::Asio::Strand> _strand;
+    std::atomic<bool> _async;
+    std::unique_ptr<AsyncLogWriter> _asyncWriter;
 };
 
 #define sLog Log::instance()
@@ -0,0 +1,92 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LogRingBuffer.h"
+#include "Errors.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+LogRingBuffer::LogRingBuffer(std::size_t capacity) :
+    _capacity(std::bit_ceil(std::max<std::size_t>(capacity, 4096))), _mask(_capacity - 1),
+    _write(0), _reservedEnd(0), _cachedRead(0), _read(0), _peekedEnd(0), _cachedWrite(0)
+{
+    _data = std::make_unique<uint8[]>(_capacity);
+}
+
+uint8* LogRingBuffer::Reserve(std::size_t size)
+{
+    ASSERT(size % 8 == 0 && size > 0);
+
+    uint64 write = _write.load(std::memory_order_relaxed);
+    std::size_t const offset = write & _mask;
+    std::size_t const contiguous = _capacity - offset;
+    std::size_t const needed = contiguous < size ? contiguous + size : size;
+
+    if (write + needed - _cachedRead > _capacity)
+    {
+        _cachedRead = _read.load(std::memory_order_acquire);
+        if (write + needed - _cachedRead > _capacity)
+            return nullptr;
+    }
+
+    if (contiguous < size)
+    {
+        // Offsets are always 8 byte aligned, so there is room for the marker
+        std::memcpy(&_data[offset], &WrapMarker, sizeof(WrapMarker));
+        write += contiguous;
+    }
+
+    _reservedEnd = write + size;
+    return &_data[write & _mask];
+}
+
+void LogRingBuffer::Commit()
+{
+    _write.store(_reservedEnd, std::memory_order_release);
+}
+
+uint8 const* LogRingBuffer::Peek()
+{
+    uint64 read = _read.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        if (read == _cachedWrite)
+        {
+            _cachedWrite = _write.load(std::memory_order_acquire);
+            if (read == _cachedWrite)
+                return nullptr;
+        }
+
+        std::size_t const offset = read & _mask;
+        uint32 size;
+        std::memcpy(&size, &_data[offset], sizeof(size));
+        if (size != WrapMarker)
+        {
+            _peekedEnd = read + size;
+            return &_data[offset];
+        }
+
+        read += _capacity - offset;
+        _read.store(read, std::memory_order_release);
+    }
+}
+
+void LogRingBuffer::Release()
+{
+    _read.store(_peekedEnd, std::memory_order_release);
+}
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LogRingBuffer_h__
+#define LogRingBuffer_h__
+
+#include "Define.h"
+#include <atomic>
+#include <memory>
+
+/**
+ * Single producer / single consumer byte ring used by the asynchronous logger.
+ *
+ * Each entry starts with a uint32 size (a multiple of 8). Entries never wrap:
+ * when the tail of the buffer is too short the producer writes a wrap marker
+ * and continues at offset 0.
+ */
+class LogRingBuffer
+{
+public:
+    static constexpr uint32 WrapMarker = 0xFFFFFFFF;
+
+    /// @param capacity rounded up to a power of two, at least 4 KiB
+    explicit LogRingBuffer(std::size_t capacity);
+
+    LogRingBuffer(LogRingBuffer const&) = delete;
+    LogRingBuffer& operator=(LogRingBuffer const&) = delete;
+
+    [[nodiscard]] std::size_t GetCapacity() const { return _capacity; }
+
+    // Producer side
+    /// Returns space for an entry of @p size bytes (must be a multiple of 8) or nullptr when the ring is full.
+    uint8* Reserve(std::size_t size);
+    /// Publishes the entry returned by the last successful Reserve().
+    void Commit();
+
+    // Consumer side
+    /// Returns the oldest published entry, or nullptr when the ring is empty.
+    uint8 const* Peek();
+    /// Releases the entry returned by Peek() back to the producer.
+    void Release();
+
+    [[nodiscard]] bool IsEmpty() const { return _read.load(std::memory_order_acquire) == _write.load(std::memory_order_acquire); }
+
+private:
+    std::unique_ptr<uint8[]> _data;
+    std::size_t _capacity;
+    std::size_t _mask;
+
+    // Producer owned
+    alignas(64) std::atomic<uint64> _write;
+    uint64 _reservedEnd;
+    uint64 _cachedRead;
+
+    // Consumer owned
+    alignas(64) std::atomic<uint64> _read;
+    uint64 _peekedEnd;
+    uint64 _cachedWrite;
+};
+
+#endif // LogRingBuffer_h__
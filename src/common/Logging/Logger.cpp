@@ -60,3 +60,12 @@ void Logger::write(LogMessage* message) const
             appender.second->write(message);
         }
 }
+
+void Logger::flush() const
+{
+    for (std::pair<uint8 const, Appender*> const& appender : appenders)
+        if (appender.second)
+        {
+            appender.second->flush();
+        }
+}
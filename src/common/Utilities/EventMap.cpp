@@ -20,8 +20,8 @@
 
 void EventMap::Reset()
 {
-    _eventMap.clear();
-    _time = TimePoint::min();
+    _eventMap.Clear();
+    _time = 0;
     _phaseMask = 0;
 }
 
@@ -53,7 +53,7 @@ void EventMap::ScheduleEvent(EventId eventId, Milliseconds time, GroupIndex grou
     if (phase > sizeof(PhaseMask) * 8)
         return;
 
-    _eventMap.emplace(_time + time, Event(eventId, group, phase));
+    _eventMap.Insert(GetEventTime(time), Event(eventId, group, phase));
 }
 
 void EventMap::ScheduleEvent(EventId eventId, Milliseconds minTime, Milliseconds maxTime, GroupIndex group /*= 0u*/, PhaseIndex phase /*= 0u*/)
@@ -75,7 +75,7 @@ void EventMap::RescheduleEvent(EventId eventId, Milliseconds time, GroupIndex gr
 
 void EventMap::Repeat(Milliseconds time)
 {
-    _eventMap.emplace(_time + time, _lastEvent);
+    _eventMap.Insert(GetEventTime(time), _lastEvent);
 }
 
 void EventMap::Repeat(Milliseconds minTime, Milliseconds maxTime)
@@ -83,23 +83,21 @@ void EventMap::Repeat(Milliseconds minTime, Milliseconds maxTime)
     Repeat(randtime(minTime, maxTime));
 }
 
-EventMap::EventId EventMap::ExecuteEvent()
+EventMap::EventId EventMap::ExecuteDueEvent()
 {
-    while (!Empty())
+    _eventMap.Advance(_time);
+
+    EventStore::Handle handle;
+    while ((handle = _eventMap.Front()) != EventStore::INVALID_HANDLE)
     {
-        auto const& itr = _eventMap.begin();
+        Event event = _eventMap.Get(handle);
+        _eventMap.Erase(handle);
 
-        if (itr->first > _time)
-            return 0;
-        else if (_phaseMask && itr->second._phaseMask && !(itr->second._phaseMask & _phaseMask))
-            _eventMap.erase(itr);
-        else
-        {
-            auto eventId = itr->second._id;
-            _lastEvent = itr->second;
-            _eventMap.erase(itr);
-            return eventId;
-        }
+        if (_phaseMask && event._phaseMask && !(event._phaseMask & _phaseMask))
+            continue;
+
+        _lastEvent = event;
+        return event._id;
     }
 
     return 0;
@@ -110,13 +108,11 @@ void EventMap::DelayEvents(Milliseconds delay)
     if (Empty())
         return;
 
-    EventStore delayed = std::move(_eventMap);
-    for (auto itr = delayed.begin(); itr != delayed.end();)
+    // every event moves by the same delay, so the events keep their order
+    _eventMap.ForEach([&](EventStore::Handle handle)
     {
-        auto node = delayed.extract(itr++);
-        node.key() = node.key() + delay;
-        _eventMap.insert(_eventMap.end(), std::move(node));
-    }
+        _eventMap.Reschedule(handle, std::max<int64>(int64(_eventMap.GetTime(handle)) + delay.count(), 0), true);
+    });
 }
 
 void EventMap::DelayEvents(Milliseconds delay, GroupIndex group)
@@ -124,36 +120,22 @@ void EventMap::DelayEvents(Milliseconds delay, GroupIndex group)
     if (group > sizeof(GroupMask) * 8 || Empty())
         return;
 
-    EventStore delayed;
-
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (!group || (itr->second._groupMask & GroupMask(1u << (group - 1u))))
-        {
-            delayed.emplace(itr->first + delay, itr->second);
-            itr = _eventMap.erase(itr);
-            continue;
-        }
-
-        ++itr;
-    }
-
-    _eventMap.insert(delayed.begin(), delayed.end());
+    // delayed events are ordered after the events already scheduled for the same time
+    for (EventStore::Handle handle : _eventMap.GetOrderedHandles())
+        if (!group || (_eventMap.Get(handle)._groupMask & GroupMask(1u << (group - 1u))))
+            _eventMap.Reschedule(handle, std::max<int64>(int64(_eventMap.GetTime(handle)) + delay.count(), 0), false);
 }
 
 void EventMap::DelayEventsToMax(Milliseconds delay, GroupIndex group)
 {
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    uint64 maxTime = GetEventTime(delay);
+    for (EventStore::Handle handle : _eventMap.GetOrderedHandles())
     {
-        if (itr->first < _time + delay && (!group || (itr->second._groupMask & GroupMask(1u << (group - 1u)))))
+        if (_eventMap.GetTime(handle) < maxTime && (!group || (_eventMap.Get(handle)._groupMask & GroupMask(1u << (group - 1u)))))
         {
-            ScheduleEvent(itr->second._id, delay, group);
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
+            ScheduleEvent(_eventMap.Get(handle)._id, delay, group);
+            _eventMap.Erase(handle);
         }
-
-        ++itr;
     }
 }
 
@@ -162,16 +144,11 @@ void EventMap::CancelEvent(EventId eventId)
     if (Empty())
         return;
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    _eventMap.ForEach([&](EventStore::Handle handle)
     {
-        if (eventId == itr->second._id)
-        {
-            itr = _eventMap.erase(itr);
-            continue;
-        }
-
-        ++itr;
-    }
+        if (eventId == _eventMap.Get(handle)._id)
+            _eventMap.Erase(handle);
+    });
 }
 
 void EventMap::CancelEventGroup(GroupIndex group)
@@ -179,17 +156,11 @@ void EventMap::CancelEventGroup(GroupIndex group)
     if (!group || group > sizeof(GroupMask) * 8 || Empty())
         return;
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    _eventMap.ForEach([&](EventStore::Handle handle)
     {
-        if (itr->second._groupMask & GroupMask(1u << (group - 1u)))
-        {
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
-        }
-
-        ++itr;
-    }
+        if (_eventMap.Get(handle)._groupMask & GroupMask(1u << (group - 1u)))
+            _eventMap.Erase(handle);
+    });
 }
 
 bool EventMap::IsInPhase(PhaseIndex phase) const
@@ -199,11 +170,17 @@ bool EventMap::IsInPhase(PhaseIndex phase) const
 
 Milliseconds EventMap::GetTimeUntilEvent(EventId eventId) const
 {
-    for (auto const& [time, event] : _eventMap)
-        if (eventId == event._id)
-            return std::chrono::duration_cast<Milliseconds>(time - _time);
+    uint64 time = std::numeric_limits<uint64>::max();
+    _eventMap.ForEach([&](EventStore::Handle handle)
+    {
+        if (eventId == _eventMap.Get(handle)._id)
+            time = std::min(time, _eventMap.GetTime(handle));
+    });
+
+    if (time == std::numeric_limits<uint64>::max())
+        return Milliseconds::max();
 
-    return Milliseconds::max();
+    return Milliseconds(int64(time) - int64(_time));
 }
 
 bool EventMap::HasTimeUntilEvent(EventId eventId) const
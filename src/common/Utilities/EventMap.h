@@ -20,7 +20,7 @@
 
 #include "Define.h"
 #include "Duration.h"
-#include <map>
+#include "TimingWheel.h"
 
 class EventMap
 {
@@ -46,9 +46,10 @@ class EventMap
 
     /**
      * Internal storage type.
-     * Key: Time as TimePoint when the event should occur.
+     * Key: Time in milliseconds of the internal timer when the event should occur.
+     * Events of the same time are executed in the order they were scheduled.
      */
-    using EventStore = std::multimap<TimePoint, Event>;
+    using EventStore = Acore::TimingWheel<Event>;
 
 public:
     EventMap() { }
@@ -76,7 +77,7 @@ public:
     */
     void Update(Milliseconds time)
     {
-        _time += time;
+        _time += time.count();
     }
 
     /**
@@ -94,7 +95,7 @@ public:
     */
     bool Empty() const
     {
-        return _eventMap.empty();
+        return _eventMap.Empty();
     }
 
     /**
@@ -180,7 +181,14 @@ public:
     * @brief Returns the next event to execute and removes it from map.
     * @return Id of the event to execute.
     */
-    EventId ExecuteEvent();
+    EventId ExecuteEvent()
+    {
+        // called on every AI update, most of the time there is nothing to execute
+        if (!_eventMap.HasDue(_time))
+            return 0;
+
+        return ExecuteDueEvent();
+    }
 
     /**
     * @name DelayEvents
@@ -245,6 +253,25 @@ public:
     bool HasTimeUntilEvent(EventId eventId) const;
 
 private:
+    /**
+    * @name ExecuteDueEvent
+    * @brief Removes events of other phases and the next event to execute from the map.
+    * @return Id of the event to execute, 0 if there is none.
+    */
+    EventId ExecuteDueEvent();
+
+    /**
+    * @name GetEventTime
+    * @brief Time of the internal timer after the given delay, delays before the start of the timer are due immediately.
+    */
+    uint64 GetEventTime(Milliseconds delay) const
+    {
+        if (delay.count() < 0 && uint64(-delay.count()) > _time)
+            return 0;
+
+        return _time + delay.count();
+    }
+
     /**
     * @name _time
     * @brief Internal timer.
@@ -255,7 +282,7 @@ private:
     * has reached their time value. Its value is changed in the
     * Update method.
     */
-    TimePoint _time{ TimePoint::min() };
+    uint64 _time{ 0 };
 
     /**
     * @name _phaseMask
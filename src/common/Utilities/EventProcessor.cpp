@@ -41,14 +41,15 @@ void EventProcessor::Update(uint32 p_time)
 {
     // update time
     m_time += p_time;
+    m_events.Advance(m_time);
 
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    EventList::Handle handle;
+    while ((handle = m_events.Front()) != EventList::INVALID_HANDLE)
     {
         // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
+        BasicEvent* event = m_events.Get(handle);
+        m_events.Erase(handle);
 
         if (event->IsRunning())
         {
@@ -81,55 +82,51 @@ void EventProcessor::Update(uint32 p_time)
 
 void EventProcessor::KillAllEvents(bool force)
 {
-    // first, abort all existing events
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    // first, abort all existing events, in the order they would have been executed
+    for (EventList::Handle handle : m_events.GetOrderedHandles())
     {
+        BasicEvent* event = m_events.Get(handle);
+
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
         // Skip non-deletable events when we are
         // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
-        {
-            ++itr;
+        if (!force && !event->IsDeletable())
             continue;
-        }
 
-        delete itr->second;
+        delete event;
 
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
+        // Clear the whole container when forcing
+        if (!force)
+            m_events.Erase(handle);
     }
 
     if (force)
-        m_events.clear();
+        m_events.Clear(m_time);
 }
 
 void EventProcessor::CancelEventGroup(uint8 group)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    for (EventList::Handle handle : m_events.GetOrderedHandles())
     {
-        if (itr->second->m_eventGroup != group)
-        {
-            ++itr;
+        BasicEvent* event = m_events.Get(handle);
+        if (event->m_eventGroup != group)
             continue;
-        }
 
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
-        delete itr->second;
-        itr = m_events.erase(itr);
+        delete event;
+        m_events.Erase(handle);
     }
 }
 
@@ -139,21 +136,17 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
     Event->m_execTime = e_time;
     Event->m_eventGroup = eventGroup;
-    m_events.emplace(e_time, Event);
+    Event->m_handle = m_events.Insert(e_time, Event);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != event)
-            continue;
+    // the handle may belong to another event handler or to an already executed event
+    if (!m_events.IsScheduled(event->m_handle) || m_events.Get(event->m_handle) != event)
+        return;
 
-        event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.emplace(newTime.count(), event);
-        break;
-    }
+    event->m_execTime = newTime.count();
+    m_events.Reschedule(event->m_handle, newTime.count(), false);
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
@@ -21,7 +21,7 @@
 #include "Define.h"
 #include "Duration.h"
 #include "Random.h"
-#include <map>
+#include "TimingWheel.h"
 
 class EventProcessor;
 
@@ -68,6 +68,7 @@ class BasicEvent
         uint64 m_addTime{0};                                   // time when the event was added to queue, filled by event handler
         uint64 m_execTime{0};                                  // planned time of next execution, filled by event handler
         uint8 m_eventGroup{0};
+        uint32 m_handle{0};                                    // position in the queue of the event handler, filled by event handler
 };
 
 template<typename T>
@@ -90,7 +91,8 @@ class LambdaBasicEvent : public BasicEvent
 template<typename T>
 using is_lambda_event = std::enable_if_t<!std::is_base_of_v<BasicEvent, std::remove_pointer_t<std::remove_cvref_t<T>>>>;
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+// ordered by execution time, events of the same time in the order they were added
+typedef Acore::TimingWheel<BasicEvent*> EventList;
 
 class EventProcessor
 {
@@ -120,7 +122,7 @@ class EventProcessor
         [[nodiscard]] uint64 CalculateQueueTime(uint64 delay) const;
 
         void CancelEventGroup(uint8 group);
-        bool HasEvents() const { return !m_events.empty(); }
+        bool HasEvents() const { return !m_events.Empty(); }
 
     protected:
         uint64 m_time{0};
@@ -0,0 +1,301 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_FLAT_HASH_MAP_H
+#define ACORE_FLAT_HASH_MAP_H
+
+#include "Define.h"
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLAT_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Acore
+{
+    /*
+      @class FlatHashMap
+      Open addressing hash map for small, trivially movable keys and values such as ObjectGuid -> pointer.
+
+      Entries live densely in a vector, so iterating touches no empty buckets. Buckets hold a control
+      byte (0 if empty, otherwise a 7 bit hash fingerprint with the high bit set) and the index of their
+      entry. Lookups probe linearly, comparing 16 control bytes at a time.
+
+      Erasing leaves no tombstones: the following buckets of the cluster are shifted back into the hole
+      and the last entry is moved into the place of the erased one. erase(iterator) returns an iterator
+      to the moved entry, so `itr = map.erase(itr)` loops visit every entry. Erasing other entries while
+      iterating may skip the last one. Insertions invalidate all iterators.
+    */
+    template<class Key, class T, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>, class Allocator = std::allocator<std::pair<Key, T>>>
+    class FlatHashMap
+    {
+    public:
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef std::pair<Key, T> value_type;
+        typedef std::size_t size_type;
+        typedef typename std::vector<value_type, Allocator>::iterator iterator;
+        typedef typename std::vector<value_type, Allocator>::const_iterator const_iterator;
+
+        FlatHashMap() = default;
+
+        iterator begin() { return _values.begin(); }
+        iterator end() { return _values.end(); }
+        const_iterator begin() const { return _values.begin(); }
+        const_iterator end() const { return _values.end(); }
+        const_iterator cbegin() const { return _values.cbegin(); }
+        const_iterator cend() const { return _values.cend(); }
+
+        [[nodiscard]] bool empty() const { return _values.empty(); }
+        [[nodiscard]] size_type size() const { return _values.size(); }
+        [[nodiscard]] size_type bucket_count() const { return _slots.size(); }
+
+        void clear()
+        {
+            _values.clear();
+            std::fill(_control.begin(), _control.end(), EMPTY);
+        }
+
+        void reserve(size_type count)
+        {
+            _values.reserve(count);
+            if (count > MaxLoad(bucket_count()))
+                Rehash(BucketCountFor(count));
+        }
+
+        iterator find(Key const& key)
+        {
+            size_type bucket;
+            return FindBucket(key, Mix(_hash(key)), bucket) ? _values.begin() + _slots[bucket] : _values.end();
+        }
+
+        const_iterator find(Key const& key) const
+        {
+            size_type bucket;
+            return FindBucket(key, Mix(_hash(key)), bucket) ? _values.begin() + _slots[bucket] : _values.end();
+        }
+
+        [[nodiscard]] bool contains(Key const& key) const { return find(key) != end(); }
+        [[nodiscard]] size_type count(Key const& key) const { return contains(key) ? 1 : 0; }
+
+        template<class... Args>
+        std::pair<iterator, bool> try_emplace(Key const& key, Args&&... args)
+        {
+            uint64 hash = Mix(_hash(key));
+            size_type bucket;
+            if (FindBucket(key, hash, bucket))
+                return { _values.begin() + _slots[bucket], false };
+
+            if (size() + 1 > MaxLoad(bucket_count()))
+            {
+                Rehash(BucketCountFor(size() + 1));
+                bucket = FindEmptyBucket(hash);
+            }
+
+            SetControl(bucket, Fingerprint(hash));
+            _slots[bucket] = uint32(_values.size());
+            _values.emplace_back(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+            return { _values.end() - 1, true };
+        }
+
+        std::pair<iterator, bool> insert(value_type const& value) { return try_emplace(value.first, value.second); }
+
+        T& operator[](Key const& key) { return try_emplace(key).first->second; }
+
+        size_type erase(Key const& key)
+        {
+            size_type bucket;
+            if (!FindBucket(key, Mix(_hash(key)), bucket))
+                return 0;
+
+            EraseBucket(bucket);
+            return 1;
+        }
+
+        iterator erase(const_iterator itr)
+        {
+            size_type index = size_type(itr - _values.cbegin());
+
+            size_type bucket;
+            FindBucket(itr->first, Mix(_hash(itr->first)), bucket);
+            EraseBucket(bucket);
+
+            return _values.begin() + index;
+        }
+
+    private:
+        static constexpr uint8 EMPTY = 0;
+        static constexpr size_type GROUP_WIDTH = 16;
+        static constexpr size_type MIN_BUCKETS = GROUP_WIDTH;
+
+        // Fibonacci hashing, std::hash of integers is the identity
+        static uint64 Mix(std::size_t hash) { return uint64(hash) * 0x9E3779B97F4A7C15ULL; }
+        static uint8 Fingerprint(uint64 hash) { return uint8(0x80 | (hash & 0x7F)); }
+        size_type HomeBucket(uint64 hash) const { return size_type(hash >> _shift); }
+
+        static size_type MaxLoad(size_type buckets) { return buckets - buckets / 4; }
+
+        static size_type BucketCountFor(size_type count)
+        {
+            size_type buckets = MIN_BUCKETS;
+            while (MaxLoad(buckets) < count)
+                buckets *= 2;
+
+            return buckets;
+        }
+
+        // The first GROUP_WIDTH - 1 control bytes are mirrored after the last bucket, so groups can be loaded from any bucket
+        void SetControl(size_type bucket, uint8 control)
+        {
+            _control[bucket] = control;
+            if (bucket < GROUP_WIDTH - 1)
+                _control[bucket_count() + bucket] = control;
+        }
+
+        // Bit i of matches/empties is set if bucket pos + i holds the fingerprint/is empty
+        void MatchGroup(size_type pos, uint8 fingerprint, uint32& matches, uint32& empties) const
+        {
+#ifdef FLAT_HASH_MAP_SSE2
+            __m128i group = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&_control[pos]));
+            matches = uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(char(fingerprint)))));
+            empties = uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_setzero_si128())));
+#else
+            matches = 0;
+            empties = 0;
+            for (size_type i = 0; i < GROUP_WIDTH; ++i)
+            {
+                matches |= uint32(_control[pos + i] == fingerprint) << i;
+                empties |= uint32(_control[pos + i] == EMPTY) << i;
+            }
+#endif
+        }
+
+        // Sets bucket to the bucket of key, or to the empty bucket ending its probe sequence if not found
+        bool FindBucket(Key const& key, uint64 hash, size_type& bucket) const
+        {
+            if (_slots.empty())
+                return false;
+
+            uint8 fingerprint = Fingerprint(hash);
+            size_type pos = HomeBucket(hash);
+            while (true)
+            {
+                uint32 matches, empties;
+                MatchGroup(pos, fingerprint, matches, empties);
+
+                // linear probing never places a key after the first empty bucket following its home
+                if (empties)
+                    matches &= (empties & (0 - empties)) - 1;
+
+                for (; matches; matches &= matches - 1)
+                {
+                    size_type candidate = (pos + std::countr_zero(matches)) & _mask;
+                    if (_equal(_values[_slots[candidate]].first, key))
+                    {
+                        bucket = candidate;
+                        return true;
+                    }
+                }
+
+                if (empties)
+                {
+                    bucket = (pos + std::countr_zero(empties)) & _mask;
+                    return false;
+                }
+
+                pos = (pos + GROUP_WIDTH) & _mask;
+            }
+        }
+
+        size_type FindEmptyBucket(uint64 hash) const
+        {
+            size_type bucket = HomeBucket(hash);
+            while (_control[bucket] != EMPTY)
+                bucket = (bucket + 1) & _mask;
+
+            return bucket;
+        }
+
+        void EraseBucket(size_type bucket)
+        {
+            uint32 index = _slots[bucket];
+
+            // shift the rest of the cluster back, every entry that would still be reached from its home bucket
+            size_type hole = bucket;
+            for (size_type next = (hole + 1) & _mask; _control[next] != EMPTY; next = (next + 1) & _mask)
+            {
+                size_type home = HomeBucket(Mix(_hash(_values[_slots[next]].first)));
+                if (((next - home) & _mask) < ((next - hole) & _mask))
+                    continue;
+
+                SetControl(hole, _control[next]);
+                _slots[hole] = _slots[next];
+                hole = next;
+            }
+
+            SetControl(hole, EMPTY);
+
+            // keep the entries dense, the last one takes the place of the erased one
+            uint32 last = uint32(_values.size() - 1);
+            if (index != last)
+            {
+                size_type lastBucket;
+                FindBucket(_values[last].first, Mix(_hash(_values[last].first)), lastBucket);
+                _slots[lastBucket] = index;
+                _values[index] = std::move(_values[last]);
+            }
+
+            _values.pop_back();
+        }
+
+        void Rehash(size_type buckets)
+        {
+            _control.assign(buckets + GROUP_WIDTH - 1, EMPTY);
+            _slots.assign(buckets, 0);
+            _mask = buckets - 1;
+            _shift = uint8(64 - std::countr_zero(buckets));
+
+            for (uint32 i = 0; i < _values.size(); ++i)
+            {
+                uint64 hash = Mix(_hash(_values[i].first));
+                size_type bucket = FindEmptyBucket(hash);
+                SetControl(bucket, Fingerprint(hash));
+                _slots[bucket] = i;
+            }
+        }
+
+        template<class U>
+        using Rebind = typename std::allocator_traits<Allocator>::template rebind_alloc<U>;
+
+        std::vector<value_type, Allocator> _values;
+        std::vector<uint8, Rebind<uint8>> _control;
+        std::vector<uint32, Rebind<uint32>> _slots;
+        size_type _mask = 0;
+        uint8 _shift = 64;
+        [[no_unique_address]] Hash _hash;
+        [[no_unique_address]] KeyEqual _equal;
+    };
+}
+
+#endif
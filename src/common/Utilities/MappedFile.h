@@ -0,0 +1,59 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MAPPEDFILE_H
+#define _MAPPEDFILE_H
+
+#include "Define.h"
+#include <string>
+
+/// Memory mapping of a whole file. Pages are shared with the kernel page cache, read from
+/// disk on first access and can be dropped again under memory pressure until they are written.
+class AC_COMMON_API MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    enum class Access
+    {
+        ReadOnly,
+        CopyOnWrite                                         // writable, written pages become private to the process
+    };
+
+    bool Open(std::string const& fileName, Access access = Access::ReadOnly);
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const { return _data != nullptr; }
+    [[nodiscard]] uint8 const* GetData() const { return _data; }
+    [[nodiscard]] uint8* GetWritableData() const { return _access == Access::CopyOnWrite ? const_cast<uint8*>(_data) : nullptr; }
+    [[nodiscard]] std::size_t GetSize() const { return _size; }
+
+private:
+    uint8 const* _data = nullptr;
+    std::size_t _size = 0;
+    Access _access = Access::ReadOnly;
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+    void* _fileHandle = nullptr;
+    void* _mappingHandle = nullptr;
+#endif
+};
+
+#endif
@@ -0,0 +1,433 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_TIMING_WHEEL_H
+#define ACORE_TIMING_WHEEL_H
+
+#include "Define.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Acore
+{
+    /*
+      @class TimingWheel
+      Hierarchical timing wheel ordering values by (time, insertion order), like a std::multimap keyed by time.
+
+      The wheel has LEVELS levels of SLOTS slots, level n slots span SLOTS^n milliseconds. A value is kept in
+      the lowest level whose rotation contains both the current time and its own time, values further away
+      wait in a far list which is redistributed whenever the top level wraps around. Advance() moves the
+      current time forward, jumping straight to the next occupied slot, and cascades the slots it reaches
+      down to the lower levels. Values due by the new time are collected on the way, sorted once and merged
+      into the ready list, which is kept in (time, sequence) order. Front() returns the first of them.
+
+      Values live in a pooled node vector and are addressed by handle, so inserting and erasing only relink
+      nodes and never allocate once the pool has grown. Handles stay valid until the value is erased,
+      references returned by Get() only until the next Insert().
+    */
+    template<class T>
+    class TimingWheel
+    {
+    public:
+        typedef uint32 Handle;
+        static constexpr Handle INVALID_HANDLE = std::numeric_limits<Handle>::max();
+
+        explicit TimingWheel(uint64 now = 0) : _now(now) { }
+
+        bool Empty() const { return !_size; }
+        std::size_t Size() const { return _size; }
+        uint64 GetNow() const { return _now; }
+
+        // Values with a time not after the current time are ready right away, after the ones already ready for that time
+        Handle Insert(uint64 time, T value)
+        {
+            Handle handle = AllocateNode();
+            Node& node = _nodes[handle];
+            node.Time = time;
+            node.Sequence = _nextSequence++;
+            node.Value = std::move(value);
+            Link(handle);
+            ++_size;
+            return handle;
+        }
+
+        void Erase(Handle handle)
+        {
+            Unlink(handle);
+            FreeNode(handle);
+            --_size;
+        }
+
+        // keepOrder keeps the insertion order of the value, otherwise it is ordered after every value inserted so far
+        void Reschedule(Handle handle, uint64 time, bool keepOrder)
+        {
+            Unlink(handle);
+            Node& node = _nodes[handle];
+            node.Time = time;
+            if (!keepOrder)
+                node.Sequence = _nextSequence++;
+            Link(handle);
+        }
+
+        bool IsScheduled(Handle handle) const { return handle < _nodes.size() && _nodes[handle].Location != LOCATION_FREE; }
+        T& Get(Handle handle) { return _nodes[handle].Value; }
+        T const& Get(Handle handle) const { return _nodes[handle].Value; }
+        uint64 GetTime(Handle handle) const { return _nodes[handle].Time; }
+
+        // First value whose time is not after the current time, INVALID_HANDLE if there is none
+        Handle Front() const { return _readyHead; }
+
+        // False if no value is ready or becomes ready by advancing to now, true does not guarantee one does
+        bool HasDue(uint64 now) const { return _readyHead != INVALID_HANDLE || _nextSlotTime <= now; }
+
+        void Advance(uint64 now)
+        {
+            // nothing becomes ready before the next occupied slot starts
+            if (_nextSlotTime > now)
+            {
+                _now = std::max(_now, now);
+                return;
+            }
+
+            AdvanceSlots(now);
+        }
+
+        void Clear(uint64 now = 0)
+        {
+            _nodes.clear();
+            std::fill(_slots.begin(), _slots.end(), INVALID_HANDLE);
+            _occupied.fill(0);
+            _freeHead = INVALID_HANDLE;
+            _readyHead = INVALID_HANDLE;
+            _readyTail = INVALID_HANDLE;
+            _farHead = INVALID_HANDLE;
+            _size = 0;
+            _now = now;
+            _nextSlotTime = std::numeric_limits<uint64>::max();
+        }
+
+        // Calls f(handle) for every value in no particular order, f may erase the value it is called for
+        template<class F>
+        void ForEach(F&& f)
+        {
+            for (Handle handle = 0; handle < _nodes.size(); ++handle)
+                if (_nodes[handle].Location != LOCATION_FREE)
+                    f(handle);
+        }
+
+        template<class F>
+        void ForEach(F&& f) const
+        {
+            for (Handle handle = 0; handle < _nodes.size(); ++handle)
+                if (_nodes[handle].Location != LOCATION_FREE)
+                    f(handle);
+        }
+
+        // Handles of all values in (time, insertion order), for operations which have to visit the values in order
+        std::vector<Handle> GetOrderedHandles() const
+        {
+            std::vector<Handle> handles;
+            handles.reserve(_size);
+            ForEach([&](Handle handle) { handles.push_back(handle); });
+            std::sort(handles.begin(), handles.end(), [this](Handle left, Handle right) { return IsBefore(left, right); });
+            return handles;
+        }
+
+    private:
+        static constexpr uint8 LEVELS = 3;
+        static constexpr uint8 SLOT_BITS = 5;
+        static constexpr uint32 SLOTS = 1 << SLOT_BITS;
+        static constexpr uint64 TOP_SPAN = uint64(1) << (SLOT_BITS * LEVELS);
+
+        static constexpr uint8 LOCATION_READY = LEVELS;
+        static constexpr uint8 LOCATION_FAR = LEVELS + 1;
+        static constexpr uint8 LOCATION_FREE = LEVELS + 2;
+
+        static_assert(SLOTS <= 32, "slot occupancy is tracked in an uint32 per level");
+
+        struct Node
+        {
+            uint64 Time;
+            uint64 Sequence;
+            T Value;
+            Handle Prev;
+            Handle Next;
+            uint8 Location;
+            uint8 Slot;
+        };
+
+        static uint32 GetDigit(uint64 time, uint8 level) { return uint32(time >> (SLOT_BITS * level)) & (SLOTS - 1); }
+
+        bool IsBefore(Handle left, Handle right) const
+        {
+            return std::tie(_nodes[left].Time, _nodes[left].Sequence) < std::tie(_nodes[right].Time, _nodes[right].Sequence);
+        }
+
+        Handle AllocateNode()
+        {
+            if (_freeHead != INVALID_HANDLE)
+            {
+                Handle handle = _freeHead;
+                _freeHead = _nodes[handle].Next;
+                return handle;
+            }
+
+            _nodes.emplace_back();
+            return Handle(_nodes.size() - 1);
+        }
+
+        void FreeNode(Handle handle)
+        {
+            Node& node = _nodes[handle];
+            node.Value = T();
+            node.Location = LOCATION_FREE;
+            node.Next = _freeHead;
+            _freeHead = handle;
+        }
+
+        // Moves the current time to now, stopping at every occupied slot on the way to cascade it
+        void AdvanceSlots(uint64 now)
+        {
+            while (_now < now)
+            {
+                uint64 next = GetNextSlotTime();
+                _nextSlotTime = next;
+                if (next > now)
+                {
+                    _now = now;
+                    break;
+                }
+
+                _now = next;
+                _nextSlotTime = std::numeric_limits<uint64>::max();
+
+                // the top level wrapped around, the far list may hold values of the new rotation
+                if (!(_now & (TOP_SPAN - 1)))
+                    Cascade(_farHead, now);
+
+                // slots starting now hold values that are due or belong to a lower level
+                for (uint8 level = 0; level < LEVELS; ++level)
+                {
+                    if (level && (_now & ((uint64(1) << (SLOT_BITS * level)) - 1)))
+                        break;
+
+                    uint32 slot = GetDigit(_now, level);
+                    if (!(_occupied[level] & (1u << slot)))
+                        continue;
+
+                    _occupied[level] &= ~(1u << slot);
+                    Cascade(_slots[level * SLOTS + slot], now);
+                }
+
+                _nextSlotTime = std::min(_nextSlotTime, GetNextSlotTime());
+            }
+
+            MergeDue();
+        }
+
+        // Start of the next occupied slot after the current time, the next top level wrap if only the far list holds values
+        uint64 GetNextSlotTime() const
+        {
+            for (uint8 level = 0; level < LEVELS; ++level)
+            {
+                // slots after the current one, the current slot of a level never holds values
+                uint32 ahead = _occupied[level] & ~((2u << GetDigit(_now, level)) - 1u);
+                if (!ahead)
+                    continue;
+
+                uint64 rotation = uint64(1) << (SLOT_BITS * (level + 1));
+                return (_now & ~(rotation - 1)) | (uint64(std::countr_zero(ahead)) << (SLOT_BITS * level));
+            }
+
+            if (_farHead != INVALID_HANDLE)
+                return (_now | (TOP_SPAN - 1)) + 1;
+
+            return std::numeric_limits<uint64>::max();
+        }
+
+        void Link(Handle handle)
+        {
+            if (_nodes[handle].Time <= _now)
+                LinkReady(handle);
+            else
+                LinkSlot(handle);
+        }
+
+        // Puts a value after the current time into its slot or the far list
+        void LinkSlot(Handle handle)
+        {
+            Node& node = _nodes[handle];
+            uint64 diff = node.Time ^ _now;
+            for (uint8 level = 0; level < LEVELS; ++level)
+            {
+                if (diff >> (SLOT_BITS * (level + 1)))
+                    continue;
+
+                if (_slots.empty())
+                    _slots.assign(LEVELS * SLOTS, INVALID_HANDLE);
+
+                node.Location = level;
+                node.Slot = uint8(GetDigit(node.Time, level));
+                PushFront(_slots[level * SLOTS + node.Slot], handle);
+                _occupied[level] |= 1u << node.Slot;
+                _nextSlotTime = std::min(_nextSlotTime, node.Time & ~((uint64(1) << (SLOT_BITS * level)) - 1));
+                return;
+            }
+
+            node.Location = LOCATION_FAR;
+            PushFront(_farHead, handle);
+            _nextSlotTime = std::min(_nextSlotTime, (_now | (TOP_SPAN - 1)) + 1);
+        }
+
+        void PushFront(Handle& head, Handle handle)
+        {
+            Node& node = _nodes[handle];
+            node.Prev = INVALID_HANDLE;
+            node.Next = head;
+            if (head != INVALID_HANDLE)
+                _nodes[head].Prev = handle;
+            head = handle;
+        }
+
+        // Inserts into the ready list in (time, sequence) order, walking from the back as new values are mostly the latest
+        void LinkReady(Handle handle)
+        {
+            Handle after = _readyTail;
+            while (after != INVALID_HANDLE && IsBefore(handle, after))
+                after = _nodes[after].Prev;
+
+            Node& node = _nodes[handle];
+            node.Location = LOCATION_READY;
+            node.Prev = after;
+            node.Next = after != INVALID_HANDLE ? _nodes[after].Next : _readyHead;
+
+            if (node.Next != INVALID_HANDLE)
+                _nodes[node.Next].Prev = handle;
+            else
+                _readyTail = handle;
+
+            if (after != INVALID_HANDLE)
+                _nodes[after].Next = handle;
+            else
+                _readyHead = handle;
+        }
+
+        void Unlink(Handle handle)
+        {
+            Node& node = _nodes[handle];
+            if (node.Prev != INVALID_HANDLE)
+                _nodes[node.Prev].Next = node.Next;
+
+            if (node.Next != INVALID_HANDLE)
+                _nodes[node.Next].Prev = node.Prev;
+
+            if (node.Location == LOCATION_READY)
+            {
+                if (_readyHead == handle)
+                    _readyHead = node.Next;
+
+                if (_readyTail == handle)
+                    _readyTail = node.Prev;
+            }
+            else if (node.Location == LOCATION_FAR)
+            {
+                if (_farHead == handle)
+                    _farHead = node.Next;
+            }
+            else
+            {
+                Handle& head = _slots[node.Location * SLOTS + node.Slot];
+                if (head == handle)
+                    head = node.Next;
+
+                if (head == INVALID_HANDLE)
+                    _occupied[node.Location] &= ~(1u << node.Slot);
+            }
+        }
+
+        // Empties a slot or the far list, values due by now are collected for MergeDue() and the others relinked
+        void Cascade(Handle& head, uint64 now)
+        {
+            Handle handle = head;
+            head = INVALID_HANDLE;
+
+            while (handle != INVALID_HANDLE)
+            {
+                Handle next = _nodes[handle].Next;
+                if (_nodes[handle].Time <= now)
+                    _due.push_back(handle);
+                else
+                    LinkSlot(handle);
+
+                handle = next;
+            }
+        }
+
+        // Merges the collected due values into the ready list, slot lists do not keep any order so they are sorted first
+        void MergeDue()
+        {
+            if (_due.empty())
+                return;
+
+            std::sort(_due.begin(), _due.end(), [this](Handle left, Handle right) { return IsBefore(left, right); });
+
+            Handle before = _readyHead;
+            for (Handle handle : _due)
+            {
+                while (before != INVALID_HANDLE && IsBefore(before, handle))
+                    before = _nodes[before].Next;
+
+                Node& node = _nodes[handle];
+                node.Location = LOCATION_READY;
+                node.Next = before;
+                node.Prev = before != INVALID_HANDLE ? _nodes[before].Prev : _readyTail;
+
+                if (node.Prev != INVALID_HANDLE)
+                    _nodes[node.Prev].Next = handle;
+                else
+                    _readyHead = handle;
+
+                if (before != INVALID_HANDLE)
+                    _nodes[before].Prev = handle;
+                else
+                    _readyTail = handle;
+            }
+
+            _due.clear();
+        }
+
+        std::vector<Node> _nodes;
+        std::vector<Handle> _slots;                          // LEVELS * SLOTS list heads, allocated with the first value put into a slot
+        std::array<uint32, LEVELS> _occupied{};              // non-empty slots of every level
+        std::vector<Handle> _due;                            // values made due while advancing, kept to reuse the capacity
+        Handle _freeHead{ INVALID_HANDLE };
+        Handle _readyHead{ INVALID_HANDLE };
+        Handle _readyTail{ INVALID_HANDLE };
+        Handle _farHead{ INVALID_HANDLE };
+        uint32 _size{ 0 };
+        uint64 _now;
+        uint64 _nextSequence{ 0 };
+        uint64 _nextSlotTime{ std::numeric_limits<uint64>::max() }; // no slot starts before, erasing values may leave it early
+    };
+}
+
+#endif
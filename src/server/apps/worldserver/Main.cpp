@@ -51,6 +51,7 @@
 #include "Systemd.h"
 #include "TC9Sidecar.h"
 #include "World.h"
+#include "WorldPacketPool.h"
 #include "WorldSessionMgr.h"
 #include "WorldSocket.h"
 #include "WorldSocketMgr.h"
@@ -190,8 +191,8 @@ int main(int argc, char** argv)
 
     // Init all logs
     sLog->RegisterAppender<AppenderDB>();
-    // If logs are supposed to be handled async then we need to pass the IoContext into the Log singleton
-    sLog->Initialize(sConfigMgr->GetOption<bool>("Log.Async.Enable", false) ? ioContext.get() : nullptr);
+    // Async logging hands messages to a dedicated writer thread through per-thread ring buffers
+    sLog->Initialize(sConfigMgr->GetOption<bool>("Log.Async.Enable", false));
 
     Acore::Banner::Show("worldserver-daemon",
         [](std::string_view text)
@@ -298,6 +299,10 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+        LoginDatabase.LogQueueMetrics();
+        CharacterDatabase.LogQueueMetrics();
+        WorldDatabase.LogQueueMetrics();
+        WorldPacketPool::LogMetrics();
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
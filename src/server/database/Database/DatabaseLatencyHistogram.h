@@ -0,0 +1,72 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DATABASELATENCYHISTOGRAM_H
+#define _DATABASELATENCYHISTOGRAM_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <array>
+#include <atomic>
+#include <string>
+
+//! Counts async operations by the time from being enqueued until they completed.
+//! Filled by the worker thread of a queue shard, read and reset by the metric logging.
+class DatabaseLatencyHistogram
+{
+public:
+    //! Upper bounds of the buckets, the last bucket counts everything slower.
+    static constexpr std::array<Milliseconds, 8> BUCKET_LIMITS = { 1ms, 2ms, 5ms, 10ms, 25ms, 50ms, 100ms, 250ms };
+    static constexpr std::size_t BUCKET_COUNT = BUCKET_LIMITS.size() + 1;
+
+    typedef std::array<uint64, BUCKET_COUNT> Counts;
+
+    static std::size_t GetBucket(std::chrono::steady_clock::duration latency)
+    {
+        std::size_t bucket = 0;
+        while (bucket < BUCKET_LIMITS.size() && latency > BUCKET_LIMITS[bucket])
+            ++bucket;
+
+        return bucket;
+    }
+
+    //! Upper bound of a bucket in milliseconds, "inf" for the last one.
+    static std::string GetBucketLabel(std::size_t bucket)
+    {
+        return bucket < BUCKET_LIMITS.size() ? std::to_string(BUCKET_LIMITS[bucket].count()) : "inf";
+    }
+
+    void Add(std::chrono::steady_clock::duration latency)
+    {
+        _counts[GetBucket(latency)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //! Returns the counts since the previous call and starts counting anew.
+    Counts Take()
+    {
+        Counts counts;
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+            counts[i] = _counts[i].exchange(0, std::memory_order_relaxed);
+
+        return counts;
+    }
+
+private:
+    std::array<std::atomic<uint64>, BUCKET_COUNT> _counts{};
+};
+
+#endif
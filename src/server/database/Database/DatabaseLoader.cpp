@@ -73,8 +73,9 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
         }
 
         uint8 const synchThreads = sConfigMgr->GetOption<uint8>(name + "Database.SynchThreads", 1);
+        bool const shardedQueues = sConfigMgr->GetOption<bool>(name + "Database.ShardedQueues", false);
 
-        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads, shardedQueues);
 
         if (uint32 error = pool.Open())
         {
@@ -0,0 +1,77 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DatabaseQueueShards.h"
+#include "Errors.h"
+#include "SQLOperation.h"
+
+DatabaseQueueShards::DatabaseQueueShards(std::size_t count) : _nextShard(0)
+{
+    ASSERT(count > 0);
+
+    _shards.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        _shards.push_back(std::make_unique<Shard>());
+}
+
+DatabaseQueueShards::~DatabaseQueueShards()
+{
+    Cancel();
+}
+
+std::size_t DatabaseQueueShards::Enqueue(SQLOperation* op, uint64 affinityKey)
+{
+    // operations of one key always go to the same worker, the others are spread evenly
+    std::size_t const index = affinityKey ? affinityKey % _shards.size() : _nextShard.fetch_add(1, std::memory_order_relaxed) % _shards.size();
+    EnqueueToShard(op, index);
+    return index;
+}
+
+void DatabaseQueueShards::EnqueueToShard(SQLOperation* op, std::size_t index)
+{
+    Shard& shard = *_shards[index];
+    op->m_latencyHistogram = &shard.Latency;
+    op->m_queueTime = std::chrono::steady_clock::now();
+    shard.Queue.Push(op);
+}
+
+void DatabaseQueueShards::EnqueueToEach(std::function<SQLOperation*()> const& create)
+{
+    for (std::size_t i = 0; i < _shards.size(); ++i)
+        EnqueueToShard(create(), i);
+}
+
+std::size_t DatabaseQueueShards::Size() const
+{
+    std::size_t size = 0;
+    for (std::unique_ptr<Shard> const& shard : _shards)
+        size += shard->Queue.Size();
+
+    return size;
+}
+
+void DatabaseQueueShards::Shutdown()
+{
+    for (std::unique_ptr<Shard> const& shard : _shards)
+        shard->Queue.Shutdown();
+}
+
+void DatabaseQueueShards::Cancel()
+{
+    for (std::unique_ptr<Shard> const& shard : _shards)
+        shard->Queue.Cancel();
+}
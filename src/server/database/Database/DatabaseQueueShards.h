@@ -0,0 +1,72 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DATABASEQUEUESHARDS_H
+#define _DATABASEQUEUESHARDS_H
+
+#include "DatabaseLatencyHistogram.h"
+#include "Define.h"
+#include "PCQueue.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+class SQLOperation;
+
+//! Async queues of a DatabaseWorkerPool in sharded mode, one per worker thread.
+//! Operations with the same non-zero affinity key always go to the same queue, so its
+//! single worker executes them in the order they were enqueued.
+class AC_DATABASE_API DatabaseQueueShards
+{
+public:
+    explicit DatabaseQueueShards(std::size_t count);
+    ~DatabaseQueueShards();
+
+    [[nodiscard]] std::size_t GetCount() const { return _shards.size(); }
+    ProducerConsumerQueue<SQLOperation*>* GetQueue(std::size_t index) { return &_shards[index]->Queue; }
+    DatabaseLatencyHistogram& GetLatency(std::size_t index) { return _shards[index]->Latency; }
+
+    //! Operations without affinity key are spread round robin. Returns the index of the queue used.
+    std::size_t Enqueue(SQLOperation* op, uint64 affinityKey);
+
+    void EnqueueToShard(SQLOperation* op, std::size_t index);
+
+    //! Enqueues one new operation to every queue, e.g. to reach every worker exactly once.
+    void EnqueueToEach(std::function<SQLOperation*()> const& create);
+
+    [[nodiscard]] std::size_t Size() const;
+    [[nodiscard]] std::size_t Size(std::size_t index) const { return _shards[index]->Queue.Size(); }
+
+    //! Graceful stop, the workers finish all queued operations before they stop.
+    void Shutdown();
+
+    //! Clears all queues and stops their workers immediately.
+    void Cancel();
+
+private:
+    struct Shard
+    {
+        ProducerConsumerQueue<SQLOperation*> Queue;
+        DatabaseLatencyHistogram Latency;
+    };
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    std::atomic<std::size_t> _nextShard;
+};
+
+#endif
@@ -16,6 +16,7 @@
  */
 
 #include "DatabaseWorker.h"
+#include "DatabaseLatencyHistogram.h"
 #include "PCQueue.h"
 #include "SQLOperation.h"
 
@@ -48,6 +49,9 @@ void DatabaseWorker::WorkerThread()
         operation->SetConnection(_connection);
         operation->call();
 
+        if (operation->m_latencyHistogram)
+            operation->m_latencyHistogram->Add(std::chrono::steady_clock::now() - operation->m_queueTime);
+
         delete operation;
     }
 }
@@ -18,9 +18,12 @@
 #include "DatabaseWorkerPool.h"
 #include "AdhocStatement.h"
 #include "CharacterDatabase.h"
+#include "DatabaseLatencyHistogram.h"
+#include "DatabaseQueueShards.h"
 #include "Errors.h"
 #include "Log.h"
 #include "LoginDatabase.h"
+#include "Metric.h"
 #include "MySQLPreparedStatement.h"
 #include "MySQLWorkaround.h"
 #include "PCQueue.h"
@@ -55,7 +58,8 @@ template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool() :
     _queue(new ProducerConsumerQueue<SQLOperation*>()),
     _async_threads(0),
-    _synch_threads(0)
+    _synch_threads(0),
+    _shardedQueues(false)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 
@@ -71,16 +75,17 @@ DatabaseWorkerPool<T>::DatabaseWorkerPool() :
 template <class T>
 DatabaseWorkerPool<T>::~DatabaseWorkerPool()
 {
-    _queue->Cancel();
+    CancelQueues();
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads)
+void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads, bool const shardedQueues)
 {
     _connectionInfo = std::make_unique<MySQLConnectionInfo>(infoString);
 
     _async_threads = asyncThreads;
     _synch_threads = synchThreads;
+    _shardedQueues = shardedQueues;
 }
 
 template <class T>
@@ -88,8 +93,12 @@ uint32 DatabaseWorkerPool<T>::Open()
 {
     WPFatal(_connectionInfo.get(), "Connection info was not set!");
 
-    LOG_INFO("sql.driver", "Opening DatabasePool '{}'. Asynchronous connections: {}, synchronous connections: {}.",
-        GetDatabaseName(), _async_threads, _synch_threads);
+    LOG_INFO("sql.driver", "Opening DatabasePool '{}'. Asynchronous connections: {}{}, synchronous connections: {}.",
+        GetDatabaseName(), _async_threads, _shardedQueues ? " (sharded queues)" : "", _synch_threads);
+
+    // created once like the shared queue, workers of a previous attempt may still wait on them
+    if (_shardedQueues && !_shards && _async_threads)
+        _shards = std::make_unique<DatabaseQueueShards>(_async_threads);
 
     uint32 error = OpenConnections(IDX_ASYNC, _async_threads);
 
@@ -112,11 +121,13 @@ uint32 DatabaseWorkerPool<T>::Open()
 template <class T>
 void DatabaseWorkerPool<T>::Close()
 {
-    LOG_INFO("sql.driver", "Closing down DatabasePool '{}'. Waiting for {} queries to finish...", GetDatabaseName(), _queue->Size());
+    LOG_INFO("sql.driver", "Closing down DatabasePool '{}'. Waiting for {} queries to finish...", GetDatabaseName(), QueueSize());
 
     // Gracefully close async query queue, worker threads will block when the destructor
     // is called from the .clear() functions below until the queue is empty
     _queue->Shutdown();
+    if (_shards)
+        _shards->Shutdown();
 
     //! Closes the actualy MySQL connection.
     _connections[IDX_ASYNC].clear();
@@ -224,22 +235,22 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(std::string_view sql)
 }
 
 template <class T>
-QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
+QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt, uint64 affinityKey)
 {
     PreparedStatementTask* task = new PreparedStatementTask(stmt, true);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     PreparedQueryResultFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, affinityKey);
     return QueryCallback(std::move(result));
 }
 
 template <class T>
-SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
+SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, uint64 affinityKey)
 {
     SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, affinityKey);
     return { std::move(holder), std::move(result) };
 }
 
@@ -250,7 +261,7 @@ SQLTransaction<T> DatabaseWorkerPool<T>::BeginTransaction()
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
+void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction, uint64 affinityKey)
 {
 #ifdef ACORE_DEBUG
     //! Only analyze transaction weaknesses in Debug mode.
@@ -269,11 +280,11 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // ACORE_DEBUG
 
-    Enqueue(new TransactionTask(transaction));
+    Enqueue(new TransactionTask(transaction), affinityKey);
 }
 
 template <class T>
-TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction)
+TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction, uint64 affinityKey)
 {
 #ifdef ACORE_DEBUG
     //! Only analyze transaction weaknesses in Debug mode.
@@ -294,7 +305,7 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
 
     TransactionWithResultTask* task = new TransactionWithResultTask(transaction);
     TransactionFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, affinityKey);
     return TransactionCallback(std::move(result));
 }
 
@@ -361,6 +372,13 @@ void DatabaseWorkerPool<T>::KeepAlive()
         }
     }
 
+    //! Sharded queues belong to a single worker each, so every worker gets exactly one ping.
+    if (_shards)
+    {
+        _shards->EnqueueToEach([]() { return new PingOperation; });
+        return;
+    }
+
     //! Assuming all worker threads are free, every worker thread will receive 1 ping operation request
     //! If one or more worker threads are busy, the ping operations will not be split evenly, but this doesn't matter
     //! as the sole purpose is to prevent connections from idling.
@@ -425,7 +443,7 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConne
             switch (type)
             {
             case IDX_ASYNC:
-                return std::make_unique<T>(_queue.get(), *_connectionInfo);
+                return std::make_unique<T>(GetAsyncQueue(i), *_connectionInfo);
             case IDX_SYNCH:
                 return std::make_unique<T>(*_connectionInfo);
             default:
@@ -436,7 +454,7 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConne
         if (uint32 error = connection->Open())
         {
             // Failed to open a connection or invalid version, abort and cleanup
-            _queue->Cancel();
+            CancelQueues();
             _connections[type].clear();
             return error;
         }
@@ -466,15 +484,62 @@ unsigned long DatabaseWorkerPool<T>::EscapeString(char* to, char const* from, un
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
+void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op, uint64 affinityKey)
 {
-    _queue->Push(op);
+    if (!_shards)
+    {
+        _queue->Push(op);
+        return;
+    }
+
+    _shards->Enqueue(op, affinityKey);
+}
+
+template <class T>
+ProducerConsumerQueue<SQLOperation*>* DatabaseWorkerPool<T>::GetAsyncQueue(uint8 index)
+{
+    if (!_shards)
+        return _queue.get();
+
+    return _shards->GetQueue(index);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::CancelQueues()
+{
+    _queue->Cancel();
+    if (_shards)
+        _shards->Cancel();
 }
 
 template <class T>
 std::size_t DatabaseWorkerPool<T>::QueueSize() const
 {
-    return _queue->Size();
+    std::size_t size = _queue->Size();
+    if (_shards)
+        size += _shards->Size();
+
+    return size;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::LogQueueMetrics()
+{
+    if (!_shards)
+        return;
+
+    std::string const database(GetDatabaseName());
+    for (std::size_t i = 0; i < _shards->GetCount(); ++i)
+    {
+        std::string const shardId = std::to_string(i);
+        METRIC_VALUE("db_shard_queue", uint64(_shards->Size(i)), METRIC_TAG("db", database), METRIC_TAG("shard", shardId));
+
+        // operations completed since the previous report, by latency bucket
+        DatabaseLatencyHistogram::Counts const counts = _shards->GetLatency(i).Take();
+        for (std::size_t bucket = 0; bucket < counts.size(); ++bucket)
+            METRIC_VALUE("db_shard_latency", counts[bucket], METRIC_TAG("db", database), METRIC_TAG("shard", shardId),
+                METRIC_TAG("bucket", DatabaseLatencyHistogram::GetBucketLabel(bucket)));
+    }
 }
 
 template <class T>
@@ -522,10 +587,10 @@ void DatabaseWorkerPool<T>::Execute(std::string_view sql)
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
+void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt, uint64 affinityKey)
 {
     PreparedStatementTask* task = new PreparedStatementTask(stmt);
-    Enqueue(task);
+    Enqueue(task, affinityKey);
 }
 
 template <class T>
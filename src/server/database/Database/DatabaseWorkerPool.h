@@ -41,6 +41,7 @@
 template <typename T>
 class ProducerConsumerQueue;
 
+class DatabaseQueueShards;
 class SQLOperation;
 struct MySQLConnectionInfo;
 
@@ -60,7 +61,9 @@ public:
     DatabaseWorkerPool();
     ~DatabaseWorkerPool();
 
-    void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads);
+    //! With shardedQueues every async worker has its own queue, operations enqueued with the same
+    //! affinity key always go to the same worker and are executed in the order they were enqueued.
+    void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads, bool const shardedQueues);
 
     uint32 Open();
     void Close();
@@ -94,7 +97,8 @@ public:
 
     //! Enqueues a one-way SQL operation in prepared statement format that will be executed asynchronously.
     //! Statement must be prepared with CONNECTION_ASYNC flag.
-    void Execute(PreparedStatement<T>* stmt);
+    //! A non-zero affinityKey (the account id the operation belongs to) keeps the operation in order with the other operations of that key.
+    void Execute(PreparedStatement<T>* stmt, uint64 affinityKey = 0);
 
     /**
         Direct synchronous one-way statement methods.
@@ -154,13 +158,15 @@ public:
     //! Enqueues a query in prepared format that will set the value of the PreparedQueryResultFuture return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Statement must be prepared with CONNECTION_ASYNC flag.
-    QueryCallback AsyncQuery(PreparedStatement<T>* stmt);
+    //! A non-zero affinityKey (the account id the operation belongs to) keeps the query in order with the other operations of that key.
+    QueryCallback AsyncQuery(PreparedStatement<T>* stmt, uint64 affinityKey = 0);
 
     //! Enqueues a vector of SQL operations (can be both adhoc and prepared) that will set the value of the QueryResultHolderFuture
     //! return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-    SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder);
+    //! A non-zero affinityKey (the account id the operation belongs to) keeps the holder in order with the other operations of that key.
+    SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, uint64 affinityKey = 0);
 
     /**
         Transaction context methods.
@@ -171,11 +177,13 @@ public:
 
     //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
-    void CommitTransaction(SQLTransaction<T> transaction);
+    //! A non-zero affinityKey (the account id the operation belongs to) keeps the transaction in order with the other operations of that key.
+    void CommitTransaction(SQLTransaction<T> transaction, uint64 affinityKey = 0);
 
     //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
-    TransactionCallback AsyncCommitTransaction(SQLTransaction<T> transaction);
+    //! A non-zero affinityKey (the account id the operation belongs to) keeps the transaction in order with the other operations of that key.
+    TransactionCallback AsyncCommitTransaction(SQLTransaction<T> transaction, uint64 affinityKey = 0);
 
     //! Directly executes a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
@@ -215,12 +223,21 @@ public:
 
     [[nodiscard]] std::size_t QueueSize() const;
 
+    //! Reports depth and latency histogram of every queue shard as metrics, nothing if the queues are not sharded.
+    void LogQueueMetrics();
+
 private:
     uint32 OpenConnections(InternalIndex type, uint8 numConnections);
 
     unsigned long EscapeString(char* to, char const* from, unsigned long length);
 
-    void Enqueue(SQLOperation* op);
+    //! Operations without affinity key go to the shared queue, or round robin to the shards in sharded mode.
+    void Enqueue(SQLOperation* op, uint64 affinityKey = 0);
+
+    ProducerConsumerQueue<SQLOperation*>* GetAsyncQueue(uint8 index);
+
+    //! Clears all queues and stops their workers.
+    void CancelQueues();
 
     //! Gets a free connection in the synchronous connection pool.
     //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
@@ -230,10 +247,13 @@ private:
 
     //! Queue shared by async worker threads.
     std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _queue;
+    //! One queue per async worker thread if the queues are sharded, _queue stays unused then.
+    std::unique_ptr<DatabaseQueueShards> _shards;
     std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     std::vector<uint8> _preparedStatementSize;
     uint8 _async_threads, _synch_threads;
+    bool _shardedQueues;
 #ifdef ACORE_DEBUG
     static inline thread_local bool _warnSyncQueries = false;
 #endif
@@ -133,6 +133,8 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_ACCOUNT_BY_NAME,
     CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES,
     CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES,
+    CHAR_REP_ACCOUNT_INSTANCE_LOCK_TIMES,
+    CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES_BY_INSTANCE,
     CHAR_SEL_MATCH_MAKER_RATING,
     CHAR_SEL_CHARACTER_COUNT,
     CHAR_UPD_NAME_BY_GUID,
@@ -195,6 +197,8 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_EQUIP_SET,
 
     CHAR_INS_AURA,
+    CHAR_REP_AURA,
+    CHAR_DEL_CHAR_AURA_BY_CASTER_SPELL,
 
     CHAR_SEL_ACCOUNT_DATA,
     CHAR_REP_ACCOUNT_DATA,
@@ -370,13 +374,16 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_CHAR_ACHIEVEMENT,
     CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS,
     CHAR_INS_CHAR_ACHIEVEMENT,
+    CHAR_REP_CHAR_ACHIEVEMENT,
     CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA,
     CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS,
+    CHAR_REP_CHAR_ACHIEVEMENT_PROGRESS,
     CHAR_INS_CHAR_ACHIEVEMENT_OFFLINE_UPDATES,
     CHAR_SEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES,
     CHAR_DEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES,
     CHAR_DEL_CHAR_REPUTATION_BY_FACTION,
     CHAR_INS_CHAR_REPUTATION_BY_FACTION,
+    CHAR_REP_CHAR_REPUTATION_BY_FACTION,
     CHAR_UPD_CHAR_ARENA_POINTS,
     CHAR_DEL_ITEM_REFUND_INSTANCE,
     CHAR_INS_ITEM_REFUND_INSTANCE,
@@ -409,6 +416,8 @@ enum CharacterDatabaseStatements : uint32
     CHAR_UPD_CHAR_TITLES_FACTION_CHANGE,
     CHAR_RES_CHAR_TITLES_FACTION_CHANGE,
     CHAR_DEL_CHAR_SPELL_COOLDOWN,
+    CHAR_DEL_CHAR_SPELL_COOLDOWN_BY_SPELL,
+    CHAR_REP_CHAR_SPELL_COOLDOWN,
     CHAR_DEL_CHARACTER,
     CHAR_DEL_CHAR_ACTION,
     CHAR_DEL_CHAR_AURA,
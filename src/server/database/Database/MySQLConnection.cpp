@@ -30,6 +30,9 @@
 #include <mysql.h>
 #include <mysqld_error.h>
 
+static constexpr uint32 MAX_BATCH_ROWS = 64;
+static constexpr uint32 MAX_BATCH_PARAMETERS = 65535;
+
 MySQLConnectionInfo::MySQLConnectionInfo(std::string_view infoString)
 {
     std::vector<std::string_view> tokens = Acore::Tokenize(infoString, ';', true);
@@ -75,6 +78,7 @@ void MySQLConnection::Close()
 {
     // Stop the worker thread before the statements are cleared
     m_worker.reset();
+    m_batchStmts.clear();
     m_stmts.clear();
 
     if (m_Mysql)
@@ -168,6 +172,7 @@ uint32 MySQLConnection::Open()
 
 bool MySQLConnection::PrepareStatements()
 {
+    m_batchStmts.clear();
     DoPrepareStatements();
     return !m_prepareError;
 }
@@ -250,6 +255,89 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     return true;
 }
 
+/// Executes consecutive statements of one batchable kind as multi-row statements, in chunks of
+/// power of two row counts so only a handful of variants get prepared per statement
+bool MySQLConnection::ExecuteBatch(std::vector<PreparedStatementBase*> const& stmts)
+{
+    if (!m_Mysql)
+        return false;
+
+    MySQLPreparedStatement* m_mStmt = GetPreparedStatement(stmts.front()->GetIndex());
+    ASSERT(m_mStmt); // Can only be null if preparation failed, server side error or bad query
+
+    uint32 maxRows = MAX_BATCH_ROWS;
+    while (maxRows > 1 && maxRows * m_mStmt->GetParameterCount() > MAX_BATCH_PARAMETERS)
+        maxRows /= 2;
+
+    for (std::size_t offset = 0; offset < stmts.size();)
+    {
+        uint32 rows = maxRows;
+        while (rows > stmts.size() - offset)
+            rows /= 2;
+
+        if (!(rows > 1 ? _ExecuteBatch(&stmts[offset], rows) : Execute(stmts[offset])))
+            return false;
+
+        offset += rows;
+    }
+
+    return true;
+}
+
+bool MySQLConnection::_ExecuteBatch(PreparedStatementBase* const* stmts, uint32 rows)
+{
+    MySQLPreparedStatement* m_mStmt = GetBatchPreparedStatement(stmts[0]->GetIndex(), rows);
+    if (!m_mStmt)
+    {
+        // could not prepare the multi-row variant, fall back to one statement per row
+        for (uint32 i = 0; i < rows; ++i)
+            if (!Execute(stmts[i]))
+                return false;
+
+        return true;
+    }
+
+    m_mStmt->BindParameters(stmts, rows);
+
+    MYSQL_STMT* msql_STMT = m_mStmt->GetSTMT();
+    MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
+
+    uint32 _s = getMSTime();
+
+#if MYSQL_VERSION_ID >= 80300
+    if (mysql_stmt_bind_named_param(msql_STMT, msql_BIND, m_mStmt->GetParameterCount(), nullptr))
+#else
+    if (mysql_stmt_bind_param(msql_STMT, msql_BIND))
+#endif
+    {
+        uint32 lErrno = mysql_errno(m_Mysql);
+        LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
+
+        if (_HandleMySQLErrno(lErrno, mysql_stmt_error(msql_STMT)))  // If it returns true, an error was handled successfully (i.e. reconnection)
+            return _ExecuteBatch(stmts, rows);       // Try again
+
+        m_mStmt->ClearParameters();
+        return false;
+    }
+
+    if (mysql_stmt_execute(msql_STMT))
+    {
+        uint32 lErrno = mysql_errno(m_Mysql);
+        LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
+
+        if (_HandleMySQLErrno(lErrno, mysql_stmt_error(msql_STMT)))  // If it returns true, an error was handled successfully (i.e. reconnection)
+            return _ExecuteBatch(stmts, rows);       // Try again
+
+        m_mStmt->ClearParameters();
+        return false;
+    }
+
+    LOG_DEBUG("sql.sql", "[{} ms] SQL(p, {} rows): {}", getMSTimeDiff(_s, getMSTime()), rows, m_mStmt->getQueryString());
+
+    m_mStmt->ClearParameters();
+    return true;
+}
+
 bool MySQLConnection::_Query(PreparedStatementBase* stmt, MySQLPreparedStatement** mysqlStmt, MySQLResult** pResult, uint64* pRowCount, uint32* pFieldCount)
 {
     if (!m_Mysql)
@@ -387,8 +475,11 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
 
     BeginTransaction();
 
-    for (auto const& data : queries)
+    std::vector<PreparedStatementBase*> batch;
+
+    for (std::size_t i = 0; i < queries.size(); ++i)
     {
+        SQLElementData const& data = queries[i];
         switch (data.type)
         {
             case SQL_ELEMENT_PREPARED:
@@ -407,7 +498,23 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
 
                 ASSERT(stmt);
 
-                if (!Execute(stmt))
+                // Consecutive appends of the same INSERT/REPLACE statement are sent as multi-row statements
+                batch.clear();
+                MySQLPreparedStatement* mStmt = GetPreparedStatement(stmt->GetIndex());
+                if (mStmt && mStmt->IsBatchable())
+                {
+                    batch.push_back(stmt);
+                    for (; i + 1 < queries.size() && queries[i + 1].type == SQL_ELEMENT_PREPARED; ++i)
+                    {
+                        PreparedStatementBase* next = std::get<PreparedStatementBase*>(queries[i + 1].element);
+                        if (next->GetIndex() != stmt->GetIndex())
+                            break;
+
+                        batch.push_back(next);
+                    }
+                }
+
+                if (!(batch.size() > 1 ? ExecuteBatch(batch) : Execute(stmt)))
                 {
                     LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
                     int errorCode = GetLastError();
@@ -534,6 +641,42 @@ void MySQLConnection::PrepareStatement(uint32 index, std::string_view sql, Conne
     }
 }
 
+MySQLPreparedStatement* MySQLConnection::GetBatchPreparedStatement(uint32 index, uint32 rows)
+{
+    uint64 key = (uint64(index) << 32) | rows;
+    auto itr = m_batchStmts.find(key);
+    if (itr != m_batchStmts.end())
+        return itr->second.get();
+
+    // a failed preparation is cached as well, those rows are then executed one by one
+    std::unique_ptr<MySQLPreparedStatement>& batchStmt = m_batchStmts[key];
+
+    MySQLPreparedStatement* baseStmt = GetPreparedStatement(index);
+    if (!baseStmt || !baseStmt->IsBatchable())
+        return nullptr;
+
+    std::string sql = baseStmt->GetBatchQueryString(rows);
+
+    MYSQL_STMT* stmt = mysql_stmt_init(m_Mysql);
+    if (!stmt)
+    {
+        LOG_ERROR("sql.sql", "In mysql_stmt_init() id: {} ({} rows), sql: \"{}\"", index, rows, sql);
+        LOG_ERROR("sql.sql", "{}", mysql_error(m_Mysql));
+        return nullptr;
+    }
+
+    if (mysql_stmt_prepare(stmt, sql.c_str(), static_cast<unsigned long>(sql.size())))
+    {
+        LOG_ERROR("sql.sql", "In mysql_stmt_prepare() id: {} ({} rows), sql: \"{}\"", index, rows, sql);
+        LOG_ERROR("sql.sql", "{}", mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+        return nullptr;
+    }
+
+    batchStmt = std::make_unique<MySQLPreparedStatement>(reinterpret_cast<MySQLStmt*>(stmt), sql);
+    return batchStmt.get();
+}
+
 PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
 {
     MySQLPreparedStatement* mysqlStmt = nullptr;
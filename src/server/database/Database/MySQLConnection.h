@@ -23,6 +23,7 @@
 #include <map>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 template <typename T>
@@ -70,6 +71,7 @@ public:
 
     bool Execute(std::string_view sql);
     bool Execute(PreparedStatementBase* stmt);
+    bool ExecuteBatch(std::vector<PreparedStatementBase*> const& stmts);
     ResultSet* Query(std::string_view sql);
     PreparedResultSet* Query(PreparedStatementBase* stmt);
     bool _Query(std::string_view sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount);
@@ -96,6 +98,7 @@ protected:
     [[nodiscard]] std::string GetServerInfo() const;
     MySQLPreparedStatement* GetPreparedStatement(uint32 index);
     void PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags);
+    MySQLPreparedStatement* GetBatchPreparedStatement(uint32 index, uint32 rows);
 
     virtual void DoPrepareStatements() = 0;
     virtual bool _HandleMySQLErrno(uint32 errNo, char const* err = "", uint8 attempts = 5);
@@ -103,11 +106,14 @@ protected:
     typedef std::vector<std::unique_ptr<MySQLPreparedStatement>> PreparedStatementContainer;
 
     PreparedStatementContainer m_stmts; //! PreparedStatements storage
+    std::unordered_map<uint64, std::unique_ptr<MySQLPreparedStatement>> m_batchStmts; //! Multi-row variants of m_stmts, prepared on first use
     bool m_reconnecting;  //! Are we reconnecting?
     bool m_prepareError;  //! Was there any error while preparing statements?
     MySQLHandle* m_Mysql; //! MySQL Handle.
 
 private:
+    bool _ExecuteBatch(PreparedStatementBase* const* stmts, uint32 rows);
+
     ProducerConsumerQueue<SQLOperation*>* m_queue;      //! Queue shared with other asynchronous connections.
     std::unique_ptr<DatabaseWorker> m_worker;           //! Core worker task.
     MySQLConnectionInfo& m_connectionInfo;              //! Connection info (used for logging)
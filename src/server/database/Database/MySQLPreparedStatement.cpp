@@ -20,6 +20,8 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "PreparedStatement.h"
+#include <algorithm>
+#include <cctype>
 
 template<typename T>
 struct MySQLType { };
@@ -35,6 +37,66 @@ template<> struct MySQLType<int64> : std::integral_constant<enum_field_types, MY
 template<> struct MySQLType<float> : std::integral_constant<enum_field_types, MYSQL_TYPE_FLOAT> { };
 template<> struct MySQLType<double> : std::integral_constant<enum_field_types, MYSQL_TYPE_DOUBLE> { };
 
+/// Splits "INSERT ... VALUES (?, ...) [ON DUPLICATE KEY UPDATE ...]" around its only VALUES group,
+/// returns false for anything that would change meaning when repeated as "VALUES (...), (...)"
+static bool SplitBatchableQuery(std::string_view query, std::string& prefix, std::string& row, std::string& suffix)
+{
+    auto startsWithNoCase = [](std::string_view str, std::string_view token)
+    {
+        return str.size() >= token.size() && std::equal(token.begin(), token.end(), str.begin(), [](char a, char b)
+        {
+            return std::toupper(static_cast<unsigned char>(a)) == b;
+        });
+    };
+
+    std::string_view trimmed = query.substr(std::min(query.find_first_not_of(" \t\n"), query.size()));
+    if (!startsWithNoCase(trimmed, "INSERT") && !startsWithNoCase(trimmed, "REPLACE"))
+        return false;
+
+    // first VALUES keyword followed by a parenthesis, later ones belong to ON DUPLICATE KEY UPDATE
+    std::size_t groupStart = std::string_view::npos;
+    for (std::size_t pos = 0; pos + 6 <= query.size(); ++pos)
+    {
+        if (!startsWithNoCase(query.substr(pos), "VALUES"))
+            continue;
+
+        std::size_t open = query.find_first_not_of(" \t\n", pos + 6);
+        if (open != std::string_view::npos && query[open] == '(')
+        {
+            groupStart = open;
+            prefix = std::string(query.substr(0, pos + 6)) + ' ';
+            break;
+        }
+    }
+
+    if (groupStart == std::string_view::npos || prefix.find('?') != std::string::npos)
+        return false;
+
+    std::size_t depth = 0;
+    std::size_t groupEnd = groupStart;
+    for (; groupEnd < query.size(); ++groupEnd)
+    {
+        if (query[groupEnd] == '(')
+            ++depth;
+        else if (query[groupEnd] == ')' && --depth == 0)
+            break;
+        else if (query[groupEnd] == '\'' || query[groupEnd] == '"')
+            return false; // string literals could hide anything, leave those statements alone
+    }
+
+    if (groupEnd == query.size())
+        return false;
+
+    std::string_view rest = query.substr(groupEnd + 1);
+    std::string_view restTrimmed = rest.substr(std::min(rest.find_first_not_of(" \t\n"), rest.size()));
+    if (rest.find('?') != std::string_view::npos || (!restTrimmed.empty() && !startsWithNoCase(restTrimmed, "ON DUPLICATE KEY UPDATE")))
+        return false;
+
+    row = std::string(query.substr(groupStart, groupEnd + 1 - groupStart));
+    suffix = restTrimmed.empty() ? std::string() : ' ' + std::string(restTrimmed);
+    return row.find('?') != std::string::npos;
+}
+
 MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string_view queryString) :
     m_stmt(nullptr),
     m_Mstmt(stmt),
@@ -50,6 +112,13 @@ MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string_view
     /// "If set to 1, causes mysql_stmt_store_result() to update the metadata MYSQL_FIELD->max_length value."
     MySQLBool bool_tmp = MySQLBool(1);
     mysql_stmt_attr_set(stmt, STMT_ATTR_UPDATE_MAX_LENGTH, &bool_tmp);
+
+    if (!SplitBatchableQuery(m_queryString, m_batchPrefix, m_batchRow, m_batchSuffix))
+    {
+        m_batchPrefix.clear();
+        m_batchRow.clear();
+        m_batchSuffix.clear();
+    }
 }
 
 MySQLPreparedStatement::~MySQLPreparedStatement()
@@ -69,7 +138,7 @@ void MySQLPreparedStatement::BindParameters(PreparedStatementBase* stmt)
 {
     m_stmt = stmt;     // Cross reference them for debug output
 
-    uint8 pos = 0;
+    uint32 pos = 0;
     for (PreparedStatementData const& data : stmt->GetParameters())
     {
         std::visit([&](auto&& param)
@@ -86,6 +155,49 @@ void MySQLPreparedStatement::BindParameters(PreparedStatementBase* stmt)
 #endif
 }
 
+void MySQLPreparedStatement::BindParameters(PreparedStatementBase* const* stmts, std::size_t count)
+{
+    m_stmt = stmts[0];
+    m_batchRows.assign(stmts, stmts + count);
+
+    uint32 pos = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        for (PreparedStatementData const& data : stmts[i]->GetParameters())
+        {
+            std::visit([&](auto&& param)
+            {
+                SetParameter(pos, param);
+            }, data.data);
+
+            ++pos;
+        }
+    }
+
+#ifdef _DEBUG
+    if (pos < m_paramCount)
+        LOG_WARN("sql.sql", "[WARNING]: BindParameters() for {} rows of statement {} did not bind all allocated parameters", count, m_stmt->GetIndex());
+#endif
+}
+
+std::string MySQLPreparedStatement::GetBatchQueryString(uint32 rows) const
+{
+    std::string queryString;
+    queryString.reserve(m_batchPrefix.size() + (m_batchRow.size() + 2) * rows + m_batchSuffix.size());
+    queryString += m_batchPrefix;
+
+    for (uint32 i = 0; i < rows; ++i)
+    {
+        if (i)
+            queryString += ", ";
+
+        queryString += m_batchRow;
+    }
+
+    queryString += m_batchSuffix;
+    return queryString;
+}
+
 void MySQLPreparedStatement::ClearParameters()
 {
     for (uint32 i=0; i < m_paramCount; ++i)
@@ -96,9 +208,12 @@ void MySQLPreparedStatement::ClearParameters()
         m_bind[i].buffer = nullptr;
         m_paramsSet[i] = false;
     }
+
+    // the rows belong to the transaction, which is released once it has run
+    m_batchRows.clear();
 }
 
-static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint8 index, uint32 paramCount)
+static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint32 index, uint32 paramCount)
 {
     LOG_ERROR("sql.driver", "Attempted to bind parameter {}{} on a PreparedStatement {} (statement has only {} parameters)",
         uint32(index) + 1, (index == 1 ? "st" : (index == 2 ? "nd" : (index == 3 ? "rd" : "nd"))), stmtIndex, paramCount);
@@ -107,7 +222,7 @@ static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint8 index, uint32 para
 }
 
 //- Bind on mysql level
-void MySQLPreparedStatement::AssertValidIndex(uint8 index)
+void MySQLPreparedStatement::AssertValidIndex(uint32 index)
 {
     ASSERT(index < m_paramCount || ParamenterIndexAssertFail(m_stmt->GetIndex(), index, m_paramCount));
 
@@ -116,7 +231,7 @@ void MySQLPreparedStatement::AssertValidIndex(uint8 index)
 }
 
 template<typename T>
-void MySQLPreparedStatement::SetParameter(const uint8 index, T value)
+void MySQLPreparedStatement::SetParameter(const uint32 index, T value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -133,12 +248,12 @@ void MySQLPreparedStatement::SetParameter(const uint8 index, T value)
     memcpy(param->buffer, &value, len);
 }
 
-void MySQLPreparedStatement::SetParameter(const uint8 index, bool value)
+void MySQLPreparedStatement::SetParameter(const uint32 index, bool value)
 {
     SetParameter(index, uint8(value ? 1 : 0));
 }
 
-void MySQLPreparedStatement::SetParameter(const uint8 index, std::nullptr_t /*value*/)
+void MySQLPreparedStatement::SetParameter(const uint32 index, std::nullptr_t /*value*/)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -152,7 +267,7 @@ void MySQLPreparedStatement::SetParameter(const uint8 index, std::nullptr_t /*va
     param->length = nullptr;
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
+void MySQLPreparedStatement::SetParameter(uint32 index, std::string const& value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -169,7 +284,7 @@ void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
     memcpy(param->buffer, value.c_str(), len);
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, std::vector<uint8> const& value)
+void MySQLPreparedStatement::SetParameter(uint32 index, std::vector<uint8> const& value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -192,18 +307,27 @@ std::string MySQLPreparedStatement::getQueryString() const
 
     std::size_t pos = 0;
 
-    for (PreparedStatementData const& data : m_stmt->GetParameters())
+    auto replaceParameters = [&](PreparedStatementBase const* stmt)
     {
-        pos = queryString.find('?', pos);
-
-        std::string replaceStr = std::visit([&](auto&& data)
+        for (PreparedStatementData const& data : stmt->GetParameters())
         {
-            return PreparedStatementData::ToString(data);
-        }, data.data);
+            pos = queryString.find('?', pos);
 
-        queryString.replace(pos, 1, replaceStr);
-        pos += replaceStr.length();
-    }
+            std::string replaceStr = std::visit([&](auto&& data)
+            {
+                return PreparedStatementData::ToString(data);
+            }, data.data);
+
+            queryString.replace(pos, 1, replaceStr);
+            pos += replaceStr.length();
+        }
+    };
+
+    if (m_batchRows.empty())
+        replaceParameters(m_stmt);
+    else
+        for (PreparedStatementBase const* stmt : m_batchRows)
+            replaceParameters(stmt);
 
     return queryString;
 }
@@ -40,23 +40,29 @@ public:
     ~MySQLPreparedStatement();
 
     void BindParameters(PreparedStatementBase* stmt);
+    /// Binds the rows of a multi-row statement, each row taken from one statement of the single-row kind
+    void BindParameters(PreparedStatementBase* const* stmts, std::size_t count);
 
     uint32 GetParameterCount() const { return m_paramCount; }
 
+    /// INSERT/REPLACE with a single VALUES group and no placeholders outside it, can be sent as multi-row statement
+    bool IsBatchable() const { return !m_batchRow.empty(); }
+    std::string GetBatchQueryString(uint32 rows) const;
+
 protected:
-    void SetParameter(const uint8 index, bool value);
-    void SetParameter(const uint8 index, std::nullptr_t /*value*/);
-    void SetParameter(const uint8 index, std::string const& value);
-    void SetParameter(const uint8 index, std::vector<uint8> const& value);
+    void SetParameter(const uint32 index, bool value);
+    void SetParameter(const uint32 index, std::nullptr_t /*value*/);
+    void SetParameter(const uint32 index, std::string const& value);
+    void SetParameter(const uint32 index, std::vector<uint8> const& value);
 
     template<typename T>
-    void SetParameter(const uint8 index, T value);
+    void SetParameter(const uint32 index, T value);
 
     MySQLStmt* GetSTMT() { return m_Mstmt; }
     MySQLBind* GetBind() { return m_bind; }
     PreparedStatementBase* m_stmt;
     void ClearParameters();
-    void AssertValidIndex(const uint8 index);
+    void AssertValidIndex(const uint32 index);
     std::string getQueryString() const;
 
 private:
@@ -65,6 +71,12 @@ private:
     std::vector<bool> m_paramsSet;
     MySQLBind* m_bind;
     std::string m_queryString{};
+    std::vector<PreparedStatementBase*> m_batchRows;    //! Bound rows of a multi-row statement, for debug output
+
+    //! m_queryString split around its VALUES group, empty m_batchRow if the statement cannot be batched
+    std::string m_batchPrefix;
+    std::string m_batchRow;
+    std::string m_batchSuffix;
 
     MySQLPreparedStatement(MySQLPreparedStatement const& right) = delete;
     MySQLPreparedStatement& operator=(MySQLPreparedStatement const& right) = delete;
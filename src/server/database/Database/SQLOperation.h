@@ -20,6 +20,7 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Duration.h"
 #include <variant>
 
 //- Type specifier of our element data
@@ -36,6 +37,7 @@ struct SQLElementData
     SQLElementDataType type;
 };
 
+class DatabaseLatencyHistogram;
 class MySQLConnection;
 
 class AC_DATABASE_API SQLOperation
@@ -55,6 +57,10 @@ public:
 
     MySQLConnection* m_conn{nullptr};
 
+    //! Set when enqueued to a sharded queue, the worker adds the time since m_queueTime once the operation completed
+    DatabaseLatencyHistogram* m_latencyHistogram{nullptr};
+    TimePoint m_queueTime;
+
 private:
     SQLOperation(SQLOperation const& right) = delete;
     SQLOperation& operator=(SQLOperation const& right) = delete;
@@ -64,6 +64,7 @@ class Transaction : public TransactionBase
 public:
     using TransactionBase::Append;
 
+    //- Consecutive appends of the same INSERT/REPLACE statement are executed as multi-row statements
     void Append(PreparedStatement<T>* statement)
     {
         AppendPreparedStatement(statement);
@@ -564,6 +564,18 @@ void SmartAI::CheckConditions(const uint32 diff)
 
 void SmartAI::UpdateAI(uint32 diff)
 {
+    // script timers fire actions on other objects, during a parallel region update they run from the merge phase
+    Creature* creature = me;
+    if (me->GetMap()->DeferParallelObjectUpdate([creature, diff]()
+    {
+        if (!creature->IsInWorld() || !creature->IsAIEnabled)
+            return;
+
+        if (SmartAI* ai = dynamic_cast<SmartAI*>(creature->AI()))
+            ai->UpdateAI(diff);
+    }))
+        return;
+
     if (!me->IsAlive())
     {
         if (IsEngaged())
@@ -1031,8 +1043,9 @@ void SmartAI::InitializeAI()
 {
     GetScript()->OnInitialize(me);
 
-    for (SmartScriptHolder const& event : GetScript()->GetEvents())
+    for (SmartScriptEvent const& scriptEvent : GetScript()->GetEvents())
     {
+        SmartScriptHolder const& event = *scriptEvent.holder;
         if (event.GetActionType() != SMART_ACTION_CAST)
             continue;
 
@@ -1054,8 +1067,9 @@ void SmartAI::InitializeAI()
     // Fallback: use first SMARTCAST_COMBAT_MOVE if no MAIN_SPELL found
     if (!_currentRangeMode)
     {
-        for (SmartScriptHolder const& event : GetScript()->GetEvents())
+        for (SmartScriptEvent const& scriptEvent : GetScript()->GetEvents())
         {
+            SmartScriptHolder const& event = *scriptEvent.holder;
             if (event.GetActionType() != SMART_ACTION_CAST)
                 continue;
 
@@ -1308,7 +1322,7 @@ void SmartAI::StopFollow(bool complete)
     me->GetMotionMaster()->MoveIdle();
 }
 
-void SmartAI::SetScript9(SmartScriptHolder& e, uint32 entry, WorldObject* invoker)
+void SmartAI::SetScript9(SmartScriptHolder const& e, uint32 entry, WorldObject* invoker)
 {
     if (invoker)
         GetScript()->mLastInvoker = invoker->GetGUID();
@@ -1488,7 +1502,7 @@ uint32 SmartGameObjectAI::GetData(uint32 id) const
     return 0;
 }
 
-void SmartGameObjectAI::SetScript9(SmartScriptHolder& e, uint32 entry, WorldObject* invoker)
+void SmartGameObjectAI::SetScript9(SmartScriptHolder const& e, uint32 entry, WorldObject* invoker)
 {
     if (invoker)
         GetScript()->mLastInvoker = invoker->GetGUID();
@@ -72,7 +72,7 @@ public:
     void SetFollow(Unit* target, float dist = 0.0f, float angle = 0.0f, uint32 credit = 0, uint32 end = 0, uint32 creditType = 0, bool aliveState = true);
     void StopFollow(bool complete);
 
-    void SetScript9(SmartScriptHolder& e, uint32 entry, WorldObject* invoker);
+    void SetScript9(SmartScriptHolder const& e, uint32 entry, WorldObject* invoker);
     SmartScript* GetScript() { return &mScript; }
     bool IsEscortInvokerInRange();
 
@@ -306,7 +306,7 @@ public:
     void SetData(uint32 id, uint32 value) override { SetData(id, value, nullptr); }
     void SetData(uint32 id, uint32 value, WorldObject* invoker);
     uint32 GetData(uint32 id) const override;
-    void SetScript9(SmartScriptHolder& e, uint32 entry, WorldObject* invoker);
+    void SetScript9(SmartScriptHolder const& e, uint32 entry, WorldObject* invoker);
     void OnGameEvent(bool start, uint16 eventId) override;
     void OnStateChanged(uint32 state, Unit* unit) override;
     void EventInform(uint32 eventId) override;
@@ -135,17 +135,17 @@ void SmartScript::OnReset()
         SetPhase(0);
 
     ResetBaseObject();
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
+    for (SmartScriptEvent& event : mEvents)
     {
-        if (!((*i).event.event_flags & SMART_EVENT_FLAG_DONT_RESET))
+        if (!(event.holder->event.event_flags & SMART_EVENT_FLAG_DONT_RESET))
         {
-            InitTimer((*i));
-            (*i).runOnce = false;
+            InitTimer(*event.holder, event.state);
+            event.state.runOnce = false;
         }
 
-        if ((*i).priority != SmartScriptHolder::DEFAULT_PRIORITY)
+        if (event.state.priority != SmartScriptEventState::DEFAULT_PRIORITY)
         {
-            (*i).priority = SmartScriptHolder::DEFAULT_PRIORITY;
+            event.state.priority = SmartScriptEventState::DEFAULT_PRIORITY;
             mEventSortingRequired = true;
         }
     }
@@ -156,46 +156,67 @@ void SmartScript::OnReset()
 
 void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
+    // actions reach other objects, events raised by a parallel region update are processed by its merge phase
+    if (me && me->FindMap() && me->FindMap()->IsParallelObjectUpdateActive())
     {
-        SMART_EVENT eventType = SMART_EVENT((*i).GetEventType());
-        if (eventType == SMART_EVENT_LINK)//special handling
-            continue;
-
-        if (eventType == e)
+        Creature* creature = me;
+        ObjectGuid const unitGUID = unit ? unit->GetGUID() : ObjectGuid::Empty;
+        ObjectGuid const gobGUID = gob ? gob->GetGUID() : ObjectGuid::Empty;
+        if (me->FindMap()->DeferParallelObjectUpdate([creature, e, unitGUID, var0, var1, bvar, spell, gobGUID]()
         {
-            ConditionList conds = sConditionMgr->GetConditionsForSmartEvent((*i).entryOrGuid, (*i).event_id, (*i).source_type);
-            ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
+            if (!creature->IsInWorld() || !creature->IsAIEnabled)
+                return;
+
+            if (SmartAI* ai = dynamic_cast<SmartAI*>(creature->AI()))
+                ai->GetScript()->ProcessEventsFor(e, unitGUID ? ObjectAccessor::GetUnit(*creature, unitGUID) : nullptr, var0, var1, bvar, spell,
+                    gobGUID ? ObjectAccessor::GetGameObject(*creature, gobGUID) : nullptr);
+        }))
+            return;
+    }
 
-            if (sConditionMgr->IsObjectMeetToConditions(info, conds))
+    // SMART_EVENT_LINK is not indexed, linked events are only processed through their parent
+    auto range = std::equal_range(mEventIndex.begin(), mEventIndex.end(), std::make_pair(uint16(e), uint16(0)), [](std::pair<uint16, uint16> const& left, std::pair<uint16, uint16> const& right)
+    {
+        return left.first < right.first;
+    });
+
+    // positions instead of iterators, the index is only rebuilt outside of event processing but must never be read out of bounds
+    for (std::size_t i = std::distance(mEventIndex.begin(), range.first), end = std::distance(mEventIndex.begin(), range.second); i < end && i < mEventIndex.size(); ++i)
+    {
+        SmartScriptEvent& event = mEvents[mEventIndex[i].second];
+        SmartScriptHolder const& holder = *event.holder;
+
+        ConditionProgram const* conds = sConditionMgr->GetConditionProgramForSmartEvent(holder.entryOrGuid, holder.event_id, holder.source_type);
+        ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
+
+        if (sConditionMgr->IsObjectMeetToConditions(info, conds))
+        {
+            ASSERT(executionStack.empty());
+            executionStack.emplace_back(SmartScriptFrame{ holder, event.state, unit, var0, var1, bvar, spell, gob });
+            while (!executionStack.empty())
             {
-                ASSERT(executionStack.empty());
-                executionStack.emplace_back(SmartScriptFrame{ *i, unit, var0, var1, bvar, spell, gob });
-                while (!executionStack.empty())
-                {
-                    auto [stack_holder , stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
-                    executionStack.pop_back();
-                    ProcessEvent(stack_holder, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
-                }
+                auto [stack_holder, stack_state, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
+                executionStack.pop_back();
+                ProcessEvent(stack_holder, stack_state, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
             }
         }
     }
 }
 
-void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
+void SmartScript::ProcessAction(SmartScriptHolder const& e, SmartScriptEventState& state, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
-    e.runOnce = true;//used for repeat check
+    state.runOnce = true;//used for repeat check
 
     //calc random
-    if (e.event.event_chance < 100 && e.event.event_chance && !(e.event.event_flags & SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL))
+    if (e.event.event_chance < 100 && e.event.event_chance && !state.ignoreChanceRoll)
     {
         uint32 rnd = urand(1, 100);
         if (e.event.event_chance <= rnd)
             return;
     }
 
-    // Remove SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL flag after processing roll chances as it's not needed anymore
-    e.event.event_flags &= ~SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL;
+    // Clear ignoreChanceRoll after processing roll chances as it's not needed anymore
+    state.ignoreChanceRoll = false;
 
     if (unit)
         mLastInvoker = unit->GetGUID();
@@ -783,7 +804,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             // If there is at least 1 failed cast and no successful casts at all, retry again on next loop
             if (failedSpellCast && !successfulSpellCast)
             {
-                RetryLater(e, true);
+                RetryLater(state, true);
                 // Don't execute linked events
                 return;
             }
@@ -2044,12 +2065,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             ac.type = (SMART_ACTION)SMART_ACTION_TRIGGER_TIMED_EVENT;
             ac.timeEvent.id = e.action.timeEvent.id;
 
-            SmartScriptHolder ev = SmartScriptHolder();
-            ev.event = ne;
-            ev.event_id = e.action.timeEvent.id;
-            ev.target = e.target;
-            ev.action = ac;
-            InitTimer(ev);
+            SmartScriptStoredEvent ev = SmartScriptStoredEvent();
+            ev.holder.event = ne;
+            ev.holder.event_id = e.action.timeEvent.id;
+            ev.holder.target = e.target;
+            ev.holder.action = ac;
+            InitTimer(ev.holder, ev.state);
             mStoredEvents.push_back(ev);
             break;
         }
@@ -3426,29 +3447,29 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         if (linked.has_value())
         {
             auto& linkedEvent = linked.value().get();
-            if (linkedEvent.GetEventType() == SMART_EVENT_LINK)
-                executionStack.emplace_back(SmartScriptFrame{ linkedEvent, unit, var0, var1, bvar, spell, gob });
+            if (linkedEvent.holder->GetEventType() == SMART_EVENT_LINK)
+                executionStack.emplace_back(SmartScriptFrame{ *linkedEvent.holder, linkedEvent.state, unit, var0, var1, bvar, spell, gob });
             else
-                LOG_ERROR("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {}, Link Event {} found but has wrong type (should be 61, is {}).", e.entryOrGuid, e.GetScriptType(), e.event_id, e.link, linkedEvent.GetEventType());
+                LOG_ERROR("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {}, Link Event {} found but has wrong type (should be 61, is {}).", e.entryOrGuid, e.GetScriptType(), e.event_id, e.link, linkedEvent.holder->GetEventType());
         }
         else
             LOG_ERROR("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {}, Link Event {} not found, skipped.", e.entryOrGuid, e.GetScriptType(), e.event_id, e.link);
     }
 }
 
-void SmartScript::ProcessTimedAction(SmartScriptHolder& e, uint32 const& min, uint32 const& max, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
+void SmartScript::ProcessTimedAction(SmartScriptHolder const& e, SmartScriptEventState& state, uint32 const& min, uint32 const& max, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
     // xinef: extended by selfs victim
-    ConditionList const conds = sConditionMgr->GetConditionsForSmartEvent(e.entryOrGuid, e.event_id, e.source_type);
+    ConditionProgram const* conds = sConditionMgr->GetConditionProgramForSmartEvent(e.entryOrGuid, e.event_id, e.source_type);
     ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
 
     if (sConditionMgr->IsObjectMeetToConditions(info, conds))
     {
-        ProcessAction(e, unit, var0, var1, bvar, spell, gob);
-        RecalcTimer(e, min, max);
+        ProcessAction(e, state, unit, var0, var1, bvar, spell, gob);
+        RecalcTimer(state, min, max);
     }
     else
-        RecalcTimer(e, 5000, 5000);
+        RecalcTimer(state, 5000, 5000);
 }
 
 void SmartScript::InstallTemplate(SmartScriptHolder const& e)
@@ -3527,7 +3548,9 @@ void SmartScript::InstallTemplate(SmartScriptHolder const& e)
 
 void SmartScript::AddEvent(SMART_EVENT e, uint32 event_flags, uint32 event_param1, uint32 event_param2, uint32 event_param3, uint32 event_param4, uint32 event_param5, uint32 event_param6, SMART_ACTION action, uint32 action_param1, uint32 action_param2, uint32 action_param3, uint32 action_param4, uint32 action_param5, uint32 action_param6, SMARTAI_TARGETS t, uint32 target_param1, uint32 target_param2, uint32 target_param3, uint32 target_param4, uint32 phaseMask)
 {
-    mInstallEvents.push_back(CreateSmartEvent(e, event_flags, event_param1, event_param2, event_param3, event_param4, event_param5, event_param6, action, action_param1, action_param2, action_param3, action_param4, action_param5, action_param6, t, target_param1, target_param2, target_param3, target_param4, phaseMask));
+    SmartScriptHolder const& holder = mInstalledHolders.emplace_back(CreateSmartEvent(e, event_flags, event_param1, event_param2, event_param3, event_param4, event_param5, event_param6, action, action_param1, action_param2, action_param3, action_param4, action_param5, action_param6, t, target_param1, target_param2, target_param3, target_param4, phaseMask));
+    SmartScriptEvent& event = mInstallEvents.emplace_back(SmartScriptEvent{ &holder, SmartScriptEventState() });
+    InitTimer(holder, event.state);
 }
 
 SmartScriptHolder SmartScript::CreateSmartEvent(SMART_EVENT e, uint32 event_flags, uint32 event_param1, uint32 event_param2, uint32 event_param3, uint32 event_param4, uint32 event_param5, uint32 event_param6, SMART_ACTION action, uint32 action_param1, uint32 action_param2, uint32 action_param3, uint32 action_param4, uint32 action_param5, uint32 action_param6, SMARTAI_TARGETS t, uint32 target_param1, uint32 target_param2, uint32 target_param3, uint32 target_param4, uint32 phaseMask)
@@ -3559,7 +3582,6 @@ SmartScriptHolder SmartScript::CreateSmartEvent(SMART_EVENT e, uint32 event_flag
     script.target.raw.param4 = target_param4;
 
     script.source_type = SMART_SCRIPT_TYPE_CREATURE;
-    InitTimer(script);
     return script;
 }
 
@@ -4240,12 +4262,12 @@ void SmartScript::GetWorldObjectsInDist(ObjectVector& targets, float dist) const
     Cell::VisitObjects(obj, searcher, dist);
 }
 
-void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
+void SmartScript::ProcessEvent(SmartScriptHolder const& e, SmartScriptEventState& state, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
-    if (!e.active && e.GetEventType() != SMART_EVENT_LINK)
+    if (!state.active && e.GetEventType() != SMART_EVENT_LINK)
         return;
 
-    if ((e.event.event_phase_mask && !IsInPhase(e.event.event_phase_mask)) || ((e.event.event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE) && e.runOnce))
+    if ((e.event.event_phase_mask && !IsInPhase(e.event.event_phase_mask)) || ((e.event.event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE) && state.runOnce))
         return;
 
     if (!(e.event.event_flags & SMART_EVENT_FLAG_WHILE_CHARMED) && IsCharmedCreature(me))
@@ -4254,21 +4276,21 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
     switch (e.GetEventType())
     {
         case SMART_EVENT_LINK://special handling
-            ProcessAction(e, unit, var0, var1, bvar, spell, gob);
+            ProcessAction(e, state, unit, var0, var1, bvar, spell, gob);
             break;
         //called from Update tick
         case SMART_EVENT_UPDATE:
-            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            ProcessTimedAction(e, state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
             break;
         case SMART_EVENT_UPDATE_OOC:
             if (me && me->IsEngaged())
                 return;
-            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            ProcessTimedAction(e, state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
             break;
         case SMART_EVENT_UPDATE_IC:
             if (!me || !me->IsEngaged())
                 return;
-            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            ProcessTimedAction(e, state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
             break;
         case SMART_EVENT_HEALTH_PCT:
             {
@@ -4277,7 +4299,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 uint32 perc = (uint32)me->GetHealthPct();
                 if (perc > e.event.minMaxRepeat.max || perc < e.event.minMaxRepeat.min)
                     return;
-                ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+                ProcessTimedAction(e, state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
                 break;
             }
         case SMART_EVENT_TARGET_HEALTH_PCT:
@@ -4287,7 +4309,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 uint32 perc = (uint32)me->GetVictim()->GetHealthPct();
                 if (perc > e.event.minMaxRepeat.max || perc < e.event.minMaxRepeat.min)
                     return;
-                ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, me->GetVictim());
+                ProcessTimedAction(e, state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, me->GetVictim());
                 break;
             }
         case SMART_EVENT_MANA_PCT:
@@ -4297,7 +4319,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 uint32 perc = uint32(me->GetPowerPct(POWER_MANA));
                 if (perc > e.event.minMaxRepeat.max || perc < e.event.minMaxRepeat.min)
                     return;
-                ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+                ProcessTimedAction(e, state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
                 break;
             }
         case SMART_EVENT_TARGET_MANA_PCT:
@@ -4307,7 +4329,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 uint32 perc = uint32(me->GetVictim()->GetPowerPct(POWER_MANA));
                 if (perc > e.event.minMaxRepeat.max || perc < e.event.minMaxRepeat.min)
                     return;
-                ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, me->GetVictim());
+                ProcessTimedAction(e, state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, me->GetVictim());
                 break;
             }
         case SMART_EVENT_RANGE:
@@ -4316,9 +4338,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     return;
 
                 if (me->IsInRange(me->GetVictim(), (float)e.event.minMaxRepeat.rangeMin, (float)e.event.minMaxRepeat.rangeMax))
-                    ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, me->GetVictim());
+                    ProcessTimedAction(e, state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, me->GetVictim());
                 else
-                    RecalcTimer(e, 1200, 1200); // make it predictable
+                    RecalcTimer(state, 1200, 1200); // make it predictable
 
                 break;
             }
@@ -4337,7 +4359,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                         if (currSpell->m_spellInfo->Id != e.event.targetCasting.spellId)
                             return;
 
-                ProcessTimedAction(e, e.event.targetCasting.repeatMin, e.event.targetCasting.repeatMax, me->GetVictim());
+                ProcessTimedAction(e, state, e.event.targetCasting.repeatMin, e.event.targetCasting.repeatMax, me->GetVictim());
                 break;
             }
         case SMART_EVENT_FRIENDLY_HEALTH:
@@ -4349,10 +4371,10 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!target || !target->IsInCombat())
                 {
                     // Xinef: if there are at least two same npcs, they will perform the same action immediately even if this is useless...
-                    RecalcTimer(e, 1000, 3000);
+                    RecalcTimer(state, 1000, 3000);
                     return;
                 }
-                ProcessTimedAction(e, e.event.friendlyHealth.repeatMin, e.event.friendlyHealth.repeatMax, target);
+                ProcessTimedAction(e, state, e.event.friendlyHealth.repeatMin, e.event.friendlyHealth.repeatMax, target);
                 break;
             }
         case SMART_EVENT_FRIENDLY_IS_CC:
@@ -4365,10 +4387,10 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (creatures.empty())
                 {
                     // Xinef: if there are at least two same npcs, they will perform the same action immediately even if this is useless...
-                    RecalcTimer(e, 1000, 3000);
+                    RecalcTimer(state, 1000, 3000);
                     return;
                 }
-                ProcessTimedAction(e, e.event.friendlyCC.repeatMin, e.event.friendlyCC.repeatMax, Acore::Containers::SelectRandomContainerElement(creatures));
+                ProcessTimedAction(e, state, e.event.friendlyCC.repeatMin, e.event.friendlyCC.repeatMax, Acore::Containers::SelectRandomContainerElement(creatures));
                 break;
             }
         case SMART_EVENT_FRIENDLY_MISSING_BUFF:
@@ -4384,7 +4406,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             if (creatures.empty())
                 return;
 
-            ProcessTimedAction(e, e.event.missingBuff.repeatMin, e.event.missingBuff.repeatMax, Acore::Containers::SelectRandomContainerElement(creatures));
+            ProcessTimedAction(e, state, e.event.missingBuff.repeatMin, e.event.missingBuff.repeatMax, Acore::Containers::SelectRandomContainerElement(creatures));
             break;
         }
         case SMART_EVENT_HAS_AURA:
@@ -4393,7 +4415,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     return;
                 uint32 count = me->GetAuraCount(e.event.aura.spell);
                 if ((!e.event.aura.count && !count) || (e.event.aura.count && count >= e.event.aura.count))
-                    ProcessTimedAction(e, e.event.aura.repeatMin, e.event.aura.repeatMax);
+                    ProcessTimedAction(e, state, e.event.aura.repeatMin, e.event.aura.repeatMax);
                 break;
             }
         case SMART_EVENT_TARGET_BUFFED:
@@ -4403,13 +4425,13 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 uint32 count = me->GetVictim()->GetAuraCount(e.event.aura.spell);
                 if (count < e.event.aura.count)
                     return;
-                ProcessTimedAction(e, e.event.aura.repeatMin, e.event.aura.repeatMax, me->GetVictim());
+                ProcessTimedAction(e, state, e.event.aura.repeatMin, e.event.aura.repeatMax, me->GetVictim());
                 break;
             }
         case SMART_EVENT_CHARMED:
             {
                 if (bvar == (e.event.charm.onRemove != 1))
-                    ProcessAction(e, unit, var0, var1, bvar, spell, gob);
+                    ProcessAction(e, state, unit, var0, var1, bvar, spell, gob);
                 break;
             }
         //no params
@@ -4432,7 +4454,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         case SMART_EVENT_JUST_CREATED:
         case SMART_EVENT_FOLLOW_COMPLETED:
         case SMART_EVENT_ON_SPELLCLICK:
-            ProcessAction(e, unit, var0, var1, bvar, spell, gob);
+            ProcessAction(e, state, unit, var0, var1, bvar, spell, gob);
             break;
 
         case SMART_EVENT_GOSSIP_HELLO:
@@ -4460,7 +4482,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 break;
             }
 
-            ProcessAction(e, unit, var0, var1, bvar, spell, gob);
+            ProcessAction(e, state, unit, var0, var1, bvar, spell, gob);
             break;
         case SMART_EVENT_IS_BEHIND_TARGET:
             {
@@ -4471,7 +4493,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 {
                     if (e.event.minMaxRepeat.rangeMax && (me->IsInRange(victim, (float)e.event.minMaxRepeat.rangeMin, (float)e.event.minMaxRepeat.rangeMax)))
                         if (!victim->HasInArc(static_cast<float>(M_PI), me))
-                            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, victim);
+                            ProcessTimedAction(e, state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, victim);
                 }
 
                 break;
@@ -4484,15 +4506,15 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (Unit* victim = me->GetVictim())
                     if ((!e.event.meleeRange.invert && me->IsWithinMeleeRange(victim, static_cast<float>(e.event.meleeRange.dist))) ||
                         (e.event.meleeRange.invert && !me->IsWithinMeleeRange(victim, static_cast<float>(e.event.meleeRange.dist))))
-                        ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, victim);
+                        ProcessTimedAction(e, state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, victim);
 
                 break;
             }
         case SMART_EVENT_RECEIVE_EMOTE:
             if (e.event.emote.emote == var0)
             {
-                ProcessAction(e, unit);
-                RecalcTimer(e, e.event.emote.cooldownMin, e.event.emote.cooldownMax);
+                ProcessAction(e, state, unit);
+                RecalcTimer(state, e.event.emote.cooldownMin, e.event.emote.cooldownMax);
             }
             break;
         case SMART_EVENT_KILL:
@@ -4503,8 +4525,8 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     return;
                 if (e.event.kill.creature && unit->GetEntry() != e.event.kill.creature)
                     return;
-                RecalcTimer(e, e.event.kill.cooldownMin, e.event.kill.cooldownMax);
-                ProcessAction(e, unit);
+                RecalcTimer(state, e.event.kill.cooldownMin, e.event.kill.cooldownMax);
+                ProcessAction(e, state, unit);
                 break;
             }
         case SMART_EVENT_SPELLHIT_TARGET:
@@ -4515,8 +4537,8 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if ((!e.event.spellHit.spell || spell->Id == e.event.spellHit.spell) &&
                         (!e.event.spellHit.school || (spell->SchoolMask & e.event.spellHit.school)))
                 {
-                    RecalcTimer(e, e.event.spellHit.cooldownMin, e.event.spellHit.cooldownMax);
-                    ProcessAction(e, unit, 0, 0, bvar, spell);
+                    RecalcTimer(state, e.event.spellHit.cooldownMin, e.event.spellHit.cooldownMax);
+                    ProcessAction(e, state, unit, 0, 0, bvar, spell);
                 }
                 break;
             }
@@ -4538,8 +4560,8 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     {
                         if (e.event.los.playerOnly && !unit->IsPlayer())
                             return;
-                        RecalcTimer(e, e.event.los.cooldownMin, e.event.los.cooldownMax);
-                        ProcessAction(e, unit);
+                        RecalcTimer(state, e.event.los.cooldownMin, e.event.los.cooldownMax);
+                        ProcessAction(e, state, unit);
                     }
                 }
                 break;
@@ -4562,8 +4584,8 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     {
                         if (e.event.los.playerOnly && !unit->IsPlayer())
                             return;
-                        RecalcTimer(e, e.event.los.cooldownMin, e.event.los.cooldownMax);
-                        ProcessAction(e, unit);
+                        RecalcTimer(state, e.event.los.cooldownMin, e.event.los.cooldownMax);
+                        ProcessAction(e, state, unit);
                     }
                 }
                 break;
@@ -4576,7 +4598,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     return;
                 if (e.event.respawn.type == SMART_SCRIPT_RESPAWN_CONDITION_AREA && GetBaseObject()->GetZoneId() != e.event.respawn.area)
                     return;
-                ProcessAction(e);
+                ProcessAction(e, state);
                 break;
             }
         case SMART_EVENT_SUMMONED_UNIT:
@@ -4587,8 +4609,8 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     return;
                 if (e.event.summoned.creature && unit->GetEntry() != e.event.summoned.creature)
                     return;
-                RecalcTimer(e, e.event.summoned.cooldownMin, e.event.summoned.cooldownMax);
-                ProcessAction(e, unit);
+                RecalcTimer(state, e.event.summoned.cooldownMin, e.event.summoned.cooldownMax);
+                ProcessAction(e, state, unit);
                 break;
             }
         case SMART_EVENT_RECEIVE_HEAL:
@@ -4596,8 +4618,8 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             {
                 if (var0 > e.event.minMaxRepeat.max || var0 < e.event.minMaxRepeat.min)
                     return;
-                RecalcTimer(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
-                ProcessAction(e, unit);
+                RecalcTimer(state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+                ProcessAction(e, state, unit);
                 break;
             }
         case SMART_EVENT_DAMAGED:
@@ -4608,14 +4630,14 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                         return;
                     if (!me->HealthBelowPctDamaged(e.event.minMaxRepeat.rangeMin, var0))
                         return;
-                    ProcessAction(e, unit);
+                    ProcessAction(e, state, unit);
                 }
                 else
                 {
                     if (var0 > e.event.minMaxRepeat.max || var0 < e.event.minMaxRepeat.min)
                         return;
-                    RecalcTimer(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
-                    ProcessAction(e, unit);
+                    RecalcTimer(state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+                    ProcessAction(e, state, unit);
                 }
                 break;
             }
@@ -4625,7 +4647,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     return;
                 if (e.event.movementInform.pathId != 0 && e.event.movementInform.pathId != me->GetWaypointPath())
                     return;
-                ProcessAction(e, unit, var0, var1);
+                ProcessAction(e, state, unit, var0, var1);
                 break;
             }
         case SMART_EVENT_TRANSPORT_RELOCATE:
@@ -4633,7 +4655,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             {
                 if (e.event.waypoint.pathID && var0 != e.event.waypoint.pathID)
                     return;
-                ProcessAction(e, unit, var0);
+                ProcessAction(e, state, unit, var0);
                 break;
             }
         case SMART_EVENT_ESCORT_REACHED:
@@ -4644,23 +4666,23 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             {
                 if (!me || (e.event.waypoint.pointID && var0 != e.event.waypoint.pointID) || (e.event.waypoint.pathID && GetPathId() != e.event.waypoint.pathID))
                     return;
-                ProcessAction(e, unit);
+                ProcessAction(e, state, unit);
                 break;
             }
         case SMART_EVENT_SUMMON_DESPAWNED:
             {
                 if (e.event.summoned.creature && e.event.summoned.creature != var0)
                     return;
-                RecalcTimer(e, e.event.summoned.cooldownMin, e.event.summoned.cooldownMax);
-                ProcessAction(e, unit, var0);
+                RecalcTimer(state, e.event.summoned.cooldownMin, e.event.summoned.cooldownMax);
+                ProcessAction(e, state, unit, var0);
                 break;
             }
         case SMART_EVENT_INSTANCE_PLAYER_ENTER:
             {
                 if (e.event.instancePlayerEnter.team && var0 != e.event.instancePlayerEnter.team)
                     return;
-                RecalcTimer(e, e.event.instancePlayerEnter.cooldownMin, e.event.instancePlayerEnter.cooldownMax);
-                ProcessAction(e, unit, var0);
+                RecalcTimer(state, e.event.instancePlayerEnter.cooldownMin, e.event.instancePlayerEnter.cooldownMax);
+                ProcessAction(e, state, unit, var0);
                 break;
             }
         case SMART_EVENT_ACCEPTED_QUEST:
@@ -4668,37 +4690,37 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             {
                 if (e.event.quest.quest && var0 != e.event.quest.quest)
                     return;
-                RecalcTimer(e, e.event.quest.cooldownMin, e.event.quest.cooldownMax);
-                ProcessAction(e, unit, var0);
+                RecalcTimer(state, e.event.quest.cooldownMin, e.event.quest.cooldownMax);
+                ProcessAction(e, state, unit, var0);
                 break;
             }
         case SMART_EVENT_TRANSPORT_ADDCREATURE:
             {
                 if (e.event.transportAddCreature.creature && var0 != e.event.transportAddCreature.creature)
                     return;
-                ProcessAction(e, unit, var0);
+                ProcessAction(e, state, unit, var0);
                 break;
             }
         case SMART_EVENT_AREATRIGGER_ONTRIGGER:
             {
                 if (e.event.areatrigger.id && var0 != e.event.areatrigger.id)
                     return;
-                ProcessAction(e, unit, var0);
+                ProcessAction(e, state, unit, var0);
                 break;
             }
         case SMART_EVENT_TEXT_OVER:
             {
                 if (var0 != e.event.textOver.textGroupID || (e.event.textOver.creatureEntry && e.event.textOver.creatureEntry != var1))
                     return;
-                ProcessAction(e, unit, var0);
+                ProcessAction(e, state, unit, var0);
                 break;
             }
         case SMART_EVENT_DATA_SET:
             {
                 if (e.event.dataSet.id != var0 || e.event.dataSet.value != var1)
                     return;
-                RecalcTimer(e, e.event.dataSet.cooldownMin, e.event.dataSet.cooldownMax);
-                ProcessAction(e, unit, var0, var1, false, nullptr, gob);
+                RecalcTimer(state, e.event.dataSet.cooldownMin, e.event.dataSet.cooldownMax);
+                ProcessAction(e, state, unit, var0, var1, false, nullptr, gob);
                 break;
             }
         case SMART_EVENT_PASSENGER_REMOVED:
@@ -4706,14 +4728,14 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             {
                 if (!unit)
                     return;
-                RecalcTimer(e, e.event.minMax.repeatMin, e.event.minMax.repeatMax);
-                ProcessAction(e, unit);
+                RecalcTimer(state, e.event.minMax.repeatMin, e.event.minMax.repeatMax);
+                ProcessAction(e, state, unit);
                 break;
             }
         case SMART_EVENT_TIMED_EVENT_TRIGGERED:
             {
                 if (e.event.timedEvent.id == var0)
-                    ProcessAction(e, unit);
+                    ProcessAction(e, state, unit);
                 break;
             }
         case SMART_EVENT_GOSSIP_SELECT:
@@ -4721,7 +4743,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 LOG_DEBUG("sql.sql", "SmartScript: Gossip Select:  menu {} action {}", var0, var1); //little help for scripters
                 if (e.event.gossip.sender != var0 || e.event.gossip.action != var1)
                     return;
-                ProcessAction(e, unit, var0, var1);
+                ProcessAction(e, state, unit, var0, var1);
                 break;
             }
         case SMART_EVENT_EVENT_PHASE_CHANGE:
@@ -4729,7 +4751,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!IsInPhase(e.event.eventPhaseChange.phasemask))
                     return;
 
-                ProcessAction(e);
+                ProcessAction(e, state);
                 break;
             }
         case SMART_EVENT_GAME_EVENT_START:
@@ -4737,29 +4759,29 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             {
                 if (e.event.gameEvent.gameEventId != var0)
                     return;
-                ProcessAction(e, nullptr, var0);
+                ProcessAction(e, state, nullptr, var0);
                 break;
             }
         case SMART_EVENT_GO_STATE_CHANGED:
             {
                 if (e.event.goStateChanged.state != var0)
                     return;
-                ProcessAction(e, unit, var0, var1);
+                ProcessAction(e, state, unit, var0, var1);
                 break;
             }
         case SMART_EVENT_GO_EVENT_INFORM:
             {
                 if (e.event.eventInform.eventId != var0)
                     return;
-                ProcessAction(e, nullptr, var0);
+                ProcessAction(e, state, nullptr, var0);
                 break;
             }
         case SMART_EVENT_ACTION_DONE:
             {
                 if (e.event.doAction.eventId != var0)
                     return;
-                RecalcTimer(e, e.event.doAction.cooldownMin, e.event.doAction.cooldownMax);
-                ProcessAction(e, unit, var0);
+                RecalcTimer(state, e.event.doAction.cooldownMin, e.event.doAction.cooldownMax);
+                ProcessAction(e, state, unit, var0);
                 break;
             }
         case SMART_EVENT_FRIENDLY_HEALTH_PCT:
@@ -4808,7 +4830,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!unitTarget)
                     return;
 
-                ProcessTimedAction(e, e.event.friendlyHealthPct.repeatMin, e.event.friendlyHealthPct.repeatMax, unitTarget);
+                ProcessTimedAction(e, state, e.event.friendlyHealthPct.repeatMin, e.event.friendlyHealthPct.repeatMax, unitTarget);
                 break;
             }
         case SMART_EVENT_DISTANCE_CREATURE:
@@ -4838,7 +4860,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 }
 
                 if (creature)
-                    ProcessTimedAction(e, e.event.distance.repeat, e.event.distance.repeat);
+                    ProcessTimedAction(e, state, e.event.distance.repeat, e.event.distance.repeat);
 
                 break;
             }
@@ -4869,7 +4891,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 }
 
                 if (gameobject)
-                    ProcessTimedAction(e, e.event.distance.repeat, e.event.distance.repeat);
+                    ProcessTimedAction(e, state, e.event.distance.repeat, e.event.distance.repeat);
 
                 break;
             }
@@ -4877,7 +4899,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             if (e.event.counter.id != var0 || GetCounterValue(e.event.counter.id) != e.event.counter.value)
                 return;
 
-            ProcessTimedAction(e, e.event.counter.cooldownMin, e.event.counter.cooldownMax);
+            ProcessTimedAction(e, state, e.event.counter.cooldownMin, e.event.counter.cooldownMax);
             break;
         case SMART_EVENT_NEAR_PLAYERS:
         {
@@ -4892,9 +4914,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                         playerCount++;
 
                 if (playerCount >= e.event.nearPlayer.minCount)
-                    ProcessAction(e, unit);
+                    ProcessAction(e, state, unit);
             }
-            RecalcTimer(e, e.event.nearPlayer.repeatMin, e.event.nearPlayer.repeatMax);
+            RecalcTimer(state, e.event.nearPlayer.repeatMin, e.event.nearPlayer.repeatMax);
             break;
         }
         case SMART_EVENT_NEAR_PLAYERS_NEGATION:
@@ -4910,9 +4932,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                         playerCount++;
 
                 if (playerCount < e.event.nearPlayerNegation.maxCount)
-                    ProcessAction(e, unit);
+                    ProcessAction(e, state, unit);
             }
-            RecalcTimer(e, e.event.nearPlayerNegation.repeatMin, e.event.nearPlayerNegation.repeatMax);
+            RecalcTimer(state, e.event.nearPlayerNegation.repeatMin, e.event.nearPlayerNegation.repeatMax);
             break;
         }
         case SMART_EVENT_NEAR_UNIT:
@@ -4941,9 +4963,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 }
 
                 if (unitCount >= e.event.nearUnit.count)
-                    ProcessAction(e, unit);
+                    ProcessAction(e, state, unit);
             }
-            RecalcTimer(e, e.event.nearUnit.timer, e.event.nearUnit.timer);
+            RecalcTimer(state, e.event.nearUnit.timer, e.event.nearUnit.timer);
             break;
         }
         case SMART_EVENT_NEAR_UNIT_NEGATION:
@@ -4972,9 +4994,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 }
 
                 if (unitCount < e.event.nearUnitNegation.count)
-                    ProcessAction(e, unit);
+                    ProcessAction(e, state, unit);
             }
-            RecalcTimer(e, e.event.nearUnitNegation.timer, e.event.nearUnitNegation.timer);
+            RecalcTimer(state, e.event.nearUnitNegation.timer, e.event.nearUnitNegation.timer);
             break;
         }
         case SMART_EVENT_AREA_CASTING:
@@ -4992,14 +5014,14 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     if (!(me->IsInRange(target, (float)e.event.minMaxRepeat.rangeMin, (float)e.event.minMaxRepeat.rangeMax)))
                         continue;
 
-                    ProcessAction(e, target);
-                    RecalcTimer(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+                    ProcessAction(e, state, target);
+                    RecalcTimer(state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
                     return;
                 }
             }
 
             // No targets found
-            RecalcTimer(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            RecalcTimer(state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
 
             break;
         }
@@ -5015,14 +5037,14 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     if (!(me->IsInRange(target, (float)e.event.minMaxRepeat.rangeMin, (float)e.event.minMaxRepeat.rangeMax)))
                         continue;
 
-                    ProcessAction(e, target);
-                    RecalcTimer(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+                    ProcessAction(e, state, target);
+                    RecalcTimer(state, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
                     return;
                 }
             }
 
             // If no targets are found and it's off cooldown, check again
-            RecalcTimer(e, 1200, 1200);
+            RecalcTimer(state, 1200, 1200);
             break;
         }
         case SMART_EVENT_WAYPOINT_REACHED:
@@ -5030,7 +5052,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         {
             if (!me || (e.event.wpData.pointId && var0 != e.event.wpData.pointId) || (e.event.wpData.pathId && me->GetWaypointPath() != e.event.wpData.pathId))
                 return;
-            ProcessAction(e, unit);
+            ProcessAction(e, state, unit);
             break;
         }
         default:
@@ -5039,14 +5061,14 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
     }
 }
 
-void SmartScript::InitTimer(SmartScriptHolder& e)
+void SmartScript::InitTimer(SmartScriptHolder const& e, SmartScriptEventState& state)
 {
     switch (e.GetEventType())
     {
         //set only events which have initial timers
         case SMART_EVENT_NEAR_PLAYERS:
         case SMART_EVENT_NEAR_PLAYERS_NEGATION:
-            RecalcTimer(e, e.event.nearPlayer.firstTimer, e.event.nearPlayer.firstTimer);
+            RecalcTimer(state, e.event.nearPlayer.firstTimer, e.event.nearPlayer.firstTimer);
             break;
         case SMART_EVENT_UPDATE:
         case SMART_EVENT_UPDATE_IC:
@@ -5057,29 +5079,29 @@ void SmartScript::InitTimer(SmartScriptHolder& e)
         case SMART_EVENT_IS_BEHIND_TARGET:
         case SMART_EVENT_FRIENDLY_HEALTH_PCT:
         case SMART_EVENT_IS_IN_MELEE_RANGE:
-            RecalcTimer(e, e.event.minMaxRepeat.min, e.event.minMaxRepeat.max);
+            RecalcTimer(state, e.event.minMaxRepeat.min, e.event.minMaxRepeat.max);
             break;
         case SMART_EVENT_DISTANCE_CREATURE:
         case SMART_EVENT_DISTANCE_GAMEOBJECT:
-            RecalcTimer(e, e.event.distance.repeat, e.event.distance.repeat);
+            RecalcTimer(state, e.event.distance.repeat, e.event.distance.repeat);
             break;
         case SMART_EVENT_NEAR_UNIT:
         case SMART_EVENT_NEAR_UNIT_NEGATION:
-            RecalcTimer(e, e.event.nearUnit.timer, e.event.nearUnit.timer);
+            RecalcTimer(state, e.event.nearUnit.timer, e.event.nearUnit.timer);
             break;
         default:
-            e.active = true;
+            state.active = true;
             break;
     }
 }
-void SmartScript::RecalcTimer(SmartScriptHolder& e, uint32 min, uint32 max)
+void SmartScript::RecalcTimer(SmartScriptEventState& state, uint32 min, uint32 max)
 {
     // min/max was checked at loading!
-    e.timer = urand(uint32(min), uint32(max));
-    e.active = e.timer ? false : true;
+    state.timer = urand(uint32(min), uint32(max));
+    state.active = state.timer ? false : true;
 }
 
-void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
+void SmartScript::UpdateTimer(SmartScriptHolder const& e, SmartScriptEventState& state, uint32 const diff)
 {
     if (e.GetEventType() == SMART_EVENT_LINK)
         return;
@@ -5093,7 +5115,7 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
     if (e.GetEventType() == SMART_EVENT_UPDATE_OOC && (me && me->IsEngaged()))//can be used with me=nullptr (go script)
         return;
 
-    if (e.timer < diff)
+    if (state.timer < diff)
     {
         // delay spell cast for another AI tick if another spell is being cast
         if (e.GetActionType() == SMART_ACTION_CAST)
@@ -5102,7 +5124,7 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
             {
                 if (me && me->IsActionPreventedByCasting())
                 {
-                    RaisePriority(e);
+                    RaisePriority(state);
                     return;
                 }
             }
@@ -5111,11 +5133,11 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
         // Delay flee for assist event if casting
         if (e.GetActionType() == SMART_ACTION_FLEE_FOR_ASSIST && me && me->IsActionPreventedByCasting())
         {
-            e.timer = 1200;
+            state.timer = 1200;
             return;
         } // @TODO: Can't these be handled by the action themselves instead? Less expensive
 
-        e.active = true;//activate events with cooldown
+        state.active = true;//activate events with cooldown
         switch (e.GetEventType())//process ONLY timed events
         {
             case SMART_EVENT_NEAR_PLAYERS:
@@ -5145,22 +5167,22 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
             case SMART_EVENT_IS_IN_MELEE_RANGE:
                 {
                     ASSERT(executionStack.empty());
-                    executionStack.emplace_back(SmartScriptFrame{ e, nullptr, 0, 0, false, nullptr, nullptr });
+                    executionStack.emplace_back(SmartScriptFrame{ e, state, nullptr, 0, 0, false, nullptr, nullptr });
                     while (!executionStack.empty())
                     {
-                        auto [stack_holder, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
+                        auto [stack_holder, stack_state, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
                         executionStack.pop_back();
-                        ProcessEvent(stack_holder, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
+                        ProcessEvent(stack_holder, stack_state, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
                     }
                     if (e.GetScriptType() == SMART_SCRIPT_TYPE_TIMED_ACTIONLIST)
                     {
-                        e.enableTimed = false;//disable event if it is in an ActionList and was processed once
-                        for (SmartAIEventList::iterator i = mTimedActionList.begin(); i != mTimedActionList.end(); ++i)
+                        state.enableTimed = false;//disable event if it is in an ActionList and was processed once
+                        for (SmartScriptEventList::iterator i = mTimedActionList.begin(); i != mTimedActionList.end(); ++i)
                         {
                             //find the first event which is not the current one and enable it
-                            if (i->event_id > e.event_id)
+                            if (i->holder->event_id > e.event_id)
                             {
-                                i->enableTimed = true;
+                                i->state.enableTimed = true;
                                 break;
                             }
                         }
@@ -5169,35 +5191,36 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
                 }
         }
 
-        if (e.priority != SmartScriptHolder::DEFAULT_PRIORITY)
+        if (state.priority != SmartScriptEventState::DEFAULT_PRIORITY)
         {
             // Reset priority to default one only if the event hasn't been rescheduled again to next loop
-            if (e.timer > 1)
+            if (state.timer > 1)
             {
                 // Re-sort events if this was moved to the top of the queue
                 mEventSortingRequired = true;
                 // Reset priority to default one
-                e.priority = SmartScriptHolder::DEFAULT_PRIORITY;
+                state.priority = SmartScriptEventState::DEFAULT_PRIORITY;
             }
         }
     }
     else
-        e.timer -= diff;
+        state.timer -= diff;
 }
 
-bool SmartScript::CheckTimer(SmartScriptHolder const& e) const
+bool SmartScript::CheckTimer(SmartScriptEventState const& state) const
 {
-    return e.active;
+    return state.active;
 }
 
 void SmartScript::InstallEvents()
 {
     if (!mInstallEvents.empty())
     {
-        for (SmartAIEventList::iterator i = mInstallEvents.begin(); i != mInstallEvents.end(); ++i)
+        for (SmartScriptEventList::iterator i = mInstallEvents.begin(); i != mInstallEvents.end(); ++i)
             mEvents.push_back(*i);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        BuildEventIndex();
     }
 }
 
@@ -5214,8 +5237,8 @@ void SmartScript::OnUpdate(uint32 const diff)
         mEventSortingRequired = false;
     }
 
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
-        UpdateTimer(*i, diff);
+    for (SmartScriptEvent& event : mEvents)
+        UpdateTimer(*event.holder, event.state, diff);
 
     if (!mStoredEvents.empty())
     {
@@ -5223,7 +5246,7 @@ void SmartScript::OnUpdate(uint32 const diff)
         for (i = mStoredEvents.begin(); i != mStoredEvents.end();)
         {
             icurr = i++;
-            UpdateTimer(*icurr, diff);
+            UpdateTimer(icurr->holder, icurr->state, diff);
         }
     }
 
@@ -5231,11 +5254,11 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (!mTimedActionList.empty())
     {
         isProcessingTimedActionList = true;
-        for (SmartAIEventList::iterator i = mTimedActionList.begin(); i != mTimedActionList.end(); ++i)
+        for (SmartScriptEvent& event : mTimedActionList)
         {
-            if ((*i).enableTimed)
+            if (event.state.enableTimed)
             {
-                UpdateTimer(*i, diff);
+                UpdateTimer(*event.holder, event.state, diff);
                 needCleanup = false;
             }
         }
@@ -5243,7 +5266,10 @@ void SmartScript::OnUpdate(uint32 const diff)
         isProcessingTimedActionList = false;
     }
     if (needCleanup)
+    {
         mTimedActionList.clear();
+        mTimedActionHolders.clear();
+    }
 
     if (!mRemIDs.empty())
     {
@@ -5269,38 +5295,53 @@ void SmartScript::OnUpdate(uint32 const diff)
     }
 }
 
-void SmartScript::SortEvents(SmartAIEventList& events)
+void SmartScript::SortEvents(SmartScriptEventList& events)
 {
     std::sort(events.begin(), events.end());
+    BuildEventIndex();
 }
 
-void SmartScript::RaisePriority(SmartScriptHolder& e)
+void SmartScript::BuildEventIndex()
 {
-    e.timer = 1200;
+    ASSERT(mEvents.size() <= std::numeric_limits<uint16>::max());
+
+    mEventIndex.clear();
+    for (std::size_t i = 0; i < mEvents.size(); ++i)
+        if (mEvents[i].holder->GetEventType() != SMART_EVENT_LINK)
+            mEventIndex.emplace_back(uint16(mEvents[i].holder->GetEventType()), uint16(i));
+
+    // ordered by event type first, then by position so every bucket keeps the processing order of mEvents
+    std::sort(mEventIndex.begin(), mEventIndex.end());
+    mEventIndex.shrink_to_fit();
+}
+
+void SmartScript::RaisePriority(SmartScriptEventState& state)
+{
+    state.timer = 1200;
     // Change priority only if it's set to default, otherwise keep the current order of events
-    if (e.priority == SmartScriptHolder::DEFAULT_PRIORITY)
+    if (state.priority == SmartScriptEventState::DEFAULT_PRIORITY)
     {
-        e.priority = mCurrentPriority++;
+        state.priority = mCurrentPriority++;
         mEventSortingRequired = true;
     }
 }
 
-void SmartScript::RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll)
+void SmartScript::RetryLater(SmartScriptEventState& state, bool ignoreChanceRoll)
 {
-    RaisePriority(e);
+    RaisePriority(state);
 
     // This allows to retry the action later without rolling again the chance roll (which might fail and end up not executing the action)
     if (ignoreChanceRoll)
-        e.event.event_flags |= SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL;
+        state.ignoreChanceRoll = true;
 
-    e.runOnce = false;
+    state.runOnce = false;
 }
 
-void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger const* at)
+void SmartScript::FillScript(SmartAIEventListPtr e, WorldObject* obj, AreaTrigger const* at)
 {
     (void)at; // ensure that the variable is referenced even if extra logs are disabled in order to pass compiler checks
 
-    if (e.empty())
+    if (!e || e->empty())
     {
         if (obj)
             LOG_DEBUG("sql.sql", "SmartScript: EventMap for Entry {} is empty but is using SmartScript.", obj->GetEntry());
@@ -5309,36 +5350,41 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger c
             LOG_DEBUG("sql.sql", "SmartScript: EventMap for AreaTrigger {} is empty but is using SmartScript.", at->entry);
         return;
     }
-    for (SmartAIEventList::iterator i = e.begin(); i != e.end(); ++i)
+    // keep the shared events alive for as long as this script uses them, reloading the store replaces them
+    mScripts.push_back(e);
+
+    for (SmartScriptHolder const& holder : *e)
     {
 #ifndef ACORE_DEBUG
-        if ((*i).event.event_flags & SMART_EVENT_FLAG_DEBUG_ONLY)
+        if (holder.event.event_flags & SMART_EVENT_FLAG_DEBUG_ONLY)
             continue;
 #endif
 
-        if ((*i).event.event_flags & SMART_EVENT_FLAG_DIFFICULTY_ALL)//if has instance flag add only if in it
+        if (holder.event.event_flags & SMART_EVENT_FLAG_DIFFICULTY_ALL)//if has instance flag add only if in it
         {
             if (obj && obj->GetMap()->IsDungeon())
             {
-                if ((1 << (obj->GetMap()->GetSpawnMode() + 1)) & (*i).event.event_flags)
+                if ((1 << (obj->GetMap()->GetSpawnMode() + 1)) & holder.event.event_flags)
                 {
-                    mEvents.push_back((*i));
+                    mEvents.push_back(SmartScriptEvent{ &holder, SmartScriptEventState() });
                 }
             }
             continue;
         }
-        mEvents.push_back((*i));//NOTE: 'world(0)' events still get processed in ANY instance mode
+        mEvents.push_back(SmartScriptEvent{ &holder, SmartScriptEventState() });//NOTE: 'world(0)' events still get processed in ANY instance mode
     }
+
+    BuildEventIndex();
 }
 
 void SmartScript::GetScript()
 {
-    SmartAIEventList e;
+    SmartAIEventListPtr e;
     if (me)
     {
-        e = sSmartScriptMgr->GetScript(-((int32)me->GetSpawnId()), mScriptType);
-        if (e.empty())
-            e = sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType);
+        e = sSmartScriptMgr->GetSharedScript(-((int32)me->GetSpawnId()), mScriptType);
+        if (!e || e->empty())
+            e = sSmartScriptMgr->GetSharedScript((int32)me->GetEntry(), mScriptType);
 
         FillScript(e, me, nullptr);
 
@@ -5346,21 +5392,21 @@ void SmartScript::GetScript()
         {
             if (cInfo->HasFlagsExtra(CREATURE_FLAG_EXTRA_DONT_OVERRIDE_ENTRY_SAI))
             {
-                e = sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType);
+                e = sSmartScriptMgr->GetSharedScript((int32)me->GetEntry(), mScriptType);
                 FillScript(e, me, nullptr);
             }
         }
     }
     else if (go)
     {
-        e = sSmartScriptMgr->GetScript(-((int32)go->GetSpawnId()), mScriptType);
-        if (e.empty())
-            e = sSmartScriptMgr->GetScript((int32)go->GetEntry(), mScriptType);
+        e = sSmartScriptMgr->GetSharedScript(-((int32)go->GetSpawnId()), mScriptType);
+        if (!e || e->empty())
+            e = sSmartScriptMgr->GetSharedScript((int32)go->GetEntry(), mScriptType);
         FillScript(e, go, nullptr);
     }
     else if (trigger)
     {
-        e = sSmartScriptMgr->GetScript((int32)trigger->entry, mScriptType);
+        e = sSmartScriptMgr->GetSharedScript((int32)trigger->entry, mScriptType);
         FillScript(e, nullptr, trigger);
     }
 }
@@ -5400,8 +5446,8 @@ void SmartScript::OnInitialize(WorldObject* obj, AreaTrigger const* at)
 
     GetScript();//load copy of script
 
-    for (SmartScriptHolder& event : mEvents)
-        InitTimer(event);//calculate timers for first time use
+    for (SmartScriptEvent& event : mEvents)
+        InitTimer(*event.holder, event.state);//calculate timers for first time use
 
     ProcessEventsFor(SMART_EVENT_AI_INIT);
     InstallEvents();
@@ -5520,7 +5566,7 @@ Unit* SmartScript::DoFindClosestFriendlyInRange(float range, bool playerOnly) co
     return unit;
 }
 
-void SmartScript::SetScript9(SmartScriptHolder& e, uint32 entry)
+void SmartScript::SetScript9(SmartScriptHolder const& e, uint32 entry)
 {
     //do NOT clear mTimedActionList if it's being iterated because it will invalidate the iterator and delete
     // any SmartScriptHolder contained like the "e" parameter passed to this function
@@ -5536,13 +5582,15 @@ void SmartScript::SetScript9(SmartScriptHolder& e, uint32 entry)
         return;
     }
 
+    // the timer type depends on the caller, so the action list keeps its own copy of the holders
     mTimedActionList.clear();
-    mTimedActionList = sSmartScriptMgr->GetScript(entry, SMART_SCRIPT_TYPE_TIMED_ACTIONLIST);
-    if (mTimedActionList.empty())
+    mTimedActionHolders = sSmartScriptMgr->GetScript(entry, SMART_SCRIPT_TYPE_TIMED_ACTIONLIST);
+    if (mTimedActionHolders.empty())
         return;
-    for (SmartAIEventList::iterator i = mTimedActionList.begin(); i != mTimedActionList.end(); ++i)
+    for (SmartAIEventList::iterator i = mTimedActionHolders.begin(); i != mTimedActionHolders.end(); ++i)
     {
-        i->enableTimed = i == mTimedActionList.begin();//enable processing only for the first action
+        SmartScriptEvent& event = mTimedActionList.emplace_back(SmartScriptEvent{ &*i, SmartScriptEventState() });
+        event.state.enableTimed = i == mTimedActionHolders.begin();//enable processing only for the first action
 
         if (e.action.timedActionList.timerType == 0)
             i->event.type = SMART_EVENT_UPDATE_OOC;
@@ -5551,7 +5599,7 @@ void SmartScript::SetScript9(SmartScriptHolder& e, uint32 entry)
         else if (e.action.timedActionList.timerType > 1)
             i->event.type = SMART_EVENT_UPDATE;
 
-        InitTimer((*i));
+        InitTimer(*i, event.state);
     }
 }
 
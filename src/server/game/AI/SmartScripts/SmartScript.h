@@ -29,7 +29,8 @@ class SmartScript
 {
     struct SmartScriptFrame
     {
-        SmartScriptHolder& holder;
+        SmartScriptHolder const& holder;
+        SmartScriptEventState& state;
         Unit* unit;
         uint32 var0;
         uint32 var1;
@@ -44,16 +45,16 @@ public:
 
     void OnInitialize(WorldObject* obj, AreaTrigger const* at = nullptr);
     void GetScript();
-    void FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger const* at);
+    void FillScript(SmartAIEventListPtr e, WorldObject* obj, AreaTrigger const* at);
 
     void ProcessEventsFor(SMART_EVENT e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
-    void ProcessEvent(SmartScriptHolder& e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
-    bool CheckTimer(SmartScriptHolder const& e) const;
-    static void RecalcTimer(SmartScriptHolder& e, uint32 min, uint32 max);
-    void UpdateTimer(SmartScriptHolder& e, uint32 const diff);
-    static void InitTimer(SmartScriptHolder& e);
-    void ProcessAction(SmartScriptHolder& e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
-    void ProcessTimedAction(SmartScriptHolder& e, uint32 const& min, uint32 const& max, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
+    void ProcessEvent(SmartScriptHolder const& e, SmartScriptEventState& state, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
+    bool CheckTimer(SmartScriptEventState const& state) const;
+    static void RecalcTimer(SmartScriptEventState& state, uint32 min, uint32 max);
+    void UpdateTimer(SmartScriptHolder const& e, SmartScriptEventState& state, uint32 const diff);
+    static void InitTimer(SmartScriptHolder const& e, SmartScriptEventState& state);
+    void ProcessAction(SmartScriptHolder const& e, SmartScriptEventState& state, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
+    void ProcessTimedAction(SmartScriptHolder const& e, SmartScriptEventState& state, uint32 const& min, uint32 const& max, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
     void GetTargets(ObjectVector& targets, SmartScriptHolder const& e, WorldObject* invoker = nullptr) const;
     void GetWorldObjectsInDist(ObjectVector& objects, float dist) const;
     void InstallTemplate(SmartScriptHolder const& e);
@@ -195,7 +196,7 @@ public:
     }
 
     //TIMED_ACTIONLIST (script type 9 aka script9)
-    void SetScript9(SmartScriptHolder& e, uint32 entry);
+    void SetScript9(SmartScriptHolder const& e, uint32 entry);
     WorldObject* GetLastInvoker(WorldObject* invoker = nullptr) const;
     ObjectGuid mLastInvoker;
     typedef std::unordered_map<uint32, uint32> CounterMap;
@@ -207,7 +208,7 @@ public:
     void AddCreatureSummon(ObjectGuid const& guid);
     void RemoveCreatureSummon(ObjectGuid const& guid);
 
-    SmartAIEventList const& GetEvents() const { return mEvents; }
+    SmartScriptEventList const& GetEvents() const { return mEvents; }
 
 private:
     void IncPhase(uint32 p);
@@ -215,13 +216,21 @@ private:
     void SetPhase(uint32 p);
     bool IsInPhase(uint32 p) const;
 
-    void SortEvents(SmartAIEventList& events);
-    void RaisePriority(SmartScriptHolder& e);
-    void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
-
-    SmartAIEventList mEvents;
-    SmartAIEventList mInstallEvents;
-    SmartAIEventList mTimedActionList;
+    void SortEvents(SmartScriptEventList& events);
+    void BuildEventIndex();
+    void RaisePriority(SmartScriptEventState& state);
+    void RetryLater(SmartScriptEventState& state, bool ignoreChanceRoll = false);
+
+    // holders are shared by all instances of the script, only the event state is kept per instance
+    std::vector<SmartAIEventListPtr> mScripts;
+    SmartScriptEventList mEvents;
+    // (event type, position in mEvents) ordered like mEvents, SMART_EVENT_LINK is not indexed
+    std::vector<std::pair<uint16, uint16>> mEventIndex;
+    // holders of events added by templates
+    std::list<SmartScriptHolder> mInstalledHolders;
+    SmartScriptEventList mInstallEvents;
+    SmartAIEventList mTimedActionHolders;
+    SmartScriptEventList mTimedActionList;
     bool isProcessingTimedActionList;
     Creature* me;
     ObjectGuid meOrigGUID;
@@ -257,7 +266,7 @@ private:
         {
             for (SmartAIEventStoredList::iterator i = mStoredEvents.begin(); i != mStoredEvents.end(); ++i)
             {
-                if (i->event_id == id)
+                if (i->holder.event_id == id)
                 {
                     mStoredEvents.erase(i);
                     return;
@@ -266,13 +275,13 @@ private:
         }
     }
     std::optional<std::reference_wrapper<
-        SmartScriptHolder>> FindLinkedEvent(uint32 link)
+        SmartScriptEvent>> FindLinkedEvent(uint32 link)
     {
         if (!mEvents.empty())
         {
-            for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
+            for (SmartScriptEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
             {
-                if (i->event_id == link)
+                if (i->holder->event_id == link)
                 {
                     return std::ref(*i);
                 }
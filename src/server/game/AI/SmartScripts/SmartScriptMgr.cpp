@@ -302,14 +302,14 @@ void SmartAIMgr::LoadSmartAIFromDB()
                 temp.target.type = SMART_TARGET_POSITION;
 
         // creature entry / guid not found in storage, create empty event list for it and increase counters
-        if (mEventMap[source_type].find(temp.entryOrGuid) == mEventMap[source_type].end())
+        std::shared_ptr<SmartAIEventList>& eventList = mEventMap[source_type][temp.entryOrGuid];
+        if (!eventList)
         {
             ++count;
-            SmartAIEventList eventList;
-            mEventMap[source_type][temp.entryOrGuid] = eventList;
+            eventList = std::make_shared<SmartAIEventList>();
         }
         // store the new event
-        mEventMap[source_type][temp.entryOrGuid].push_back(temp);
+        eventList->push_back(temp);
     } while (result->NextRow());
 
     CheckIfSmartAIInDatabaseExists();
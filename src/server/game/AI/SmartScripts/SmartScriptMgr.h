@@ -1971,9 +1971,6 @@ enum SmartEventFlags
 
     SMART_EVENT_FLAG_DIFFICULTY_ALL        = (SMART_EVENT_FLAG_DIFFICULTY_0 | SMART_EVENT_FLAG_DIFFICULTY_1 | SMART_EVENT_FLAG_DIFFICULTY_2 | SMART_EVENT_FLAG_DIFFICULTY_3),
     SMART_EVENT_FLAGS_ALL                  = (SMART_EVENT_FLAG_NOT_REPEATABLE | SMART_EVENT_FLAG_DIFFICULTY_ALL | SMART_EVENT_FLAG_RESERVED_5 | SMART_EVENT_FLAG_RESERVED_6 | SMART_EVENT_FLAG_DEBUG_ONLY | SMART_EVENT_FLAG_DONT_RESET | SMART_EVENT_FLAG_WHILE_CHARMED),
-
-    // Temp flags, used only at runtime, never stored in DB
-    SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL = 0x40000000,              //Event occurs no matter what roll_chance_i(e.event.event_chance) returns.
 };
 
 enum SmartCastFlags
@@ -2002,11 +1999,11 @@ enum SmartFollowType
 };
 
 // one line in DB is one event
+// Event as loaded from `smart_scripts`, never changed after loading and shared by every SmartScript using it
 struct SmartScriptHolder
 {
     SmartScriptHolder() : entryOrGuid(0), source_type(SMART_SCRIPT_TYPE_CREATURE)
-        , event_id(0), link(0), event(), action(), target(), timer(0), priority(DEFAULT_PRIORITY), active(false), runOnce(false)
-        , enableTimed(false) {}
+        , event_id(0), link(0), event(), action(), target() {}
 
     int32 entryOrGuid;
     SmartScriptType source_type;
@@ -2024,20 +2021,39 @@ public:
     uint32 GetTargetType() const { return (uint32)target.type; }
 
     [[nodiscard]] bool IsAreatriggerScript() const { return source_type == SMART_SCRIPT_TYPE_AREATRIGGER; }
+};
 
-    uint32 timer;
-    uint32 priority;
-    bool active;
-    bool runOnce;
-    bool enableTimed;
+// Per instance state of a SmartScriptHolder
+struct SmartScriptEventState
+{
+    uint32 timer = 0;
+    uint32 priority = DEFAULT_PRIORITY;
+    bool active = false;
+    bool runOnce = false;
+    bool enableTimed = false;
+    bool ignoreChanceRoll = false;                          // event occurs no matter what event_chance rolls, set when the action is retried
+
+    static constexpr uint32 DEFAULT_PRIORITY = std::numeric_limits<uint32>::max();
+};
+
+// Event of a SmartScript, the holder is owned by SmartAIMgr or the SmartScript itself
+struct SmartScriptEvent
+{
+    SmartScriptHolder const* holder;
+    SmartScriptEventState state;
 
     // Default comparision operator using priority field as first ordering field
-    bool operator<(SmartScriptHolder const& other) const
+    bool operator<(SmartScriptEvent const& other) const
     {
-        return std::tie(priority, entryOrGuid, source_type, event_id, link) < std::tie(other.priority, other.entryOrGuid, other.source_type, other.event_id, other.link);
+        return std::tie(state.priority, holder->entryOrGuid, holder->source_type, holder->event_id, holder->link) < std::tie(other.state.priority, other.holder->entryOrGuid, other.holder->source_type, other.holder->event_id, other.holder->link);
     }
+};
 
-    static constexpr uint32 DEFAULT_PRIORITY = std::numeric_limits<uint32>::max();
+// Event created at runtime by SMART_ACTION_CREATE_TIMED_EVENT
+struct SmartScriptStoredEvent
+{
+    SmartScriptHolder holder;
+    SmartScriptEventState state;
 };
 
 typedef std::vector<WorldObject*> ObjectVector;
@@ -2101,10 +2117,12 @@ private:
 
 // all events for a single entry
 typedef std::vector<SmartScriptHolder> SmartAIEventList;
-typedef std::list<SmartScriptHolder> SmartAIEventStoredList;
+typedef std::shared_ptr<SmartAIEventList const> SmartAIEventListPtr;
+typedef std::vector<SmartScriptEvent> SmartScriptEventList;
+typedef std::list<SmartScriptStoredEvent> SmartAIEventStoredList;
 
 // all events for all entries / guids
-typedef std::unordered_map<int32, SmartAIEventList> SmartAIEventMap;
+typedef std::unordered_map<int32, std::shared_ptr<SmartAIEventList>> SmartAIEventMap;
 
 class SmartAIMgr
 {
@@ -2117,17 +2135,24 @@ public:
     void LoadSmartAIFromDB();
     void CheckIfSmartAIInDatabaseExists();
 
-    SmartAIEventList GetScript(int32 entry, SmartScriptType type)
+    SmartAIEventList GetScript(int32 entry, SmartScriptType type) const
     {
-        SmartAIEventList temp;
-        if (mEventMap[uint32(type)].find(entry) != mEventMap[uint32(type)].end())
-            return mEventMap[uint32(type)][entry];
-        else
-        {
-            if (entry > 0) //first search is for guid (negative), do not drop error if not found
-                LOG_DEBUG("sql.sql", "SmartAIMgr::GetScript: Could not load Script for Entry {} ScriptType {}.", entry, uint32(type));
-            return temp;
-        }
+        if (SmartAIEventListPtr script = GetSharedScript(entry, type))
+            return *script;
+
+        return SmartAIEventList();
+    }
+
+    // Events are shared by every SmartScript of the entry / guid and stay valid after reloading the store
+    SmartAIEventListPtr GetSharedScript(int32 entry, SmartScriptType type) const
+    {
+        auto itr = mEventMap[uint32(type)].find(entry);
+        if (itr != mEventMap[uint32(type)].end())
+            return itr->second;
+
+        if (entry > 0) //first search is for guid (negative), do not drop error if not found
+            LOG_DEBUG("sql.sql", "SmartAIMgr::GetScript: Could not load Script for Entry {} ScriptType {}.", entry, uint32(type));
+        return nullptr;
     }
 
 private:
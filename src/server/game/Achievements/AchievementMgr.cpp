@@ -510,6 +510,7 @@ void AchievementMgr::Reset()
 
     _completedAchievements.clear();
     _criteriaProgress.clear();
+    _player->GetConditionCache().Invalidate();
     DeleteFromDB(_player->GetGUID().GetCounter());
 
     // re-fill data
@@ -573,12 +574,7 @@ void AchievementMgr::SaveToDB(CharacterDatabaseTransaction trans)
             if (!iter->second.changed)
                 continue;
 
-            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_ACHIEVEMENT_BY_ACHIEVEMENT);
-            stmt->SetData(0, iter->first);
-            stmt->SetData(1, GetPlayer()->GetGUID().GetCounter());
-            trans->Append(stmt);
-
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_ACHIEVEMENT);
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_ACHIEVEMENT);
             stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
             stmt->SetData(1, iter->first);
             stmt->SetData(2, uint32(iter->second.date));
@@ -597,21 +593,23 @@ void AchievementMgr::SaveToDB(CharacterDatabaseTransaction trans)
             if (!iter->second.changed)
                 continue;
 
-            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA);
-            stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
-            stmt->SetData(1, iter->first);
-            trans->Append(stmt);
-
             // pussywizard: insert only for (counter != 0) is very important! this is how criteria of completed achievements gets deleted from db (by setting counter to 0); if conflicted during merge - contact me
+            CharacterDatabasePreparedStatement* stmt = nullptr;
             if (iter->second.counter)
             {
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS);
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_ACHIEVEMENT_PROGRESS);
                 stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
                 stmt->SetData(1, iter->first);
                 stmt->SetData(2, iter->second.counter);
                 stmt->SetData(3, uint32(iter->second.date));
-                trans->Append(stmt);
             }
+            else
+            {
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA);
+                stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
+                stmt->SetData(1, iter->first);
+            }
+            trans->Append(stmt);
 
             iter->second.changed = false;
 
@@ -2307,6 +2305,7 @@ void AchievementMgr::CompletedAchievement(AchievementEntry const* achievement)
     CompletedAchievementData& ca = _completedAchievements[achievement->ID];
     ca.date = GameTime::GetGameTime().count();
     ca.changed = true;
+    _player->GetConditionCache().Invalidate();
 
     sScriptMgr->OnPlayerAchievementComplete(GetPlayer(), achievement);
 
@@ -25,6 +25,7 @@
 #include "ObjectGuid.h"
 #include "Timer.h"
 #include "WorldPacket.h"
+#include <map>
 #include <unordered_map>
 
 class Item;
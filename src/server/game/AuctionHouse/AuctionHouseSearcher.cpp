@@ -17,6 +17,7 @@
 
 #include "AuctionHouseMgr.h"
 #include "AuctionHouseSearcher.h"
+#include "AuctionSearchIndex.h"
 #include "CharacterCache.h"
 #include "DBCStores.h"
 #include "GameTime.h"
@@ -24,12 +25,17 @@
 
 AuctionHouseWorkerThread::AuctionHouseWorkerThread(ProducerConsumerQueue<AuctionSearcherRequest*>* requestQueue, MPSCQueue<AuctionSearcherResponse>* responseQueue)
 {
+    for (std::unique_ptr<AuctionSearchIndex>& searchIndex : _searchIndex)
+        searchIndex = std::make_unique<AuctionSearchIndex>();
+
     _workerThread = std::thread(&AuctionHouseWorkerThread::Run, this);
     _requestQueue = requestQueue;
     _responseQueue = responseQueue;
     _stopped = false;
 }
 
+AuctionHouseWorkerThread::~AuctionHouseWorkerThread() = default;
+
 void AuctionHouseWorkerThread::Stop()
 {
     _stopped = true;
@@ -85,25 +91,21 @@ void AuctionHouseWorkerThread::ProcessSearchUpdates()
 
 void AuctionHouseWorkerThread::SearchUpdateAdd(AuctionSearchAdd const& auctionAdd)
 {
-    SearchableAuctionEntriesMap& searchableAuctionMap = GetSearchableAuctionMap(auctionAdd.listFaction);
-    searchableAuctionMap.insert(std::make_pair(auctionAdd.searchableAuctionEntry->Id, auctionAdd.searchableAuctionEntry));
+    GetSearchIndex(auctionAdd.listFaction).Add(auctionAdd.searchableAuctionEntry);
 }
 
 void AuctionHouseWorkerThread::SearchUpdateRemove(AuctionSearchRemove const& auctionRemove)
 {
-    SearchableAuctionEntriesMap& searchableAuctionMap = GetSearchableAuctionMap(auctionRemove.listFaction);
-    searchableAuctionMap.erase(auctionRemove.auctionId);
+    GetSearchIndex(auctionRemove.listFaction).Remove(auctionRemove.auctionId);
 }
 
 void AuctionHouseWorkerThread::SearchUpdateBid(AuctionSearchUpdateBid const& auctionUpdateBid)
 {
-    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchableAuctionMap(auctionUpdateBid.listFaction);
-    SearchableAuctionEntriesMap::const_iterator itr = searchableAuctionMap.find(auctionUpdateBid.auctionId);
-    if (itr != searchableAuctionMap.end())
-    {
-        itr->second->bid = auctionUpdateBid.bid;
-        itr->second->bidderGuid = auctionUpdateBid.bidderGuid;
-    }
+    AuctionSearchIndex& searchIndex = GetSearchIndex(auctionUpdateBid.listFaction);
+    if (auctionUpdateBid.applyBid)
+        searchIndex.UpdateBid(auctionUpdateBid.auctionId, auctionUpdateBid.bid, auctionUpdateBid.bidderGuid);
+    else
+        searchIndex.InvalidateAuction(auctionUpdateBid.auctionId);
 }
 
 void AuctionHouseWorkerThread::ProcessSearchRequests()
@@ -141,7 +143,7 @@ void AuctionHouseWorkerThread::ProcessSearchRequests()
 
 void AuctionHouseWorkerThread::SearchListRequest(AuctionSearchListRequest const& searchListRequest)
 {
-    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchableAuctionMap(searchListRequest.listFaction);
+    AuctionSearchIndex& searchIndex = GetSearchIndex(searchListRequest.listFaction);
     uint32 count = 0, totalCount = 0;
 
     AuctionSearcherResponse* searchResponse = new AuctionSearcherResponse();
@@ -151,14 +153,9 @@ void AuctionHouseWorkerThread::SearchListRequest(AuctionSearchListRequest const&
 
     if (!searchListRequest.searchInfo.getAll)
     {
-        SortableAuctionEntriesList auctionEntries;
-        BuildListAuctionItems(searchListRequest, auctionEntries, searchableAuctionMap);
-
-        if (!searchListRequest.searchInfo.sorting.empty() && auctionEntries.size() > MAX_AUCTIONS_PER_PAGE)
-        {
-            AuctionSorter sorter(&searchListRequest.searchInfo.sorting, searchListRequest.playerInfo.loc_idx);
-            std::sort(auctionEntries.begin(), auctionEntries.end(), sorter);
-        }
+        // Only the requested page needs to be in order
+        SortableAuctionEntriesList const& auctionEntries = searchIndex.Search(searchListRequest.searchInfo, searchListRequest.playerInfo,
+            searchListRequest.searchInfo.listfrom + MAX_AUCTIONS_PER_PAGE);
 
         SortableAuctionEntriesList::const_iterator itr = auctionEntries.begin();
         if (searchListRequest.searchInfo.listfrom)
@@ -182,6 +179,7 @@ void AuctionHouseWorkerThread::SearchListRequest(AuctionSearchListRequest const&
     else
     {
         // getAll handling
+        SearchableAuctionEntriesMap const& searchableAuctionMap = searchIndex.GetEntries();
         for (auto const& pair : searchableAuctionMap)
         {
             std::shared_ptr<SearchableAuctionEntry> const& Aentry = pair.second;
@@ -204,7 +202,7 @@ void AuctionHouseWorkerThread::SearchListRequest(AuctionSearchListRequest const&
 
 void AuctionHouseWorkerThread::SearchOwnerListRequest(AuctionSearchOwnerListRequest const& searchOwnerListRequest)
 {
-    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchableAuctionMap(searchOwnerListRequest.listFaction);
+    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchIndex(searchOwnerListRequest.listFaction).GetEntries();
 
     AuctionSearcherResponse* searchResponse = new AuctionSearcherResponse();
     searchResponse->playerGuid = searchOwnerListRequest.ownerGuid;
@@ -234,7 +232,7 @@ void AuctionHouseWorkerThread::SearchOwnerListRequest(AuctionSearchOwnerListRequ
 
 void AuctionHouseWorkerThread::SearchBidderListRequest(AuctionSearchBidderListRequest const& searchBidderListRequest)
 {
-    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchableAuctionMap(searchBidderListRequest.listFaction);
+    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchIndex(searchBidderListRequest.listFaction).GetEntries();
 
     AuctionSearcherResponse* searchResponse = new AuctionSearcherResponse();
     searchResponse->playerGuid = searchBidderListRequest.ownerGuid;
@@ -274,66 +272,6 @@ void AuctionHouseWorkerThread::SearchBidderListRequest(AuctionSearchBidderListRe
     _responseQueue->Enqueue(searchResponse);
 }
 
-void AuctionHouseWorkerThread::BuildListAuctionItems(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& auctionEntries, SearchableAuctionEntriesMap const& auctionMap) const
-{
-    // pussywizard: optimization, this is a simplified case for the default search state (no filters)
-    if (searchRequest.searchInfo.itemClass == 0xffffffff && searchRequest.searchInfo.itemSubClass == 0xffffffff
-        && searchRequest.searchInfo.inventoryType == 0xffffffff && searchRequest.searchInfo.quality == 0xffffffff
-        && searchRequest.searchInfo.levelmin == 0x00 && searchRequest.searchInfo.levelmax == 0x00
-        && searchRequest.searchInfo.usable == 0x00 && searchRequest.searchInfo.wsearchedname.empty())
-    {
-        for (auto const& pair : auctionMap)
-            auctionEntries.push_back(pair.second.get());
-
-        return;
-    }
-
-    for (auto const& pair : auctionMap)
-    {
-        std::shared_ptr<SearchableAuctionEntry> const& Aentry = pair.second;
-        SearchableAuctionEntryItem const& Aitem = Aentry->item;
-        ItemTemplate const* proto = Aitem.itemTemplate;
-
-        if (searchRequest.searchInfo.itemClass != 0xffffffff && proto->Class != searchRequest.searchInfo.itemClass)
-            continue;
-
-        if (searchRequest.searchInfo.itemSubClass != 0xffffffff && proto->SubClass != searchRequest.searchInfo.itemSubClass)
-            continue;
-
-        if (searchRequest.searchInfo.inventoryType != 0xffffffff && proto->InventoryType != searchRequest.searchInfo.inventoryType)
-        {
-            // xinef: exception, robes are counted as chests
-            if (searchRequest.searchInfo.inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
-                continue;
-        }
-
-        if (searchRequest.searchInfo.quality != 0xffffffff && proto->Quality < searchRequest.searchInfo.quality)
-            continue;
-
-        if (searchRequest.searchInfo.levelmin != 0x00 && (proto->RequiredLevel < searchRequest.searchInfo.levelmin
-            || (searchRequest.searchInfo.levelmax != 0x00 && proto->RequiredLevel > searchRequest.searchInfo.levelmax)))
-        {
-            continue;
-        }
-
-        if (searchRequest.searchInfo.usable != 0x00)
-        {
-            if (!searchRequest.playerInfo.usablePlayerInfo.value().PlayerCanUseItem(proto))
-                continue;
-        }
-
-        // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
-        // No need to do any of this if no search term was entered
-        if (!searchRequest.searchInfo.wsearchedname.empty())
-        {
-            if (Aitem.itemName[searchRequest.playerInfo.loc_idx].find(searchRequest.searchInfo.wsearchedname) == std::wstring::npos)
-                continue;
-        }
-
-        auctionEntries.push_back(Aentry.get());
-    }
-}
-
 AuctionHouseSearcher::AuctionHouseSearcher()
 {
     for (uint32 i = 0; i < sWorld->getIntConfig(CONFIG_AUCTIONHOUSE_WORKERTHREADS); ++i)
@@ -414,9 +352,13 @@ void AuctionHouseSearcher::RemoveAuction(AuctionEntry const* auctionEntry)
 
 void AuctionHouseSearcher::UpdateBid(AuctionEntry const* auctionEntry)
 {
-    // Updating bids is a bit unique, we really only need to update a single worker as every worker thread contains
-    // a map of shared pointers to the same SearchableAuctionEntry's, so updating one will update them all.
-    NotifyOneWorker(std::make_shared<AuctionSearchUpdateBid>(auctionEntry->Id, auctionEntry->GetFactionId(), auctionEntry->bid, auctionEntry->bidder));
+    // Every worker thread contains a map of shared pointers to the same SearchableAuctionEntry's, so the bid is written
+    // once by the first worker. The others only drop their cached search results that contain the auction.
+    NotifyOneWorker(std::make_shared<AuctionSearchUpdateBid>(auctionEntry->Id, auctionEntry->GetFactionId(), auctionEntry->bid, auctionEntry->bidder, true));
+
+    std::shared_ptr<AuctionSearchUpdateBid> const invalidate = std::make_shared<AuctionSearchUpdateBid>(auctionEntry->Id, auctionEntry->GetFactionId(), auctionEntry->bid, auctionEntry->bidder, false);
+    for (std::size_t i = 1; i < _workerThreads.size(); ++i)
+        _workerThreads[i]->AddAuctionSearchUpdateToQueue(invalidate);
 }
 
 void AuctionHouseSearcher::NotifyAllWorkers(std::shared_ptr<AuctionSearcherUpdate> const auctionSearchUpdate)
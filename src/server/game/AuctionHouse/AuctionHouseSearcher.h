@@ -29,6 +29,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+class AuctionSearchIndex;
 struct ItemTemplate;
 
 enum AuctionSortOrder
@@ -218,12 +219,13 @@ struct AuctionSearchRemove : AuctionSearcherUpdate
 
 struct AuctionSearchUpdateBid : AuctionSearcherUpdate
 {
-    AuctionSearchUpdateBid(uint32 _auctionId, AuctionHouseFaction _listFaction, uint32 _bid, ObjectGuid _bidderGuid)
-        : AuctionSearcherUpdate(AuctionSearcherUpdate::Type::UPDATE_BID, _listFaction), auctionId(_auctionId), bid(_bid), bidderGuid(_bidderGuid) { }
+    AuctionSearchUpdateBid(uint32 _auctionId, AuctionHouseFaction _listFaction, uint32 _bid, ObjectGuid _bidderGuid, bool _applyBid)
+        : AuctionSearcherUpdate(AuctionSearcherUpdate::Type::UPDATE_BID, _listFaction), auctionId(_auctionId), bid(_bid), bidderGuid(_bidderGuid), applyBid(_applyBid) { }
 
     uint32 auctionId;
     uint32 bid;
     ObjectGuid bidderGuid;
+    bool applyBid;                                          // false: the entry is shared and updated by another worker, only drop cached views
 };
 
 typedef std::unordered_map<uint32, std::shared_ptr<SearchableAuctionEntry>> SearchableAuctionEntriesMap;
@@ -244,6 +246,7 @@ class AuctionHouseWorkerThread
 {
 public:
     AuctionHouseWorkerThread(ProducerConsumerQueue<AuctionSearcherRequest*>* requestQueue, MPSCQueue<AuctionSearcherResponse>* responseQueue);
+    ~AuctionHouseWorkerThread();
 
     void Stop();
 
@@ -262,11 +265,9 @@ private:
     void SearchOwnerListRequest(AuctionSearchOwnerListRequest const& searchOwnerListRequest);
     void SearchBidderListRequest(AuctionSearchBidderListRequest const& searchBidderListRequest);
 
-    void BuildListAuctionItems(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& auctionEntries, SearchableAuctionEntriesMap const& auctionMap) const;
+    AuctionSearchIndex& GetSearchIndex(AuctionHouseFaction faction) { return *_searchIndex[static_cast<uint8>(faction)]; };
 
-    SearchableAuctionEntriesMap& GetSearchableAuctionMap(AuctionHouseFaction faction) { return _searchableAuctionMap[static_cast<uint8>(faction)]; };
-
-    SearchableAuctionEntriesMap _searchableAuctionMap[MAX_AUCTION_HOUSE_FACTIONS];
+    std::unique_ptr<AuctionSearchIndex> _searchIndex[MAX_AUCTION_HOUSE_FACTIONS];
     LockedQueue<std::shared_ptr<AuctionSearcherUpdate>> _auctionUpdatesQueue;
 
     ProducerConsumerQueue<AuctionSearcherRequest*>* _requestQueue;
@@ -0,0 +1,451 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuctionSearchIndex.h"
+#include "ItemTemplate.h"
+#include <algorithm>
+
+void AuctionSearchIndex::Add(std::shared_ptr<SearchableAuctionEntry> const& entry)
+{
+    if (!_entries.insert(std::make_pair(entry->Id, entry)).second)
+        return;
+
+    UpdateIndexes(entry.get(), true);
+    InvalidateViews(*entry);
+}
+
+void AuctionSearchIndex::Remove(uint32 auctionId)
+{
+    SearchableAuctionEntriesMap::iterator itr = _entries.find(auctionId);
+    if (itr == _entries.end())
+        return;
+
+    // Views may still point at the entry, drop them before it can be freed
+    InvalidateViews(*itr->second);
+    UpdateIndexes(itr->second.get(), false);
+    _entries.erase(itr);
+}
+
+void AuctionSearchIndex::UpdateBid(uint32 auctionId, uint32 bid, ObjectGuid bidderGuid)
+{
+    SearchableAuctionEntriesMap::const_iterator itr = _entries.find(auctionId);
+    if (itr == _entries.end())
+        return;
+
+    itr->second->bid = bid;
+    itr->second->bidderGuid = bidderGuid;
+    InvalidateViews(*itr->second);
+}
+
+void AuctionSearchIndex::InvalidateAuction(uint32 auctionId)
+{
+    SearchableAuctionEntriesMap::const_iterator itr = _entries.find(auctionId);
+    if (itr != _entries.end())
+        InvalidateViews(*itr->second);
+}
+
+SortableAuctionEntriesList const& AuctionSearchIndex::Search(AuctionHouseSearchInfo const& searchInfo, AuctionHousePlayerInfo const& playerInfo, std::size_t sortedCount)
+{
+    ++_statistics.Searches;
+
+    // Results of "usable items" searches depend on the player's skills and spells, they are not worth caching
+    if (searchInfo.usable)
+    {
+        _uncachedResult.clear();
+        CollectMatches(searchInfo, playerInfo, _uncachedResult);
+
+        std::size_t alreadySorted = 0;
+        SortPrefix(_uncachedResult, alreadySorted, sortedCount, searchInfo.sorting, playerInfo.loc_idx);
+        return _uncachedResult;
+    }
+
+    std::string key = GetViewKey(searchInfo, playerInfo.loc_idx);
+    ViewMap::iterator itr = _views.find(key);
+    if (itr != _views.end())
+    {
+        ++_statistics.ViewHits;
+        _viewOrder.splice(_viewOrder.end(), _viewOrder, itr->second.OrderItr);
+
+        SortedView& view = itr->second;
+        SortPrefix(view.Entries, view.SortedCount, sortedCount, view.SearchInfo.sorting, view.PlayerInfo.loc_idx);
+        return view.Entries;
+    }
+
+    SortedView view;
+    view.SearchInfo = searchInfo;
+    view.PlayerInfo = playerInfo;
+    view.PlayerInfo.usablePlayerInfo.reset();
+    CollectMatches(view.SearchInfo, view.PlayerInfo, view.Entries);
+
+    // A single result larger than the whole cache is not cached at all
+    if (view.Entries.size() > _maxCachedViewEntries)
+    {
+        _uncachedResult = std::move(view.Entries);
+
+        std::size_t alreadySorted = 0;
+        SortPrefix(_uncachedResult, alreadySorted, sortedCount, searchInfo.sorting, playerInfo.loc_idx);
+        return _uncachedResult;
+    }
+
+    while (!_viewOrder.empty() && _cachedViewEntries + view.Entries.size() > _maxCachedViewEntries)
+        EraseView(_views.find(_viewOrder.front()));
+
+    _cachedViewEntries += view.Entries.size();
+    view.OrderItr = _viewOrder.insert(_viewOrder.end(), key);
+
+    SortedView& cached = _views.emplace(std::move(key), std::move(view)).first->second;
+    SortPrefix(cached.Entries, cached.SortedCount, sortedCount, cached.SearchInfo.sorting, cached.PlayerInfo.loc_idx);
+    return cached.Entries;
+}
+
+bool AuctionSearchIndex::Matches(SearchableAuctionEntry const& entry, AuctionHouseSearchInfo const& searchInfo, AuctionHousePlayerInfo const& playerInfo)
+{
+    ItemTemplate const* proto = entry.item.itemTemplate;
+
+    if (searchInfo.itemClass != 0xffffffff && proto->Class != searchInfo.itemClass)
+        return false;
+
+    if (searchInfo.itemSubClass != 0xffffffff && proto->SubClass != searchInfo.itemSubClass)
+        return false;
+
+    if (searchInfo.inventoryType != 0xffffffff && proto->InventoryType != searchInfo.inventoryType)
+    {
+        // xinef: exception, robes are counted as chests
+        if (searchInfo.inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
+            return false;
+    }
+
+    if (searchInfo.quality != 0xffffffff && proto->Quality < searchInfo.quality)
+        return false;
+
+    if (searchInfo.levelmin != 0x00 && (proto->RequiredLevel < searchInfo.levelmin
+        || (searchInfo.levelmax != 0x00 && proto->RequiredLevel > searchInfo.levelmax)))
+    {
+        return false;
+    }
+
+    if (searchInfo.usable != 0x00)
+    {
+        if (!playerInfo.usablePlayerInfo.value().PlayerCanUseItem(proto))
+            return false;
+    }
+
+    // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
+    // No need to do any of this if no search term was entered
+    if (!searchInfo.wsearchedname.empty())
+    {
+        if (GetName(entry, playerInfo.loc_idx).find(searchInfo.wsearchedname) == std::wstring::npos)
+            return false;
+    }
+
+    return true;
+}
+
+AuctionSearchIndex::NameGroupKey AuctionSearchIndex::GetNameGroupKey(SearchableAuctionEntry const& entry)
+{
+    // The displayed name only depends on the item and its random property (suffix)
+    return (uint64(entry.item.entry) << 32) | uint32(entry.item.randomPropertyId);
+}
+
+std::wstring const& AuctionSearchIndex::GetName(SearchableAuctionEntry const& entry, int locale)
+{
+    return entry.item.itemName[locale];
+}
+
+std::vector<uint64> AuctionSearchIndex::GetTrigrams(std::wstring const& name)
+{
+    std::vector<uint64> trigrams;
+    if (name.size() < 3)
+        return trigrams;
+
+    trigrams.reserve(name.size() - 2);
+    for (std::size_t i = 0; i + 2 < name.size(); ++i)
+    {
+        // Code points fit in 21 bits
+        trigrams.push_back((uint64(name[i] & 0x1FFFFF) << 42) | (uint64(name[i + 1] & 0x1FFFFF) << 21) | uint64(name[i + 2] & 0x1FFFFF));
+    }
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    return trigrams;
+}
+
+std::string AuctionSearchIndex::GetViewKey(AuctionHouseSearchInfo const& searchInfo, int locale)
+{
+    std::string key;
+    auto append = [&key](auto value)
+    {
+        key.append(reinterpret_cast<char const*>(&value), sizeof(value));
+    };
+
+    append(locale);
+    append(searchInfo.itemClass);
+    append(searchInfo.itemSubClass);
+    append(searchInfo.inventoryType);
+    append(searchInfo.quality);
+    append(searchInfo.levelmin);
+    append(searchInfo.levelmax);
+
+    append(uint32(searchInfo.sorting.size()));
+    for (AuctionSortInfo const& sort : searchInfo.sorting)
+    {
+        append(uint8(sort.sortOrder));
+        append(sort.isDesc);
+    }
+
+    key.append(reinterpret_cast<char const*>(searchInfo.wsearchedname.data()), searchInfo.wsearchedname.size() * sizeof(wchar_t));
+    return key;
+}
+
+void AuctionSearchIndex::UpdateIndexes(SearchableAuctionEntry* entry, bool add)
+{
+    auto update = [entry, add](auto& index, auto key)
+    {
+        if (add)
+        {
+            index[key].insert(entry);
+            return;
+        }
+
+        auto itr = index.find(key);
+        if (itr == index.end())
+            return;
+
+        itr->second.erase(entry);
+        if (itr->second.empty())
+            index.erase(itr);
+    };
+
+    ItemTemplate const* proto = entry->item.itemTemplate;
+    update(_byClass, proto->Class);
+    update(_byClassSubClass, (proto->Class << 16) | proto->SubClass);
+    update(_byInventoryType, proto->InventoryType);
+    update(_byQuality, proto->Quality);
+    update(_byRequiredLevel, proto->RequiredLevel);
+
+    // Name groups only enter the trigram indexes when they gain their first member and leave with their last one
+    NameGroupKey const key = GetNameGroupKey(*entry);
+    bool const groupExisted = _nameGroups.find(key) != _nameGroups.end();
+    update(_nameGroups, key);
+    bool const groupExists = _nameGroups.find(key) != _nameGroups.end();
+
+    if (groupExisted == groupExists)
+        return;
+
+    for (uint32 locale = 0; locale < TOTAL_LOCALES; ++locale)
+        if (_nameIndexes[locale].Built)
+            UpdateNameIndex(_nameIndexes[locale], key, GetName(*entry, locale), groupExists);
+}
+
+void AuctionSearchIndex::UpdateNameIndex(NameIndex& index, NameGroupKey key, std::wstring const& name, bool add)
+{
+    for (uint64 trigram : GetTrigrams(name))
+    {
+        if (add)
+        {
+            index.Trigrams[trigram].insert(key);
+            continue;
+        }
+
+        auto itr = index.Trigrams.find(trigram);
+        if (itr == index.Trigrams.end())
+            continue;
+
+        itr->second.erase(key);
+        if (itr->second.empty())
+            index.Trigrams.erase(itr);
+    }
+}
+
+AuctionSearchIndex::NameIndex& AuctionSearchIndex::GetNameIndex(int locale)
+{
+    NameIndex& index = _nameIndexes[locale];
+    if (!index.Built)
+    {
+        for (auto const& [key, group] : _nameGroups)
+            UpdateNameIndex(index, key, GetName(**group.begin(), locale), true);
+
+        index.Built = true;
+    }
+
+    return index;
+}
+
+void AuctionSearchIndex::CollectMatches(AuctionHouseSearchInfo const& searchInfo, AuctionHousePlayerInfo const& playerInfo, SortableAuctionEntriesList& result)
+{
+    auto collect = [&](EntrySet const& entries)
+    {
+        _statistics.CandidatesScanned += entries.size();
+        for (SearchableAuctionEntry* entry : entries)
+            if (Matches(*entry, searchInfo, playerInfo))
+                result.push_back(entry);
+    };
+
+    if (!searchInfo.wsearchedname.empty())
+    {
+        // The name is checked once per name group instead of once per auction
+        std::wstring const& searchedName = searchInfo.wsearchedname;
+        auto collectGroup = [&](EntrySet const& group)
+        {
+            if (GetName(**group.begin(), playerInfo.loc_idx).find(searchedName) != std::wstring::npos)
+                collect(group);
+        };
+
+        std::vector<uint64> trigrams = GetTrigrams(searchedName);
+        if (trigrams.empty())
+        {
+            for (auto const& [key, group] : _nameGroups)
+                collectGroup(group);
+
+            return;
+        }
+
+        NameIndex const& index = GetNameIndex(playerInfo.loc_idx);
+        std::unordered_set<NameGroupKey> const* candidates = nullptr;
+        for (uint64 trigram : trigrams)
+        {
+            auto itr = index.Trigrams.find(trigram);
+            if (itr == index.Trigrams.end())
+                return;
+
+            if (!candidates || itr->second.size() < candidates->size())
+                candidates = &itr->second;
+        }
+
+        for (NameGroupKey key : *candidates)
+            collectGroup(_nameGroups.at(key));
+
+        return;
+    }
+
+    // Scan the smallest set of candidates any of the filters narrows the search down to
+    std::vector<EntrySet const*> best;
+    std::size_t bestSize = _entries.size();
+    bool indexed = false;
+
+    auto consider = [&](std::vector<EntrySet const*> const& sets)
+    {
+        std::size_t size = 0;
+        for (EntrySet const* set : sets)
+            size += set->size();
+
+        if (size < bestSize || !indexed)
+        {
+            best = sets;
+            bestSize = size;
+            indexed = true;
+        }
+    };
+
+    auto lookup = [](EntryIndex const& index, uint32 key, std::vector<EntrySet const*>& sets)
+    {
+        EntryIndex::const_iterator itr = index.find(key);
+        if (itr != index.end())
+            sets.push_back(&itr->second);
+    };
+
+    if (searchInfo.itemClass != 0xffffffff)
+    {
+        std::vector<EntrySet const*> sets;
+        if (searchInfo.itemSubClass != 0xffffffff)
+            lookup(_byClassSubClass, (searchInfo.itemClass << 16) | searchInfo.itemSubClass, sets);
+        else
+            lookup(_byClass, searchInfo.itemClass, sets);
+
+        consider(sets);
+    }
+
+    if (searchInfo.inventoryType != 0xffffffff)
+    {
+        std::vector<EntrySet const*> sets;
+        lookup(_byInventoryType, searchInfo.inventoryType, sets);
+        if (searchInfo.inventoryType == INVTYPE_CHEST)
+            lookup(_byInventoryType, INVTYPE_ROBE, sets);
+
+        consider(sets);
+    }
+
+    if (searchInfo.quality != 0xffffffff)
+    {
+        std::vector<EntrySet const*> sets;
+        for (uint32 quality = searchInfo.quality; quality < MAX_ITEM_QUALITY; ++quality)
+            lookup(_byQuality, quality, sets);
+
+        consider(sets);
+    }
+
+    if (searchInfo.levelmin != 0x00)
+    {
+        std::vector<EntrySet const*> sets;
+        for (auto const& [requiredLevel, entries] : _byRequiredLevel)
+            if (requiredLevel >= searchInfo.levelmin && (searchInfo.levelmax == 0x00 || requiredLevel <= searchInfo.levelmax))
+                sets.push_back(&entries);
+
+        consider(sets);
+    }
+
+    if (indexed)
+    {
+        for (EntrySet const* set : best)
+            collect(*set);
+
+        return;
+    }
+
+    _statistics.CandidatesScanned += _entries.size();
+    result.reserve(_entries.size());
+    for (auto const& pair : _entries)
+        if (Matches(*pair.second, searchInfo, playerInfo))
+            result.push_back(pair.second.get());
+}
+
+void AuctionSearchIndex::SortPrefix(SortableAuctionEntriesList& entries, std::size_t& sortedCount, std::size_t requested, AuctionSortOrderVector const& sorting, int locale)
+{
+    // Small results are sent unsorted, the client orders a single page itself
+    if (sorting.empty() || entries.size() <= MAX_AUCTIONS_PER_PAGE)
+    {
+        sortedCount = entries.size();
+        return;
+    }
+
+    requested = std::min(requested, entries.size());
+    if (requested <= sortedCount)
+        return;
+
+    // Everything behind the sorted prefix compares greater or equal, so sorting can continue from there
+    AuctionSorter sorter(&sorting, locale);
+    std::partial_sort(entries.begin() + sortedCount, entries.begin() + requested, entries.end(), sorter);
+    sortedCount = requested;
+}
+
+void AuctionSearchIndex::InvalidateViews(SearchableAuctionEntry const& entry)
+{
+    for (ViewMap::iterator itr = _views.begin(); itr != _views.end();)
+    {
+        if (Matches(entry, itr->second.SearchInfo, itr->second.PlayerInfo))
+            itr = EraseView(itr);
+        else
+            ++itr;
+    }
+}
+
+AuctionSearchIndex::ViewMap::iterator AuctionSearchIndex::EraseView(ViewMap::iterator itr)
+{
+    _cachedViewEntries -= itr->second.Entries.size();
+    _viewOrder.erase(itr->second.OrderItr);
+    return _views.erase(itr);
+}
@@ -0,0 +1,126 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _AUCTION_SEARCH_INDEX_H
+#define _AUCTION_SEARCH_INDEX_H
+
+#include "AuctionHouseSearcher.h"
+#include <array>
+#include <list>
+
+/**
+ * Auctions of one faction as seen by an AuctionHouseWorkerThread.
+ *
+ * Besides the id map it keeps secondary indexes by item class, class/subclass,
+ * inventory type, quality and required level, and groups auctions sharing a name
+ * (same item entry and random property). Per locale, a trigram index over those
+ * name groups is built on the first search in that locale.
+ *
+ * Search results are cached as views keyed by the search filters and sort order.
+ * A view is only sorted as far as pages have been requested (top-K) and is dropped
+ * when an added, removed or re-bid auction matches its filters. The least recently
+ * used views are evicted once all views together hold more than the configured number
+ * of entries (MaxCachedViewEntries by default).
+ */
+class AuctionSearchIndex
+{
+public:
+    static constexpr std::size_t MaxCachedViewEntries = 256 * 1024;
+
+    explicit AuctionSearchIndex(std::size_t maxCachedViewEntries = MaxCachedViewEntries) : _maxCachedViewEntries(maxCachedViewEntries) { }
+
+    struct Statistics
+    {
+        uint64 Searches = 0;
+        uint64 ViewHits = 0;
+        uint64 CandidatesScanned = 0;
+    };
+
+    void Add(std::shared_ptr<SearchableAuctionEntry> const& entry);
+    void Remove(uint32 auctionId);
+    void UpdateBid(uint32 auctionId, uint32 bid, ObjectGuid bidderGuid);
+    /// Drops the views containing the auction without touching it, for bids applied through another index sharing the entry
+    void InvalidateAuction(uint32 auctionId);
+
+    [[nodiscard]] SearchableAuctionEntriesMap const& GetEntries() const { return _entries; }
+    [[nodiscard]] Statistics const& GetStatistics() const { return _statistics; }
+    [[nodiscard]] std::size_t GetCachedViewCount() const { return _views.size(); }
+    [[nodiscard]] std::size_t GetCachedViewEntryCount() const { return _cachedViewEntries; }
+
+    /// Returns all auctions matching the request, the first @p sortedCount of them in the requested order.
+    /// The list stays valid until the index is modified or searched again.
+    SortableAuctionEntriesList const& Search(AuctionHouseSearchInfo const& searchInfo, AuctionHousePlayerInfo const& playerInfo, std::size_t sortedCount);
+
+    static bool Matches(SearchableAuctionEntry const& entry, AuctionHouseSearchInfo const& searchInfo, AuctionHousePlayerInfo const& playerInfo);
+
+private:
+    typedef std::unordered_set<SearchableAuctionEntry*> EntrySet;
+    typedef std::unordered_map<uint32, EntrySet> EntryIndex;
+    typedef uint64 NameGroupKey;
+
+    struct NameIndex
+    {
+        bool Built = false;
+        std::unordered_map<uint64, std::unordered_set<NameGroupKey>> Trigrams;
+    };
+
+    struct SortedView
+    {
+        AuctionHouseSearchInfo SearchInfo;
+        AuctionHousePlayerInfo PlayerInfo;
+        SortableAuctionEntriesList Entries;
+        std::size_t SortedCount = 0;
+        std::list<std::string>::iterator OrderItr;
+    };
+
+    typedef std::unordered_map<std::string, SortedView> ViewMap;
+
+    static NameGroupKey GetNameGroupKey(SearchableAuctionEntry const& entry);
+    static std::wstring const& GetName(SearchableAuctionEntry const& entry, int locale);
+    static std::vector<uint64> GetTrigrams(std::wstring const& name);
+    static std::string GetViewKey(AuctionHouseSearchInfo const& searchInfo, int locale);
+
+    void UpdateIndexes(SearchableAuctionEntry* entry, bool add);
+    void UpdateNameIndex(NameIndex& index, NameGroupKey key, std::wstring const& name, bool add);
+    NameIndex& GetNameIndex(int locale);
+
+    void CollectMatches(AuctionHouseSearchInfo const& searchInfo, AuctionHousePlayerInfo const& playerInfo, SortableAuctionEntriesList& result);
+    static void SortPrefix(SortableAuctionEntriesList& entries, std::size_t& sortedCount, std::size_t requested, AuctionSortOrderVector const& sorting, int locale);
+    void InvalidateViews(SearchableAuctionEntry const& entry);
+    ViewMap::iterator EraseView(ViewMap::iterator itr);
+
+    SearchableAuctionEntriesMap _entries;
+
+    EntryIndex _byClass;
+    EntryIndex _byClassSubClass;
+    EntryIndex _byInventoryType;
+    EntryIndex _byQuality;
+    EntryIndex _byRequiredLevel;
+
+    std::unordered_map<NameGroupKey, EntrySet> _nameGroups;
+    std::array<NameIndex, TOTAL_LOCALES> _nameIndexes;
+
+    ViewMap _views;
+    std::list<std::string> _viewOrder;                      // least recently used first
+    std::size_t _cachedViewEntries = 0;
+    std::size_t const _maxCachedViewEntries;
+    SortableAuctionEntriesList _uncachedResult;
+
+    Statistics _statistics;
+};
+
+#endif
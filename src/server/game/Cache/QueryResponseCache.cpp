@@ -0,0 +1,51 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QueryResponseCache.h"
+#include "Log.h"
+#include "World.h"
+
+QueryResponseCache* QueryResponseCache::instance()
+{
+    static QueryResponseCache instance;
+    return &instance;
+}
+
+void QueryResponseCache::LoadConfig()
+{
+    bool enabled = sWorld->getBoolConfig(CONFIG_CACHE_QUERY_RESPONSES);
+    if (enabled != _enabled)
+        InvalidateAll();
+
+    _enabled = enabled;
+}
+
+void QueryResponseCache::Invalidate(QueryResponseCacheType type)
+{
+    Storage& storage = _storage[type];
+    std::unique_lock<std::shared_mutex> lock(storage.Lock);
+    storage.Responses.clear();
+    ++storage.Generation;
+
+    LOG_DEBUG("server.loading", "QueryResponseCache: invalidated responses of type {}", uint32(type));
+}
+
+void QueryResponseCache::InvalidateAll()
+{
+    for (uint8 type = 0; type < MAX_QUERY_CACHE_TYPE; ++type)
+        Invalidate(QueryResponseCacheType(type));
+}
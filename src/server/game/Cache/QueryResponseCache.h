@@ -0,0 +1,123 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _QUERY_RESPONSE_CACHE_H_
+#define _QUERY_RESPONSE_CACHE_H_
+
+#include "Common.h"
+#include "FlatHashMap.h"
+#include "WorldPacket.h"
+#include <array>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+enum QueryResponseCacheType : uint8
+{
+    QUERY_CACHE_CREATURE,
+    QUERY_CACHE_GAMEOBJECT,
+    QUERY_CACHE_ITEM,
+    QUERY_CACHE_QUEST,
+    QUERY_CACHE_NPC_TEXT,
+    QUERY_CACHE_PAGE_TEXT,
+
+    MAX_QUERY_CACHE_TYPE
+};
+
+/**
+ * Prebuilt responses to the static data queries (creature, gameobject, item, quest,
+ * npc text and page text), one immutable packet per (entry, locale).
+ *
+ * Packets are built on first request and shared between all sessions, which send
+ * them without copying. The `.reload` commands of the underlying tables invalidate
+ * the affected type; a response built concurrently with an invalidation is dropped.
+ */
+class AC_GAME_API QueryResponseCache
+{
+    QueryResponseCache() = default;
+    ~QueryResponseCache() = default;
+
+    QueryResponseCache(QueryResponseCache const&) = delete;
+    QueryResponseCache(QueryResponseCache&&) = delete;
+
+    QueryResponseCache& operator= (QueryResponseCache const&) = delete;
+    QueryResponseCache& operator= (QueryResponseCache&&) = delete;
+public:
+    typedef std::shared_ptr<WorldPacket const> Response;
+
+    static QueryResponseCache* instance();
+
+    void LoadConfig();
+
+    // Returns the cached response, calling builder() to create it on a miss
+    template<class Builder>
+    Response Get(QueryResponseCacheType type, uint32 entry, LocaleConstant locale, Builder&& builder)
+    {
+        return Get(type, entry, locale, 0, std::forward<Builder>(builder));
+    }
+
+    // Same as above for a per-player variant of the response (e.g. level dependent fields),
+    // variant 0 is the shared response and variants are limited to 24 bits
+    template<class Builder>
+    Response Get(QueryResponseCacheType type, uint32 entry, LocaleConstant locale, uint32 variant, Builder&& builder)
+    {
+        if (!_enabled)
+            return std::make_shared<WorldPacket const>(builder());
+
+        Storage& storage = _storage[type];
+        uint64 key = MakeKey(entry, locale, variant);
+        uint32 generation;
+        {
+            std::shared_lock<std::shared_mutex> lock(storage.Lock);
+            auto itr = storage.Responses.find(key);
+            if (itr != storage.Responses.end())
+                return itr->second;
+
+            generation = storage.Generation;
+        }
+
+        // build outside of the lock, concurrent misses for the same key resolve to the first insert
+        Response response = std::make_shared<WorldPacket const>(builder());
+
+        std::unique_lock<std::shared_mutex> lock(storage.Lock);
+        if (storage.Generation != generation)
+            return response;
+
+        return storage.Responses.try_emplace(key, std::move(response)).first->second;
+    }
+
+    void Invalidate(QueryResponseCacheType type);
+    void InvalidateAll();
+
+private:
+    static uint64 MakeKey(uint32 entry, LocaleConstant locale, uint32 variant) { return (uint64(entry) << 32) | (uint64(variant & 0xFFFFFF) << 8) | uint64(locale); }
+
+    struct Storage
+    {
+        std::shared_mutex Lock;
+        Acore::FlatHashMap<uint64, Response> Responses;
+        uint32 Generation = 0;
+    };
+
+    std::array<Storage, MAX_QUERY_CACHE_TYPE> _storage;
+    bool _enabled = true;
+};
+
+#define sQueryResponseCache QueryResponseCache::instance()
+
+#endif
@@ -0,0 +1,360 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldSnapshot.h"
+#include "CryptoHash.h"
+#include "DatabaseEnv.h"
+#include "GitRevision.h"
+#include "Log.h"
+#include "QueryResult.h"
+#include "StringFormat.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    constexpr char WORLD_SNAPSHOT_MAGIC[4] = { 'A', 'C', 'W', 'S' };
+    constexpr uint32 WORLD_SNAPSHOT_VERSION = 1;
+
+    struct FileHeader
+    {
+        char Magic[4];
+        uint32 Version;
+        uint32 SectionCount;
+        uint32 Reserved;
+    };
+
+    struct SectionHeader
+    {
+        uint32 Id;
+        uint32 Reserved;
+        uint64 Offset;
+        uint64 Size;
+        WorldSnapshot::Key Key;
+        uint8 Padding[4];
+    };
+
+    // payload: PayloadHeader, records padded to 8 bytes, then the strings as (uint32 length, bytes)
+    struct PayloadHeader
+    {
+        uint64 RecordCount;
+        uint32 RecordSize;
+        uint32 StringCount;
+    };
+
+    static_assert(std::is_same_v<WorldSnapshot::Key, Acore::Crypto::SHA1::Digest>);
+    static_assert(sizeof(FileHeader) == 16 && sizeof(SectionHeader) == 48 && sizeof(PayloadHeader) == 16);
+
+    constexpr uint64 Align8(uint64 size) { return (size + 7) & ~uint64(7); }
+}
+
+WorldSnapshot* WorldSnapshot::instance()
+{
+    static WorldSnapshot instance;
+    return &instance;
+}
+
+void WorldSnapshot::Open(std::string const& fileName)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    _fileName = fileName;
+    _sections = { };
+
+    if (!_file.Open(fileName))
+    {
+        LOG_INFO("server.loading", "World snapshot {} not found, loading from the database.", fileName);
+        return;
+    }
+
+    if (!ParseFile())
+    {
+        LOG_ERROR("server.loading", "World snapshot {} is invalid or of an older format, loading from the database.", fileName);
+        _sections = { };
+        _file.Close();
+        return;
+    }
+
+    LOG_INFO("server.loading", "Using world snapshot {} ({} bytes)", fileName, _file.GetSize());
+}
+
+bool WorldSnapshot::ParseFile()
+{
+    uint8 const* data = _file.GetData();
+    std::size_t size = _file.GetSize();
+
+    FileHeader header;
+    if (size < sizeof(header))
+        return false;
+
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.Magic, WORLD_SNAPSHOT_MAGIC, sizeof(header.Magic)) != 0 || header.Version != WORLD_SNAPSHOT_VERSION)
+        return false;
+
+    if (header.SectionCount > (size - sizeof(header)) / sizeof(SectionHeader))
+        return false;
+
+    for (uint32 i = 0; i < header.SectionCount; ++i)
+    {
+        SectionHeader sectionHeader;
+        std::memcpy(&sectionHeader, data + sizeof(header) + i * sizeof(sectionHeader), sizeof(sectionHeader));
+        if (sectionHeader.Offset % 8 || sectionHeader.Offset > size || sectionHeader.Size > size - sectionHeader.Offset)
+            return false;
+
+        // sections of a newer server are skipped
+        if (sectionHeader.Id >= MAX_WORLD_SNAPSHOT_SECTION)
+            continue;
+
+        Section& section = _sections[sectionHeader.Id];
+        section.SectionKey = sectionHeader.Key;
+        section.Stored = data + sectionHeader.Offset;
+        section.StoredSize = sectionHeader.Size;
+    }
+
+    return true;
+}
+
+bool WorldSnapshot::ReadSection(WorldSnapshotSection id, Key const& key, uint32 recordSize, uint8 const*& records, uint64& count, std::vector<std::string_view>& strings)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    Section& section = _sections[id];
+    if (section.State == SectionState::Written)
+        return false;
+
+    PayloadHeader header;
+    if (!section.Stored || section.SectionKey != key || section.StoredSize < sizeof(header))
+    {
+        section.State = SectionState::Stale;
+        return false;
+    }
+
+    std::memcpy(&header, section.Stored, sizeof(header));
+
+    uint64 recordsEnd = sizeof(header) + Align8(header.RecordCount * recordSize);
+    if (header.RecordSize != recordSize || header.RecordCount > section.StoredSize / recordSize || recordsEnd > section.StoredSize)
+    {
+        section.State = SectionState::Stale;
+        return false;
+    }
+
+    strings.clear();
+    strings.reserve(header.StringCount);
+    uint64 offset = recordsEnd;
+    for (uint32 i = 0; i < header.StringCount; ++i)
+    {
+        uint32 length;
+        if (section.StoredSize - offset < sizeof(length))
+            break;
+
+        std::memcpy(&length, section.Stored + offset, sizeof(length));
+        offset += sizeof(length);
+        if (section.StoredSize - offset < length)
+            break;
+
+        strings.emplace_back(reinterpret_cast<char const*>(section.Stored + offset), length);
+        offset += length;
+    }
+
+    if (strings.size() != header.StringCount)
+    {
+        section.State = SectionState::Stale;
+        return false;
+    }
+
+    section.State = SectionState::Valid;
+    records = section.Stored + sizeof(header);
+    count = header.RecordCount;
+    return true;
+}
+
+void WorldSnapshot::WriteSection(WorldSnapshotSection id, Key const& key, uint32 recordSize, uint8 const* records, uint64 count, std::vector<std::string> const& strings)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    if (!IsOpen())
+        return;
+
+    PayloadHeader header;
+    header.RecordCount = count;
+    header.RecordSize = recordSize;
+    header.StringCount = uint32(strings.size());
+
+    uint64 size = sizeof(header) + Align8(count * recordSize);
+    for (std::string const& string : strings)
+        size += sizeof(uint32) + string.size();
+
+    Section& section = _sections[id];
+    section.State = SectionState::Written;
+    section.SectionKey = key;
+    section.Pending.assign(size, 0);
+
+    uint8* out = section.Pending.data();
+    std::memcpy(out, &header, sizeof(header));
+    if (count)
+        std::memcpy(out + sizeof(header), records, count * recordSize);
+
+    out += sizeof(header) + Align8(count * recordSize);
+    for (std::string const& string : strings)
+    {
+        uint32 length = uint32(string.size());
+        std::memcpy(out, &length, sizeof(length));
+        std::memcpy(out + sizeof(length), string.data(), length);
+        out += sizeof(length) + length;
+    }
+}
+
+void WorldSnapshot::Save()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    if (!IsOpen())
+        return;
+
+    bool changed = false;
+    std::vector<std::pair<uint32, Section const*>> sections;
+    for (uint32 i = 0; i < MAX_WORLD_SNAPSHOT_SECTION; ++i)
+    {
+        Section const& section = _sections[i];
+        if (section.State == SectionState::Written)
+        {
+            changed = true;
+            sections.emplace_back(i, &section);
+        }
+        else if (section.State == SectionState::Stale)
+            changed |= section.Stored != nullptr;
+        else if (section.Stored)
+            sections.emplace_back(i, &section);
+    }
+
+    if (changed)
+    {
+        FileHeader header;
+        std::memcpy(header.Magic, WORLD_SNAPSHOT_MAGIC, sizeof(header.Magic));
+        header.Version = WORLD_SNAPSHOT_VERSION;
+        header.SectionCount = uint32(sections.size());
+        header.Reserved = 0;
+
+        std::vector<SectionHeader> sectionHeaders;
+        uint64 offset = sizeof(header) + sections.size() * sizeof(SectionHeader);
+        for (auto const& [id, section] : sections)
+        {
+            SectionHeader& sectionHeader = sectionHeaders.emplace_back();
+            std::memset(&sectionHeader, 0, sizeof(sectionHeader));
+            sectionHeader.Id = id;
+            sectionHeader.Offset = offset;
+            sectionHeader.Size = section->State == SectionState::Written ? section->Pending.size() : section->StoredSize;
+            sectionHeader.Key = section->SectionKey;
+            offset = Align8(offset + sectionHeader.Size);
+        }
+
+        // written next to the old file and renamed over it, the old one stays mapped meanwhile
+        std::string tempName = _fileName + ".tmp";
+        {
+            std::ofstream file(tempName, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+            file.write(reinterpret_cast<char const*>(sectionHeaders.data()), sectionHeaders.size() * sizeof(SectionHeader));
+
+            uint64 position = sizeof(header) + sectionHeaders.size() * sizeof(SectionHeader);
+            for (std::size_t i = 0; i < sections.size(); ++i)
+            {
+                static char const padding[8] = { };
+                file.write(padding, sectionHeaders[i].Offset - position);
+
+                Section const* section = sections[i].second;
+                if (section->State == SectionState::Written)
+                    file.write(reinterpret_cast<char const*>(section->Pending.data()), section->Pending.size());
+                else
+                    file.write(reinterpret_cast<char const*>(section->Stored), section->StoredSize);
+
+                position = sectionHeaders[i].Offset + sectionHeaders[i].Size;
+            }
+
+            file.close();
+            if (!file)
+            {
+                LOG_ERROR("server.loading", "Could not write world snapshot {}", tempName);
+                std::error_code error;
+                std::filesystem::remove(tempName, error);
+                changed = false;
+            }
+        }
+
+        if (changed)
+        {
+            _file.Close();
+
+            std::error_code error;
+            std::filesystem::rename(tempName, _fileName, error);
+            if (error)
+                LOG_ERROR("server.loading", "Could not replace world snapshot {}: {}", _fileName, error.message());
+            else
+                LOG_INFO("server.loading", "Saved world snapshot {} ({} sections, {} bytes)", _fileName, sections.size(), offset);
+        }
+    }
+
+    _file.Close();
+    _sections = { };
+    _fileName.clear();
+}
+
+Optional<WorldSnapshot::Key> WorldSnapshot::ComputeKey(std::initializer_list<std::string_view> tables, std::initializer_list<std::string_view> dbcFiles) const
+{
+    Acore::Crypto::SHA1 hash;
+    hash.UpdateData(GitRevision::GetHash());
+    hash.UpdateData(std::to_string(WORLD_SNAPSHOT_VERSION));
+
+    std::string query = "CHECKSUM TABLE ";
+    for (std::string_view table : tables)
+    {
+        if (table != *tables.begin())
+            query += ", ";
+
+        query += Acore::StringFormat("`{}`", table);
+    }
+
+    // Table, Checksum (NULL for missing tables)
+    QueryResult result = WorldDatabase.Query(query);
+    if (!result)
+        return { };
+
+    do
+    {
+        Field* fields = result->Fetch();
+        hash.UpdateData(fields[0].Get<std::string>());
+        hash.UpdateData(fields[1].IsNull() ? std::string("NULL") : fields[1].Get<std::string>());
+    } while (result->NextRow());
+
+    // spawns are validated against the client data, a changed DBC file must invalidate them as well
+    for (std::string_view dbcFile : dbcFiles)
+    {
+        hash.UpdateData(dbcFile);
+
+        std::ifstream file{ std::string(dbcFile), std::ios::binary };
+        if (!file)
+        {
+            hash.UpdateData("MISSING");
+            continue;
+        }
+
+        std::array<char, 64 * 1024> buffer;
+        while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0)
+            hash.UpdateData(reinterpret_cast<uint8 const*>(buffer.data()), std::size_t(file.gcount()));
+    }
+
+    hash.Finalize();
+    return hash.GetDigest();
+}
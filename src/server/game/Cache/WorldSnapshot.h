@@ -0,0 +1,129 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WORLD_SNAPSHOT_H_
+#define _WORLD_SNAPSHOT_H_
+
+#include "Define.h"
+#include "MappedFile.h"
+#include "Optional.h"
+#include <array>
+#include <initializer_list>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+enum WorldSnapshotSection : uint32
+{
+    WORLD_SNAPSHOT_CREATURES,
+    WORLD_SNAPSHOT_GAMEOBJECTS,
+
+    MAX_WORLD_SNAPSHOT_SECTION
+};
+
+/**
+ * Binary snapshot of loaded world data, used to skip the SQL queries on the next start.
+ *
+ * Each section holds an array of fixed size records plus a string table the records refer
+ * to by index. A section is stored together with a key, normally the checksum of the world
+ * tables it was built from (see ComputeKey()); reading it with a different key fails and the
+ * caller loads from SQL and writes the section again. The file is memory mapped until Save(),
+ * which rewrites it once the whole startup finished, keeping the sections still valid.
+ */
+class AC_GAME_API WorldSnapshot
+{
+    WorldSnapshot() = default;
+    ~WorldSnapshot() = default;
+
+    WorldSnapshot(WorldSnapshot const&) = delete;
+    WorldSnapshot(WorldSnapshot&&) = delete;
+
+    WorldSnapshot& operator= (WorldSnapshot const&) = delete;
+    WorldSnapshot& operator= (WorldSnapshot&&) = delete;
+public:
+    typedef std::array<uint8, 20> Key;                      // SHA1 digest
+
+    static WorldSnapshot* instance();
+
+    // Maps the snapshot file, an invalid or missing file leaves every section empty
+    void Open(std::string const& fileName);
+    // Writes the file if any section was rewritten and releases the mapping
+    void Save();
+
+    [[nodiscard]] bool IsOpen() const { return !_fileName.empty(); }
+
+    // Checksum of the given world tables, the contents of the given DBC files, the server revision and the snapshot format.
+    // Empty if the tables could not be checksummed. DBC overrides live in the `*_dbc` world tables, pass those as tables too
+    Optional<Key> ComputeKey(std::initializer_list<std::string_view> tables, std::initializer_list<std::string_view> dbcFiles = { }) const;
+
+    // Records of a section written with the same key. They point into the mapped file and stay valid until Save()
+    template<typename T>
+    bool Read(WorldSnapshotSection section, Key const& key, std::span<T const>& records, std::vector<std::string_view>& strings)
+    {
+        static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= 8, "snapshot records are read in place");
+
+        uint8 const* data;
+        uint64 count;
+        if (!ReadSection(section, key, sizeof(T), data, count, strings))
+            return false;
+
+        records = std::span<T const>(reinterpret_cast<T const*>(data), count);
+        return true;
+    }
+
+    template<typename T>
+    void Write(WorldSnapshotSection section, Key const& key, std::vector<T> const& records, std::vector<std::string> const& strings)
+    {
+        static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= 8, "snapshot records are read in place");
+
+        WriteSection(section, key, sizeof(T), reinterpret_cast<uint8 const*>(records.data()), records.size(), strings);
+    }
+
+private:
+    enum class SectionState : uint8
+    {
+        Unused,                                             // not requested (yet), kept as is
+        Valid,                                              // read with a matching key
+        Stale,                                              // requested with a different key
+        Written
+    };
+
+    struct Section
+    {
+        SectionState State = SectionState::Unused;
+        Key SectionKey = { };
+        uint8 const* Stored = nullptr;                      // payload in the mapped file
+        uint64 StoredSize = 0;
+        std::vector<uint8> Pending;                         // payload to write
+    };
+
+    bool ReadSection(WorldSnapshotSection section, Key const& key, uint32 recordSize, uint8 const*& records, uint64& count, std::vector<std::string_view>& strings);
+    void WriteSection(WorldSnapshotSection section, Key const& key, uint32 recordSize, uint8 const* records, uint64 count, std::vector<std::string> const& strings);
+    bool ParseFile();
+
+    std::mutex _lock;
+    std::string _fileName;
+    MappedFile _file;
+    std::array<Section, MAX_WORLD_SNAPSHOT_SECTION> _sections;
+};
+
+#define sWorldSnapshot WorldSnapshot::instance()
+
+#endif
@@ -912,16 +912,25 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
+    if (playersStore.empty())
+        return;
+
+    // every member socket queues the same payload
+    std::shared_ptr<WorldPacket const> sharedData = std::make_shared<WorldPacket const>(*data);
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
         if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(guid))
-            i->second.plrPtr->SendDirectMessage(data);
+            i->second.plrPtr->SendDirectMessage(sharedData);
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
 {
+    if (playersStore.empty())
+        return;
+
+    std::shared_ptr<WorldPacket const> sharedData = std::make_shared<WorldPacket const>(*data);
     for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
         if (i->first != who)
-            i->second.plrPtr->SendDirectMessage(data);
+            i->second.plrPtr->SendDirectMessage(sharedData);
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
@@ -932,8 +941,12 @@ void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
 
 void Channel::SendToAllWatching(WorldPacket* data)
 {
+    if (playersWatchingStore.empty())
+        return;
+
+    std::shared_ptr<WorldPacket const> sharedData = std::make_shared<WorldPacket const>(*data);
     for (PlayersWatchingContainer::const_iterator i = playersWatchingStore.begin(); i != playersWatchingStore.end(); ++i)
-        (*i)->SendDirectMessage(data);
+        (*i)->SendDirectMessage(sharedData);
 }
 
 bool Channel::ShouldAnnouncePlayer(Player const* player) const
@@ -32,6 +32,7 @@
 #include "SpellAuras.h"
 #include "SpellMgr.h"
 #include "WorldState.h"
+#include <algorithm>
 
 // Checks if object meets the condition
 // Can have CONDITION_SOURCE_TYPE_NONE && !mReferenceId if called from a special event (ie: eventAI)
@@ -99,7 +100,10 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
             {
                 if (FactionEntry const* faction = sFactionStore.LookupEntry(ConditionValue1))
                 {
-                    condMeets = (ConditionValue2 & (1 << player->GetReputationMgr().GetRank(faction)));
+                    condMeets = player->GetConditionCache().Evaluate(this, [&]()
+                    {
+                        return (ConditionValue2 & (1 << player->GetReputationMgr().GetRank(faction))) != 0;
+                    });
                 }
             }
         }
@@ -111,7 +115,7 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
         {
             if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
             {
-                condMeets = player->HasAchieved(ConditionValue1);
+                condMeets = player->GetConditionCache().Evaluate(this, [&]() { return player->HasAchieved(ConditionValue1); });
             }
         }
         break;
@@ -169,7 +173,7 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
         {
             if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
             {
-                condMeets = player->GetQuestRewardStatus(ConditionValue1);
+                condMeets = player->GetConditionCache().Evaluate(this, [&]() { return player->GetQuestRewardStatus(ConditionValue1); });
             }
         }
         break;
@@ -855,7 +859,49 @@ uint32 Condition::GetMaxAvailableConditionTargets()
     return 1;
 }
 
-ConditionMgr::ConditionMgr() {}
+bool ConditionProgram::Evaluate(ConditionSourceInfo& sourceInfo) const
+{
+    if (_instructions.empty())
+        return _conditions.empty();
+
+    // keep reporting the failed condition which comes last in the source list,
+    // like when every ElseGroup was checked in list order
+    Condition* lastFailedCondition = sourceInfo.mLastFailedCondition;
+    uint32 lastFailedPosition = 0;
+    bool failed = false;
+
+    for (uint32 i = 0; i < _instructions.size();)
+    {
+        Instruction const& instruction = _instructions[i];
+        bool meets = true;
+        if (instruction.Reference)
+            meets = instruction.Reference->Evaluate(sourceInfo);
+        else if (!instruction.Cond->ReferenceId)
+            meets = instruction.Cond->Meets(sourceInfo);
+
+        if (!meets)
+        {
+            if (!failed || instruction.Position > lastFailedPosition)
+            {
+                lastFailedCondition = sourceInfo.mLastFailedCondition;
+                lastFailedPosition = instruction.Position;
+                failed = true;
+            }
+
+            i = instruction.NextGroup;
+            continue;
+        }
+
+        // all conditions of the group are met
+        if (++i == instruction.NextGroup)
+            return true;
+    }
+
+    sourceInfo.mLastFailedCondition = lastFailedCondition;
+    return false;
+}
+
+ConditionMgr::ConditionMgr() : _generation(0) {}
 
 ConditionMgr::~ConditionMgr()
 {
@@ -873,7 +919,7 @@ ConditionList ConditionMgr::GetConditionReferences(uint32 refId)
     ConditionList                               conditions;
     ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(refId);
     if (ref != ConditionReferenceStore.end())
-        conditions = (*ref).second;
+        conditions = ref->second.GetConditions();
     return conditions;
 }
 
@@ -899,7 +945,7 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& co
         {
             ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
             ASSERT(ref != ConditionReferenceStore.end() && "ConditionMgr::GetSearcherTypeMaskForConditionList - incorrect reference");
-            ElseGroupStore[(*i)->ElseGroup] &= GetSearcherTypeMaskForConditionList((*ref).second);
+            ElseGroupStore[(*i)->ElseGroup] &= GetSearcherTypeMaskForConditionList(ref->second.GetConditions());
         }
         else // handle normal condition
         {
@@ -918,6 +964,36 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& co
 
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
 {
+    // most lists have a single ElseGroup, all of its conditions have to be met
+    if (std::all_of(conditions.begin(), conditions.end(), [&](Condition const* cond) { return cond->ElseGroup == conditions.front()->ElseGroup; }))
+    {
+        bool loaded = false;
+        for (Condition* cond : conditions)
+        {
+            if (!cond->isLoaded())
+                continue;
+
+            loaded = true;
+            if (cond->ReferenceId)
+            {
+                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(cond->ReferenceId);
+                if (ref != ConditionReferenceStore.end())
+                {
+                    if (!ref->second.Evaluate(sourceInfo))
+                        return false;
+                }
+                else
+                {
+                    LOG_DEBUG("condition", "IsPlayerMeetToConditionList: Reference template -{} not found", cond->ReferenceId);
+                }
+            }
+            else if (!cond->Meets(sourceInfo))
+                return false;
+        }
+
+        return loaded;
+    }
+
     //     groupId, groupCheckPassed
     std::map<uint32, bool> ElseGroupStore;
     for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
@@ -938,7 +1014,7 @@ bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo,
                 ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
                 if (ref != ConditionReferenceStore.end())
                 {
-                    if (!IsObjectMeetToConditionList(sourceInfo, (*ref).second))
+                    if (!ref->second.Evaluate(sourceInfo))
                         ElseGroupStore[(*i)->ElseGroup] = false;
                 }
                 else
@@ -981,6 +1057,26 @@ bool ConditionMgr::IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, Con
     return IsObjectMeetToConditionList(sourceInfo, conditions);
 }
 
+bool ConditionMgr::IsObjectMeetToConditions(WorldObject* object, ConditionProgram const* program)
+{
+    ConditionSourceInfo srcInfo = ConditionSourceInfo(object);
+    return IsObjectMeetToConditions(srcInfo, program);
+}
+
+bool ConditionMgr::IsObjectMeetToConditions(WorldObject* object1, WorldObject* object2, ConditionProgram const* program)
+{
+    ConditionSourceInfo srcInfo = ConditionSourceInfo(object1, object2);
+    return IsObjectMeetToConditions(srcInfo, program);
+}
+
+bool ConditionMgr::IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionProgram const* program)
+{
+    if (!program)
+        return true;
+
+    return program->Evaluate(sourceInfo);
+}
+
 bool ConditionMgr::CanHaveSourceGroupSet(ConditionSourceType sourceType) const
 {
     return (sourceType == CONDITION_SOURCE_TYPE_CREATURE_LOOT_TEMPLATE || sourceType == CONDITION_SOURCE_TYPE_DISENCHANT_LOOT_TEMPLATE || sourceType == CONDITION_SOURCE_TYPE_FISHING_LOOT_TEMPLATE || sourceType == CONDITION_SOURCE_TYPE_GAMEOBJECT_LOOT_TEMPLATE || sourceType == CONDITION_SOURCE_TYPE_ITEM_LOOT_TEMPLATE || sourceType == CONDITION_SOURCE_TYPE_MAIL_LOOT_TEMPLATE || sourceType == CONDITION_SOURCE_TYPE_MILLING_LOOT_TEMPLATE ||
@@ -993,131 +1089,90 @@ bool ConditionMgr::CanHaveSourceIdSet(ConditionSourceType sourceType) const
     return (sourceType == CONDITION_SOURCE_TYPE_SMART_EVENT || sourceType == CONDITION_SOURCE_TYPE_OBJECT_VISIBILITY);
 }
 
-ConditionList ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry)
+ConditionProgram const* ConditionMgr::GetConditionProgram(ConditionSourceType sourceType, uint32 sourceGroup, int32 sourceEntry, uint32 sourceId /*= 0*/) const
 {
-    ConditionList spellCond;
-    if (sourceType > CONDITION_SOURCE_TYPE_NONE && sourceType < CONDITION_SOURCE_TYPE_MAX)
-    {
-        ConditionContainer::const_iterator itr = ConditionStore.find(sourceType);
-        if (itr != ConditionStore.end())
-        {
-            ConditionTypeContainer::const_iterator i = (*itr).second.find(entry);
-            if (i != (*itr).second.end())
-            {
-                spellCond = (*i).second;
-                LOG_DEBUG("condition", "GetConditionsForNotGroupedEntry: found conditions for type {} and entry {}", uint32(sourceType), entry);
-            }
-        }
-    }
-    return spellCond;
+    ConditionProgramContainer::const_iterator itr = ConditionProgramStore.find({ sourceType, sourceGroup, sourceEntry, sourceId });
+    return itr != ConditionProgramStore.end() ? &itr->second : nullptr;
 }
 
-ConditionList ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId)
+ConditionProgram const* ConditionMgr::GetConditionProgramForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const
 {
-    ConditionList                                   cond;
-    CreatureSpellConditionContainer::const_iterator itr = SpellClickEventConditionStore.find(creatureId);
-    if (itr != SpellClickEventConditionStore.end())
-    {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            LOG_DEBUG("condition", "GetConditionsForSpellClickEvent: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
-        }
-    }
-    return cond;
+    if (sourceType <= CONDITION_SOURCE_TYPE_NONE || sourceType >= CONDITION_SOURCE_TYPE_MAX)
+        return nullptr;
+
+    return GetConditionProgram(sourceType, 0, int32(entry));
 }
 
-ConditionList ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId)
+ConditionProgram const* ConditionMgr::GetConditionProgramForSpellClickEvent(uint32 creatureId, uint32 spellId) const
 {
-    ConditionList                                   cond;
-    CreatureSpellConditionContainer::const_iterator itr = VehicleSpellConditionStore.find(creatureId);
-    if (itr != VehicleSpellConditionStore.end())
-    {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            LOG_DEBUG("condition", "GetConditionsForVehicleSpell: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
-        }
-    }
-    return cond;
+    return GetConditionProgram(CONDITION_SOURCE_TYPE_SPELL_CLICK_EVENT, creatureId, int32(spellId));
 }
 
-ConditionList ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType)
+ConditionProgram const* ConditionMgr::GetConditionProgramForVehicleSpell(uint32 creatureId, uint32 spellId) const
 {
-    ConditionList                                cond;
-    SmartEventConditionContainer::const_iterator itr = SmartEventConditionStore.find(std::make_pair(entryOrGuid, sourceType));
-    if (itr != SmartEventConditionStore.end())
-    {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(eventId + 1);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            LOG_DEBUG("condition", "GetConditionsForSmartEvent: found conditions for Smart Event entry or guid {} event_id {}", entryOrGuid, eventId);
-        }
-    }
-    return cond;
+    return GetConditionProgram(CONDITION_SOURCE_TYPE_VEHICLE_SPELL, creatureId, int32(spellId));
 }
 
-ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId)
+ConditionProgram const* ConditionMgr::GetConditionProgramForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const
 {
-    ConditionList                               cond;
-    NpcVendorConditionContainer::const_iterator itr = NpcVendorConditionContainerStore.find(creatureId);
-    if (itr != NpcVendorConditionContainerStore.end())
-    {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(itemId);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            if (itemId)
-            {
-                LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {} item {}", creatureId, itemId);
-            }
-            else
-            {
-                LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {}", creatureId);
-            }
-        }
-    }
-    return cond;
+    return GetConditionProgram(CONDITION_SOURCE_TYPE_SMART_EVENT, eventId + 1, entryOrGuid, sourceType);
 }
 
-ConditionList ConditionMgr::GetConditionsForObjectVisibility(WorldObject const* object) const
+ConditionProgram const* ConditionMgr::GetConditionProgramForNpcVendorEvent(uint32 creatureId, uint32 itemId) const
 {
-    ConditionList cond;
+    return GetConditionProgram(CONDITION_SOURCE_TYPE_NPC_VENDOR, creatureId, int32(itemId));
+}
 
+ConditionProgram const* ConditionMgr::GetConditionProgramForObjectVisibility(WorldObject const* object) const
+{
     if (!object->IsCreature() && !object->IsGameObject())
-        return cond;
+        return nullptr;
 
     uint32 entry = object->GetEntry();
     uint32 sourceGroup = object->IsGameObject() ? 1 : 0;
+    uint32 guid = object->IsGameObject() ? object->ToGameObject()->GetSpawnId() : object->ToCreature()->GetSpawnId();
 
-    auto itrBucket = ObjectVisibilityConditionStore.find(std::make_pair(entry, sourceGroup));
-    if (itrBucket == ObjectVisibilityConditionStore.end())
-        return cond;
+    // guid-level conditions replace the entry-level ones
+    if (ConditionProgram const* program = GetConditionProgram(CONDITION_SOURCE_TYPE_OBJECT_VISIBILITY, sourceGroup, int32(entry), guid))
+        return program;
 
-    uint32 guid = object->IsGameObject() ? object->ToGameObject()->GetSpawnId() : object->ToCreature()->GetSpawnId();
+    return GetConditionProgram(CONDITION_SOURCE_TYPE_OBJECT_VISIBILITY, sourceGroup, int32(entry));
+}
 
-    auto const& sourceIdConditions = itrBucket->second;
+ConditionList ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry)
+{
+    ConditionProgram const* program = GetConditionProgramForNotGroupedEntry(sourceType, entry);
+    return program ? program->GetConditions() : ConditionList();
+}
 
-    auto itrGuid = sourceIdConditions.find(guid);
-    if (itrGuid != sourceIdConditions.end())
-    {
-        cond.insert(cond.end(), itrGuid->second.begin(), itrGuid->second.end());
-        LOG_DEBUG("condition", "GetConditionsForObjectVisibility: found guid-level conditions for sourceGroup {} entry {} guid {}", sourceGroup, entry, guid);
-    }
-    else
-    {
-        auto itrEntry = sourceIdConditions.find(0);
-        if (itrEntry != sourceIdConditions.end())
-        {
-            cond.insert(cond.end(), itrEntry->second.begin(), itrEntry->second.end());
-            LOG_DEBUG("condition", "GetConditionsForObjectVisibility: found entry-level conditions for sourceGroup {} entry {}", sourceGroup, entry);
-        }
-    }
+ConditionList ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId)
+{
+    ConditionProgram const* program = GetConditionProgramForSpellClickEvent(creatureId, spellId);
+    return program ? program->GetConditions() : ConditionList();
+}
 
-    return cond;
+ConditionList ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId)
+{
+    ConditionProgram const* program = GetConditionProgramForVehicleSpell(creatureId, spellId);
+    return program ? program->GetConditions() : ConditionList();
+}
+
+ConditionList ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType)
+{
+    ConditionProgram const* program = GetConditionProgramForSmartEvent(entryOrGuid, eventId, sourceType);
+    return program ? program->GetConditions() : ConditionList();
+}
+
+ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId)
+{
+    ConditionProgram const* program = GetConditionProgramForNpcVendorEvent(creatureId, itemId);
+    return program ? program->GetConditions() : ConditionList();
+}
+
+ConditionList ConditionMgr::GetConditionsForObjectVisibility(WorldObject const* object) const
+{
+    ConditionProgram const* program = GetConditionProgramForObjectVisibility(object);
+    return program ? program->GetConditions() : ConditionList();
 }
 
 void ConditionMgr::LoadConditions(bool isReload)
@@ -1125,6 +1180,7 @@ void ConditionMgr::LoadConditions(bool isReload)
     uint32 oldMSTime = getMSTime();
 
     Clean();
+    ++_generation;
 
     // must clear all custom handled cases (groupped types) before reload
     if (isReload)
@@ -1227,12 +1283,7 @@ void ConditionMgr::LoadConditions(bool isReload)
         if (iSourceTypeOrReferenceId < 0) // it is a reference template
         {
             uint32 uRefId = std::abs(iSourceTypeOrReferenceId);
-            if (ConditionReferenceStore.find(uRefId) == ConditionReferenceStore.end()) // make sure we have a list for our conditions, based on reference id
-            {
-                ConditionList mCondList;
-                ConditionReferenceStore[uRefId] = mCondList;
-            }
-            ConditionReferenceStore[uRefId].push_back(cond); // add to reference storage
+            ConditionReferenceStore[uRefId]._conditions.push_back(cond); // add to reference storage, compiled once everything is loaded
             count++;
             continue;
         } // end of reference templates
@@ -1321,7 +1372,7 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_SPELL_CLICK_EVENT:
             {
-                SpellClickEventConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                ConditionProgramStore[{ cond->SourceType, cond->SourceGroup, cond->SourceEntry, 0 }]._conditions.push_back(cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
@@ -1331,30 +1382,28 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_VEHICLE_SPELL:
             {
-                VehicleSpellConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                ConditionProgramStore[{ cond->SourceType, cond->SourceGroup, cond->SourceEntry, 0 }]._conditions.push_back(cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
             }
             case CONDITION_SOURCE_TYPE_SMART_EVENT:
             {
-                //! TODO: PAIR_32 ?
-                std::pair<int32, uint32> key = std::make_pair(cond->SourceEntry, cond->SourceId);
-                SmartEventConditionStore[key][cond->SourceGroup].push_back(cond);
+                ConditionProgramStore[{ cond->SourceType, cond->SourceGroup, cond->SourceEntry, cond->SourceId }]._conditions.push_back(cond);
                 valid = true;
                 ++count;
                 continue;
             }
             case CONDITION_SOURCE_TYPE_NPC_VENDOR:
             {
-                NpcVendorConditionContainerStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                ConditionProgramStore[{ cond->SourceType, cond->SourceGroup, cond->SourceEntry, 0 }]._conditions.push_back(cond);
                 valid = true;
                 ++count;
                 continue;
             }
             case CONDITION_SOURCE_TYPE_OBJECT_VISIBILITY:
             {
-                ObjectVisibilityConditionStore[std::make_pair(uint32(cond->SourceEntry), cond->SourceGroup)][cond->SourceId].push_back(cond);
+                ConditionProgramStore[{ cond->SourceType, cond->SourceGroup, cond->SourceEntry, cond->SourceId }]._conditions.push_back(cond);
                 valid = true;
                 ++count;
                 continue; // do not add to AllocatedMemoryStore to avoid double-deleting
@@ -1382,29 +1431,31 @@ void ConditionMgr::LoadConditions(bool isReload)
         }
 
         // handle not grouped conditions
-        // make sure we have a storage list for our SourceType
-        if (ConditionStore.find(cond->SourceType) == ConditionStore.end())
-        {
-            ConditionTypeContainer mTypeMap;
-            ConditionStore[cond->SourceType] = mTypeMap; // add new empty list for SourceType
-        }
-
-        // make sure we have a condition list for our SourceType's entry
-        if (ConditionStore[cond->SourceType].find(cond->SourceEntry) == ConditionStore[cond->SourceType].end())
-        {
-            ConditionList mCondList;
-            ConditionStore[cond->SourceType][cond->SourceEntry] = mCondList;
-        }
-
         // add new Condition to storage based on Type/Entry
-        ConditionStore[cond->SourceType][cond->SourceEntry].push_back(cond);
+        ConditionProgramStore[{ cond->SourceType, 0, cond->SourceEntry, 0 }]._conditions.push_back(cond);
         ++count;
     } while (result->NextRow());
 
+    CompilePrograms();
+
     LOG_INFO("server.loading", ">> Loaded {} conditions in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
 
+void ConditionMgr::LoadConditionsForTest(std::map<uint32, ConditionList> const& references, ConditionList const& conditions)
+{
+    Clean();
+    ++_generation;
+
+    for (auto const& [referenceId, referenceConditions] : references)
+        ConditionReferenceStore[referenceId]._conditions = referenceConditions;
+
+    for (Condition* cond : conditions)
+        ConditionProgramStore[{ cond->SourceType, 0, cond->SourceEntry, 0 }]._conditions.push_back(cond);
+
+    CompilePrograms();
+}
+
 bool ConditionMgr::addToLootTemplate(Condition* cond, LootTemplate* loot)
 {
     if (!loot)
@@ -2641,90 +2692,83 @@ bool ConditionMgr::isConditionTypeValid(Condition* cond)
     return true;
 }
 
-void ConditionMgr::Clean()
+void ConditionMgr::CompilePrograms()
 {
-    for (ConditionReferenceContainer::iterator itr = ConditionReferenceStore.begin(); itr != ConditionReferenceStore.end(); ++itr)
-    {
-        for (ConditionList::const_iterator it = itr->second.begin(); it != itr->second.end(); ++it) delete *it;
-        itr->second.clear();
-    }
+    std::vector<uint32> referenceStack;
+    for (auto& [referenceId, program] : ConditionReferenceStore)
+        Compile(program, referenceId, referenceStack);
 
-    ConditionReferenceStore.clear();
+    for (auto& [key, program] : ConditionProgramStore)
+        Compile(program, 0, referenceStack);
+}
 
-    for (ConditionContainer::iterator itr = ConditionStore.begin(); itr != ConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
+void ConditionMgr::Compile(ConditionProgram& program, uint32 referenceId, std::vector<uint32>& referenceStack)
+{
+    // already compiled as a dependency of another reference
+    if (!program._instructions.empty())
+        return;
 
-    ConditionStore.clear();
+    referenceStack.push_back(referenceId);
 
-    for (CreatureSpellConditionContainer::iterator itr = VehicleSpellConditionStore.begin(); itr != VehicleSpellConditionStore.end(); ++itr)
+    uint32 position = 0;
+    for (Condition* cond : program._conditions)
     {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
-
-    VehicleSpellConditionStore.clear();
+        uint32 const conditionPosition = position++;
+        if (!cond->isLoaded())
+            continue;
 
-    for (SmartEventConditionContainer::iterator itr = SmartEventConditionStore.begin(); itr != SmartEventConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
+        ConditionProgram::Instruction instruction = { cond, nullptr, 0, conditionPosition };
+        if (cond->ReferenceId)
         {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
+            ConditionReferenceContainer::iterator ref = ConditionReferenceStore.find(cond->ReferenceId);
+            if (ref == ConditionReferenceStore.end())
+                LOG_ERROR("sql.sql", "Condition (SourceType: {}, SourceGroup: {}, SourceEntry: {}) uses not existing reference template -{}, reference ignored.", uint32(cond->SourceType), cond->SourceGroup, cond->SourceEntry, cond->ReferenceId);
+            else if (std::find(referenceStack.begin(), referenceStack.end(), cond->ReferenceId) != referenceStack.end())
+                LOG_ERROR("sql.sql", "Condition reference template -{} is referencing itself through -{}, reference ignored.", cond->ReferenceId, referenceStack.back());
+            else
+            {
+                Compile(ref->second, cond->ReferenceId, referenceStack);
+                instruction.Reference = &ref->second;
+            }
         }
-        itr->second.clear();
+
+        program._instructions.push_back(instruction);
     }
 
-    SmartEventConditionStore.clear();
+    // group the conditions by ElseGroup, keeping the list order within every group
+    std::stable_sort(program._instructions.begin(), program._instructions.end(), [](ConditionProgram::Instruction const& left, ConditionProgram::Instruction const& right)
+    {
+        return left.Cond->ElseGroup < right.Cond->ElseGroup;
+    });
 
-    for (CreatureSpellConditionContainer::iterator itr = SpellClickEventConditionStore.begin(); itr != SpellClickEventConditionStore.end(); ++itr)
+    for (uint32 end = program._instructions.size(); end > 0;)
     {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
+        uint32 begin = end - 1;
+        while (begin > 0 && program._instructions[begin - 1].Cond->ElseGroup == program._instructions[end - 1].Cond->ElseGroup)
+            --begin;
 
-    SpellClickEventConditionStore.clear();
+        for (uint32 i = begin; i < end; ++i)
+            program._instructions[i].NextGroup = end;
 
-    for (NpcVendorConditionContainer::iterator itr = NpcVendorConditionContainerStore.begin(); itr != NpcVendorConditionContainerStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
+        end = begin;
     }
 
-    NpcVendorConditionContainerStore.clear();
+    referenceStack.pop_back();
+}
 
-    for (auto& itr : ObjectVisibilityConditionStore)
-    {
-        for (auto& sourceIdConds : itr.second)
-        {
-            for (Condition* cond : sourceIdConds.second)
-                delete cond;
+void ConditionMgr::Clean()
+{
+    for (auto& [referenceId, program] : ConditionReferenceStore)
+        for (Condition* cond : program._conditions)
+            delete cond;
 
-            sourceIdConds.second.clear();
-        }
+    ConditionReferenceStore.clear();
 
-        itr.second.clear();
-    }
+    for (auto& [key, program] : ConditionProgramStore)
+        for (Condition* cond : program._conditions)
+            delete cond;
 
-    ObjectVisibilityConditionStore.clear();
+    ConditionProgramStore.clear();
 
     // this is a BIG hack, feel free to fix it if you can figure out the ConditionMgr ;)
     for (std::list<Condition*>::const_iterator itr = AllocatedMemoryStore.begin(); itr != AllocatedMemoryStore.end(); ++itr) delete *itr;
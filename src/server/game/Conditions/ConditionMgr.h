@@ -21,6 +21,9 @@
 #include "Define.h"
 #include <list>
 #include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 class Player;
 class Unit;
@@ -110,16 +113,18 @@ enum ConditionTypes
 
     The following steps only apply if your condition can be grouped:
 
-    Step 6: Determine how you are going to store your conditions. You need to add a new storage container
-            for it in ConditionMgr class, along with a function like:
-            ConditionList GetConditionsForXXXYourNewSourceTypeXXX(parameters...)
+    Step 6: Determine how you are going to store your conditions. Conditions which are not kept by their
+            owner (like loot templates and gossip menus do) go to ConditionProgramStore, keyed by
+            SourceType, SourceGroup, SourceEntry and SourceId, along with a function like:
+            ConditionProgram const* GetConditionProgramForXXXYourNewSourceTypeXXX(parameters...)
 
             The above function should be placed in upper level (practical) code that actually
             checks the conditions.
 
     Step 7: Implement loading for your source type in ConditionMgr::LoadConditions.
 
-    Step 8: Implement memory cleaning for your source type in ConditionMgr::Clean.
+    Step 8: Implement memory cleaning for your source type in ConditionMgr::Clean, unless it is
+            stored in ConditionProgramStore.
 */
 enum ConditionSourceType
 {
@@ -238,14 +243,59 @@ struct Condition
 };
 
 typedef std::list<Condition*> ConditionList;
-typedef std::map<uint32, ConditionList> ConditionTypeContainer;
-typedef std::map<ConditionSourceType, ConditionTypeContainer> ConditionContainer;
-typedef std::map<uint32, ConditionTypeContainer> CreatureSpellConditionContainer;
-typedef std::map<uint32, ConditionTypeContainer> NpcVendorConditionContainer;
-typedef std::map<std::pair<int32, uint32 /*SAI source_type*/>, ConditionTypeContainer> SmartEventConditionContainer;
-typedef std::map<std::pair<uint32 /*SourceEntry*/, uint32 /*SourceGroup*/>, std::map<uint32 /*SourceId*/, ConditionList>> ObjectVisibilityConditionContainer;
 
-typedef std::map<uint32, ConditionList> ConditionReferenceContainer;//only used for references
+// A ConditionList compiled at load time. The conditions are kept sorted by ElseGroup in one flat
+// array and every instruction knows where the next ElseGroup starts, so a failed condition skips
+// the rest of its group and the first group which is fully met ends the evaluation.
+class ConditionProgram
+{
+public:
+    [[nodiscard]] bool IsEmpty() const { return _conditions.empty(); }
+    [[nodiscard]] ConditionList const& GetConditions() const { return _conditions; }
+
+    bool Evaluate(ConditionSourceInfo& sourceInfo) const;
+
+private:
+    friend class ConditionMgr;
+
+    struct Instruction
+    {
+        Condition* Cond;
+        ConditionProgram const* Reference; // compiled reference template, nullptr if not found
+        uint32 NextGroup;                  // index of the first instruction of the next ElseGroup
+        uint32 Position;                   // position in the source list
+    };
+
+    std::vector<Instruction> _instructions;
+    ConditionList _conditions;
+};
+
+struct ConditionProgramKey
+{
+    ConditionSourceType SourceType;
+    uint32 SourceGroup;
+    int32 SourceEntry;
+    uint32 SourceId;
+
+    bool operator==(ConditionProgramKey const& right) const = default;
+};
+
+namespace std
+{
+    template<>
+    struct hash<ConditionProgramKey>
+    {
+        size_t operator()(ConditionProgramKey const& key) const
+        {
+            uint64 const high = (uint64(key.SourceType) << 32) | key.SourceGroup;
+            uint64 const low = (uint64(uint32(key.SourceEntry)) << 32) | key.SourceId;
+            return hash<uint64>()(high * 0x9E3779B97F4A7C15ULL ^ low);
+        }
+    };
+}
+
+typedef std::unordered_map<ConditionProgramKey, ConditionProgram> ConditionProgramContainer;
+typedef std::unordered_map<uint32, ConditionProgram> ConditionReferenceContainer; //only used for references
 
 class ConditionMgr
 {
@@ -264,6 +314,9 @@ public:
     bool IsObjectMeetToConditions(WorldObject* object, ConditionList const& conditions);
     bool IsObjectMeetToConditions(WorldObject* object1, WorldObject* object2, ConditionList const& conditions);
     bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
+    bool IsObjectMeetToConditions(WorldObject* object, ConditionProgram const* program);
+    bool IsObjectMeetToConditions(WorldObject* object1, WorldObject* object2, ConditionProgram const* program);
+    bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionProgram const* program);
     [[nodiscard]] bool CanHaveSourceGroupSet(ConditionSourceType sourceType) const;
     [[nodiscard]] bool CanHaveSourceIdSet(ConditionSourceType sourceType) const;
     ConditionList GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry);
@@ -273,6 +326,21 @@ public:
     ConditionList GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
     ConditionList GetConditionsForObjectVisibility(WorldObject const* object) const;
 
+    // Compiled variants of the lookups above, nullptr when there are no conditions
+    [[nodiscard]] ConditionProgram const* GetConditionProgramForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const;
+    [[nodiscard]] ConditionProgram const* GetConditionProgramForSpellClickEvent(uint32 creatureId, uint32 spellId) const;
+    [[nodiscard]] ConditionProgram const* GetConditionProgramForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const;
+    [[nodiscard]] ConditionProgram const* GetConditionProgramForVehicleSpell(uint32 creatureId, uint32 spellId) const;
+    [[nodiscard]] ConditionProgram const* GetConditionProgramForNpcVendorEvent(uint32 creatureId, uint32 itemId) const;
+    [[nodiscard]] ConditionProgram const* GetConditionProgramForObjectVisibility(WorldObject const* object) const;
+
+    // Incremented on every (re)load, conditions cached by players are only valid for the generation they were stored in
+    [[nodiscard]] uint32 GetGeneration() const { return _generation; }
+
+    // Replaces all the loaded conditions by the given not grouped conditions and reference templates,
+    // the conditions are owned by the manager afterwards
+    void LoadConditionsForTest(std::map<uint32, ConditionList> const& references, ConditionList const& conditions);
+
 private:
     bool isSourceTypeValid(Condition* cond);
     bool addToLootTemplate(Condition* cond, LootTemplate* loot);
@@ -280,19 +348,71 @@ private:
     bool addToGossipMenuItems(Condition* cond);
     bool addToSpellImplicitTargetConditions(Condition* cond);
     bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
+    [[nodiscard]] ConditionProgram const* GetConditionProgram(ConditionSourceType sourceType, uint32 sourceGroup, int32 sourceEntry, uint32 sourceId = 0) const;
+    void CompilePrograms();
+    void Compile(ConditionProgram& program, uint32 referenceId, std::vector<uint32>& referenceStack);
 
     void Clean(); // free up resources
     std::list<Condition*> AllocatedMemoryStore; // some garbage collection :)
 
-    ConditionContainer                 ConditionStore;
-    ConditionReferenceContainer        ConditionReferenceStore;
-    CreatureSpellConditionContainer    VehicleSpellConditionStore;
-    CreatureSpellConditionContainer    SpellClickEventConditionStore;
-    NpcVendorConditionContainer        NpcVendorConditionContainerStore;
-    SmartEventConditionContainer       SmartEventConditionStore;
-    ObjectVisibilityConditionContainer ObjectVisibilityConditionStore;
+    ConditionProgramContainer   ConditionProgramStore;
+    ConditionReferenceContainer ConditionReferenceStore;
+    uint32 _generation;
 };
 
 #define sConditionMgr ConditionMgr::instance()
 
+// Results of the conditions which only depend on persistent player state (rewarded quests,
+// achievements, reputation ranks), invalidated by the player whenever that state changes.
+// Conditions of a player may be checked from other map update threads (e.g. visibility of
+// objects updated in parallel), so the results are guarded by a lock
+class PlayerConditionCache
+{
+public:
+    template<class Check>
+    bool Evaluate(Condition const* condition, Check&& check)
+    {
+        uint32 const generation = sConditionMgr->GetGeneration();
+        uint32 invalidations;
+
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            if (_generation != generation)
+            {
+                _results.clear();
+                _generation = generation;
+            }
+
+            auto itr = _results.find(condition);
+            if (itr != _results.end())
+                return itr->second;
+
+            invalidations = _invalidations;
+        }
+
+        // the check itself may touch other players' caches, never run it under the lock
+        bool const result = check();
+
+        // drop the result if the player state changed while it was being computed
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_generation == generation && _invalidations == invalidations)
+            _results.emplace(condition, result);
+
+        return result;
+    }
+
+    void Invalidate()
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _results.clear();
+        ++_invalidations;
+    }
+
+private:
+    std::mutex _lock;
+    std::unordered_map<Condition const*, bool> _results;
+    uint32 _generation = 0;
+    uint32 _invalidations = 0;
+};
+
 #endif
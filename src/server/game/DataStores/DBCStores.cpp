@@ -26,7 +26,11 @@
 #include "SpellMgr.h"
 #include "TransportMgr.h"
 #include "World.h"
+#include <atomic>
+#include <filesystem>
+#include <functional>
 #include <map>
+#include <thread>
 
 typedef std::map<uint16, uint32> AreaFlagByAreaID;
 typedef std::map<uint32, uint32> AreaFlagByMapID;
@@ -210,12 +214,11 @@ static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, std::string const&
 }
 
 template<class T>
-inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, char const* dbTable = nullptr)
+inline void LoadDBC(uint32 availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, char const* dbTable = nullptr)
 {
     // compatibility format and C++ structure sizes
     ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
-    ++DBCFileCount;
     std::string dbcFilename = dbcPath + filename;
     bool existDBData = false;
 
@@ -231,8 +234,7 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
             localizedName.push_back('/');
             localizedName.append(filename);
 
-            if (!storage.LoadStringsFrom(localizedName.c_str()))
-                availableDbcLocales &= ~(1 << i);             // mark as not available for speedup next checks
+            storage.LoadStringsFrom(localizedName.c_str());
         }
     }
 
@@ -258,16 +260,24 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
     }
 }
 
-void LoadDBCStores(std::string const& dataPath)
+void LoadDBCStores(std::string const& dataPath, uint32 threads)
 {
     uint32 oldMSTime = getMSTime();
 
     std::string dbcPath = dataPath + "dbc/";
 
-    StoreProblemList bad_dbc_files;
-    uint32 availableDbcLocales = 0xFFFFFFFF;
+    std::vector<std::function<void(StoreProblemList&)>> loads;
 
-#define LOAD_DBC(store, file, dbtable) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, dbtable)
+    // the locales are looked up once before the parallel loads, so every store skips the same locales
+    uint32 availableDbcLocales = 0;
+    for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+    {
+        std::error_code error;
+        if (std::filesystem::is_directory(dbcPath + localeNames[i], error))
+            availableDbcLocales |= 1 << i;
+    }
+
+#define LOAD_DBC(store, file, dbtable) loads.emplace_back([&, availableDbcLocales](StoreProblemList& errors) { LoadDBC(availableDbcLocales, errors, store, dbcPath, file, dbtable); })
 
     LOAD_DBC(sAreaTableStore,                       "AreaTable.dbc",                        "areatable_dbc");
     LOAD_DBC(sAchievementStore,                     "Achievement.dbc",                      "achievement_dbc");
@@ -384,6 +394,28 @@ void LoadDBCStores(std::string const& dataPath)
 
 #undef LOAD_DBC
 
+    // the stores are independent of each other, errors are collected per store to keep their order
+    std::vector<StoreProblemList> loadErrors(loads.size());
+    std::atomic<std::size_t> nextLoad = 0;
+    auto loadWorker = [&]()
+    {
+        for (std::size_t i = nextLoad++; i < loads.size(); i = nextLoad++)
+            loads[i](loadErrors[i]);
+    };
+
+    std::vector<std::thread> loadThreads;
+    for (std::size_t i = 1; i < std::min<std::size_t>(threads, loads.size()); ++i)
+        loadThreads.emplace_back(loadWorker);
+
+    loadWorker();
+    for (std::thread& thread : loadThreads)
+        thread.join();
+
+    DBCFileCount = uint32(loads.size());
+    StoreProblemList bad_dbc_files;
+    for (StoreProblemList& errors : loadErrors)
+        bad_dbc_files.splice(bad_dbc_files.end(), errors);
+
     for (CharStartOutfitEntry const* outfit : sCharStartOutfitStore)
         sCharStartOutfitMap[outfit->Race | (outfit->Class << 8) | (outfit->Gender << 16)] = outfit;
 
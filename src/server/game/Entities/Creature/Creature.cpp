@@ -172,14 +172,21 @@ CreatureModel const* CreatureTemplate::GetFirstVisibleModel() const
     return &CreatureModel::DefaultVisibleModel;
 }
 
-void CreatureTemplate::InitializeQueryData()
+WorldPacket CreatureTemplate::BuildQueryData(LocaleConstant locale) const
 {
-    queryData.Initialize(SMSG_CREATURE_QUERY_RESPONSE, 1);
+    std::string localeName = Name;
+    std::string localeTitle = SubName;
+    if (CreatureLocale const* cl = sObjectMgr->GetCreatureLocale(Entry))
+    {
+        ObjectMgr::GetLocaleString(cl->Name, locale, localeName);
+        ObjectMgr::GetLocaleString(cl->Title, locale, localeTitle);
+    }
 
+    WorldPacket queryData(SMSG_CREATURE_QUERY_RESPONSE, 100);
     queryData << uint32(Entry);                                   // creature entry
-    queryData << Name;
+    queryData << localeName;
     queryData << uint8(0) << uint8(0) << uint8(0);                // name2, name3, name4, always empty
-    queryData << SubName;
+    queryData << localeTitle;
     queryData << IconName;                                        // "Directions" for guard, string for Icons 2.3.0
     queryData << uint32(type_flags);                              // flags
     queryData << uint32(type);                                    // CreatureType.dbc
@@ -206,7 +213,13 @@ void CreatureTemplate::InitializeQueryData()
     queryData << float(ModHealth);                                // dmg/hp modifier
     queryData << float(ModMana);                                  // dmg/mana modifier
     queryData << uint8(RacialLeader);
+
+    CreatureQuestItemList const* items = sObjectMgr->GetCreatureQuestItemList(Entry);
+    for (std::size_t i = 0; i < MAX_CREATURE_QUEST_ITEMS; ++i)
+        queryData << (items && i < items->size() ? uint32((*items)[i]) : uint32(0));
+
     queryData << uint32(movementId);                              // CreatureMovementInfo.dbc
+    return queryData;
 }
 
 bool AssistDelayEvent::Execute(uint64 /*e_time*/, uint32 /*p_time*/)
@@ -2038,7 +2051,7 @@ void Creature::Respawn(bool force)
         }
     }
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_RESPAWN, GetEntry());
+    ConditionProgram const* conditions = sConditionMgr->GetConditionProgramForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_RESPAWN, GetEntry());
 
     if (!sConditionMgr->IsObjectMeetToConditions(this, conditions) && !force)
     {
@@ -240,7 +240,6 @@ struct CreatureTemplate
     int32   CreatureImmunitiesId;
     uint32  flags_extra;
     uint32  ScriptID;
-    WorldPacket queryData; // pussywizard
     CreatureModel const* GetModelByIdx(uint32 idx) const;
     CreatureModel const* GetRandomValidModel() const;
     CreatureModel const* GetFirstValidModel() const;
@@ -277,7 +276,8 @@ struct CreatureTemplate
 
     [[nodiscard]] bool HasFlagsExtra (uint32 flag) const { return (flags_extra & flag) != 0; }
 
-    void InitializeQueryData();
+    // SMSG_CREATURE_QUERY_RESPONSE for the given locale, shared through QueryResponseCache
+    [[nodiscard]] WorldPacket BuildQueryData(LocaleConstant locale) const;
 };
 
 typedef std::vector<uint32> CreatureQuestItemList;
@@ -123,6 +123,7 @@ public:
     ~GameObject() override;
 
     void BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target) override;
+    void PatchValuesUpdate(ByteBuffer& valuesUpdateBuf, BuildValuesCachePosPointers const& posPointers, Player* target) const;
 
     void AddToWorld() override;
     void RemoveFromWorld() override;
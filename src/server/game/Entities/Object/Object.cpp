@@ -86,6 +86,9 @@ Object::Object() : m_PackGUID(sizeof(uint64) + 1)
 WorldObject::~WorldObject()
 {
     sScriptMgr->OnWorldObjectDestroy(this);
+
+    // deleted while still linked to a grid cell
+    RemoveFromGridCellIndex();
 }
 
 Object::~Object()
@@ -492,13 +495,28 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
     if (!target)
         return;
 
+    uint32* flags = nullptr;
+    uint32 visibleFlag = GetUpdateFieldData(target, flags);
+
+    ValuesUpdateCacheStats& stats = GetValuesUpdateCacheStats();
+    uint64 cacheKey = MakeValuesUpdateCacheKey(visibleFlag, updateType);
+
+    auto cacheIt = _valuesUpdateCache.find(cacheKey);
+    if (cacheIt != _valuesUpdateCache.end())
+    {
+        ++stats.Hits;
+        stats.BytesSaved += cacheIt->second.buffer.size();
+        data->append(cacheIt->second.buffer);
+        return;
+    }
+
+    ++stats.Misses;
+
+    BuildValuesCachedBuffer cacheValue(500);
     ByteBuffer fieldBuffer;
     UpdateMask updateMask;
     updateMask.SetCount(m_valuesCount);
 
-    uint32* flags = nullptr;
-    uint32 visibleFlag = GetUpdateFieldData(target, flags);
-
     for (uint16 index = 0; index < m_valuesCount; ++index)
     {
         if (_fieldNotifyFlags & flags[index] ||
@@ -509,13 +527,27 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
         }
     }
 
-    *data << uint8(updateMask.GetBlockCount());
-    updateMask.AppendToPacket(data);
-    data->append(fieldBuffer);
+    cacheValue.buffer << uint8(updateMask.GetBlockCount());
+    updateMask.AppendToPacket(&cacheValue.buffer);
+    cacheValue.buffer.append(fieldBuffer);
+
+    data->append(cacheValue.buffer);
+
+    if (CanCacheValuesUpdate())
+        _valuesUpdateCache.emplace(cacheKey, std::move(cacheValue));
+}
+
+Object::ValuesUpdateCacheStats& Object::GetValuesUpdateCacheStats()
+{
+    static thread_local ValuesUpdateCacheStats stats;
+    return stats;
 }
 
 void Object::AddToObjectUpdateIfNeeded()
 {
+    // any field change makes the serialized values blocks stale
+    InvalidateValuesUpdateCache();
+
     if (m_inWorld && !m_objectUpdated)
     {
         AddToObjectUpdate();
@@ -526,6 +558,7 @@ void Object::AddToObjectUpdateIfNeeded()
 void Object::ClearUpdateMask(bool remove)
 {
     _changesMask.Clear();
+    InvalidateValuesUpdateCache();
 
     if (m_objectUpdated)
     {
@@ -736,6 +769,10 @@ void Object::SetFloatValue(uint16 index, float value)
         m_floatValues[index] = value;
         _changesMask.SetBit(index);
 
+        // units are range filtered by their combat reach in the grid cell object index
+        if (index == UNIT_FIELD_COMBATREACH && IsUnit())
+            ToUnit()->UpdateGridCellIndexObjectSize();
+
         AddToObjectUpdateIfNeeded();
     }
 }
@@ -1061,7 +1098,7 @@ WorldObject::WorldObject() : WorldLocation(),
     LastUsedScriptID(0), m_name(""), m_isActive(false), _visibilityDistanceOverrideType(VisibilityDistanceType::Normal), m_zoneScript(nullptr),
     _zoneId(0), _areaId(0), _floorZ(INVALID_HEIGHT), _outdoors(false), _liquidData(), _updatePositionData(false), m_transport(nullptr),
     m_currMap(nullptr), _heartbeatTimer(HEARTBEAT_INTERVAL), m_InstanceId(0), m_phaseMask(PHASEMASK_NORMAL), m_useCombinedPhases(true),
-    m_notifyflags(0), m_executed_notifies(0), _objectVisibilityContainer(this)
+    m_notifyflags(0), m_executed_notifies(0), _objectVisibilityContainer(this), _gridCellIndex(nullptr), _gridCellIndexSlot(0)
 {
     m_serverSideVisibility.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE | GHOST_VISIBILITY_GHOST);
     m_serverSideVisibilityDetect.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE);
@@ -2996,6 +3033,9 @@ void WorldObject::SetPhaseMask(uint32 newPhaseMask, bool update)
     sScriptMgr->OnBeforeWorldObjectSetPhaseMask(this, m_phaseMask, newPhaseMask, m_useCombinedPhases, update);
     m_phaseMask = newPhaseMask;
 
+    if (_gridCellIndex)
+        _gridCellIndex->UpdatePhaseMask(_gridCellIndexSlot, m_phaseMask, m_useCombinedPhases);
+
     if (update && IsInWorld())
         UpdateObjectVisibility();
 }
@@ -3078,7 +3118,15 @@ void WorldObject::AddToNotify(uint16 f)
         {
             if (f & NOTIFY_VISIBILITY_CHANGED)
             {
-                uint32 EVENT_VISIBILITY_DELAY = u->FindMap() ? DynamicVisibilityMgr::GetVisibilityNotifyDelay(u->FindMap()->GetEntry()->map_type) : 1000;
+                uint32 EVENT_VISIBILITY_DELAY = 1000;
+                if (Map* map = u->FindMap())
+                {
+                    Player const* player = u->ToPlayer();
+                    if (player && player->CanUpdateVisibilityIncrementally())
+                        EVENT_VISIBILITY_DELAY = DynamicVisibilityMgr::GetIncrementalVisibilityNotifyDelay(map->GetEntry()->map_type);
+                    else
+                        EVENT_VISIBILITY_DELAY = DynamicVisibilityMgr::GetVisibilityNotifyDelay(map->GetEntry()->map_type);
+                }
 
                 uint32 diff = getMSTimeDiff(u->m_last_notify_mstime, GameTime::GetGameTimeMS().count());
                 if (diff >= EVENT_VISIBILITY_DELAY / 2)
@@ -133,6 +133,16 @@ public:
     void SendUpdateToPlayer(Player* player);
 
     void BuildValuesUpdateBlockForPlayer(UpdateData* data, Player* target);
+
+    // Per thread counters of the values update cache, read and reset by Map::SendObjectUpdates
+    struct ValuesUpdateCacheStats
+    {
+        uint64 Hits = 0;
+        uint64 Misses = 0;
+        uint64 BytesSaved = 0;
+    };
+
+    static ValuesUpdateCacheStats& GetValuesUpdateCacheStats();
     void BuildOutOfRangeUpdateBlock(UpdateData* data) const;
     void BuildMovementUpdateBlock(UpdateData* data, uint32 flags = 0) const;
 
@@ -274,6 +284,23 @@ protected:
 
     bool m_objectUpdated;
 
+    // Values blocks already serialized for the current change set, shared by every observer with the
+    // same visibility flags. Dropped whenever a field changes or the update mask is cleared.
+    typedef std::unordered_map<uint64 /*visibleFlag(uint32) + updateType(uint8)*/, BuildValuesCachedBuffer> ValuesUpdateCache;
+    ValuesUpdateCache _valuesUpdateCache;
+
+    // Only objects queued for this tick's SendObjectUpdates keep their blocks, ClearUpdateMask drops them
+    // once the changes are sent. Blocks built for an idle object are not kept across ticks.
+    [[nodiscard]] bool CanCacheValuesUpdate() const { return m_objectUpdated; }
+
+    void InvalidateValuesUpdateCache()
+    {
+        if (!_valuesUpdateCache.empty())
+            _valuesUpdateCache.clear();
+    }
+
+    static uint64 MakeValuesUpdateCacheKey(uint32 visibleFlag, uint8 updateType) { return static_cast<uint64>(visibleFlag) << 8 | updateType; }
+
 private:
     bool m_inWorld;
 
@@ -375,6 +402,7 @@ public:
     {
         ASSERT(IsInGrid());
         _gridRef.unlink();
+        static_cast<T*>(this)->RemoveFromGridCellIndex();
     }
 private:
     GridReference<T> _gridRef;
@@ -486,6 +514,18 @@ public:
     void AddToWorld() override;
     void RemoveFromWorld() override;
 
+    // Position::Relocate, hidden to keep the grid cell object index in sync
+    void Relocate(float x, float y) { Position::Relocate(x, y); UpdateGridCellIndexPosition(); }
+    void Relocate(float x, float y, float z) { Position::Relocate(x, y, z); UpdateGridCellIndexPosition(); }
+    void Relocate(float x, float y, float z, float orientation) { Position::Relocate(x, y, z, orientation); UpdateGridCellIndexPosition(); }
+    void Relocate(Position const& pos) { Position::Relocate(pos); UpdateGridCellIndexPosition(); }
+    void Relocate(Position const* pos) { Position::Relocate(pos); UpdateGridCellIndexPosition(); }
+
+    [[nodiscard]] GridCellObjectIndex* GetGridCellIndex() const { return _gridCellIndex; }
+    void SetGridCellIndex(GridCellObjectIndex* index, uint32 slot) { _gridCellIndex = index; _gridCellIndexSlot = slot; }
+    void RemoveFromGridCellIndex() { if (_gridCellIndex) _gridCellIndex->Remove(_gridCellIndexSlot); }
+    void UpdateGridCellIndexObjectSize() { if (_gridCellIndex) _gridCellIndex->UpdateObjectSize(_gridCellIndexSlot, GetObjectSize()); }
+
     void GetNearPoint2D(WorldObject const* searcher, float& x, float& y, float distance, float absAngle, Position const* startPos = nullptr) const;
     void GetNearPoint2D(float& x, float& y, float distance, float absAngle, Position const* startPos = nullptr) const;
     void GetNearPoint(WorldObject const* searcher, float& x, float& y, float& z, float searcher_size, float distance2d, float absAngle, float controlZ = 0, Position const* startPos = nullptr) const;
@@ -517,6 +557,7 @@ public:
     [[nodiscard]] uint32 GetPhaseMask() const { return m_phaseMask; }
     bool InSamePhase(WorldObject const* obj) const { return InSamePhase(obj->GetPhaseMask()); }
     [[nodiscard]] bool InSamePhase(uint32 phasemask) const { return m_useCombinedPhases ? GetPhaseMask() & phasemask : GetPhaseMask() == phasemask; }
+    [[nodiscard]] bool UsesCombinedPhases() const { return m_useCombinedPhases; }
 
     [[nodiscard]] uint32 GetZoneId() const;
     [[nodiscard]] uint32 GetAreaId() const;
@@ -797,6 +838,11 @@ private:
     GuidUnorderedSet _allowedLooters;
 
     ObjectVisibilityContainer _objectVisibilityContainer;
+
+    void UpdateGridCellIndexPosition() { if (_gridCellIndex) _gridCellIndex->UpdatePosition(_gridCellIndexSlot, GetPositionX(), GetPositionY()); }
+
+    GridCellObjectIndex* _gridCellIndex;                // set while in a grid cell
+    uint32 _gridCellIndexSlot;
 };
 
 namespace Acore
@@ -19,15 +19,15 @@
 #define _OBJECTVISIBILITYCONTAINER_H
 
 #include "Common.h"
+#include "FlatHashMap.h"
 #include "ObjectGuid.h"
 #include <memory>
-#include <unordered_map>
 
 class Player;
 class WorldObject;
 
-typedef std::unordered_map<ObjectGuid, WorldObject*> VisibleWorldObjectsMap;
-typedef std::unordered_map<ObjectGuid, Player*> VisiblePlayersMap;
+typedef Acore::FlatHashMap<ObjectGuid, WorldObject*> VisibleWorldObjectsMap;
+typedef Acore::FlatHashMap<ObjectGuid, Player*> VisiblePlayersMap;
 
 // Class that manages the visibility containers of a worldobject
 class ObjectVisibilityContainer
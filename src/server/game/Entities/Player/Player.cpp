@@ -64,6 +64,7 @@
 #include "OutdoorPvP.h"
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
+#include "PlayerSaveSnapshot.h"
 #include "PetitionMgr.h"
 #include "QuestDef.h"
 #include "RBAC.h"
@@ -398,6 +399,7 @@ Player::Player(WorldSession* session): Unit(), m_mover(this), _cinematicMgr(*thi
 
     m_achievementMgr = new AchievementMgr(this);
     m_reputationMgr = new ReputationMgr(this);
+    m_saveSnapshot = new PlayerSaveSnapshot();
 
     m_NeedToSaveGlyphs = false;
     m_MountBlockId = 0;
@@ -461,6 +463,7 @@ Player::~Player()
     delete m_runes;
     delete m_achievementMgr;
     delete m_reputationMgr;
+    delete m_saveSnapshot;
 
     sWorldSessionMgr->DecreasePlayerCount();
 
@@ -3784,18 +3787,24 @@ void Player::_LoadSpellCooldowns(PreparedQueryResult result)
 
 void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
-    stmt->SetData(0, GetGUID().GetRawValue());
-    trans->Append(stmt);
+    CharacterDatabasePreparedStatement* stmt = nullptr;
+    std::map<uint32, PlayerSaveSnapshot::SpellCooldown>& savedCooldowns = m_saveSnapshot->SpellCooldowns;
+
+    if (m_saveSnapshot->FullSave)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
+        stmt->SetData(0, GetGUID().GetRawValue());
+        trans->Append(stmt);
+        savedCooldowns.clear();
+    }
 
     time_t curTime = GameTime::GetGameTime().count();
     uint32 curMSTime = GameTime::GetGameTimeMS().count();
     uint32 infTime = curMSTime + infinityCooldownDelayCheck;
 
-    bool first_round = true;
-    std::ostringstream ss;
+    std::map<uint32, PlayerSaveSnapshot::SpellCooldown> activeCooldowns;
 
-    // remove outdated and save active
+    // remove outdated and save active, only cooldowns that are new or changed since the last save are written
     for (SpellCooldowns::iterator itr = m_spellCooldowns.begin(); itr != m_spellCooldowns.end();)
     {
         // Xinef: dummy cooldown for procs
@@ -3809,25 +3818,41 @@ void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout
             m_spellCooldowns.erase(itr++);
         else if (itr->second.end <= infTime && (logout || itr->second.end > (curMSTime + 5 * MINUTE * IN_MILLISECONDS)))             // not save locked cooldowns, it will be reset or set at reload
         {
-            if (first_round)
+            PlayerSaveSnapshot::SpellCooldown cooldown(itr->second.end, itr->second.category, itr->second.itemid, bool(itr->second.needSendToClient));
+            activeCooldowns.emplace(itr->first, cooldown);
+
+            auto saved = savedCooldowns.find(itr->first);
+            if (saved == savedCooldowns.end() || saved->second != cooldown)
             {
-                ss << "INSERT INTO character_spell_cooldown (guid, spell, category, item, time, needSend) VALUES ";
-                first_round = false;
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_SPELL_COOLDOWN);
+                stmt->SetData(0, GetGUID().GetCounter());
+                stmt->SetData(1, itr->first);
+                stmt->SetData(2, itr->second.category);
+                stmt->SetData(3, itr->second.itemid);
+                stmt->SetData(4, uint64(((itr->second.end - curMSTime) / IN_MILLISECONDS) + curTime));
+                stmt->SetData(5, itr->second.needSendToClient);
+                trans->Append(stmt);
             }
-            // next new/changed record prefix
-            else
-                ss << ',';
 
-            uint64 cooldown = uint64(((itr->second.end - curMSTime) / IN_MILLISECONDS) + curTime);
-            ss << '(' << GetGUID().GetCounter() << ',' << itr->first << ',' << itr->second.category << "," << itr->second.itemid << ',' << cooldown << ',' << (itr->second.needSendToClient ? '1' : '0') << ')';
             ++itr;
         }
         else
             ++itr;
     }
-    // if something changed execute
-    if (!first_round)
-        trans->Append(ss.str().c_str());
+
+    // cooldowns written before that expired or are no longer saved
+    for (auto const& [spellId, cooldown] : savedCooldowns)
+    {
+        if (activeCooldowns.count(spellId))
+            continue;
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN_BY_SPELL);
+        stmt->SetData(0, GetGUID().GetRawValue());
+        stmt->SetData(1, spellId);
+        trans->Append(stmt);
+    }
+
+    savedCooldowns = std::move(activeCooldowns);
 }
 
 uint32 Player::resetTalentsCost() const
@@ -4204,7 +4229,7 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool up
                     do
                     {
                         ObjectGuid::LowType petguidlow = (*resultPets)[0].Get<uint32>();
-                        Pet::DeleteFromDB(petguidlow);
+                        Pet::DeleteFromDB(petguidlow, accountId);
                     } while (resultPets->NextRow());
                 }
 
@@ -4383,7 +4408,7 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool up
 
                 sScriptMgr->OnPlayerDeleteFromDB(trans, lowGuid);
 
-                CharacterDatabase.CommitTransaction(trans);
+                CharacterDatabase.CommitTransaction(trans, accountId);
                 break;
             }
         // The character gets unlinked from the account, the name gets freed up and appears as deleted ingame
@@ -4393,7 +4418,7 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool up
 
                 stmt->SetData(0, lowGuid);
 
-                CharacterDatabase.Execute(stmt);
+                CharacterDatabase.Execute(stmt, accountId);
                 break;
             }
         default:
@@ -5856,6 +5881,11 @@ void Player::SendDirectMessage(WorldPacket const* data) const
     m_session->SendPacket(data);
 }
 
+void Player::SendDirectMessage(std::shared_ptr<WorldPacket const> const& data) const
+{
+    m_session->SendPacket(data);
+}
+
 void Player::SendCinematicStart(uint32 CinematicSequenceId) const
 {
     WorldPacket data(SMSG_TRIGGER_CINEMATIC, 4);
@@ -9861,7 +9891,7 @@ void Player::VehicleSpellInitialize()
             continue;
         }
 
-        ConditionList conditions = sConditionMgr->GetConditionsForVehicleSpell(vehicle->GetEntry(), spellId);
+        ConditionProgram const* conditions = sConditionMgr->GetConditionProgramForVehicleSpell(vehicle->GetEntry(), spellId);
         if (!sConditionMgr->IsObjectMeetToConditions(this, vehicle, conditions))
         {
             LOG_DEBUG("condition", "VehicleSpellInitialize: conditions not met for Vehicle entry {} spell {}", vehicle->ToCreature()->GetEntry(), spellId);
@@ -10925,7 +10955,7 @@ bool Player::BuyItemFromVendorSlot(ObjectGuid vendorguid, uint32 vendorslot, uin
         return false;
     }
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), item);
+    ConditionProgram const* conditions = sConditionMgr->GetConditionProgramForNpcVendorEvent(creature->GetEntry(), item);
     if (!sConditionMgr->IsObjectMeetToConditions(this, creature, conditions))
     {
         //LOG_DEBUG("condition", "BuyItemFromVendor: conditions not met for creature entry {} item {}", creature->GetEntry(), item);
@@ -12380,6 +12410,7 @@ void Player::SetSeasonalQuestStatus(uint32 quest_id)
 
     m_seasonalquests[quest->GetEventIdForQuest()].insert(quest_id);
     m_SeasonalQuestChanged = true;
+    m_conditionCache.Invalidate();
 }
 
 void Player::SetMonthlyQuestStatus(uint32 quest_id)
@@ -12418,6 +12449,7 @@ void Player::ResetSeasonalQuestStatus(uint16 event_id)
     m_seasonalquests.erase(event_id);
     // DB data deleted in caller
     m_SeasonalQuestChanged = false;
+    m_conditionCache.Invalidate();
 }
 
 void Player::ResetMonthlyQuestStatus()
@@ -14609,7 +14641,7 @@ bool Player::CanSeeSpellClickOn(Creature const* c) const
         if (!itr->second.IsFitToRequirements(this, c))
             return false;
 
-        ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(c->GetEntry(), itr->second.spellId);
+        ConditionProgram const* conds = sConditionMgr->GetConditionProgramForSpellClickEvent(c->GetEntry(), itr->second.spellId);
         ConditionSourceInfo info = ConditionSourceInfo(const_cast<Player*>(this), const_cast<Creature*>(c));
         if (sConditionMgr->IsObjectMeetToConditions(info, conds))
             return true;
@@ -14623,7 +14655,7 @@ bool Player::CanSeeObjectByVisibilityConditions(WorldObject const* object) const
     if (IsGameMaster())
         return true;
 
-    ConditionList conds = sConditionMgr->GetConditionsForObjectVisibility(object);
+    ConditionProgram const* conds = sConditionMgr->GetConditionProgramForObjectVisibility(object);
     ConditionSourceInfo info = ConditionSourceInfo(const_cast<Player*>(this), const_cast<WorldObject*>(object));
     return sConditionMgr->IsObjectMeetToConditions(info, conds);
 }
@@ -14700,7 +14732,7 @@ bool Player::CanSeeVendor(Creature const* creature) const
     if (!creature->HasNpcFlag(UNIT_NPC_FLAG_VENDOR))
         return true;
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), 0);
+    ConditionProgram const* conditions = sConditionMgr->GetConditionProgramForNpcVendorEvent(creature->GetEntry(), 0);
     if (!sConditionMgr->IsObjectMeetToConditions(const_cast<Player*>(this), const_cast<Creature*>(creature), conditions))
         return false;
 
@@ -15012,11 +15044,7 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     if (!mEntry)
         return;
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
-    stmt->SetData(0, GetGUID().GetRawValue());
-    trans->Append(stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_ENTRY_POINT);
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PLAYER_ENTRY_POINT);
     stmt->SetData(0, GetGUID().GetRawValue());
     stmt->SetData (1, m_entryPointData.joinPos.GetPositionX());
     stmt->SetData (2, m_entryPointData.joinPos.GetPositionY());
@@ -15026,6 +15054,17 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     stmt->SetData(6, m_entryPointData.taxiPath[0]);
     stmt->SetData(7, m_entryPointData.taxiPath[1]);
     stmt->SetData(8, m_entryPointData.mountSpell);
+
+    // same row as written last time
+    if (PlayerSaveSnapshot::IsUnchanged(m_saveSnapshot->EntryPoint, stmt))
+    {
+        delete stmt;
+        return;
+    }
+
+    CharacterDatabasePreparedStatement* delStmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
+    delStmt->SetData(0, GetGUID().GetRawValue());
+    trans->Append(delStmt);
     trans->Append(stmt);
 }
 
@@ -16136,7 +16175,7 @@ void Player::RefundItem(Item* item)
 
     SaveInventoryAndGoldToDB(trans);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetSession()->GetAccountId());
 }
 
 void Player::SetRandomWinner(bool isWinner)
@@ -16324,20 +16363,45 @@ void Player::_LoadPetStable(uint8 petStableSlots, PreparedQueryResult result)
 
 void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
 {
-    if (_instanceResetTimes.empty())
+    std::map<uint32, PlayerSaveSnapshot::Row>& savedTimes = m_saveSnapshot->InstanceTimes;
+    if (_instanceResetTimes.empty() && savedTimes.empty())
         return;
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
-    stmt->SetData(0, GetSession()->GetAccountId());
-    trans->Append(stmt);
+    CharacterDatabasePreparedStatement* stmt = nullptr;
+    if (m_saveSnapshot->FullSave)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
+        stmt->SetData(0, GetSession()->GetAccountId());
+        trans->Append(stmt);
+    }
 
     for (InstanceTimeMap::const_iterator itr = _instanceResetTimes.begin(); itr != _instanceResetTimes.end(); ++itr)
     {
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_ACCOUNT_INSTANCE_LOCK_TIMES);
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_ACCOUNT_INSTANCE_LOCK_TIMES);
         stmt->SetData(0, GetSession()->GetAccountId());
         stmt->SetData(1, itr->first);
         stmt->SetData(2, (int64)itr->second);
+
+        if (PlayerSaveSnapshot::IsUnchanged(savedTimes[itr->first], stmt))
+            delete stmt;
+        else
+            trans->Append(stmt);
+    }
+
+    // instances whose lock time ran out since the last save
+    for (auto itr = savedTimes.begin(); itr != savedTimes.end();)
+    {
+        if (_instanceResetTimes.count(itr->first))
+        {
+            ++itr;
+            continue;
+        }
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES_BY_INSTANCE);
+        stmt->SetData(0, GetSession()->GetAccountId());
+        stmt->SetData(1, itr->first);
         trans->Append(stmt);
+        itr = savedTimes.erase(itr);
     }
 }
 
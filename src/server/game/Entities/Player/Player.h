@@ -52,6 +52,7 @@ struct VendorItem;
 
 class AchievementMgr;
 class ReputationMgr;
+struct PlayerSaveSnapshot;
 class Channel;
 class CharacterCreateInfo;
 class Creature;
@@ -1602,6 +1603,8 @@ public:
 
     void SaveToDB(bool create, bool logout);
     void SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout);
+    // callers committing the transaction of SaveToDB themselves call this when the commit failed
+    void InvalidateSaveSnapshot();
     void SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans);                    // fast save function for item/money cheating preventing
     void SaveGoldToDB(CharacterDatabaseTransaction trans);
     void _SaveSkills(CharacterDatabaseTransaction trans);
@@ -2156,6 +2159,7 @@ public:
     ReputationMgr&       GetReputationMgr()       { return *m_reputationMgr; }
     [[nodiscard]] ReputationMgr const& GetReputationMgr() const { return *m_reputationMgr; }
     [[nodiscard]] ReputationRank GetReputationRank(uint32 faction_id) const;
+    PlayerConditionCache& GetConditionCache() { return m_conditionCache; }
     void RewardReputation(Unit* victim);
     void RewardReputation(Quest const* quest);
 
@@ -2278,6 +2282,7 @@ public:
     void SendInitWorldStates(uint32 zoneId, uint32 areaId);
     void SendUpdateWorldState(uint32 variable, uint32 value) const;
     void SendDirectMessage(WorldPacket const* data) const;
+    void SendDirectMessage(std::shared_ptr<WorldPacket const> const& data) const;
     void SendBGWeekendWorldStates();
     void SendBattlefieldWorldStates();
 
@@ -2430,6 +2435,13 @@ public:
     // currently visible objects at player client
     std::vector<Unit*> m_newVisible; // pussywizard
 
+    // sight position and range of the last visibility update of the surroundings, incremental updates move on from it
+    [[nodiscard]] bool CanUpdateVisibilityIncrementally() const;
+    [[nodiscard]] bool HasVisibilityUpdatePosition() const { return m_hasVisibilityUpdatePosition; }
+    [[nodiscard]] Position const& GetVisibilityUpdatePosition() const { return m_visibilityUpdatePosition; }
+    void SetVisibilityUpdatePosition(bool fullUpdate);
+    void ResetVisibilityUpdatePosition() { m_hasVisibilityUpdatePosition = false; }
+
     [[nodiscard]] bool HaveAtClient(WorldObject const* u) const;
     [[nodiscard]] bool HaveAtClient(ObjectGuid guid) const;
 
@@ -3047,6 +3059,8 @@ private:
 
     AchievementMgr* m_achievementMgr;
     ReputationMgr*  m_reputationMgr;
+    PlayerSaveSnapshot* m_saveSnapshot;
+    PlayerConditionCache m_conditionCache;
 
     SpellCooldowns m_spellCooldowns;
 
@@ -3070,6 +3084,11 @@ private:
 
     Optional<float> _farSightDistance = { };
 
+    Position m_visibilityUpdatePosition;
+    float m_visibilityUpdateRange = 0.0f;
+    bool m_hasVisibilityUpdatePosition = false;
+    uint32 m_lastFullVisibilityUpdate = 0;
+
     bool _wasOutdoor;
 
     PlayerSettingMap m_charSettingsMap;
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PLAYER_SAVE_SNAPSHOT_H
+#define _PLAYER_SAVE_SNAPSHOT_H
+
+#include "PreparedStatement.h"
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <string>
+#include <tuple>
+
+/// Values written by the previous character save for the tables that have no in-memory change
+/// tracking of their own. The next save compares against them, writes only the rows that changed
+/// and deletes vanished rows one by one instead of wiping and refilling the whole table.
+struct PlayerSaveSnapshot
+{
+    typedef std::vector<PreparedStatementData> Row;
+    typedef std::tuple<uint64, uint64, uint32, uint8> AuraKey; // casterGuid, itemGuid, spell, effectMask
+    typedef std::tuple<uint32, uint32, uint32, bool> SpellCooldown; // end (game ms), category, item, needSend
+
+    /// Returns true if stmt writes exactly lastSaved, otherwise remembers its values and returns false
+    static bool IsUnchanged(Row& lastSaved, PreparedStatementBase const* stmt)
+    {
+        std::vector<PreparedStatementData> const& parameters = stmt->GetParameters();
+        if (lastSaved.size() == parameters.size() && std::equal(parameters.begin(), parameters.end(), lastSaved.begin(),
+            [](PreparedStatementData const& left, PreparedStatementData const& right) { return left.data == right.data; }))
+            return true;
+
+        lastSaved = parameters;
+        return false;
+    }
+
+    /// Forgets everything, the next save writes all tables in full. Set from the commit callback
+    /// when a save transaction failed, so nothing is skipped on the assumption it was written.
+    void Invalidate() { Invalidated.store(true, std::memory_order_relaxed); }
+
+    /// Called at the start of a save, FullSave tells the savers to wipe and write their tables in full
+    void BeginSave()
+    {
+        if (Invalidated.exchange(false, std::memory_order_relaxed))
+        {
+            EntryPoint.clear();
+            Stats.clear();
+            Auras.clear();
+            SpellCooldowns.clear();
+            InstanceTimes.clear();
+            Settings.clear();
+            Initialized = false;
+        }
+
+        FullSave = !Initialized;
+        Initialized = true;
+    }
+
+    std::atomic<bool> Invalidated{false};
+    bool Initialized{false};
+    bool FullSave{true};
+
+    Row EntryPoint;
+    Row Stats;
+    std::map<AuraKey, Row> Auras;
+    std::map<uint32, SpellCooldown> SpellCooldowns;
+    std::map<uint32, Row> InstanceTimes;
+    std::map<std::string, Row> Settings;
+};
+
+#endif
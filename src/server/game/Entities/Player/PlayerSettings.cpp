@@ -16,6 +16,7 @@
  */
 
 #include "Player.h"
+#include "PlayerSaveSnapshot.h"
 #include "StringConvert.h"
 #include "Tokenize.h"
 #include "CharacterDatabase.h"
@@ -152,7 +153,10 @@ void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
             continue;
 
         CharacterDatabasePreparedStatement* stmt = PlayerSettingsStore::PrepareReplaceStatement(GetGUID().GetCounter(), source, settings);
-        trans->Append(stmt);
+        if (PlayerSaveSnapshot::IsUnchanged(m_saveSnapshot->Settings[source], stmt))
+            delete stmt;
+        else
+            trans->Append(stmt);
     }
 }
 
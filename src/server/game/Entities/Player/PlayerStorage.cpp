@@ -48,6 +48,7 @@
 #include "OutdoorPvP.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerSaveSnapshot.h"
 #include "QueryHolder.h"
 #include "QuestDef.h"
 #include "RBAC.h"
@@ -7199,7 +7200,24 @@ void Player::SaveToDB(bool create, bool logout)
 
     SaveToDB(trans, create, logout);
 
-    CharacterDatabase.CommitTransaction(trans);
+    // rows skipped as unchanged are only known to be in the database if this commit went through
+    ObjectGuid guid = GetGUID();
+    WorldSession* session = GetSession();
+    session->AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(trans, session->GetAccountId())).AfterComplete([session, guid](bool success)
+    {
+        if (success)
+            return;
+
+        if (Player* player = session->GetPlayer())
+            if (player->GetGUID() == guid)
+                player->InvalidateSaveSnapshot();
+    });
+}
+
+void Player::InvalidateSaveSnapshot()
+{
+    // rows skipped as unchanged may not be in the database, the next save writes everything
+    m_saveSnapshot->Invalidate();
 }
 
 void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout)
@@ -7214,6 +7232,8 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
         return;
     }
 
+    m_saveSnapshot->BeginSave();
+
     // pussywizard: full save now, so clear partial additional saves
     m_additionalSaveTimer = 0;
     m_additionalSaveMask = 0;
@@ -7293,6 +7313,8 @@ void Player::SaveGoldToDB(CharacterDatabaseTransaction trans)
 void Player::_SaveActions(CharacterDatabaseTransaction trans)
 {
     CharacterDatabasePreparedStatement* stmt = nullptr;
+    // inserts go last and back to back, the transaction sends them as one multi-row statement
+    std::vector<CharacterDatabasePreparedStatement*> inserts;
 
     for (ActionButtonList::iterator itr = m_actionButtons.begin(); itr != m_actionButtons.end();)
     {
@@ -7305,7 +7327,7 @@ void Player::_SaveActions(CharacterDatabaseTransaction trans)
                 stmt->SetData(2, itr->first);
                 stmt->SetData(3, itr->second.GetAction());
                 stmt->SetData(4, uint8(itr->second.GetType()));
-                trans->Append(stmt);
+                inserts.push_back(stmt);
 
                 itr->second.uState = ACTIONBUTTON_UNCHANGED;
                 ++itr;
@@ -7336,13 +7358,24 @@ void Player::_SaveActions(CharacterDatabaseTransaction trans)
                 break;
         }
     }
+
+    for (CharacterDatabasePreparedStatement* insert : inserts)
+        trans->Append(insert);
 }
 
 void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
-    stmt->SetData(0, GetGUID().GetRawValue());
-    trans->Append(stmt);
+    std::map<PlayerSaveSnapshot::AuraKey, PlayerSaveSnapshot::Row>& savedAuras = m_saveSnapshot->Auras;
+    CharacterDatabasePreparedStatement* stmt = nullptr;
+    if (m_saveSnapshot->FullSave)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA);
+        stmt->SetData(0, GetGUID().GetRawValue());
+        trans->Append(stmt);
+        savedAuras.clear();
+    }
+
+    std::set<PlayerSaveSnapshot::AuraKey> savedKeys;
 
     for (AuraMap::const_iterator itr = m_ownedAuras.begin(); itr != m_ownedAuras.end(); ++itr)
     {
@@ -7375,7 +7408,7 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
         }
 
         uint8 index = 0;
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_AURA);
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_AURA);
         stmt->SetData(index++, GetGUID().GetRawValue());
         stmt->SetData(index++, itr->second->GetCasterGUID().GetRawValue());
         stmt->SetData(index++, itr->second->GetCastItemGUID().GetRawValue());
@@ -7392,7 +7425,32 @@ void Player::_SaveAuras(CharacterDatabaseTransaction trans, bool logout)
         stmt->SetData(index++, itr->second->GetMaxDuration());
         stmt->SetData(index++, itr->second->GetDuration());
         stmt->SetData(index, itr->second->GetCharges());
+
+        PlayerSaveSnapshot::AuraKey key(aura->GetCasterGUID().GetRawValue(), aura->GetCastItemGUID().GetRawValue(), aura->GetId(), effMask);
+        savedKeys.insert(key);
+        if (PlayerSaveSnapshot::IsUnchanged(savedAuras[key], stmt))
+            delete stmt;
+        else
+            trans->Append(stmt);
+    }
+
+    // auras that expired or were removed since the last save
+    for (auto itr = savedAuras.begin(); itr != savedAuras.end();)
+    {
+        if (savedKeys.count(itr->first))
+        {
+            ++itr;
+            continue;
+        }
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_AURA_BY_CASTER_SPELL);
+        stmt->SetData(0, GetGUID().GetRawValue());
+        stmt->SetData(1, std::get<0>(itr->first));
+        stmt->SetData(2, std::get<1>(itr->first));
+        stmt->SetData(3, std::get<2>(itr->first));
+        stmt->SetData(4, std::get<3>(itr->first));
         trans->Append(stmt);
+        itr = savedAuras.erase(itr);
     }
 }
 
@@ -7462,6 +7520,8 @@ void Player::_SaveInventory(CharacterDatabaseTransaction trans)
         return;
 
     uint64 guid = GetGUID().GetRawValue();
+    // inventory rows are written after the loop so they go out as one multi-row REPLACE
+    std::vector<CharacterDatabasePreparedStatement*> inventoryRows;
     for (std::size_t i = 0; i < m_itemUpdateQueue.size(); ++i)
     {
         Item* item = m_itemUpdateQueue[i];
@@ -7519,7 +7579,7 @@ void Player::_SaveInventory(CharacterDatabaseTransaction trans)
                 stmt->SetData(1, bag_guid);
                 stmt->SetData (2, item->GetSlot());
                 stmt->SetData(3, item->GetGUID().GetCounter());
-                trans->Append(stmt);
+                inventoryRows.push_back(stmt);
                 break;
             case ITEM_REMOVED:
                 stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_INVENTORY_BY_ITEM);
@@ -7531,6 +7591,10 @@ void Player::_SaveInventory(CharacterDatabaseTransaction trans)
 
         item->SaveToDB(trans);                                   // item have unchanged inventory record and can be save standalone
     }
+
+    for (CharacterDatabasePreparedStatement* inventoryRow : inventoryRows)
+        trans->Append(inventoryRow);
+
     m_itemUpdateQueue.clear();
 }
 
@@ -7618,6 +7682,8 @@ void Player::_SaveQuestStatus(CharacterDatabaseTransaction trans)
     QuestStatusSaveMap::iterator saveItr;
     QuestStatusMap::iterator statusItr;
     CharacterDatabasePreparedStatement* stmt = nullptr;
+    // one row per quest, so deletes can go first and the REPLACE/INSERT rows back to back
+    std::vector<CharacterDatabasePreparedStatement*> rows;
 
     bool keepAbandoned = !(sWorld->GetCleaningFlags() & CharacterDatabaseCleaner::CLEANING_FLAG_QUESTSTATUS);
 
@@ -7644,7 +7710,7 @@ void Player::_SaveQuestStatus(CharacterDatabaseTransaction trans)
                     stmt->SetData(index++, statusItr->second.ItemCount[i]);
 
                 stmt->SetData(index, statusItr->second.PlayerCount);
-                trans->Append(stmt);
+                rows.push_back(stmt);
             }
         }
         else
@@ -7658,6 +7724,11 @@ void Player::_SaveQuestStatus(CharacterDatabaseTransaction trans)
 
     m_QuestStatusSave.clear();
 
+    for (CharacterDatabasePreparedStatement* row : rows)
+        trans->Append(row);
+
+    rows.clear();
+
     for (saveItr = m_RewardedQuestsSave.begin(); saveItr != m_RewardedQuestsSave.end(); ++saveItr)
     {
         if (saveItr->second)
@@ -7667,11 +7738,18 @@ void Player::_SaveQuestStatus(CharacterDatabaseTransaction trans)
 
         stmt->SetData(0, GetGUID().GetRawValue());
         stmt->SetData(1, saveItr->first);
-        trans->Append(stmt);
+
+        if (saveItr->second)
+            rows.push_back(stmt);
+        else
+            trans->Append(stmt);
     }
 
     m_RewardedQuestsSave.clear();
 
+    for (CharacterDatabasePreparedStatement* row : rows)
+        trans->Append(row);
+
     if (!isTransaction)
         CharacterDatabase.CommitTransaction(trans);
 }
@@ -7796,6 +7874,8 @@ void Player::_SaveMonthlyQuestStatus(CharacterDatabaseTransaction trans)
 void Player::_SaveSkills(CharacterDatabaseTransaction trans)
 {
     CharacterDatabasePreparedStatement* stmt = nullptr;
+    // inserts go last and back to back, the transaction sends them as one multi-row statement
+    std::vector<CharacterDatabasePreparedStatement*> inserts;
     // we don't need transactions here.
     for (SkillStatusMap::iterator itr = mSkillStatus.begin(); itr != mSkillStatus.end();)
     {
@@ -7828,7 +7908,7 @@ void Player::_SaveSkills(CharacterDatabaseTransaction trans)
                 stmt->SetData(1, uint16(itr->first));
                 stmt->SetData(2, value);
                 stmt->SetData(3, max);
-                trans->Append(stmt);
+                inserts.push_back(stmt);
 
                 break;
             case SKILL_CHANGED:
@@ -7847,11 +7927,16 @@ void Player::_SaveSkills(CharacterDatabaseTransaction trans)
 
         ++itr;
     }
+
+    for (CharacterDatabasePreparedStatement* insert : inserts)
+        trans->Append(insert);
 }
 
 void Player::_SaveSpells(CharacterDatabaseTransaction trans)
 {
     CharacterDatabasePreparedStatement* stmt = nullptr;
+    // all deletes first, then the inserts back to back so they go out as one multi-row statement
+    std::vector<CharacterDatabasePreparedStatement*> inserts;
 
     for (PlayerSpellMap::iterator itr = m_spells.begin(); itr != m_spells.end();)
     {
@@ -7878,7 +7963,7 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
             stmt->SetData(0, GetGUID().GetRawValue());
             stmt->SetData(1, itr->first);
             stmt->SetData(2, itr->second->specMask);
-            trans->Append(stmt);
+            inserts.push_back(stmt);
         }
 
         if (itr->second->State == PLAYERSPELL_REMOVED)
@@ -7892,6 +7977,9 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
             ++itr;
         }
     }
+
+    for (CharacterDatabasePreparedStatement* insert : inserts)
+        trans->Append(insert);
 }
 
 // save player stats -- only for external usage
@@ -7902,15 +7990,9 @@ void Player::_SaveStats(CharacterDatabaseTransaction trans)
     if (!sWorld->getIntConfig(CONFIG_MIN_LEVEL_STAT_SAVE) || GetLevel() < sWorld->getIntConfig(CONFIG_MIN_LEVEL_STAT_SAVE))
         return;
 
-    CharacterDatabasePreparedStatement* stmt = nullptr;
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_STATS);
-    stmt->SetData(0, GetGUID().GetRawValue());
-    trans->Append(stmt);
-
     uint8 index = 0;
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_STATS);
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_STATS);
     stmt->SetData(index++, GetGUID().GetRawValue());
     stmt->SetData(index++, GetMaxHealth());
 
@@ -7934,6 +8016,16 @@ void Player::_SaveStats(CharacterDatabaseTransaction trans)
     stmt->SetData(index++, GetBaseSpellPowerBonus());
     stmt->SetData(index++, GetUInt32Value(PLAYER_FIELD_COMBAT_RATING_1 + static_cast<uint16>(CR_CRIT_TAKEN_SPELL)));
 
+    // same row as written last time
+    if (PlayerSaveSnapshot::IsUnchanged(m_saveSnapshot->Stats, stmt))
+    {
+        delete stmt;
+        return;
+    }
+
+    CharacterDatabasePreparedStatement* delStmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_STATS);
+    delStmt->SetData(0, GetGUID().GetRawValue());
+    trans->Append(delStmt);
     trans->Append(stmt);
 }
 
@@ -1619,7 +1619,37 @@ void Player::UpdateVisibilityForPlayer(bool mapChange)
     notifier.SendToSelf();
 
     if (mapChange)
+    {
         m_last_notify_position.Relocate(-5000.0f, -5000.0f, -5000.0f, 0.0f);
+        ResetVisibilityUpdatePosition();
+    }
+    else
+        SetVisibilityUpdatePosition(true);
+}
+
+bool Player::CanUpdateVisibilityIncrementally() const
+{
+    if (!m_hasVisibilityUpdatePosition || !sWorld->getBoolConfig(CONFIG_VISIBILITY_INCREMENTAL))
+        return false;
+
+    // only the distance to the sight position is tracked, far sight, remote sight and ghost visibility need more
+    if (m_seer != this || GetFarSightDistance() || _cinematicMgr.IsOnCinematic() || !IsAlive())
+        return false;
+
+    if (GetSightRange() != m_visibilityUpdateRange)
+        return false;
+
+    return getMSTimeDiff(m_lastFullVisibilityUpdate, GameTime::GetGameTimeMS().count()) < sWorld->getIntConfig(CONFIG_VISIBILITY_INCREMENTAL_FULL_UPDATE_INTERVAL);
+}
+
+void Player::SetVisibilityUpdatePosition(bool fullUpdate)
+{
+    m_visibilityUpdatePosition.Relocate(GetSightPosition());
+    m_visibilityUpdateRange = GetSightRange();
+    m_hasVisibilityUpdatePosition = true;
+
+    if (fullUpdate)
+        m_lastFullVisibilityUpdate = GameTime::GetGameTimeMS().count();
 }
 
 void Player::UpdateObjectVisibility(bool forced, bool fromUpdate)
@@ -1629,7 +1659,11 @@ void Player::UpdateObjectVisibility(bool forced, bool fromUpdate)
         return;
 
     if (!forced)
+    {
+        // not a move, the next update has to look at everything in range
+        ResetVisibilityUpdatePosition();
         AddToNotify(NOTIFY_VISIBILITY_CHANGED);
+    }
     else if (!isBeingLoaded())
     {
         if (!fromUpdate) // pussywizard:
@@ -1822,11 +1856,14 @@ void Player::UpdateForQuestWorldObjects()
                 {
                     //! This code doesn't look right, but it was logically converted to condition system to do the exact
                     //! same thing it did before. It definitely needs to be overlooked for intended functionality.
-                    ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(obj->GetEntry(), _itr->second.spellId);
                     bool buildUpdateBlock = false;
-                    for (ConditionList::const_iterator jtr = conds.begin(); jtr != conds.end() && !buildUpdateBlock; ++jtr)
-                        if ((*jtr)->ConditionType == CONDITION_QUESTREWARDED || (*jtr)->ConditionType == CONDITION_QUESTTAKEN)
-                            buildUpdateBlock = true;
+                    if (ConditionProgram const* program = sConditionMgr->GetConditionProgramForSpellClickEvent(obj->GetEntry(), _itr->second.spellId))
+                    {
+                        ConditionList const& conds = program->GetConditions();
+                        for (ConditionList::const_iterator jtr = conds.begin(); jtr != conds.end() && !buildUpdateBlock; ++jtr)
+                            if ((*jtr)->ConditionType == CONDITION_QUESTREWARDED || (*jtr)->ConditionType == CONDITION_QUESTTAKEN)
+                                buildUpdateBlock = true;
+                    }
 
                     if (buildUpdateBlock)
                     {
@@ -2450,5 +2487,5 @@ void Player::UpdateAdditionalSaves(uint32 p_time)
         SaveGoldToDB(trans);
     }
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetSession()->GetAccountId());
 }
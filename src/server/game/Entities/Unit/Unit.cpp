@@ -520,7 +520,7 @@ void Unit::Update(uint32 p_time)
             {
                 m_delayed_unit_relocation_timer = 0;
                 //ExecuteDelayedUnitRelocationEvent();
-                FindMap()->i_objectsForDelayedVisibility.insert(this);
+                FindMap()->AddObjectForDelayedVisibility(this);
             }
             else
                 m_delayed_unit_relocation_timer -= p_time;
@@ -1372,6 +1372,28 @@ SpellCastResult Unit::CastSpell(SpellCastTargets const& targets, SpellInfo const
         originalCaster = triggeredByAura->GetCasterGUID();
     }
 
+    // A spell reaches its targets when it is prepared, during a parallel region update it is cast from the
+    // serial merge phase of the map instead. The triggering aura is looked up again by then. The cast is not
+    // checked before that, callers get SPELL_CAST_DEFERRED instead of its result.
+    if (Map* map = FindMap(); map && map->IsParallelObjectUpdateActive() && !castItem)
+    {
+        CustomSpellValues values = value ? *value : CustomSpellValues();
+        uint32 const auraSpellId = triggeredByAura ? triggeredByAura->GetId() : 0;
+        uint8 const auraEffIndex = triggeredByAura ? triggeredByAura->GetEffIndex() : 0;
+        ObjectGuid const auraCasterGUID = triggeredByAura ? triggeredByAura->GetCasterGUID() : ObjectGuid::Empty;
+
+        if (map->DeferParallelObjectUpdate([this, deferredTargets = SpellCastTargets(targets), spellInfo, values, triggerFlags, auraSpellId, auraEffIndex, auraCasterGUID, originalCaster]() mutable
+        {
+            if (!IsInWorld())
+                return;
+
+            deferredTargets.Update(this);
+            AuraEffect const* aura = auraSpellId ? GetAuraEffect(auraSpellId, auraEffIndex, auraCasterGUID) : nullptr;
+            CastSpell(deferredTargets, spellInfo, values.empty() ? nullptr : &values, triggerFlags, nullptr, aura, originalCaster);
+        }))
+            return SPELL_CAST_DEFERRED;
+    }
+
     Spell* spell = new Spell(this, spellInfo, triggerFlags, originalCaster);
 
     if (value)
@@ -15538,7 +15560,7 @@ bool Unit::HandleSpellClick(Unit* clicker, int8 seatId)
             continue;
 
         //! Check database conditions
-        ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(spellClickEntry, itr->second.spellId);
+        ConditionProgram const* conds = sConditionMgr->GetConditionProgramForSpellClickEvent(spellClickEntry, itr->second.spellId);
         ConditionSourceInfo info = ConditionSourceInfo(clicker, this);
         if (!sConditionMgr->IsObjectMeetToConditions(info, conds))
             continue;
@@ -16372,6 +16394,7 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
                 Cell::VisitObjects(viewPoint, notifier, player->GetSightRange());
                 Cell::VisitFarVisibleObjects(viewPoint, notifier, VISIBILITY_DISTANCE_GIGANTIC);
                 notifier.SendToSelf();
+                player->SetVisibilityUpdatePosition(true);
             }
 
     if (Player* player = this->ToPlayer())
@@ -16383,6 +16406,8 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
         if (viewPoint->GetMapId() != player->GetMapId() || !viewPoint->IsPositionValid() || !player->IsPositionValid())
             return;
 
+        bool incremental = player->CanUpdateVisibilityIncrementally();
+
         if (Unit* active = viewPoint->ToUnit())
         {
             if (active->IsVehicle())
@@ -16395,7 +16420,8 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
                 float dz     = active->m_last_notify_position.GetPositionZ() - active->GetPositionZ();
                 float distsq = dx * dx + dy * dy + dz * dz;
 
-                float mindistsq = DynamicVisibilityMgr::GetReqMoveDistSq(active->FindMap()->GetEntry()->map_type);
+                uint32 mapType = active->FindMap()->GetEntry()->map_type;
+                float mindistsq = incremental ? DynamicVisibilityMgr::GetIncrementalReqMoveDistSq(mapType) : DynamicVisibilityMgr::GetReqMoveDistSq(mapType);
                 if (distsq < mindistsq)
                     return;
 
@@ -16405,10 +16431,25 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
 
         GetMap()->LoadGridsInRange(*player, MAX_VISIBILITY_DISTANCE);
 
-        Acore::PlayerRelocationNotifier notifier(*player);
-        Cell::VisitObjects(player->GetSightPosition().GetPositionX(), player->GetSightPosition().GetPositionY(), player->GetMap(), notifier, player->GetSightRange());
-        Cell::VisitFarVisibleObjects(player->GetSightPosition().GetPositionX(), player->GetSightPosition().GetPositionY(), player->GetMap(), notifier, VISIBILITY_DISTANCE_GIGANTIC);
-        notifier.SendToSelf();
+        Position const& sightPosition = player->GetSightPosition();
+        if (incremental)
+        {
+            Position const& lastPosition = player->GetVisibilityUpdatePosition();
+
+            Acore::PlayerRelocationDeltaNotifier notifier(*player, lastPosition);
+            Cell::VisitObjectsDelta(sightPosition.GetPositionX(), sightPosition.GetPositionY(), lastPosition.GetPositionX(), lastPosition.GetPositionY(), player->GetMap(), notifier, player->GetSightRange());
+            Cell::VisitFarVisibleObjects(sightPosition.GetPositionX(), sightPosition.GetPositionY(), player->GetMap(), notifier, VISIBILITY_DISTANCE_GIGANTIC);
+            notifier.SendToSelf();
+        }
+        else
+        {
+            Acore::PlayerRelocationNotifier notifier(*player);
+            Cell::VisitObjects(sightPosition.GetPositionX(), sightPosition.GetPositionY(), player->GetMap(), notifier, player->GetSightRange());
+            Cell::VisitFarVisibleObjects(sightPosition.GetPositionX(), sightPosition.GetPositionY(), player->GetMap(), notifier, VISIBILITY_DISTANCE_GIGANTIC);
+            notifier.SendToSelf();
+        }
+
+        player->SetVisibilityUpdatePosition(!incremental);
 
         this->AddToNotify(NOTIFY_AI_RELOCATION);
     }
@@ -16425,9 +16466,10 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
         if (distsq < mindistsq)
             return;
 
+        Position lastPosition = unit->m_last_notify_position;
         unit->m_last_notify_position.Relocate(unit->GetPositionX(), unit->GetPositionY(), unit->GetPositionZ());
 
-        Acore::CreatureRelocationNotifier relocate(*unit);
+        Acore::CreatureRelocationNotifier relocate(*unit, sWorld->getBoolConfig(CONFIG_VISIBILITY_INCREMENTAL) ? &lastPosition : nullptr);
         Cell::VisitObjects(unit, relocate, unit->GetVisibilityRange());
 
         this->AddToNotify(NOTIFY_AI_RELOCATION);
@@ -16776,11 +16818,15 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     if (plr && plr->IsInSameRaidWith(target))
         visibleFlag |= UF_FLAG_PARTY_MEMBER;
 
-    uint64 cacheKey = static_cast<uint64>(visibleFlag) << 8 | updateType;
+    ValuesUpdateCacheStats& stats = GetValuesUpdateCacheStats();
+    uint64 cacheKey = MakeValuesUpdateCacheKey(visibleFlag, updateType);
 
     auto cacheIt = _valuesUpdateCache.find(cacheKey);
     if (cacheIt != _valuesUpdateCache.end())
     {
+        ++stats.Hits;
+        stats.BytesSaved += cacheIt->second.buffer.size();
+
         int32 cachePos = static_cast<int32>(data->wpos());
         data->append(cacheIt->second.buffer);
 
@@ -16793,6 +16839,8 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
         return;
     }
 
+    ++stats.Misses;
+
     BuildValuesCachedBuffer cacheValue(500);
 
     ByteBuffer fieldBuffer(400);
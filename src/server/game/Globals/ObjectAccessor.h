@@ -19,6 +19,7 @@
 #define ACORE_OBJECTACCESSOR_H
 
 #include "Define.h"
+#include "FlatHashMap.h"
 #include "GridDefines.h"
 #include "Object.h"
 #include <shared_mutex>
@@ -44,7 +45,7 @@ class HashMapHolder
 
 public:
 
-    typedef std::unordered_map<ObjectGuid, T*> MapType;
+    typedef Acore::FlatHashMap<ObjectGuid, T*> MapType;
 
     static void Insert(T* o);
 
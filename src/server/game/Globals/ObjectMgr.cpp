@@ -52,8 +52,10 @@
 #include "Util.h"
 #include "Vehicle.h"
 #include "World.h"
+#include "WorldSnapshot.h"
 #include <boost/algorithm/string.hpp>
 #include <numeric>
+#include <unordered_set>
 
 #include "ItemEnchantmentMgr.h"
 
@@ -567,10 +569,7 @@ void ObjectMgr::LoadCreatureTemplates()
 
     // Checking needs to be done after loading because of the difficulty self referencing
     for (CreatureTemplateContainer::iterator itr = _creatureTemplateStore.begin(); itr != _creatureTemplateStore.end(); ++itr)
-    {
         CheckCreatureTemplate(&itr->second);
-        itr->second.InitializeQueryData();
-    }
 
     LOG_INFO("server.loading", ">> Loaded {} Creature Definitions in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
@@ -2317,10 +2316,133 @@ void ObjectMgr::LoadGameObjectSummons()
     LOG_INFO("server.loading", " ");
 }
 
+namespace
+{
+    // Validated spawns as stored in the world snapshot, ScriptName indexes the section string table
+    struct CreatureSnapshotRecord
+    {
+        ObjectGuid::LowType SpawnId;
+        uint32 Id;
+        uint32 Id2;
+        uint32 Id3;
+        uint32 DisplayId;
+        uint32 PhaseMask;
+        float PosX;
+        float PosY;
+        float PosZ;
+        float Orientation;
+        uint32 ScriptName;
+        uint32 SpawnGroupId;
+        uint32 PoolId;
+        uint32 SpawnTimeSecs;
+        float WanderDistance;
+        uint32 CurrentWaypoint;
+        uint32 CurHealth;
+        uint32 CurMana;
+        uint32 NpcFlag;
+        uint32 UnitFlags;
+        uint32 DynamicFlags;
+        uint16 MapId;
+        int8 EquipmentId;
+        uint8 MovementType;
+        uint8 SpawnMask;
+        uint8 AddToGrid;
+    };
+
+    struct GameObjectSnapshotRecord
+    {
+        ObjectGuid::LowType SpawnId;
+        uint32 Id;
+        uint32 PhaseMask;
+        float PosX;
+        float PosY;
+        float PosZ;
+        float Orientation;
+        float RotationX;
+        float RotationY;
+        float RotationZ;
+        float RotationW;
+        uint32 ScriptName;
+        uint32 SpawnGroupId;
+        uint32 PoolId;
+        int32 SpawnTimeSecs;
+        uint32 AnimProgress;
+        uint16 MapId;
+        uint8 GoState;
+        uint8 ArtKit;
+        uint8 SpawnMask;
+        uint8 AddToGrid;
+    };
+
+    std::vector<uint32> GetSnapshotScriptIds(std::vector<std::string_view> const& scriptNames)
+    {
+        std::vector<uint32> scriptIds;
+        scriptIds.reserve(scriptNames.size());
+        for (std::string_view scriptName : scriptNames)
+            scriptIds.push_back(sObjectMgr->GetScriptId(std::string(scriptName)));
+
+        return scriptIds;
+    }
+}
+
 void ObjectMgr::LoadCreatures()
 {
     uint32 oldMSTime = getMSTime();
 
+    // the spawns are validated against the templates, so these are part of the snapshot key
+    Optional<WorldSnapshot::Key> snapshotKey;
+    if (sWorldSnapshot->IsOpen() && !sWorld->getBoolConfig(CONFIG_CALCULATE_CREATURE_ZONE_AREA_DATA))
+    {
+        std::string const dbcPath = sWorld->GetDataPath() + "dbc/";
+        snapshotKey = sWorldSnapshot->ComputeKey({ "creature", "game_event_creature", "pool_creature", "creature_multispawn", "creature_template", "creature_equip_template", "gameobject_template", "transports", "map_dbc", "mapdifficulty_dbc" },
+            { dbcPath + "Map.dbc", dbcPath + "MapDifficulty.dbc" });
+    }
+
+    std::span<CreatureSnapshotRecord const> snapshotRecords;
+    std::vector<std::string_view> snapshotStrings;
+    if (snapshotKey && sWorldSnapshot->Read(WORLD_SNAPSHOT_CREATURES, *snapshotKey, snapshotRecords, snapshotStrings))
+    {
+        std::vector<uint32> scriptIds = GetSnapshotScriptIds(snapshotStrings);
+
+        _creatureDataStore.rehash(snapshotRecords.size());
+        for (CreatureSnapshotRecord const& record : snapshotRecords)
+        {
+            CreatureData& data      = _creatureDataStore[record.SpawnId];
+            data.spawnId            = record.SpawnId;
+            data.id                 = record.Id;
+            data.id2                = record.Id2;
+            data.id3                = record.Id3;
+            data.displayid          = record.DisplayId;
+            data.mapid              = record.MapId;
+            data.equipmentId        = record.EquipmentId;
+            data.posX               = record.PosX;
+            data.posY               = record.PosY;
+            data.posZ               = record.PosZ;
+            data.orientation        = record.Orientation;
+            data.spawntimesecs      = record.SpawnTimeSecs;
+            data.wander_distance    = record.WanderDistance;
+            data.currentwaypoint    = record.CurrentWaypoint;
+            data.curhealth          = record.CurHealth;
+            data.curmana            = record.CurMana;
+            data.movementType       = record.MovementType;
+            data.spawnMask          = record.SpawnMask;
+            data.phaseMask          = record.PhaseMask;
+            data.poolId             = record.PoolId;
+            data.npcflag            = record.NpcFlag;
+            data.unit_flags         = record.UnitFlags;
+            data.dynamicflags       = record.DynamicFlags;
+            data.ScriptId           = record.ScriptName < scriptIds.size() ? scriptIds[record.ScriptName] : 0;
+            data.spawnGroupId       = record.SpawnGroupId;
+
+            if (record.AddToGrid)
+                AddCreatureToGrid(record.SpawnId, &data);
+        }
+
+        LOG_INFO("server.loading", ">> Loaded {} Creatures from the world snapshot in {} ms", snapshotRecords.size(), GetMSTimeDiffToNow(oldMSTime));
+        LOG_INFO("server.loading", " ");
+        return;
+    }
+
     //                                                     0         1   2        3            4           5           6            7              8             9
     QueryResult result = WorldDatabase.Query("SELECT creature.guid, id, map, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, wander_distance, "
                          //      10            11       12          13           14         15         16          17             18                 19                    20
@@ -2350,6 +2472,7 @@ void ObjectMgr::LoadCreatures()
                     spawnMasks[i] |= (1 << k);
 
     _creatureDataStore.rehash(result->GetRowCount());
+    std::unordered_set<ObjectGuid::LowType> gridSpawns;
     uint32 count = 0;
     do
     {
@@ -2493,7 +2616,11 @@ void ObjectMgr::LoadCreatures()
         // Add to grid if not managed by the game event. Pooled spawns are in
         // the grid data too; the grid loader filters them by pool state.
         if (gameEvent == 0)
+        {
             AddCreatureToGrid(spawnId, &data);
+            if (snapshotKey)
+                gridSpawns.insert(spawnId);
+        }
 
         ++count;
     } while (result->NextRow());
@@ -2564,6 +2691,44 @@ void ObjectMgr::LoadCreatures()
         LOG_INFO("server.loading", ">> Loaded {} creature spawn variants", variantCount);
     }
 
+    if (snapshotKey)
+    {
+        std::vector<CreatureSnapshotRecord> records;
+        records.reserve(_creatureDataStore.size());
+        for (auto const& [spawnId, data] : _creatureDataStore)
+        {
+            CreatureSnapshotRecord& record = records.emplace_back();
+            record.SpawnId          = spawnId;
+            record.Id               = data.id;
+            record.Id2              = data.id2;
+            record.Id3              = data.id3;
+            record.DisplayId        = data.displayid;
+            record.PhaseMask        = data.phaseMask;
+            record.PosX             = data.posX;
+            record.PosY             = data.posY;
+            record.PosZ             = data.posZ;
+            record.Orientation      = data.orientation;
+            record.ScriptName       = data.ScriptId;
+            record.SpawnGroupId     = data.spawnGroupId;
+            record.PoolId           = data.poolId;
+            record.SpawnTimeSecs    = data.spawntimesecs;
+            record.WanderDistance   = data.wander_distance;
+            record.CurrentWaypoint  = data.currentwaypoint;
+            record.CurHealth        = data.curhealth;
+            record.CurMana          = data.curmana;
+            record.NpcFlag          = data.npcflag;
+            record.UnitFlags        = data.unit_flags;
+            record.DynamicFlags     = data.dynamicflags;
+            record.MapId            = data.mapid;
+            record.EquipmentId      = data.equipmentId;
+            record.MovementType     = data.movementType;
+            record.SpawnMask        = data.spawnMask;
+            record.AddToGrid        = gridSpawns.count(spawnId) ? 1 : 0;
+        }
+
+        sWorldSnapshot->Write(WORLD_SNAPSHOT_CREATURES, *snapshotKey, records, _scriptNamesStore);
+    }
+
     LOG_INFO("server.loading", ">> Loaded {} Creatures in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -2921,6 +3086,51 @@ void ObjectMgr::LoadGameobjects()
 {
     uint32 oldMSTime = getMSTime();
 
+    Optional<WorldSnapshot::Key> snapshotKey;
+    if (sWorldSnapshot->IsOpen() && !sWorld->getBoolConfig(CONFIG_CALCULATE_GAMEOBJECT_ZONE_AREA_DATA))
+    {
+        std::string const dbcPath = sWorld->GetDataPath() + "dbc/";
+        snapshotKey = sWorldSnapshot->ComputeKey({ "gameobject", "game_event_gameobject", "pool_gameobject", "gameobject_template", "transports", "map_dbc", "mapdifficulty_dbc", "gameobjectdisplayinfo_dbc" },
+            { dbcPath + "Map.dbc", dbcPath + "MapDifficulty.dbc", dbcPath + "GameObjectDisplayInfo.dbc" });
+    }
+
+    std::span<GameObjectSnapshotRecord const> snapshotRecords;
+    std::vector<std::string_view> snapshotStrings;
+    if (snapshotKey && sWorldSnapshot->Read(WORLD_SNAPSHOT_GAMEOBJECTS, *snapshotKey, snapshotRecords, snapshotStrings))
+    {
+        std::vector<uint32> scriptIds = GetSnapshotScriptIds(snapshotStrings);
+
+        _gameObjectDataStore.rehash(snapshotRecords.size());
+        for (GameObjectSnapshotRecord const& record : snapshotRecords)
+        {
+            GameObjectData& data = _gameObjectDataStore[record.SpawnId];
+            data.spawnId        = record.SpawnId;
+            data.id             = record.Id;
+            data.mapid          = record.MapId;
+            data.posX           = record.PosX;
+            data.posY           = record.PosY;
+            data.posZ           = record.PosZ;
+            data.orientation    = record.Orientation;
+            data.rotation       = G3D::Quat(record.RotationX, record.RotationY, record.RotationZ, record.RotationW);
+            data.spawntimesecs  = record.SpawnTimeSecs;
+            data.ScriptId       = record.ScriptName < scriptIds.size() ? scriptIds[record.ScriptName] : 0;
+            data.spawnGroupId   = record.SpawnGroupId;
+            data.animprogress   = record.AnimProgress;
+            data.artKit         = record.ArtKit;
+            data.go_state       = GOState(record.GoState);
+            data.spawnMask      = record.SpawnMask;
+            data.phaseMask      = record.PhaseMask;
+            data.poolId         = record.PoolId;
+
+            if (record.AddToGrid)
+                AddGameobjectToGrid(record.SpawnId, &data);
+        }
+
+        LOG_INFO("server.loading", ">> Loaded {} Gameobjects from the world snapshot in {} ms", snapshotRecords.size(), GetMSTimeDiffToNow(oldMSTime));
+        LOG_INFO("server.loading", " ");
+        return;
+    }
+
     //                                                0                1   2    3           4           5           6
     QueryResult result = WorldDatabase.Query("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
                          //   7          8          9          10         11             12            13     14         15         16          17
@@ -2949,6 +3159,7 @@ void ObjectMgr::LoadGameobjects()
                     spawnMasks[i] |= (1 << k);
 
     _gameObjectDataStore.rehash(result->GetRowCount());
+    std::unordered_set<ObjectGuid::LowType> gridSpawns;
     do
     {
         Field* fields = result->Fetch();
@@ -3096,9 +3307,46 @@ void ObjectMgr::LoadGameobjects()
         }
 
         if (gameEvent == 0)                      // if not this is to be managed by GameEvent System
+        {
             AddGameobjectToGrid(guid, &data);
+            if (snapshotKey)
+                gridSpawns.insert(guid);
+        }
     } while (result->NextRow());
 
+    if (snapshotKey)
+    {
+        std::vector<GameObjectSnapshotRecord> records;
+        records.reserve(_gameObjectDataStore.size());
+        for (auto const& [spawnId, data] : _gameObjectDataStore)
+        {
+            GameObjectSnapshotRecord& record = records.emplace_back();
+            record.SpawnId          = spawnId;
+            record.Id               = data.id;
+            record.PhaseMask        = data.phaseMask;
+            record.PosX             = data.posX;
+            record.PosY             = data.posY;
+            record.PosZ             = data.posZ;
+            record.Orientation      = data.orientation;
+            record.RotationX        = data.rotation.x;
+            record.RotationY        = data.rotation.y;
+            record.RotationZ        = data.rotation.z;
+            record.RotationW        = data.rotation.w;
+            record.ScriptName       = data.ScriptId;
+            record.SpawnGroupId     = data.spawnGroupId;
+            record.PoolId           = data.poolId;
+            record.SpawnTimeSecs    = data.spawntimesecs;
+            record.AnimProgress     = data.animprogress;
+            record.MapId            = data.mapid;
+            record.GoState          = uint8(data.go_state);
+            record.ArtKit           = data.artKit;
+            record.SpawnMask        = data.spawnMask;
+            record.AddToGrid        = gridSpawns.count(spawnId) ? 1 : 0;
+        }
+
+        sWorldSnapshot->Write(WORLD_SNAPSHOT_GAMEOBJECTS, *snapshotKey, records, _scriptNamesStore);
+    }
+
     LOG_INFO("server.loading", ">> Loaded {} Gameobjects in {} ms", (unsigned long)_gameObjectDataStore.size(), GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -5150,9 +5398,6 @@ void ObjectMgr::LoadQuests()
         }
     }
 
-    for (QuestMap::iterator itr = _questTemplates.begin(); itr != _questTemplates.end(); ++itr)
-        itr->second->InitializeQueryData();
-
     std::map<uint32, uint32> usedMailTemplates;
 
     // Load `quest_details`
@@ -11051,6 +11296,8 @@ void ObjectMgr::LoadGameObjectQuestItems()
 {
     uint32 oldMSTime = getMSTime();
 
+    _gameObjectQuestItemStore.clear();                             // needed for reload case
+
     //                                               0                1        2
     QueryResult result = WorldDatabase.Query("SELECT GameObjectEntry, ItemId, Idx FROM gameobject_questitem ORDER BY Idx ASC");
 
@@ -11096,6 +11343,8 @@ void ObjectMgr::LoadCreatureQuestItems()
 {
     uint32 oldMSTime = getMSTime();
 
+    _creatureQuestItemStore.clear();                             // needed for reload case
+
     //                                               0              1        2
     QueryResult result = WorldDatabase.Query("SELECT CreatureEntry, ItemId, Idx FROM creature_questitem ORDER BY Idx ASC");
 
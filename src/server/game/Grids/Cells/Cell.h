@@ -31,6 +31,12 @@ struct CellArea
 
     bool operator!() const { return low_bound == high_bound; }
 
+    [[nodiscard]] bool Contains(CellCoord const& cell) const
+    {
+        return cell.x_coord >= low_bound.x_coord && cell.x_coord <= high_bound.x_coord
+            && cell.y_coord >= low_bound.y_coord && cell.y_coord <= high_bound.y_coord;
+    }
+
     void ResizeBorders(CellCoord& begin_cell, CellCoord& end_cell) const
     {
         begin_cell = low_bound;
@@ -106,6 +112,9 @@ struct Cell
     template<class T> static void VisitObjects(WorldObject const* obj, T& visitor, float radius);
     template<class T> static void VisitObjects(float x, float y, Map* map, T& visitor, float radius);
 
+    // Visits the cells around x, y like VisitObjects, telling the visitor which cells were out of the same area around lastX, lastY
+    template<class T> static void VisitObjectsDelta(float x, float y, float lastX, float lastY, Map* map, T& visitor, float radius);
+
     template<class T> static void VisitFarVisibleObjects(WorldObject const* obj, T& visitor, float radius);
     template<class T> static void VisitFarVisibleObjects(float x, float y, Map* map, T& visitor, float radius);
 
@@ -173,8 +173,38 @@ inline void Cell::VisitObjects(float x, float y, Map* map, T& visitor, float rad
     CellCoord p(Acore::ComputeCellCoord(x, y));
     Cell cell(p);
 
+    // lets indexed searchers skip objects out of the searched area, see Acore::GridIndexSearcher
+    if constexpr (requires { visitor.SetGridSearchArea(x, y, radius); })
+        visitor.SetGridSearchArea(x, y, radius);
+
     TypeContainerVisitor<T, GridTypeMapContainer> gnotifier(visitor);
     cell.Visit(p, gnotifier, *map, x, y, radius);
+
+    if constexpr (requires { visitor.SetGridSearchArea(x, y, radius); })
+        visitor.SetGridSearchArea(x, y, 0.0f);
+}
+
+template<class T>
+inline void Cell::VisitObjectsDelta(float x, float y, float lastX, float lastY, Map* map, T& visitor, float radius)
+{
+    if (radius > SIZE_OF_GRIDS)
+        radius = SIZE_OF_GRIDS;
+
+    CellArea area = Cell::CalculateCellArea(x, y, radius);
+    CellArea lastArea = Cell::CalculateCellArea(lastX, lastY, radius);
+
+    TypeContainerVisitor<T, GridTypeMapContainer> gnotifier(visitor);
+    for (uint32 cellX = area.low_bound.x_coord; cellX <= area.high_bound.x_coord; ++cellX)
+    {
+        for (uint32 cellY = area.low_bound.y_coord; cellY <= area.high_bound.y_coord; ++cellY)
+        {
+            CellCoord cellCoord(cellX, cellY);
+            visitor.SetCellEntered(!lastArea.Contains(cellCoord));
+
+            Cell cell(cellCoord);
+            map->Visit(cell, gnotifier);
+        }
+    }
 }
 
 template<class T>
@@ -30,6 +30,7 @@
 */
 
 #include "Define.h"
+#include "GridCellObjectIndex.h"
 #include "TypeContainer.h"
 #include "TypeContainerVisitor.h"
 
@@ -50,13 +51,18 @@ public:
     {
         _gridObjects.template insert<SPECIFIC_OBJECT>(obj);
         ASSERT(obj->IsInGrid());
+        _objectIndex.Insert(obj);
     }
 
     // Visit grid objects
+    // Visitors declaring GRID_INDEX_TYPE_MASK filter over the object index instead of walking the object lists
     template<class T>
     void Visit(TypeContainerVisitor<T, TypeMapContainer<GRID_OBJECT_TYPES>>& visitor)
     {
-        visitor.Visit(_gridObjects);
+        if constexpr (requires { T::GRID_INDEX_TYPE_MASK; })
+            visitor.GetVisitor().Visit(_objectIndex);
+        else
+            visitor.Visit(_gridObjects);
     }
 
     template<class SPECIFIC_OBJECT>
@@ -80,6 +86,7 @@ public:
 
 private:
     TypeMapContainer<GRID_OBJECT_TYPES> _gridObjects;
+    GridCellObjectIndex _objectIndex;
     TypeVectorContainer<FAR_VISIBLE_OBJECT_TYPES> _farVisibleObjects;
 };
 #endif
@@ -0,0 +1,179 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridCellObjectIndex.h"
+#include "GridDefines.h"
+#include "Object.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GRID_CELL_INDEX_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    uint32 GetGridMapTypeMask(WorldObject const* obj)
+    {
+        switch (obj->GetTypeId())
+        {
+            case TYPEID_PLAYER:
+                return GRID_MAP_TYPE_MASK_PLAYER;
+            case TYPEID_UNIT:
+                return GRID_MAP_TYPE_MASK_CREATURE;
+            case TYPEID_GAMEOBJECT:
+                return GRID_MAP_TYPE_MASK_GAMEOBJECT;
+            case TYPEID_DYNAMICOBJECT:
+                return GRID_MAP_TYPE_MASK_DYNAMICOBJECT;
+            case TYPEID_CORPSE:
+                return GRID_MAP_TYPE_MASK_CORPSE;
+            default:
+                ABORT();
+        }
+    }
+}
+
+GridCellObjectIndex::~GridCellObjectIndex()
+{
+    for (WorldObject* obj : _objects)
+        obj->SetGridCellIndex(nullptr, 0);
+}
+
+void GridCellObjectIndex::Insert(WorldObject* obj)
+{
+    ASSERT(!obj->GetGridCellIndex());
+
+    uint32 slot = uint32(_objects.size());
+    _x.push_back(obj->GetPositionX());
+    _y.push_back(obj->GetPositionY());
+    _size.push_back(obj->IsUnit() ? obj->GetObjectSize() : 0.0f);
+    _phaseMask.push_back(obj->GetPhaseMask());
+    _combinedPhases.push_back(obj->UsesCombinedPhases() ? 0xFFFFFFFF : 0);
+    _typeMask.push_back(GetGridMapTypeMask(obj));
+    _objects.push_back(obj);
+
+    obj->SetGridCellIndex(this, slot);
+}
+
+void GridCellObjectIndex::Remove(uint32 slot)
+{
+    ASSERT(slot < _objects.size());
+
+    _objects[slot]->SetGridCellIndex(nullptr, 0);
+
+    // swap the last entry in, slots are not stable
+    uint32 last = uint32(_objects.size() - 1);
+    if (slot != last)
+    {
+        _x[slot] = _x[last];
+        _y[slot] = _y[last];
+        _size[slot] = _size[last];
+        _phaseMask[slot] = _phaseMask[last];
+        _combinedPhases[slot] = _combinedPhases[last];
+        _typeMask[slot] = _typeMask[last];
+        _objects[slot] = _objects[last];
+        _objects[slot]->SetGridCellIndex(this, slot);
+    }
+
+    _x.pop_back();
+    _y.pop_back();
+    _size.pop_back();
+    _phaseMask.pop_back();
+    _combinedPhases.pop_back();
+    _typeMask.pop_back();
+    _objects.pop_back();
+}
+
+bool GridCellObjectIndex::Matches(GridCellObjectIndexFilter const& filter, uint32 slot) const
+{
+    if (!(_typeMask[slot] & filter.TypeMask))
+        return false;
+
+    if (filter.CheckPhase)
+    {
+        // same as WorldObject::InSamePhase
+        if (_combinedPhases[slot] ? !(_phaseMask[slot] & filter.PhaseMask) : _phaseMask[slot] != filter.PhaseMask)
+            return false;
+    }
+
+    if (_typeMask[slot] & filter.RangeTypeMask)
+    {
+        float dx = _x[slot] - filter.X;
+        float dy = _y[slot] - filter.Y;
+        float range = filter.Range + (filter.AddObjectSize ? _size[slot] : 0.0f);
+        if (dx * dx + dy * dy > range * range)
+            return false;
+    }
+
+    return true;
+}
+
+void GridCellObjectIndex::Select(GridCellObjectIndexFilter const& filter, std::vector<GridCellObjectIndexCandidate>& result) const
+{
+    uint32 const count = uint32(_objects.size());
+    uint32 slot = 0;
+
+#ifdef GRID_CELL_INDEX_SSE2
+    __m128 const centerX = _mm_set1_ps(filter.X);
+    __m128 const centerY = _mm_set1_ps(filter.Y);
+    __m128 const range = _mm_set1_ps(filter.Range);
+    __m128 const sizeFactor = _mm_set1_ps(filter.AddObjectSize ? 1.0f : 0.0f);
+    __m128i const typeMask = _mm_set1_epi32(int32(filter.TypeMask));
+    __m128i const rangeTypeMask = _mm_set1_epi32(int32(filter.RangeTypeMask));
+    __m128i const phaseMask = _mm_set1_epi32(int32(filter.PhaseMask));
+    __m128i const skipPhase = _mm_set1_epi32(filter.CheckPhase ? 0 : -1);
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const allSet = _mm_set1_epi32(-1);
+
+    for (; slot + 4 <= count; slot += 4)
+    {
+        __m128i types = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&_typeMask[slot]));
+        __m128i wanted = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(types, typeMask), zero), allSet);
+
+        // phase, per object either shared bits or equality
+        __m128i phases = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&_phaseMask[slot]));
+        __m128i combined = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&_combinedPhases[slot]));
+        __m128i sharedPhase = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(phases, phaseMask), zero), allSet);
+        __m128i equalPhase = _mm_cmpeq_epi32(phases, phaseMask);
+        __m128i inPhase = _mm_or_si128(_mm_and_si128(combined, sharedPhase), _mm_andnot_si128(combined, equalPhase));
+        inPhase = _mm_or_si128(inPhase, skipPhase);
+
+        // range, only for the types asking for it
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(&_x[slot]), centerX);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(&_y[slot]), centerY);
+        __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 limit = _mm_add_ps(range, _mm_mul_ps(_mm_loadu_ps(&_size[slot]), sizeFactor));
+        __m128i inRange = _mm_castps_si128(_mm_cmple_ps(distSq, _mm_mul_ps(limit, limit)));
+        __m128i rangeChecked = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(types, rangeTypeMask), zero), allSet);
+        inRange = _mm_or_si128(inRange, _mm_andnot_si128(rangeChecked, allSet));
+
+        int matches = _mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(_mm_and_si128(wanted, inPhase), inRange)));
+        for (uint32 lane = 0; matches; ++lane, matches >>= 1)
+            if (matches & 1)
+                result.push_back({ _objects[slot + lane], _typeMask[slot + lane] });
+    }
+#endif
+
+    for (; slot < count; ++slot)
+        if (Matches(filter, slot))
+            result.push_back({ _objects[slot], _typeMask[slot] });
+}
+
+std::vector<GridCellObjectIndexCandidate>& GridCellObjectIndex::GetCandidateBuffer()
+{
+    thread_local std::vector<GridCellObjectIndexCandidate> buffer;
+    return buffer;
+}
@@ -0,0 +1,99 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_GRID_CELL_OBJECT_INDEX_H
+#define ACORE_GRID_CELL_OBJECT_INDEX_H
+
+#include "Define.h"
+#include <vector>
+
+class WorldObject;
+
+// What a visitor wants from a cell, tested over the packed object index
+struct GridCellObjectIndexFilter
+{
+    uint32 TypeMask = 0x1F;         // GridMapTypeMask of the wanted objects
+    bool CheckPhase = false;        // objects must be InSamePhase(PhaseMask)
+    uint32 PhaseMask = 0;
+    uint32 RangeTypeMask = 0;       // GridMapTypeMask of the objects tested against the range, others always pass
+    float X = 0.0f;
+    float Y = 0.0f;
+    float Range = 0.0f;             // 2d range around X, Y
+    bool AddObjectSize = false;     // extend Range by the size (combat reach) of each unit
+};
+
+struct GridCellObjectIndexCandidate
+{
+    WorldObject* Object;
+    uint32 TypeMask;
+};
+
+/*
+  @class GridCellObjectIndex
+  Structure of arrays mirror of the objects stored in a GridCell, holding what
+  searchers look at before anything else: position, phase and object type.
+  Filtering over it avoids walking the intrusive lists and loading every object
+  just to reject it. Objects keep their slot (see WorldObject::GetGridCellIndex)
+  and update it on relocation, phase and size changes.
+*/
+class GridCellObjectIndex
+{
+public:
+    GridCellObjectIndex() = default;
+    ~GridCellObjectIndex();
+
+    GridCellObjectIndex(GridCellObjectIndex const&) = delete;
+    GridCellObjectIndex& operator=(GridCellObjectIndex const&) = delete;
+
+    void Insert(WorldObject* obj);
+    void Remove(uint32 slot);
+
+    void UpdatePosition(uint32 slot, float x, float y)
+    {
+        _x[slot] = x;
+        _y[slot] = y;
+    }
+
+    void UpdatePhaseMask(uint32 slot, uint32 phaseMask, bool combinedPhases)
+    {
+        _phaseMask[slot] = phaseMask;
+        _combinedPhases[slot] = combinedPhases ? 0xFFFFFFFF : 0;
+    }
+
+    void UpdateObjectSize(uint32 slot, float size) { _size[slot] = size; }
+
+    // Appends the objects passing the filter to result
+    void Select(GridCellObjectIndexFilter const& filter, std::vector<GridCellObjectIndexCandidate>& result) const;
+
+    [[nodiscard]] uint32 Size() const { return uint32(_objects.size()); }
+
+    // Scratch buffer for Select results, shared by nested visits on the same thread
+    static std::vector<GridCellObjectIndexCandidate>& GetCandidateBuffer();
+
+private:
+    [[nodiscard]] bool Matches(GridCellObjectIndexFilter const& filter, uint32 slot) const;
+
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _size;
+    std::vector<uint32> _phaseMask;
+    std::vector<uint32> _combinedPhases;    // all bits set when the object combines phases
+    std::vector<uint32> _typeMask;
+    std::vector<WorldObject*> _objects;
+};
+
+#endif
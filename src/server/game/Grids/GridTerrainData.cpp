@@ -3,129 +3,186 @@
 #include "GridTerrainData.h"
 #include "Log.h"
 #include "MapDefines.h"
+#include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <G3D/Ray.h>
 
 uint16 const holetab_h[4] = { 0x1111, 0x2222, 0x4444, 0x8888 };
 uint16 const holetab_v[4] = { 0x000F, 0x00F0, 0x0F00, 0xF000 };
 
-GridTerrainData::GridTerrainData()
+GridTerrainData::GridTerrainData() : _fileData(nullptr), _fileSize(0)
 {
     _gridGetHeight = &GridTerrainData::getHeightFromFlat;
 }
 
-TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName)
+TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName, bool memoryMapped)
 {
     // Check if file exists, we do this first as we need to
     // differentiate between file existing and any other file errors
     if (!std::filesystem::exists(mapFileName))
         return TerrainMapDataReadResult::NotFound;
 
-    // Start the input stream and check for any errors
-    std::ifstream fileStream(mapFileName, std::ios::binary);
-    if (fileStream.fail())
-        return TerrainMapDataReadResult::ReadError;
+    if (memoryMapped)
+    {
+        // sections are used in place, pages are only read once a lookup touches them
+        _mappedFile = std::make_unique<MappedFile>();
+        if (!_mappedFile->Open(mapFileName))
+            return TerrainMapDataReadResult::ReadError;
+
+        _fileData = _mappedFile->GetData();
+        _fileSize = _mappedFile->GetSize();
+    }
+    else
+    {
+        // one read of the whole file into one allocation, sections point into it
+        std::ifstream fileStream(mapFileName, std::ios::binary | std::ios::ate);
+        if (fileStream.fail())
+            return TerrainMapDataReadResult::ReadError;
+
+        std::streamoff const fileSize = fileStream.tellg();
+        if (fileSize <= 0)
+            return TerrainMapDataReadResult::ReadError;
+
+        _fileCopy = std::make_unique<uint8[]>(std::size_t(fileSize));
+        fileStream.seekg(0);
+        if (!fileStream.read(reinterpret_cast<char*>(_fileCopy.get()), fileSize))
+            return TerrainMapDataReadResult::ReadError;
+
+        _fileData = _fileCopy.get();
+        _fileSize = std::size_t(fileSize);
+    }
 
     // Read the map header
     map_fileheader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    if (_fileSize < sizeof(header))
         return TerrainMapDataReadResult::ReadError;
 
+    memcpy(&header, _fileData, sizeof(header));
+
     // Check for valid map and version magics
     if (header.mapMagic != MapMagic.asUInt || header.versionMagic != MapVersionMagic)
         return TerrainMapDataReadResult::InvalidMagic;
 
+    // Every section must be as large in the file as the header says, a truncated file is rejected
+    // before any lookup can read past its end
+    auto const isInFile = [this](uint32 offset, uint32 size) { return uint64(offset) + size <= _fileSize; };
+
     // Load area data
-    if (header.areaMapOffset && !LoadAreaData(fileStream, header.areaMapOffset))
+    if (header.areaMapOffset && (!isInFile(header.areaMapOffset, header.areaMapSize) || !LoadAreaData(header.areaMapOffset)))
         return TerrainMapDataReadResult::InvalidAreaData;
 
     // Load height data
-    if (header.heightMapOffset && !LoadHeightData(fileStream, header.heightMapOffset))
+    if (header.heightMapOffset && (!isInFile(header.heightMapOffset, header.heightMapSize) || !LoadHeightData(header.heightMapOffset)))
         return TerrainMapDataReadResult::InvalidHeightData;
 
     // Load liquid data
-    if (header.liquidMapOffset && !LoadLiquidData(fileStream, header.liquidMapOffset))
+    if (header.liquidMapOffset && (!isInFile(header.liquidMapOffset, header.liquidMapSize) || !LoadLiquidData(header.liquidMapOffset)))
         return TerrainMapDataReadResult::InvalidLiquidData;
 
     // Load hole data
-    if (header.holesSize && !LoadHolesData(fileStream, header.holesOffset))
+    if (header.holesSize && (!isInFile(header.holesOffset, header.holesSize) || !LoadHolesData(header.holesOffset)))
         return TerrainMapDataReadResult::InvalidHoleData;
 
     return TerrainMapDataReadResult::Success;
 }
 
-bool GridTerrainData::LoadAreaData(std::ifstream& fileStream, uint32 const offset)
+template<typename T>
+T const* GridTerrainData::GetFileSection(std::size_t offset, std::size_t count)
 {
-    fileStream.seekg(offset);
+    static_assert(alignof(T) <= alignof(uint32), "sections are at most uint32 aligned");
+
+    std::size_t const size = count * sizeof(T);
+    if (offset > _fileSize || size > _fileSize - offset)
+        return nullptr;
 
-    map_areaHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapAreaMagic.asUInt)
+    uint8 const* section = _fileData + offset;
+    if (reinterpret_cast<uintptr_t>(section) % alignof(T) == 0)
+        return reinterpret_cast<T const*>(section);
+
+    std::unique_ptr<uint32[]> copy = std::make_unique<uint32[]>((size + sizeof(uint32) - 1) / sizeof(uint32));
+    memcpy(copy.get(), section, size);
+    _alignedSections.push_back(std::move(copy));
+    return reinterpret_cast<T const*>(_alignedSections.back().get());
+}
+
+bool GridTerrainData::LoadAreaData(uint32 const offset)
+{
+    map_areaHeader const* header = GetFileSection<map_areaHeader>(offset, 1);
+    if (!header || header->fourcc != MapAreaMagic.asUInt)
         return false;
 
     _loadedAreaData = std::make_unique<LoadedAreaData>();
-    _loadedAreaData->gridArea = header.gridArea;
-    if (!(header.flags & MAP_AREA_NO_AREA))
+    _loadedAreaData->gridArea = header->gridArea;
+    if (!(header->flags & MAP_AREA_NO_AREA))
     {
-        _loadedAreaData->areaMap = std::make_unique<LoadedAreaData::AreaMapType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedAreaData->areaMap.get()), sizeof(LoadedAreaData::AreaMapType)))
+        _loadedAreaData->areaMap = GetFileSection<uint16>(offset + sizeof(map_areaHeader), LoadedAreaData::AreaMapSize);
+        if (!_loadedAreaData->areaMap)
             return false;
     }
     return true;
 }
 
-bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadHeightData(uint32 const offset)
 {
-    fileStream.seekg(offset);
-
-    map_heightHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapHeightMagic.asUInt)
+    map_heightHeader const* header = GetFileSection<map_heightHeader>(offset, 1);
+    if (!header || header->fourcc != MapHeightMagic.asUInt)
         return false;
 
+    std::size_t dataOffset = offset + sizeof(map_heightHeader);
     _loadedHeightData = std::make_unique<LoadedHeightData>();
-    _loadedHeightData->gridHeight = header.gridHeight;
-    if (!(header.flags & MAP_HEIGHT_NO_HEIGHT))
+    _loadedHeightData->gridHeight = header->gridHeight;
+    if (!(header->flags & MAP_HEIGHT_NO_HEIGHT))
     {
-        if ((header.flags & MAP_HEIGHT_AS_INT16))
+        if ((header->flags & MAP_HEIGHT_AS_INT16))
         {
             _loadedHeightData->uint16HeightData = std::make_unique<LoadedHeightData::Uint16HeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint16HeightData->v9), sizeof(_loadedHeightData->uint16HeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint16HeightData->v8), sizeof(_loadedHeightData->uint16HeightData->v8)))
+            _loadedHeightData->uint16HeightData->v9 = GetFileSection<uint16>(dataOffset, LoadedHeightData::V9Size);
+            _loadedHeightData->uint16HeightData->v8 = GetFileSection<uint16>(dataOffset + LoadedHeightData::V9Size * sizeof(uint16), LoadedHeightData::V8Size);
+            if (!_loadedHeightData->uint16HeightData->v9 || !_loadedHeightData->uint16HeightData->v8)
                 return false;
 
-            _loadedHeightData->uint16HeightData->gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
+            dataOffset += (LoadedHeightData::V9Size + LoadedHeightData::V8Size) * sizeof(uint16);
+            _loadedHeightData->uint16HeightData->gridIntHeightMultiplier = (header->gridMaxHeight - header->gridHeight) / 65535;
             _gridGetHeight = &GridTerrainData::getHeightFromUint16;
         }
-        else if ((header.flags & MAP_HEIGHT_AS_INT8))
+        else if ((header->flags & MAP_HEIGHT_AS_INT8))
         {
             _loadedHeightData->uint8HeightData = std::make_unique<LoadedHeightData::Uint8HeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint8HeightData->v9), sizeof(_loadedHeightData->uint8HeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint8HeightData->v8), sizeof(_loadedHeightData->uint8HeightData->v8)))
+            _loadedHeightData->uint8HeightData->v9 = GetFileSection<uint8>(dataOffset, LoadedHeightData::V9Size);
+            _loadedHeightData->uint8HeightData->v8 = GetFileSection<uint8>(dataOffset + LoadedHeightData::V9Size * sizeof(uint8), LoadedHeightData::V8Size);
+            if (!_loadedHeightData->uint8HeightData->v9 || !_loadedHeightData->uint8HeightData->v8)
                 return false;
 
-            _loadedHeightData->uint8HeightData->gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
+            dataOffset += (LoadedHeightData::V9Size + LoadedHeightData::V8Size) * sizeof(uint8);
+            _loadedHeightData->uint8HeightData->gridIntHeightMultiplier = (header->gridMaxHeight - header->gridHeight) / 255;
             _gridGetHeight = &GridTerrainData::getHeightFromUint8;
         }
         else
         {
             _loadedHeightData->floatHeightData = std::make_unique<LoadedHeightData::FloatHeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->floatHeightData->v9), sizeof(_loadedHeightData->floatHeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->floatHeightData->v8), sizeof(_loadedHeightData->floatHeightData->v8)))
+            _loadedHeightData->floatHeightData->v9 = GetFileSection<float>(dataOffset, LoadedHeightData::V9Size);
+            _loadedHeightData->floatHeightData->v8 = GetFileSection<float>(dataOffset + LoadedHeightData::V9Size * sizeof(float), LoadedHeightData::V8Size);
+            if (!_loadedHeightData->floatHeightData->v9 || !_loadedHeightData->floatHeightData->v8)
                 return false;
 
+            dataOffset += (LoadedHeightData::V9Size + LoadedHeightData::V8Size) * sizeof(float);
             _gridGetHeight = &GridTerrainData::getHeightFromFloat;
         }
     }
     else
         _gridGetHeight = &GridTerrainData::getHeightFromFlat;
 
-    if (header.flags & MAP_HEIGHT_HAS_FLIGHT_BOUNDS)
+    if (header->flags & MAP_HEIGHT_HAS_FLIGHT_BOUNDS)
     {
         std::array<int16, 9> maxHeights;
         std::array<int16, 9> minHeights;
-        if (!fileStream.read(reinterpret_cast<char*>(maxHeights.data()), sizeof(maxHeights)) ||
-            !fileStream.read(reinterpret_cast<char*>(minHeights.data()), sizeof(minHeights)))
+        if (dataOffset + sizeof(maxHeights) + sizeof(minHeights) > _fileSize)
             return false;
 
+        memcpy(maxHeights.data(), _fileData + dataOffset, sizeof(maxHeights));
+        memcpy(minHeights.data(), _fileData + dataOffset + sizeof(maxHeights), sizeof(minHeights));
+
         static uint32 constexpr indices[8][3] =
         {
             { 3, 0, 4 },
@@ -163,49 +220,49 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
     return true;
 }
 
-bool GridTerrainData::LoadLiquidData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadLiquidData(uint32 const offset)
 {
-    fileStream.seekg(offset);
-
-    map_liquidHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapLiquidMagic.asUInt)
+    map_liquidHeader const* header = GetFileSection<map_liquidHeader>(offset, 1);
+    if (!header || header->fourcc != MapLiquidMagic.asUInt)
         return false;
 
+    std::size_t dataOffset = offset + sizeof(map_liquidHeader);
     _loadedLiquidData = std::make_unique<LoadedLiquidData>();
-    _loadedLiquidData->liquidGlobalEntry = header.liquidType;
-    _loadedLiquidData->liquidGlobalFlags = header.liquidFlags;
-    _loadedLiquidData->liquidOffX = header.offsetX;
-    _loadedLiquidData->liquidOffY = header.offsetY;
-    _loadedLiquidData->liquidWidth = header.width;
-    _loadedLiquidData->liquidHeight = header.height;
-    _loadedLiquidData->liquidLevel = header.liquidLevel;
-
-    if (!(header.flags & MAP_LIQUID_NO_TYPE))
+    _loadedLiquidData->liquidGlobalEntry = header->liquidType;
+    _loadedLiquidData->liquidGlobalFlags = header->liquidFlags;
+    _loadedLiquidData->liquidOffX = header->offsetX;
+    _loadedLiquidData->liquidOffY = header->offsetY;
+    _loadedLiquidData->liquidWidth = header->width;
+    _loadedLiquidData->liquidHeight = header->height;
+    _loadedLiquidData->liquidLevel = header->liquidLevel;
+
+    if (!(header->flags & MAP_LIQUID_NO_TYPE))
     {
-        _loadedLiquidData->liquidEntry = std::make_unique<LoadedLiquidData::LiquidEntryType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidEntry.get()), sizeof(LoadedLiquidData::LiquidEntryType)))
+        _loadedLiquidData->liquidEntry = GetFileSection<uint16>(dataOffset, LoadedLiquidData::LiquidEntrySize);
+        if (!_loadedLiquidData->liquidEntry)
             return false;
 
-        _loadedLiquidData->liquidFlags = std::make_unique<LoadedLiquidData::LiquidFlagsType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidFlags.get()), sizeof(LoadedLiquidData::LiquidFlagsType)))
+        dataOffset += LoadedLiquidData::LiquidEntrySize * sizeof(uint16);
+        _loadedLiquidData->liquidFlags = GetFileSection<uint8>(dataOffset, LoadedLiquidData::LiquidFlagsSize);
+        if (!_loadedLiquidData->liquidFlags)
             return false;
+
+        dataOffset += LoadedLiquidData::LiquidFlagsSize * sizeof(uint8);
     }
-    if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
+    if (!(header->flags & MAP_LIQUID_NO_HEIGHT))
     {
-        _loadedLiquidData->liquidMap = std::make_unique<LoadedLiquidData::LiquidMapType>();
-        _loadedLiquidData->liquidMap->resize(_loadedLiquidData->liquidWidth * _loadedLiquidData->liquidHeight);
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidMap->data()), _loadedLiquidData->liquidMap->size() * sizeof(float)))
+        _loadedLiquidData->liquidMap = GetFileSection<float>(dataOffset, std::size_t(_loadedLiquidData->liquidWidth) * _loadedLiquidData->liquidHeight);
+        if (!_loadedLiquidData->liquidMap)
             return false;
     }
     return true;
 }
 
-bool GridTerrainData::LoadHolesData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadHolesData(uint32 const offset)
 {
-    fileStream.seekg(offset);
-
     _loadedHoleData = std::make_unique<LoadedHoleData>();
-    if (!fileStream.read(reinterpret_cast<char*>(&_loadedHoleData->holes), sizeof(_loadedHoleData->holes)))
+    _loadedHoleData->holes = GetFileSection<uint16>(offset, LoadedHoleData::HolesSize);
+    if (!_loadedHoleData->holes)
         return false;
 
     return true;
@@ -223,7 +280,7 @@ uint16 GridTerrainData::getArea(float x, float y) const
     y = 16 * (32 - y / SIZE_OF_GRIDS);
     int lx = (int)x & 15;
     int ly = (int)y & 15;
-    return _loadedAreaData->areaMap->at(lx * 16 + ly);
+    return _loadedAreaData->areaMap[lx * 16 + ly];
 }
 
 float GridTerrainData::getHeightFromFlat(float /*x*/, float /*y*/) const
@@ -338,7 +395,7 @@ float GridTerrainData::getHeightFromUint8(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint8* V9_h1_ptr = &_loadedHeightData->uint8HeightData->v9[x_int * 128 + x_int + y_int];
+    uint8 const* V9_h1_ptr = &_loadedHeightData->uint8HeightData->v9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -408,7 +465,7 @@ float GridTerrainData::getHeightFromUint16(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint16* V9_h1_ptr = &_loadedHeightData->uint16HeightData->v9[x_int * 128 + x_int + y_int];
+    uint16 const* V9_h1_ptr = &_loadedHeightData->uint16HeightData->v9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -523,11 +580,11 @@ float GridTerrainData::getLiquidLevel(float x, float y) const
     if (cy_int < 0 || cy_int >= _loadedLiquidData->liquidWidth)
         return INVALID_HEIGHT;
 
-    return _loadedLiquidData->liquidMap->at(cx_int * _loadedLiquidData->liquidWidth + cy_int);
+    return _loadedLiquidData->liquidMap[cx_int * _loadedLiquidData->liquidWidth + cy_int];
 }
 
 // Get water state on map
-LiquidData const GridTerrainData::GetLiquidData(float x, float y, float z, float collisionHeight, Optional<uint8> ReqLiquidType) const
+LiquidData const GridTerrainData::GetLiquidData(float x, float y, float z, float collisionHeight, std::optional<uint8> ReqLiquidType) const
 {
     LiquidData liquidData;
     liquidData.Status = LIQUID_MAP_NO_WATER;
@@ -547,8 +604,8 @@ LiquidData const GridTerrainData::GetLiquidData(float x, float y, float z, float
 
         // Check water type in cell
         int idx = (x_int >> 3) * 16 + (y_int >> 3);
-        uint8 type = _loadedLiquidData->liquidFlags ? _loadedLiquidData->liquidFlags->at(idx) : _loadedLiquidData->liquidGlobalFlags;
-        uint32 entry = _loadedLiquidData->liquidEntry ? _loadedLiquidData->liquidEntry->at(idx) : _loadedLiquidData->liquidGlobalEntry;
+        uint8 type = _loadedLiquidData->liquidFlags ? _loadedLiquidData->liquidFlags[idx] : _loadedLiquidData->liquidGlobalFlags;
+        uint32 entry = _loadedLiquidData->liquidEntry ? _loadedLiquidData->liquidEntry[idx] : _loadedLiquidData->liquidGlobalEntry;
         if (LiquidTypeEntry const* liquidEntry = sLiquidTypeStore.LookupEntry(entry))
         {
             type &= MAP_LIQUID_TYPE_DARK_WATER;
@@ -586,7 +643,7 @@ LiquidData const GridTerrainData::GetLiquidData(float x, float y, float z, float
             if (lx_int >= 0 && lx_int < _loadedLiquidData->liquidHeight && ly_int >= 0 && ly_int < _loadedLiquidData->liquidWidth)
             {
                 // Get water level
-                float liquid_level = _loadedLiquidData->liquidMap ? _loadedLiquidData->liquidMap->at(lx_int * _loadedLiquidData->liquidWidth + ly_int) : _loadedLiquidData->liquidLevel;
+                float liquid_level = _loadedLiquidData->liquidMap ? _loadedLiquidData->liquidMap[lx_int * _loadedLiquidData->liquidWidth + ly_int] : _loadedLiquidData->liquidLevel;
                 // Get ground level
                 float ground_level = getHeight(x, y);
 
@@ -19,9 +19,13 @@
 #define GRID_TERRAIN_DATA_H
 
 #include "Common.h"
+#include "MappedFile.h"
+#include <array>
 #include <fstream>
 #include <G3D/Plane.h>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #define MAX_HEIGHT            100000.0f                     // can be use for find ground height at surface
 #define INVALID_HEIGHT       -100000.0f                     // for check, must be equal to VMAP_INVALID_HEIGHT, real value for unknown height is VMAP_INVALID_HEIGHT_VALUE
@@ -113,45 +117,42 @@ struct map_liquidHeader
 // Loaded map data structures
 // ******************************************
 
+// The array pointers point into the map file contents held by GridTerrainData,
+// either a memory mapping of the file or a single heap copy of it
+
 struct LoadedAreaData
 {
-    typedef std::array<uint16, 16 * 16> AreaMapType;
+    static constexpr std::size_t AreaMapSize = 16 * 16;
 
     uint16 gridArea;
-    std::unique_ptr<AreaMapType> areaMap;
+    uint16 const* areaMap = nullptr;
 };
 
 struct LoadedHeightData
 {
     typedef std::array<G3D::Plane, 8> HeightPlanesType;
 
+    static constexpr std::size_t V9Size = 129 * 129;
+    static constexpr std::size_t V8Size = 128 * 128;
+
     struct Uint16HeightData
     {
-        typedef std::array<uint16, 129 * 129> V9Type;
-        typedef std::array<uint16, 128 * 128> V8Type;
-
-        V9Type v9;
-        V8Type v8;
+        uint16 const* v9;
+        uint16 const* v8;
         float gridIntHeightMultiplier;
     };
 
     struct Uint8HeightData
     {
-        typedef std::array<uint8, 129 * 129> V9Type;
-        typedef std::array<uint8, 128 * 128> V8Type;
-
-        V9Type v9;
-        V8Type v8;
+        uint8 const* v9;
+        uint8 const* v8;
         float gridIntHeightMultiplier;
     };
 
     struct FloatHeightData
     {
-        typedef std::array<float, 129 * 129> V9Type;
-        typedef std::array<float, 128 * 128> V8Type;
-
-        V9Type v9;
-        V8Type v8;
+        float const* v9;
+        float const* v8;
     };
 
     float gridHeight;
@@ -163,9 +164,8 @@ struct LoadedHeightData
 
 struct LoadedLiquidData
 {
-    typedef std::array<uint16, 16 * 16> LiquidEntryType;
-    typedef std::array<uint8, 16 * 16> LiquidFlagsType;
-    typedef std::vector<float> LiquidMapType;
+    static constexpr std::size_t LiquidEntrySize = 16 * 16;
+    static constexpr std::size_t LiquidFlagsSize = 16 * 16;
 
     uint16 liquidGlobalEntry;
     uint8 liquidGlobalFlags;
@@ -174,16 +174,16 @@ struct LoadedLiquidData
     uint8 liquidWidth;
     uint8 liquidHeight;
     float liquidLevel;
-    std::unique_ptr<LiquidEntryType> liquidEntry;
-    std::unique_ptr<LiquidFlagsType> liquidFlags;
-    std::unique_ptr<LiquidMapType> liquidMap;
+    uint16 const* liquidEntry = nullptr;
+    uint8 const* liquidFlags = nullptr;
+    float const* liquidMap = nullptr;
 };
 
 struct LoadedHoleData
 {
-    typedef std::array<uint16, 16 * 16> HolesType;
+    static constexpr std::size_t HolesSize = 16 * 16;
 
-    HolesType holes;
+    uint16 const* holes;
 };
 
 enum LiquidStatus : uint32
@@ -220,10 +220,22 @@ enum class TerrainMapDataReadResult
 
 class GridTerrainData
 {
-    bool LoadAreaData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadHeightData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadLiquidData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadHolesData(std::ifstream& fileStream, uint32 const offset);
+    bool LoadAreaData(uint32 const offset);
+    bool LoadHeightData(uint32 const offset);
+    bool LoadLiquidData(uint32 const offset);
+    bool LoadHolesData(uint32 const offset);
+
+    // Returns count elements of T at offset in the map file, nullptr if the file is too short.
+    // Sections the file layout leaves misaligned for T are copied into _alignedSections.
+    template<typename T>
+    T const* GetFileSection(std::size_t offset, std::size_t count);
+
+    // The whole map file: a read only memory mapping (MapTerrain.MemoryMapped) or a single heap copy
+    std::unique_ptr<MappedFile> _mappedFile;
+    std::unique_ptr<uint8[]> _fileCopy;
+    uint8 const* _fileData;
+    std::size_t _fileSize;
+    std::vector<std::unique_ptr<uint32[]>> _alignedSections;
 
     std::unique_ptr<LoadedAreaData> _loadedAreaData;
     std::unique_ptr<LoadedHeightData> _loadedHeightData;
@@ -243,13 +255,13 @@ class GridTerrainData
 public:
     GridTerrainData();
     ~GridTerrainData() { };
-    TerrainMapDataReadResult Load(std::string const& mapFileName);
+    TerrainMapDataReadResult Load(std::string const& mapFileName, bool memoryMapped = false);
 
     uint16 getArea(float x, float y) const;
     inline float getHeight(float x, float y) const { return (this->*_gridGetHeight)(x, y); }
     float getMinHeight(float x, float y) const;
     float getLiquidLevel(float x, float y) const;
-    LiquidData const GetLiquidData(float x, float y, float z, float collisionHeight, Optional<uint8> ReqLiquidType) const;
+    LiquidData const GetLiquidData(float x, float y, float z, float collisionHeight, std::optional<uint8> ReqLiquidType) const;
 };
 
 #endif
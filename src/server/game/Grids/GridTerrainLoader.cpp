@@ -1,4 +1,5 @@
 #include "GridTerrainLoader.h"
+#include "GridTerrainPrefetcher.h"
 #include "IVMapMgr.h"
 #include "Map.h"
 #include "MMapMgr.h"
@@ -32,8 +33,19 @@ void GridTerrainLoader::LoadMap()
 
     // loading data
     LOG_DEBUG("maps", "Loading map {}", mapFileName);
-    std::unique_ptr<GridTerrainData> terrainData = std::make_unique<GridTerrainData>();
-    TerrainMapDataReadResult loadResult = terrainData->Load(mapFileName);
+    std::shared_ptr<GridTerrainData> terrainData;
+    TerrainMapDataReadResult loadResult;
+    if (_prefetched)
+    {
+        terrainData = std::move(_prefetched->TerrainData);
+        loadResult = _prefetched->TerrainResult;
+    }
+    else
+    {
+        terrainData = std::make_shared<GridTerrainData>();
+        loadResult = terrainData->Load(mapFileName, sWorld->getBoolConfig(CONFIG_MAP_TERRAIN_MEMORY_MAPPED));
+    }
+
     if (loadResult == TerrainMapDataReadResult::Success)
         _grid.SetTerrainData(std::move(terrainData));
     else
@@ -71,7 +83,8 @@ void GridTerrainLoader::LoadVMap()
 
 void GridTerrainLoader::LoadMMap()
 {
-    int const mmapLoadResult = _map->GetMapCollisionData().LoadMMapTile(_grid.GetX(), _grid.GetY());
+    MMAP::MMapTileData* prefetchedTile = _prefetched && _prefetched->LoadMMap ? &_prefetched->NavMeshTile : nullptr;
+    int const mmapLoadResult = _map->GetMapCollisionData().LoadMMapTile(_grid.GetX(), _grid.GetY(), prefetchedTile);
     switch (mmapLoadResult)
     {
     case MMAP::MMAP_LOAD_RESULT_OK:
@@ -21,12 +21,14 @@
 #include "GridDefines.h"
 
 class Map;
+struct GridTerrainPrefetchRequest;
 
 class GridTerrainLoader
 {
 public:
-    GridTerrainLoader(MapGridType& grid, Map* map)
-        : _grid(grid), _map(map) { }
+    // prefetched, if given, is a finished prefetch request whose file contents are used instead of reading from disk
+    GridTerrainLoader(MapGridType& grid, Map* map, GridTerrainPrefetchRequest* prefetched = nullptr)
+        : _grid(grid), _map(map), _prefetched(prefetched) { }
 
     void LoadTerrain();
 
@@ -40,6 +42,7 @@ private:
 
     MapGridType& _grid;
     Map* _map;
+    GridTerrainPrefetchRequest* _prefetched;
 };
 
 #endif
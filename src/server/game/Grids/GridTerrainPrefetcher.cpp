@@ -0,0 +1,126 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridTerrainPrefetcher.h"
+#include "GameTime.h"
+#include "Log.h"
+#include "MapTree.h"
+#include "StringFormat.h"
+#include "World.h"
+
+void GridTerrainPrefetcher::Activate(std::size_t numThreads)
+{
+    _cancelationToken = false;
+
+    _workerThreads.reserve(numThreads);
+    for (std::size_t i = 0; i < numThreads; ++i)
+        _workerThreads.push_back(std::thread(&GridTerrainPrefetcher::WorkerThread, this));
+}
+
+void GridTerrainPrefetcher::Deactivate()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _cancelationToken = true;
+    }
+    _workCondition.notify_all();
+
+    for (std::thread& thread : _workerThreads)
+        if (thread.joinable())
+            thread.join();
+
+    _workerThreads.clear();
+
+    // requests nobody picked up are still owned by their MapGridManager, the map thread will claim and load them itself
+    std::lock_guard<std::mutex> guard(_lock);
+    _queue.clear();
+}
+
+std::shared_ptr<GridTerrainPrefetchRequest> GridTerrainPrefetcher::Schedule(uint32 mapId, uint16 gridX, uint16 gridY, bool loadVMap, bool loadMMap)
+{
+    std::shared_ptr<GridTerrainPrefetchRequest> request = std::make_shared<GridTerrainPrefetchRequest>(mapId, gridX, gridY, loadVMap, loadMMap, GameTime::GetGameTimeMS().count());
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _queue.push_back(request);
+    }
+    _workCondition.notify_one();
+
+    return request;
+}
+
+bool GridTerrainPrefetcher::Claim(GridTerrainPrefetchRequest& request)
+{
+    GridTerrainPrefetchState expected = GridTerrainPrefetchState::Queued;
+    if (request.State.compare_exchange_strong(expected, GridTerrainPrefetchState::Claimed, std::memory_order_acq_rel))
+        return false;
+
+    if (expected == GridTerrainPrefetchState::Loading)
+    {
+        std::unique_lock<std::mutex> guard(_lock);
+        _finishedCondition.wait(guard, [&request] { return request.State.load(std::memory_order_acquire) == GridTerrainPrefetchState::Done; });
+    }
+
+    return true;
+}
+
+void GridTerrainPrefetcher::WorkerThread()
+{
+    while (true)
+    {
+        std::shared_ptr<GridTerrainPrefetchRequest> request;
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            _workCondition.wait(guard, [this] { return !_queue.empty() || _cancelationToken; });
+            if (_cancelationToken)
+                return;
+
+            request = std::move(_queue.front());
+            _queue.pop_front();
+        }
+
+        GridTerrainPrefetchState expected = GridTerrainPrefetchState::Queued;
+        if (!request->State.compare_exchange_strong(expected, GridTerrainPrefetchState::Loading, std::memory_order_acq_rel))
+            continue;
+
+        Load(*request);
+
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            request->State.store(GridTerrainPrefetchState::Done, std::memory_order_release);
+        }
+        _finishedCondition.notify_all();
+    }
+}
+
+void GridTerrainPrefetcher::Load(GridTerrainPrefetchRequest& request)
+{
+    std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", sWorld->GetDataPath(), request.MapId, request.GridX, request.GridY);
+    std::shared_ptr<GridTerrainData> terrainData = std::make_shared<GridTerrainData>();
+    request.TerrainResult = terrainData->Load(mapFileName, sWorld->getBoolConfig(CONFIG_MAP_TERRAIN_MEMORY_MAPPED));
+    if (request.TerrainResult == TerrainMapDataReadResult::Success)
+        request.TerrainData = std::move(terrainData);
+
+    // vmap tiles are linked into the shared static tree on the map thread, here only the models they reference are read
+    if (request.LoadVMap)
+        VMAP::StaticMapTree::PreloadTileModels(sWorld->GetDataPath() + "vmaps/", request.MapId, request.GridX, request.GridY);
+
+    if (request.LoadMMap)
+        MMAP::MMapMgr::ReadTile(request.MapId, request.GridX, request.GridY, request.NavMeshTile);
+
+    LOG_DEBUG("maps", "Prefetched terrain of map {} grid [{}, {}]", request.MapId, request.GridX, request.GridY);
+}
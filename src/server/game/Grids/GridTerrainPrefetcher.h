@@ -0,0 +1,92 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_GRID_TERRAIN_PREFETCHER_H
+#define ACORE_GRID_TERRAIN_PREFETCHER_H
+
+#include "Define.h"
+#include "GridTerrainData.h"
+#include "MMapMgr.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+enum class GridTerrainPrefetchState : uint8
+{
+    Queued,
+    Loading,
+    Done,
+    Claimed     // taken back by the map thread before a worker picked it up
+};
+
+// Terrain of one base map grid, read from disk ahead of the grid being created.
+// Only the file reads happen on the prefetch threads, linking vmap tiles and adding
+// nav mesh tiles is left to the map thread in GridTerrainLoader.
+struct GridTerrainPrefetchRequest
+{
+    GridTerrainPrefetchRequest(uint32 mapId, uint16 gridX, uint16 gridY, bool loadVMap, bool loadMMap, uint32 requestTime)
+        : MapId(mapId), GridX(gridX), GridY(gridY), LoadVMap(loadVMap), LoadMMap(loadMMap), RequestTime(requestTime) { }
+
+    uint32 MapId;
+    uint16 GridX;
+    uint16 GridY;
+    bool LoadVMap;
+    bool LoadMMap;
+    uint32 RequestTime;
+
+    std::atomic<GridTerrainPrefetchState> State{GridTerrainPrefetchState::Queued};
+
+    // valid once State is Done
+    std::shared_ptr<GridTerrainData> TerrainData;
+    TerrainMapDataReadResult TerrainResult = TerrainMapDataReadResult::NotFound;
+    MMAP::MMapTileData NavMeshTile;
+};
+
+class GridTerrainPrefetcher
+{
+public:
+    GridTerrainPrefetcher() : _cancelationToken(false) { }
+    ~GridTerrainPrefetcher() = default;
+
+    void Activate(std::size_t numThreads);
+    void Deactivate();
+    bool IsActive() const { return !_workerThreads.empty(); }
+
+    std::shared_ptr<GridTerrainPrefetchRequest> Schedule(uint32 mapId, uint16 gridX, uint16 gridY, bool loadVMap, bool loadMMap);
+
+    // Hands the request over to the calling map thread. Returns false if no worker had started on it yet,
+    // the caller then loads the grid itself instead of waiting behind the queue. Otherwise waits for
+    // a read in progress to finish and returns true with the results filled in.
+    bool Claim(GridTerrainPrefetchRequest& request);
+
+private:
+    void WorkerThread();
+    static void Load(GridTerrainPrefetchRequest& request);
+
+    std::deque<std::shared_ptr<GridTerrainPrefetchRequest>> _queue;
+    std::vector<std::thread> _workerThreads;
+    std::mutex _lock;
+    std::condition_variable _workCondition;
+    std::condition_variable _finishedCondition;
+    bool _cancelationToken;
+};
+
+#endif
@@ -1,6 +1,9 @@
 #include "MapGridManager.h"
+#include "GameTime.h"
 #include "GridObjectLoader.h"
 #include "GridTerrainLoader.h"
+#include "MapMgr.h"
+#include "Metric.h"
 
 void MapGridManager::CreateGrid(uint16 const x, uint16 const y)
 {
@@ -20,8 +23,23 @@ void MapGridManager::CreateGrid(uint16 const x, uint16 const y)
     std::unique_ptr<MapGridType> grid = std::make_unique<MapGridType>(x, y);
     grid->link(_map);
 
+    // Use the terrain read ahead by the prefetch threads if there is any. A request still waiting
+    // in the queue is taken back and read here, one already being read is waited for.
+    std::shared_ptr<GridTerrainPrefetchRequest> prefetched;
+    auto prefetchItr = _terrainPrefetches.find(x * MAX_NUMBER_OF_GRIDS + y);
+    if (prefetchItr != _terrainPrefetches.end())
+    {
+        if (sMapMgr->GetTerrainPrefetcher()->Claim(*prefetchItr->second))
+            prefetched = prefetchItr->second;
+
+        _terrainPrefetches.erase(prefetchItr);
+    }
+
+    METRIC_VALUE("map_grid_terrain_prefetched", uint64(prefetched ? 1 : 0),
+        METRIC_TAG("map_id", std::to_string(_map->GetId())));
+
     // Terrain is loading during create (should/can we move this to LoadGrid?)
-    GridTerrainLoader loader(*grid, _map);
+    GridTerrainLoader loader(*grid, _map, prefetched.get());
     loader.LoadTerrain();
 
     _mapGrid[x][y] = std::move(grid);
@@ -69,6 +87,54 @@ void MapGridManager::UnloadGrid(uint16 const x, uint16 const y)
     _mapGrid[x][y] = nullptr;
 }
 
+void MapGridManager::PrefetchGridTerrain(uint16 const x, uint16 const y)
+{
+    // instances share the terrain of their parent map
+    if (_map->GetInstanceId() != 0 || !IsValidGridCoordinates(x, y))
+        return;
+
+    GridTerrainPrefetcher* prefetcher = sMapMgr->GetTerrainPrefetcher();
+    if (!prefetcher->IsActive())
+        return;
+
+    std::lock_guard<std::mutex> guard(_gridLock);
+    if (IsGridCreated(x, y))
+        return;
+
+    std::shared_ptr<GridTerrainPrefetchRequest>& request = _terrainPrefetches[x * MAX_NUMBER_OF_GRIDS + y];
+    if (request)
+        return;
+
+    MapCollisionData const& collisionData = _map->GetMapCollisionData();
+    request = prefetcher->Schedule(_map->GetId(), x, y, collisionData.CanLoadVMapTiles(), collisionData.CanLoadMMapTiles());
+}
+
+void MapGridManager::RemoveExpiredTerrainPrefetches(uint32 const maxAge)
+{
+    uint32 const now = GameTime::GetGameTimeMS().count();
+
+    std::lock_guard<std::mutex> guard(_gridLock);
+    for (auto itr = _terrainPrefetches.begin(); itr != _terrainPrefetches.end();)
+    {
+        GridTerrainPrefetchRequest& request = *itr->second;
+        if (getMSTimeDiff(request.RequestTime, now) < maxAge)
+        {
+            ++itr;
+            continue;
+        }
+
+        // a read in progress is left to finish, a queued one is withdrawn
+        GridTerrainPrefetchState state = GridTerrainPrefetchState::Queued;
+        if (!request.State.compare_exchange_strong(state, GridTerrainPrefetchState::Claimed) && state == GridTerrainPrefetchState::Loading)
+        {
+            ++itr;
+            continue;
+        }
+
+        itr = _terrainPrefetches.erase(itr);
+    }
+}
+
 bool MapGridManager::IsGridCreated(uint16 const x, uint16 const y) const
 {
     if (!MapGridManager::IsValidGridCoordinates(x, y))
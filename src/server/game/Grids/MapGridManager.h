@@ -24,8 +24,10 @@
 #include "MapGrid.h"
 
 #include <mutex>
+#include <unordered_map>
 
 class Map;
+struct GridTerrainPrefetchRequest;
 
 class MapGridManager
 {
@@ -39,6 +41,11 @@ public:
     bool IsGridLoaded(uint16 const x, uint16 const y) const;
     MapGridType* GetGrid(uint16 const x, uint16 const y);
 
+    // Queues the terrain of a not yet created grid to be read on the terrain prefetch threads, CreateGrid picks it up
+    void PrefetchGridTerrain(uint16 const x, uint16 const y);
+    // Drops prefetched terrain nobody created a grid for within maxAge milliseconds
+    void RemoveExpiredTerrainPrefetches(uint32 const maxAge);
+
     static bool IsValidGridCoordinates(uint16 const x, uint16 const y) { return (x < MAX_NUMBER_OF_GRIDS && y < MAX_NUMBER_OF_GRIDS); }
 
     uint32 GetCreatedGridsCount();
@@ -57,6 +64,9 @@ private:
 
     std::mutex _gridLock;
     std::unique_ptr<MapGridType> _mapGrid[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+
+    // pending and finished terrain prefetches by grid id (x * MAX_NUMBER_OF_GRIDS + y), guarded by _gridLock
+    std::unordered_map<uint32, std::shared_ptr<GridTerrainPrefetchRequest>> _terrainPrefetches;
 };
 
 #endif
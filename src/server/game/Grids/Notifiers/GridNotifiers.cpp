@@ -154,14 +154,62 @@ void PlayerRelocationNotifier::Visit(PlayerMapType& m)
     }
 }
 
+bool PlayerRelocationDeltaNotifier::MayChangeVisibilityOf(WorldObject const* target) const
+{
+    // stealth detection depends on the distance, vehicle accessories on the visibility of their base
+    if (i_cellEntered || target->m_stealth.GetFlags())
+        return true;
+
+    // units may have moved since their last notify as well, players see them where they were then
+    if (Unit const* unit = target->ToUnit())
+    {
+        if (unit->GetVehicleBase())
+            return true;
+
+        return CrossesSightRange(i_lastPosition, GetLastNotifyPosition(unit), i_player.GetSightPosition(), *unit, i_player.GetSightRange(target) + unit->GetObjectSize());
+    }
+
+    return CrossesSightRange(target, i_lastPosition, i_player.GetSightPosition(), i_player.GetSightRange(target));
+}
+
+void PlayerRelocationDeltaNotifier::Visit(PlayerMapType& m)
+{
+    bool stealthed = i_player.m_stealth.GetFlags() != 0;
+
+    for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        Player* player = iter->GetSource();
+        if (MayChangeVisibilityOf(player))
+            i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
+
+        // whether they see us only changes if the distance between us crossed their sight range, see PlayerRelocationNotifier
+        if (stealthed || player->GetFarSightDistance() || !player->IsAlive() || !player->HasVisibilityUpdatePosition()
+            || CrossesSightRange(player->GetVisibilityUpdatePosition(), i_lastPosition, player->GetSightPosition(), i_player, player->GetSightRange(&i_player) + i_player.GetObjectSize()))
+            player->UpdateVisibilityOf(&i_player);
+    }
+}
+
+bool CreatureRelocationNotifier::MayChangeVisibilityFor(Player const* player) const
+{
+    if (!i_lastPosition || i_creature.m_stealth.GetFlags() || i_creature.GetVehicleBase())
+        return true;
+
+    if (player->GetFarSightDistance() || !player->IsAlive() || !player->HasVisibilityUpdatePosition())
+        return true;
+
+    // the player may have moved since its last visibility update as well
+    return CrossesSightRange(player->GetVisibilityUpdatePosition(), *i_lastPosition, player->GetSightPosition(), i_creature, player->GetSightRange(&i_creature) + i_creature.GetObjectSize());
+}
+
 void CreatureRelocationNotifier::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
         Player* player = iter->GetSource();
 
-        // NOTIFY_VISIBILITY_CHANGED does not guarantee that player will do it himself (because distance is also checked), but screw it, it's not that important
-        if (!player->m_seer->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
+        // not skipped when the player has a visibility update pending, an incremental update of the player
+        // only looks at objects its own move brought across the sight range and would miss this creature
+        if (MayChangeVisibilityFor(player))
             player->UpdateVisibilityOf(&i_creature);
 
         // NOTIFY_AI_RELOCATION does not guarantee that player will do it himself (because distance is also checked), but screw it, it's not that important
@@ -221,29 +269,8 @@ void MessageDistDeliverer::Visit(PlayerMapType& m)
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
         Player* target = iter->GetSource();
-        if (!target->InSamePhase(i_phaseMask))
-            continue;
-
-        if (required3dDist)
-        {
-            if (target->GetExactDistSq(i_source) > i_distSq)
-                continue;
-        }
-        else
-            if (target->GetExactDist2dSq(i_source) > i_distSq)
-                continue;
-
-        // Send packet to all who are sharing the player's vision
-        if (target->HasSharedVision())
-        {
-            SharedVisionList::const_iterator i = target->GetSharedVisionList().begin();
-            for (; i != target->GetSharedVisionList().end(); ++i)
-                if ((*i)->m_seer == target)
-                    SendPacket(*i);
-        }
-
-        if (target->m_seer == target || target->GetVehicle())
-            SendPacket(target);
+        if (target->InSamePhase(i_phaseMask))
+            VisitObject(target);
     }
 }
 
@@ -252,52 +279,88 @@ void MessageDistDeliverer::Visit(CreatureMapType& m)
     for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
         Creature* target = iter->GetSource();
-        if (!target->HasSharedVision() || !target->InSamePhase(i_phaseMask))
-            continue;
+        if (target->InSamePhase(i_phaseMask))
+            VisitObject(target);
+    }
+}
 
-        if (required3dDist)
-        {
-            if (target->GetExactDistSq(i_source) > i_distSq)
-                continue;
-        }
-        else
-            if (target->GetExactDist2dSq(i_source) > i_distSq)
-                continue;
+void MessageDistDeliverer::Visit(DynamicObjectMapType& m)
+{
+    for (DynamicObjectMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        DynamicObject* target = iter->GetSource();
+        if (target->InSamePhase(i_phaseMask))
+            VisitObject(target);
+    }
+}
 
-        // Send packet to all who are sharing the creature's vision
+void MessageDistDeliverer::VisitObject(Player* target)
+{
+    if (required3dDist)
+    {
+        if (target->GetExactDistSq(i_source) > i_distSq)
+            return;
+    }
+    else
+        if (target->GetExactDist2dSq(i_source) > i_distSq)
+            return;
+
+    // Send packet to all who are sharing the player's vision
+    if (target->HasSharedVision())
+    {
         SharedVisionList::const_iterator i = target->GetSharedVisionList().begin();
         for (; i != target->GetSharedVisionList().end(); ++i)
             if ((*i)->m_seer == target)
                 SendPacket(*i);
     }
+
+    if (target->m_seer == target || target->GetVehicle())
+        SendPacket(target);
 }
 
-void MessageDistDeliverer::Visit(DynamicObjectMapType& m)
+void MessageDistDeliverer::VisitObject(Creature* target)
 {
-    for (DynamicObjectMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    if (!target->HasSharedVision())
+        return;
+
+    if (required3dDist)
     {
-        DynamicObject* target = iter->GetSource();
-        if (!target->GetCasterGUID().IsPlayer() || !target->InSamePhase(i_phaseMask))
-            continue;
+        if (target->GetExactDistSq(i_source) > i_distSq)
+            return;
+    }
+    else
+        if (target->GetExactDist2dSq(i_source) > i_distSq)
+            return;
 
-        // Xinef: Check whether the dynobject allows to see through it
-        if (!target->IsViewpoint())
-            continue;
+    // Send packet to all who are sharing the creature's vision
+    SharedVisionList::const_iterator i = target->GetSharedVisionList().begin();
+    for (; i != target->GetSharedVisionList().end(); ++i)
+        if ((*i)->m_seer == target)
+            SendPacket(*i);
+}
 
-        if (required3dDist)
-        {
-            if (target->GetExactDistSq(i_source) > i_distSq)
-                continue;
-        }
-        else
-            if (target->GetExactDist2dSq(i_source) > i_distSq)
-                continue;
+void MessageDistDeliverer::VisitObject(DynamicObject* target)
+{
+    if (!target->GetCasterGUID().IsPlayer())
+        return;
 
-        // Send packet back to the caster if the caster has vision of dynamic object
-        Player* caster = (Player*)target->GetCaster();
-        if (caster && caster->m_seer == target)
-            SendPacket(caster);
+    // Xinef: Check whether the dynobject allows to see through it
+    if (!target->IsViewpoint())
+        return;
+
+    if (required3dDist)
+    {
+        if (target->GetExactDistSq(i_source) > i_distSq)
+            return;
     }
+    else
+        if (target->GetExactDist2dSq(i_source) > i_distSq)
+            return;
+
+    // Send packet back to the caster if the caster has vision of dynamic object
+    Player* caster = (Player*)target->GetCaster();
+    if (caster && caster->m_seer == target)
+        SendPacket(caster);
 }
 
 void MessageDistDelivererToHostile::Visit(PlayerMapType& m)
@@ -79,12 +79,63 @@ namespace Acore
         void Visit(PlayerMapType&);
     };
 
+    // Whether the distance between a sight position and a unit crosses maxDist from where both were at their last
+    // notify to where they are now, as tested by WorldObject::IsWithinSightRange. Only valid for units, they do not
+    // override that test. Both ends may have moved, the one not notified now still stands at its last notify
+    inline bool CrossesSightRange(Position const& lastSightPosition, Position const& lastPosition, Position const& sightPosition, Position const& position, float maxDist)
+    {
+        return lastSightPosition.IsInDist2d(&lastPosition, maxDist) != sightPosition.IsInDist2d(&position, maxDist);
+    }
+
+    // Position of the unit at its last relocation notify. Units added to the map or respawned since carry a far away
+    // placeholder instead, their own next notify updates every player in range and until then they stand where they are
+    inline Position const& GetLastNotifyPosition(Unit const* unit)
+    {
+        if (unit->m_last_notify_position.GetPositionX() == -5000.0f)
+            return *unit;
+
+        return unit->m_last_notify_position;
+    }
+
+    // Whether moving a sight position between two positions takes target across the edge of the sight range.
+    // Uses the target's own IsWithinSightRange, game objects test against their model bounds
+    inline bool CrossesSightRange(WorldObject const* target, Position const& from, Position const& to, float sightRange)
+    {
+        return target->IsWithinSightRange(from, sightRange) != target->IsWithinSightRange(to, sightRange);
+    }
+
+    // PlayerRelocationNotifier for a move away from the player's last visibility update position.
+    // Everything in cells the sight range did not reach before is updated, elsewhere only objects
+    // the move brings across the edge of the sight range. See Cell::VisitObjectsDelta
+    struct PlayerRelocationDeltaNotifier : public PlayerRelocationNotifier
+    {
+        Position const i_lastPosition;
+        bool i_cellEntered;
+
+        PlayerRelocationDeltaNotifier(Player& player, Position const& lastPosition) :
+            PlayerRelocationNotifier(player), i_lastPosition(lastPosition), i_cellEntered(true) { }
+
+        void SetCellEntered(bool entered) { i_cellEntered = entered; }
+
+        template<class T> void Visit(std::vector<T>& m) { VisibleNotifier::Visit(m); }
+        template<class T> void Visit(GridRefMgr<T>& m);
+        void Visit(PlayerMapType&);
+
+    private:
+        [[nodiscard]] bool MayChangeVisibilityOf(WorldObject const* target) const;
+    };
+
     struct CreatureRelocationNotifier
     {
         Creature& i_creature;
-        CreatureRelocationNotifier(Creature& c) : i_creature(c) {}
+        Position const* i_lastPosition;     // set for incremental updates, players only see a difference when we cross their sight range
+
+        CreatureRelocationNotifier(Creature& c, Position const* lastPosition = nullptr) : i_creature(c), i_lastPosition(lastPosition) {}
         template<class T> void Visit(GridRefMgr<T>&) {}
         void Visit(PlayerMapType&);
+
+    private:
+        [[nodiscard]] bool MayChangeVisibilityFor(Player const* player) const;
     };
 
     struct AIRelocationNotifier
@@ -105,7 +156,102 @@ namespace Acore
         OtherTeam,
     };
 
-    struct MessageDistDeliverer
+    // Base of the searchers visiting grid cells through their GridCellObjectIndex: phase, type and
+    // range are tested over the packed index and only matching objects are handed to VisitObject
+    template<class SEARCHER, uint32 TYPE_MASK>
+    struct GridIndexSearcher
+    {
+        static constexpr uint32 GRID_INDEX_TYPE_MASK = TYPE_MASK;
+
+        GridCellObjectIndexFilter i_indexFilter;
+        float i_searcherSize;
+        bool i_exactRange;
+
+        GridIndexSearcher(WorldObject const* searcher, bool checkPhase, uint32 typeMask = TYPE_MASK)
+            : i_searcherSize(searcher->GetObjectSize()), i_exactRange(false)
+        {
+            i_indexFilter.TypeMask = typeMask & TYPE_MASK;
+            i_indexFilter.CheckPhase = checkPhase;
+            i_indexFilter.PhaseMask = searcher->GetPhaseMask();
+        }
+
+        // Restricts the index to an exact 2d range, searchers doing their own distance test on the same center
+        void SetExactRange(WorldObject const* center, float range, uint32 typeMask)
+        {
+            i_indexFilter.RangeTypeMask = typeMask;
+            i_indexFilter.X = center->GetPositionX();
+            i_indexFilter.Y = center->GetPositionY();
+            i_indexFilter.Range = range;
+            i_indexFilter.AddObjectSize = false;
+            i_exactRange = true;
+        }
+
+        // Set by Cell::VisitObjects, radius <= 0 clears it. Checks accept units up to their range plus the size of
+        // both objects, so units further than that from the visited area are skipped without being loaded.
+        void SetGridSearchArea(float x, float y, float radius)
+        {
+            if (i_exactRange)
+                return;
+
+            if (radius <= 0.0f || radius > SIZE_OF_GRIDS)
+            {
+                i_indexFilter.RangeTypeMask = 0;
+                return;
+            }
+
+            i_indexFilter.RangeTypeMask = GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_CREATURE;
+            i_indexFilter.X = x;
+            i_indexFilter.Y = y;
+            i_indexFilter.Range = radius + i_searcherSize;
+            i_indexFilter.AddObjectSize = true;
+        }
+
+        void Visit(GridCellObjectIndex const& index)
+        {
+            std::vector<GridCellObjectIndexCandidate>& candidates = GridCellObjectIndex::GetCandidateBuffer();
+            std::size_t const begin = candidates.size();
+            index.Select(i_indexFilter, candidates);
+
+            // by index, checks may run nested searches appending to the same buffer
+            for (std::size_t i = begin; i < candidates.size(); ++i)
+                Dispatch(candidates[i]);
+
+            candidates.resize(begin);
+        }
+
+    private:
+        void Dispatch(GridCellObjectIndexCandidate candidate)
+        {
+            SEARCHER& searcher = static_cast<SEARCHER&>(*this);
+            switch (candidate.TypeMask)
+            {
+                case GRID_MAP_TYPE_MASK_PLAYER:
+                    if constexpr ((TYPE_MASK & GRID_MAP_TYPE_MASK_PLAYER) != 0)
+                        searcher.VisitObject(static_cast<Player*>(candidate.Object));
+                    break;
+                case GRID_MAP_TYPE_MASK_CREATURE:
+                    if constexpr ((TYPE_MASK & GRID_MAP_TYPE_MASK_CREATURE) != 0)
+                        searcher.VisitObject(static_cast<Creature*>(candidate.Object));
+                    break;
+                case GRID_MAP_TYPE_MASK_GAMEOBJECT:
+                    if constexpr ((TYPE_MASK & GRID_MAP_TYPE_MASK_GAMEOBJECT) != 0)
+                        searcher.VisitObject(static_cast<GameObject*>(candidate.Object));
+                    break;
+                case GRID_MAP_TYPE_MASK_DYNAMICOBJECT:
+                    if constexpr ((TYPE_MASK & GRID_MAP_TYPE_MASK_DYNAMICOBJECT) != 0)
+                        searcher.VisitObject(static_cast<DynamicObject*>(candidate.Object));
+                    break;
+                case GRID_MAP_TYPE_MASK_CORPSE:
+                    if constexpr ((TYPE_MASK & GRID_MAP_TYPE_MASK_CORPSE) != 0)
+                        searcher.VisitObject(static_cast<Corpse*>(candidate.Object));
+                    break;
+                default:
+                    break;
+            }
+        }
+    };
+
+    struct MessageDistDeliverer : GridIndexSearcher<MessageDistDeliverer, GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_CREATURE | GRID_MAP_TYPE_MASK_DYNAMICOBJECT>
     {
         WorldObject const* i_source;
         WorldPacket const* i_message;
@@ -117,6 +263,7 @@ namespace Acore
         bool required3dDist;
 
         MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, TeamFilter teamFilter = TeamFilter::All, Player const* skipped = nullptr, bool req3dDist = false) :
+            GridIndexSearcher(src, true),
             i_source(src),
             i_message(msg),
             i_phaseMask(src->GetPhaseMask()),
@@ -125,13 +272,23 @@ namespace Acore
             teamId(src->IsPlayer() ? src->ToPlayer()->GetTeamId() : TEAM_NEUTRAL),
             skipped_receiver(skipped),
             required3dDist(req3dDist)
-        { }
+        {
+            // the 2d range also bounds required3dDist
+            if (dist > 0.0f)
+                SetExactRange(src, dist, GRID_INDEX_TYPE_MASK);
+        }
 
+        using GridIndexSearcher::Visit;
         void Visit(VisiblePlayersMap const& m);
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
         void Visit(DynamicObjectMapType& m);
 
+        // phase already tested by the caller
+        void VisitObject(Player* target);
+        void VisitObject(Creature* target);
+        void VisitObject(DynamicObject* target);
+
         template <class SKIP> void Visit(GridRefMgr<SKIP>&) { }
 
         void SendPacket(Player* player) const
@@ -258,7 +415,7 @@ namespace Acore
     };
 
     template<class Check>
-    struct WorldObjectListSearcher : ContainerInserter<WorldObject*>
+    struct WorldObjectListSearcher : ContainerInserter<WorldObject*>, GridIndexSearcher<WorldObjectListSearcher<Check>, GRID_MAP_TYPE_MASK_ALL>
     {
         uint32 i_mapTypeMask;
         uint32 i_phaseMask;
@@ -266,7 +423,7 @@ namespace Acore
 
         template<typename Container>
         WorldObjectListSearcher(WorldObject const* searcher, Container& container, Check & check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
-                : ContainerInserter<WorldObject*>(container),
+                : ContainerInserter<WorldObject*>(container), GridIndexSearcher<WorldObjectListSearcher<Check>, GRID_MAP_TYPE_MASK_ALL>(searcher, false, mapTypeMask),
                   i_mapTypeMask(mapTypeMask), i_phaseMask(searcher->GetPhaseMask()), i_check(check) { }
 
         void Visit(PlayerMapType& m);
@@ -275,6 +432,9 @@ namespace Acore
         void Visit(GameObjectMapType& m);
         void Visit(DynamicObjectMapType& m);
 
+        using GridIndexSearcher<WorldObjectListSearcher<Check>, GRID_MAP_TYPE_MASK_ALL>::Visit;
+        template<class T> void VisitObject(T* obj) { if (i_check(obj)) this->Insert(obj); }
+
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
 
@@ -408,102 +568,120 @@ namespace Acore
 
     // First accepted by Check Unit if any
     template<class Check>
-    struct UnitSearcher
+    struct UnitSearcher : GridIndexSearcher<UnitSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_CREATURE>
     {
         uint32 i_phaseMask;
         Unit*& i_object;
         Check& i_check;
 
         UnitSearcher(WorldObject const* searcher, Unit*& result, Check& check)
-            : i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check) {}
+            : GridIndexSearcher<UnitSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_CREATURE>(searcher, true), i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check) {}
 
         void Visit(CreatureMapType& m);
         void Visit(PlayerMapType& m);
 
+        using GridIndexSearcher<UnitSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_CREATURE>::Visit;
+        template<class T> void VisitObject(T* obj) { if (!i_object && i_check(obj)) i_object = obj; }
+
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
 
     // Last accepted by Check Unit if any (Check can change requirements at each call)
     template<class Check>
-    struct UnitLastSearcher
+    struct UnitLastSearcher : GridIndexSearcher<UnitLastSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_CREATURE>
     {
         uint32 i_phaseMask;
         Unit*& i_object;
         Check& i_check;
 
         UnitLastSearcher(WorldObject const* searcher, Unit*& result, Check& check)
-            : i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check) {}
+            : GridIndexSearcher<UnitLastSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_CREATURE>(searcher, true), i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check) {}
 
         void Visit(CreatureMapType& m);
         void Visit(PlayerMapType& m);
 
+        using GridIndexSearcher<UnitLastSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_CREATURE>::Visit;
+        template<class T> void VisitObject(T* obj) { if (i_check(obj)) i_object = obj; }
+
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
 
     // All accepted by Check units if any
     template<class Check>
-    struct UnitListSearcher : ContainerInserter<Unit*>
+    struct UnitListSearcher : ContainerInserter<Unit*>, GridIndexSearcher<UnitListSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_CREATURE>
     {
         uint32 i_phaseMask;
         Check& i_check;
 
         template<typename Container>
         UnitListSearcher(WorldObject const* searcher, Container& container, Check& check)
-                : ContainerInserter<Unit*>(container),
+                : ContainerInserter<Unit*>(container), GridIndexSearcher<UnitListSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_CREATURE>(searcher, true),
                   i_phaseMask(searcher->GetPhaseMask()), i_check(check) { }
 
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
 
+        using GridIndexSearcher<UnitListSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_CREATURE>::Visit;
+        template<class T> void VisitObject(T* obj) { if (i_check(obj)) this->Insert(obj); }
+
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
 
     // Creature searchers
 
     template<class Check>
-    struct CreatureSearcher
+    struct CreatureSearcher : GridIndexSearcher<CreatureSearcher<Check>, GRID_MAP_TYPE_MASK_CREATURE>
     {
         uint32 i_phaseMask;
         Creature*& i_object;
         Check& i_check;
 
         CreatureSearcher(WorldObject const* searcher, Creature*& result, Check& check)
-            : i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check) {}
+            : GridIndexSearcher<CreatureSearcher<Check>, GRID_MAP_TYPE_MASK_CREATURE>(searcher, true), i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check) {}
 
         void Visit(CreatureMapType& m);
 
+        using GridIndexSearcher<CreatureSearcher<Check>, GRID_MAP_TYPE_MASK_CREATURE>::Visit;
+        template<class T> void VisitObject(T* obj) { if (!i_object && i_check(obj)) i_object = obj; }
+
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
 
     // Last accepted by Check Creature if any (Check can change requirements at each call)
     template<class Check>
-    struct CreatureLastSearcher
+    struct CreatureLastSearcher : GridIndexSearcher<CreatureLastSearcher<Check>, GRID_MAP_TYPE_MASK_CREATURE>
     {
         uint32 i_phaseMask;
         Creature*& i_object;
         Check& i_check;
 
         CreatureLastSearcher(WorldObject const* searcher, Creature*& result, Check& check)
-            : i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check) {}
+            : GridIndexSearcher<CreatureLastSearcher<Check>, GRID_MAP_TYPE_MASK_CREATURE>(searcher, true), i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check) {}
 
         void Visit(CreatureMapType& m);
 
+        using GridIndexSearcher<CreatureLastSearcher<Check>, GRID_MAP_TYPE_MASK_CREATURE>::Visit;
+        template<class T> void VisitObject(T* obj) { if (i_check(obj)) i_object = obj; }
+
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
 
     template<class Check>
-    struct CreatureListSearcher : ContainerInserter<Creature*>
+    struct CreatureListSearcher : ContainerInserter<Creature*>, GridIndexSearcher<CreatureListSearcher<Check>, GRID_MAP_TYPE_MASK_CREATURE>
     {
         uint32 i_phaseMask;
         Check& i_check;
 
         template<typename Container>
         CreatureListSearcher(WorldObject const* searcher, Container& container, Check & check)
-                : ContainerInserter<Creature*>(container),
+                : ContainerInserter<Creature*>(container), GridIndexSearcher<CreatureListSearcher<Check>, GRID_MAP_TYPE_MASK_CREATURE>(searcher, true),
                   i_phaseMask(searcher->GetPhaseMask()), i_check(check) { }
 
         void Visit(CreatureMapType& m);
 
+        using GridIndexSearcher<CreatureListSearcher<Check>, GRID_MAP_TYPE_MASK_CREATURE>::Visit;
+        template<class T> void VisitObject(T* obj) { if (i_check(obj)) this->Insert(obj); }
+
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
 
@@ -529,33 +707,39 @@ namespace Acore
     // Player searchers
 
     template<class Check>
-    struct PlayerSearcher
+    struct PlayerSearcher : GridIndexSearcher<PlayerSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER>
     {
         uint32 i_phaseMask;
         Player*& i_object;
         Check& i_check;
 
         PlayerSearcher(WorldObject const* searcher, Player*& result, Check& check)
-            : i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check) {}
+            : GridIndexSearcher<PlayerSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER>(searcher, true), i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check) {}
 
         void Visit(PlayerMapType& m);
 
+        using GridIndexSearcher<PlayerSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER>::Visit;
+        template<class T> void VisitObject(T* obj) { if (!i_object && i_check(obj)) i_object = obj; }
+
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
 
     template<class Check>
-    struct PlayerListSearcher : ContainerInserter<Player*>
+    struct PlayerListSearcher : ContainerInserter<Player*>, GridIndexSearcher<PlayerListSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER>
     {
         uint32 i_phaseMask;
         Check& i_check;
 
         template<typename Container>
         PlayerListSearcher(WorldObject const* searcher, Container& container, Check & check)
-                : ContainerInserter<Player*>(container),
+                : ContainerInserter<Player*>(container), GridIndexSearcher<PlayerListSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER>(searcher, true),
                   i_phaseMask(searcher->GetPhaseMask()), i_check(check) { }
 
         void Visit(PlayerMapType& m);
 
+        using GridIndexSearcher<PlayerListSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER>::Visit;
+        template<class T> void VisitObject(T* obj) { if (i_check(obj)) this->Insert(obj); }
+
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
 
@@ -576,18 +760,21 @@ namespace Acore
     };
 
     template<class Check>
-    struct PlayerLastSearcher
+    struct PlayerLastSearcher : GridIndexSearcher<PlayerLastSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER>
     {
         uint32 i_phaseMask;
         Player*& i_object;
         Check& i_check;
 
-        PlayerLastSearcher(WorldObject const* searcher, Player*& result, Check& check) : i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check)
+        PlayerLastSearcher(WorldObject const* searcher, Player*& result, Check& check) : GridIndexSearcher<PlayerLastSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER>(searcher, true), i_phaseMask(searcher->GetPhaseMask()), i_object(result), i_check(check)
         {
         }
 
         void Visit(PlayerMapType& m);
 
+        using GridIndexSearcher<PlayerLastSearcher<Check>, GRID_MAP_TYPE_MASK_PLAYER>::Visit;
+        template<class T> void VisitObject(T* obj) { if (i_check(obj)) i_object = obj; }
+
         template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
     };
 
@@ -43,6 +43,14 @@ inline void Acore::VisibleNotifier::Visit(GridRefMgr<T>& m)
         i_player.UpdateVisibilityOf(iter->GetSource(), i_data, i_visibleNow);
 }
 
+template<class T>
+inline void Acore::PlayerRelocationDeltaNotifier::Visit(GridRefMgr<T>& m)
+{
+    for (typename GridRefMgr<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
+        if (MayChangeVisibilityOf(iter->GetSource()))
+            i_player.UpdateVisibilityOf(iter->GetSource(), i_data, i_visibleNow);
+}
+
 // SEARCHERS & LIST SEARCHERS & WORKERS
 
 // WorldObject searchers & workers
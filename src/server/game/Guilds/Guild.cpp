@@ -1689,7 +1689,7 @@ void Guild::HandleMemberDepositMoney(WorldSession* session, uint32 amount)
     player->SaveGoldToDB(trans);
     _LogBankEvent(trans, GUILD_BANK_LOG_DEPOSIT_MONEY, uint8(0), player->GetGUID(), amount);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, session->GetAccountId());
 
     if (session->HasPermission(rbac::RBAC_PERM_LOG_GM_TRADE))
     {
@@ -1749,7 +1749,7 @@ bool Guild::HandleMemberWithdrawMoney(WorldSession* session, uint32 amount, bool
 
     // Log guild bank event
     _LogBankEvent(trans, repair ? GUILD_BANK_LOG_REPAIR_MONEY : GUILD_BANK_LOG_WITHDRAW_MONEY, uint8(0), player->GetGUID(), amount);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, session->GetAccountId());
 
     if (session->HasPermission(rbac::RBAC_PERM_LOG_GM_TRADE))
     {
@@ -2768,7 +2768,8 @@ bool Guild::_DoItemsMove(MoveItemData* pSrc, MoveItemData* pDest, bool sendError
     if (swap)
         pSrc->StoreItem(trans, pDestItem);
 
-    CharacterDatabase.CommitTransaction(trans);
+    // both sides belong to the same player, keep the commit in order with the saves of that player
+    CharacterDatabase.CommitTransaction(trans, pSrc->GetPlayer()->GetSession()->GetAccountId());
     return true;
 }
 
@@ -620,6 +620,7 @@ private:
         Item* GetItem(bool isCloned = false) const { return isCloned ? m_pClonedItem : m_pItem; }
         uint8 GetContainer() const { return m_container; }
         uint8 GetSlotId() const { return m_slotId; }
+        Player* GetPlayer() const { return m_pPlayer; }
 
     protected:
         virtual InventoryResult CanStore(Item* pItem, bool swap) = 0;
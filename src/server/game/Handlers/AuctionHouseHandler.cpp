@@ -325,7 +325,7 @@ void WorldSession::HandleAuctionSellItem(WorldPacket& recvData)
             item->SaveToDB(trans);
             AH->SaveToDB(trans);
             _player->SaveInventoryAndGoldToDB(trans);
-            CharacterDatabase.CommitTransaction(trans);
+            CharacterDatabase.CommitTransaction(trans, GetAccountId());
 
             SendAuctionCommandResult(AH->Id, AUCTION_SELL_ITEM, ERR_AUCTION_OK);
 
@@ -399,7 +399,7 @@ void WorldSession::HandleAuctionSellItem(WorldPacket& recvData)
             newItem->SaveToDB(trans);
             AH->SaveToDB(trans);
             _player->SaveInventoryAndGoldToDB(trans);
-            CharacterDatabase.CommitTransaction(trans);
+            CharacterDatabase.CommitTransaction(trans, GetAccountId());
 
             SendAuctionCommandResult(AH->Id, AUCTION_SELL_ITEM, ERR_AUCTION_OK);
 
@@ -587,7 +587,7 @@ void WorldSession::HandleAuctionPlaceBid(WorldPacket& recvData)
         auctionHouse->RemoveAuction(auction);
     }
     player->SaveInventoryAndGoldToDB(trans);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetAccountId());
 }
 
 //this void is called when auction_owner cancels his auction
@@ -661,7 +661,7 @@ void WorldSession::HandleAuctionRemoveItem(WorldPacket& recvData)
 
     player->SaveInventoryAndGoldToDB(trans);
     auction->DeleteFromDB(trans);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetAccountId());
 
     sAuctionMgr->RemoveAItem(auction->item_guid);
     auctionHouse->RemoveAuction(auction);
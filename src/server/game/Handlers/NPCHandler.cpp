@@ -153,7 +153,7 @@ void WorldSession::HandleGossipHelloOpcode(WorldPacket& recvData)
         return;
 
     // Check GossipHello conditions - block gossip opening if conditions not met
-    ConditionList gossipConditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_GOSSIP_HELLO, unit->GetEntry());
+    ConditionProgram const* gossipConditions = sConditionMgr->GetConditionProgramForNotGroupedEntry(CONDITION_SOURCE_TYPE_GOSSIP_HELLO, unit->GetEntry());
     if (!sConditionMgr->IsObjectMeetToConditions(_player, unit, gossipConditions))
         return;
 
@@ -476,7 +476,7 @@ void WorldSession::HandleStablePet(WorldPacket& recvData)
             stmt->SetData(0, PetSaveMode(PET_SAVE_FIRST_STABLE_SLOT + freeSlot));
             stmt->SetData(1, _player->GetGUID().GetCounter());
             stmt->SetData(2, petStable->UnslottedPets[0].PetNumber);
-            CharacterDatabase.Execute(stmt);
+            CharacterDatabase.Execute(stmt, GetAccountId());
 
             // stable unsummoned pet
             petStable->StabledPets[freeSlot] = std::move(petStable->UnslottedPets.back());
@@ -562,7 +562,7 @@ void WorldSession::HandleUnstablePet(WorldPacket& recvData)
         stmt->SetData(0, PetSaveMode(PET_SAVE_FIRST_STABLE_SLOT + std::distance(petStable->StabledPets.begin(), stabledPet)));
         stmt->SetData(1, _player->GetGUID().GetCounter());
         stmt->SetData(2, petStable->UnslottedPets[0].PetNumber);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, GetAccountId());
 
         // move unsummoned pet into CurrentPet slot so that it gets moved into stable slot later
         petStable->CurrentPet = std::move(petStable->UnslottedPets.back());
@@ -587,7 +587,7 @@ void WorldSession::HandleUnstablePet(WorldPacket& recvData)
         stmt->SetData(0, PET_SAVE_NOT_IN_SLOT);
         stmt->SetData(1, _player->GetGUID().GetCounter());
         stmt->SetData(2, petnumber);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, GetAccountId());
 
         SendStableResult(STABLE_ERR_STABLE);
     }
@@ -598,7 +598,7 @@ void WorldSession::HandleUnstablePet(WorldPacket& recvData)
         stmt->SetData(0, PET_SAVE_AS_CURRENT);
         stmt->SetData(1, _player->GetGUID().GetCounter());
         stmt->SetData(2, petnumber);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, GetAccountId());
 
         SendStableResult(STABLE_SUCCESS_UNSTABLE);
     }
@@ -714,7 +714,7 @@ void WorldSession::HandleStableSwapPet(WorldPacket& recvData)
         stmt->SetData(0, PetSaveMode(PET_SAVE_FIRST_STABLE_SLOT + std::distance(petStable->StabledPets.begin(), stabledPet)));
         stmt->SetData(1, _player->GetGUID().GetCounter());
         stmt->SetData(2, petStable->UnslottedPets[0].PetNumber);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, GetAccountId());
 
         // move unsummoned pet into CurrentPet slot so that it gets moved into stable slot later
         petStable->CurrentPet = std::move(petStable->UnslottedPets.back());
@@ -741,7 +741,7 @@ void WorldSession::HandleStableSwapPet(WorldPacket& recvData)
         stmt->SetData(0, PET_SAVE_NOT_IN_SLOT);
         stmt->SetData(1, _player->GetGUID().GetCounter());
         stmt->SetData(2, petId);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, GetAccountId());
     }
     else
     {
@@ -750,7 +750,7 @@ void WorldSession::HandleStableSwapPet(WorldPacket& recvData)
         stmt->SetData(0, PET_SAVE_AS_CURRENT);
         stmt->SetData(1, _player->GetGUID().GetCounter());
         stmt->SetData(2, petId);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, GetAccountId());
 
         SendStableResult(STABLE_SUCCESS_UNSTABLE);
     }
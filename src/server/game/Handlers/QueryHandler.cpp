@@ -25,6 +25,7 @@
 #include "Pet.h"
 #include "Player.h"
 #include "QueryPackets.h"
+#include "QueryResponseCache.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -95,62 +96,11 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recvData)
     CreatureTemplate const* ci = sObjectMgr->GetCreatureTemplate(entry);
     if (ci)
     {
-        std::string Name, Title;
-        Name = ci->Name;
-        Title = ci->SubName;
-
-        LocaleConstant loc_idx = GetSessionDbLocaleIndex();
-        if (loc_idx >= 0)
+        LocaleConstant locale = GetSessionDbLocaleIndex();
+        SendPacket(sQueryResponseCache->Get(QUERY_CACHE_CREATURE, entry, locale, [ci, locale]()
         {
-            if (CreatureLocale const* cl = sObjectMgr->GetCreatureLocale(entry))
-            {
-                ObjectMgr::GetLocaleString(cl->Name, loc_idx, Name);
-                ObjectMgr::GetLocaleString(cl->Title, loc_idx, Title);
-            }
-        }
-        // guess size
-        WorldPacket data(SMSG_CREATURE_QUERY_RESPONSE, 100);
-        data << uint32(entry);                                       // creature entry
-        data << Name;
-        data << uint8(0) << uint8(0) << uint8(0);                    // name2, name3, name4, always empty
-        data << Title;
-        data << ci->IconName;                                        // "Directions" for guard, string for Icons 2.3.0
-        data << uint32(ci->type_flags);                              // flags
-        data << uint32(ci->type);                                    // CreatureType.dbc
-        data << uint32(ci->family);                                  // CreatureFamily.dbc
-        data << uint32(ci->rank);                                    // Creature Rank (elite, boss, etc)
-        data << uint32(ci->KillCredit[0]);                           // new in 3.1, kill credit
-        data << uint32(ci->KillCredit[1]);                           // new in 3.1, kill credit
-        if (ci->GetModelByIdx(0))
-            data << uint32(ci->GetModelByIdx(0)->CreatureDisplayID); // Modelid1
-        else
-            data << uint32(0);                                       // Modelid1
-        if (ci->GetModelByIdx(1))
-            data << uint32(ci->GetModelByIdx(1)->CreatureDisplayID); // Modelid2
-        else
-            data << uint32(0);                                       // Modelid2
-        if (ci->GetModelByIdx(2))
-            data << uint32(ci->GetModelByIdx(2)->CreatureDisplayID); // Modelid3
-        else
-            data << uint32(0);                                       // Modelid3
-        if (ci->GetModelByIdx(3))
-            data << uint32(ci->GetModelByIdx(3)->CreatureDisplayID); // Modelid4
-        else
-            data << uint32(0);                                       // Modelid4
-        data << float(ci->ModHealth);                                // dmg/hp modifier
-        data << float(ci->ModMana);                                  // dmg/mana modifier
-        data << uint8(ci->RacialLeader);
-
-        CreatureQuestItemList const* items = sObjectMgr->GetCreatureQuestItemList(entry);
-        if (items)
-            for (std::size_t i = 0; i < MAX_CREATURE_QUEST_ITEMS; ++i)
-                data << (i < items->size() ? uint32((*items)[i]) : uint32(0));
-        else
-            for (std::size_t i = 0; i < MAX_CREATURE_QUEST_ITEMS; ++i)
-                data << uint32(0);
-
-        data << uint32(ci->movementId);                              // CreatureMovementInfo.dbc
-        SendPacket(&data);
+            return ci->BuildQueryData(locale);
+        }));
     }
     else
     {
@@ -162,6 +112,36 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recvData)
     }
 }
 
+static WorldPacket BuildGameObjectQueryResponse(GameObjectTemplate const* info, LocaleConstant locale)
+{
+    std::string Name = info->name;
+    std::string CastBarCaption = info->castBarCaption;
+
+    if (GameObjectLocale const* gameObjectLocale = sObjectMgr->GetGameObjectLocale(info->entry))
+    {
+        ObjectMgr::GetLocaleString(gameObjectLocale->Name, locale, Name);
+        ObjectMgr::GetLocaleString(gameObjectLocale->CastBarCaption, locale, CastBarCaption);
+    }
+
+    WorldPacket data(SMSG_GAMEOBJECT_QUERY_RESPONSE, 150);
+    data << uint32(info->entry);
+    data << uint32(info->type);
+    data << uint32(info->displayId);
+    data << Name;
+    data << uint8(0) << uint8(0) << uint8(0);           // name2, name3, name4
+    data << info->IconName;                             // 2.0.3, string. Icon name to use instead of default icon for go's (ex: "Attack" makes sword)
+    data << CastBarCaption;                             // 2.0.3, string. Text will appear in Cast Bar when using GO (ex: "Collecting")
+    data << info->unk1;                                 // 2.0.3, string
+    data.append(info->raw.data, MAX_GAMEOBJECT_DATA);
+    data << float(info->size);                          // go size
+
+    GameObjectQuestItemList const* items = sObjectMgr->GetGameObjectQuestItemList(info->entry);
+    for (std::size_t i = 0; i < MAX_GAMEOBJECT_QUEST_ITEMS; ++i)
+        data << (items && i < items->size() ? uint32((*items)[i]) : uint32(0));
+
+    return data;
+}
+
 /// Only _static_ data is sent in this packet !!!
 void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recvData)
 {
@@ -173,44 +153,12 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recvData)
     GameObjectTemplate const* info = sObjectMgr->GetGameObjectTemplate(entry);
     if (info)
     {
-        std::string Name;
-        std::string IconName;
-        std::string CastBarCaption;
-
-        Name = info->name;
-        IconName = info->IconName;
-        CastBarCaption = info->castBarCaption;
-
-        LocaleConstant localeConstant = GetSessionDbLocaleIndex();
-        if (localeConstant >= LOCALE_enUS)
-            if (GameObjectLocale const* gameObjectLocale = sObjectMgr->GetGameObjectLocale(entry))
-            {
-                ObjectMgr::GetLocaleString(gameObjectLocale->Name, localeConstant, Name);
-                ObjectMgr::GetLocaleString(gameObjectLocale->CastBarCaption, localeConstant, CastBarCaption);
-            }
-
         LOG_DEBUG("network", "WORLD: CMSG_GAMEOBJECT_QUERY '{}' - Entry: {}. ", info->name, entry);
-        WorldPacket data (SMSG_GAMEOBJECT_QUERY_RESPONSE, 150);
-        data << uint32(entry);
-        data << uint32(info->type);
-        data << uint32(info->displayId);
-        data << Name;
-        data << uint8(0) << uint8(0) << uint8(0);           // name2, name3, name4
-        data << IconName;                                   // 2.0.3, string. Icon name to use instead of default icon for go's (ex: "Attack" makes sword)
-        data << CastBarCaption;                             // 2.0.3, string. Text will appear in Cast Bar when using GO (ex: "Collecting")
-        data << info->unk1;                                 // 2.0.3, string
-        data.append(info->raw.data, MAX_GAMEOBJECT_DATA);
-        data << float(info->size);                          // go size
-
-        GameObjectQuestItemList const* items = sObjectMgr->GetGameObjectQuestItemList(entry);
-        if (items)
-            for (std::size_t i = 0; i < MAX_GAMEOBJECT_QUEST_ITEMS; ++i)
-                data << (i < items->size() ? uint32((*items)[i]) : uint32(0));
-        else
-            for (std::size_t i = 0; i < MAX_GAMEOBJECT_QUEST_ITEMS; ++i)
-                data << uint32(0);
-
-        SendPacket(&data);
+        LocaleConstant locale = GetSessionDbLocaleIndex();
+        SendPacket(sQueryResponseCache->Get(QUERY_CACHE_GAMEOBJECT, entry, locale, [info, locale]()
+        {
+            return BuildGameObjectQueryResponse(info, locale);
+        }));
         LOG_DEBUG("network", "WORLD: Sent SMSG_GAMEOBJECT_QUERY_RESPONSE");
     }
     else
@@ -271,18 +219,8 @@ void WorldSession::HandleCorpseQueryOpcode(WorldPacket& /*recvData*/)
     SendPacket(&data);
 }
 
-void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recvData)
+static WorldPacket BuildNpcTextQueryResponse(uint32 textID, GossipText const* gossip, LocaleConstant locale)
 {
-    uint32 textID;
-    ObjectGuid guid;
-
-    recvData >> textID;
-    LOG_DEBUG("network", "WORLD: CMSG_NPC_TEXT_QUERY TextId: {}", textID);
-
-    recvData >> guid;
-
-    GossipText const* gossip = sObjectMgr->GetGossipText(textID);
-
     WorldPacket data(SMSG_NPC_TEXT_UPDATE, 100);          // guess size
     data << textID;
 
@@ -305,7 +243,6 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recvData)
     else
     {
         std::string text0[MAX_GOSSIP_TEXT_OPTIONS], text1[MAX_GOSSIP_TEXT_OPTIONS];
-        LocaleConstant locale = GetSessionDbLocaleIndex();
 
         for (uint8 i = 0; i < MAX_GOSSIP_TEXT_OPTIONS; ++i)
         {
@@ -352,7 +289,33 @@ void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recvData)
         }
     }
 
-    SendPacket(&data);
+    return data;
+}
+
+void WorldSession::HandleNpcTextQueryOpcode(WorldPacket& recvData)
+{
+    uint32 textID;
+    ObjectGuid guid;
+
+    recvData >> textID;
+    LOG_DEBUG("network", "WORLD: CMSG_NPC_TEXT_QUERY TextId: {}", textID);
+
+    recvData >> guid;
+
+    GossipText const* gossip = sObjectMgr->GetGossipText(textID);
+    LocaleConstant locale = GetSessionDbLocaleIndex();
+
+    // missing texts are not cached, clients may query any id
+    if (gossip)
+        SendPacket(sQueryResponseCache->Get(QUERY_CACHE_NPC_TEXT, textID, locale, [textID, gossip, locale]()
+        {
+            return BuildNpcTextQueryResponse(textID, gossip, locale);
+        }));
+    else
+    {
+        WorldPacket data = BuildNpcTextQueryResponse(textID, nullptr, locale);
+        SendPacket(&data);
+    }
 
     LOG_DEBUG("network", "WORLD: Sent SMSG_NPC_TEXT_UPDATE");
 }
@@ -364,33 +327,35 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recvData)
     recvData >> pageID;
     recvData.read_skip<uint64>();                          // guid
 
+    LocaleConstant locale = GetSessionDbLocaleIndex();
     while (pageID)
     {
         PageText const* pageText = sObjectMgr->GetPageText(pageID);
-        // guess size
-        WorldPacket data(SMSG_PAGE_TEXT_QUERY_RESPONSE, 50);
-        data << pageID;
-
         if (!pageText)
         {
+            WorldPacket data(SMSG_PAGE_TEXT_QUERY_RESPONSE, 50);
+            data << pageID;
             data << "Item page missing.";
             data << uint32(0);
+            SendPacket(&data);
             pageID = 0;
         }
         else
         {
-            std::string Text = pageText->Text;
-
-            int loc_idx = GetSessionDbLocaleIndex();
-            if (loc_idx >= 0)
-                if (PageTextLocale const* player = sObjectMgr->GetPageTextLocale(pageID))
-                    ObjectMgr::GetLocaleString(player->Text, loc_idx, Text);
-
-            data << Text;
-            data << pageText->NextPage;
+            SendPacket(sQueryResponseCache->Get(QUERY_CACHE_PAGE_TEXT, pageID, locale, [pageID, pageText, locale]()
+            {
+                std::string Text = pageText->Text;
+                if (PageTextLocale const* pageTextLocale = sObjectMgr->GetPageTextLocale(pageID))
+                    ObjectMgr::GetLocaleString(pageTextLocale->Text, locale, Text);
+
+                WorldPacket data(SMSG_PAGE_TEXT_QUERY_RESPONSE, 50);
+                data << pageID;
+                data << Text;
+                data << pageText->NextPage;
+                return data;
+            }));
             pageID = pageText->NextPage;
         }
-        SendPacket(&data);
 
         LOG_DEBUG("network", "WORLD: Sent SMSG_PAGE_TEXT_QUERY_RESPONSE");
     }
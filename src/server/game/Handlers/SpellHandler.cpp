@@ -321,7 +321,7 @@ void WorldSession::HandleOpenWrappedItemCallback(uint8 bagIndex, uint8 slot, Obj
     stmt->SetData(0, item->GetGUID().GetCounter());
     trans->Append(stmt);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetAccountId());
 }
 
 void WorldSession::HandleGameObjectUseOpcode(WorldPacket& recvData)
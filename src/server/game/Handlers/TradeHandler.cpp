@@ -654,11 +654,11 @@ void WorldSession::HandleAcceptTradeOpcode(WorldPacket& /*recvPacket*/)
         {
             CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
             _player->SaveInventoryAndGoldToDB(trans);
-            CharacterDatabase.CommitTransaction(trans);
+            CharacterDatabase.CommitTransaction(trans, GetAccountId());
 
             trans = CharacterDatabase.BeginTransaction();
             trader->SaveInventoryAndGoldToDB(trans);
-            CharacterDatabase.CommitTransaction(trans);
+            CharacterDatabase.CommitTransaction(trans, trader->GetSession()->GetAccountId());
         }
         else
         {
@@ -666,7 +666,8 @@ void WorldSession::HandleAcceptTradeOpcode(WorldPacket& /*recvPacket*/)
             CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
             _player->SaveInventoryAndGoldToDB(trans);
             trader->SaveInventoryAndGoldToDB(trans);
-            CharacterDatabase.CommitTransaction(trans);
+            // one transaction can only be kept in order with the saves of one account
+            CharacterDatabase.CommitTransaction(trans, GetAccountId());
         }
 
         info.Status = TRADE_STATUS_TRADE_COMPLETE;
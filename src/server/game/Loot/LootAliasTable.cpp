@@ -0,0 +1,95 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LootAliasTable.h"
+#include "Random.h"
+#include <algorithm>
+
+LootAliasTable::LootAliasTable(std::vector<float> const& chances) : _missIndex(chances.size())
+{
+    uint32 const count = chances.size() + 1;
+    _probabilities.resize(count);
+
+    // the part of [0, 100) covered by every entry, a 100% (or more) chance takes all the rest
+    double total = 0.0;
+    for (uint32 i = 0; i < chances.size(); ++i)
+    {
+        double const begin = std::min(total, 100.0);
+        total += std::max(chances[i], 0.0f);
+        _probabilities[i] = (std::min(total, 100.0) - begin) / 100.0;
+    }
+
+    _probabilities[_missIndex] = std::max(100.0 - total, 0.0) / 100.0;
+
+    _threshold.assign(count, 1.0);
+    _alias.resize(count);
+    for (uint32 i = 0; i < count; ++i)
+        _alias[i] = i;
+
+    std::vector<double> scaled(count);
+    std::vector<uint32> small;
+    std::vector<uint32> large;
+    for (uint32 i = 0; i < count; ++i)
+    {
+        scaled[i] = _probabilities[i] * count;
+        (scaled[i] < 1.0 ? small : large).push_back(i);
+    }
+
+    while (!small.empty() && !large.empty())
+    {
+        uint32 const less = small.back();
+        small.pop_back();
+        uint32 const more = large.back();
+
+        _threshold[less] = scaled[less];
+        _alias[less] = more;
+
+        scaled[more] -= 1.0 - scaled[less];
+        if (scaled[more] < 1.0)
+        {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+
+    // whatever is left only differs from 1 by rounding errors
+    for (uint32 index : small)
+        _threshold[index] = 1.0;
+}
+
+uint32 LootAliasTable::Sample() const
+{
+    return Sample(rand_norm());
+}
+
+uint32 LootAliasTable::Sample(double roll) const
+{
+    if (_threshold.empty())
+        return _missIndex;
+
+    double const scaled = roll * _threshold.size();
+    uint32 const bucket = std::min<uint32>(uint32(scaled), _threshold.size() - 1);
+    return (scaled - bucket) < _threshold[bucket] ? bucket : _alias[bucket];
+}
+
+double LootAliasTable::GetProbability(uint32 index) const
+{
+    if (_probabilities.empty())
+        return index == _missIndex ? 1.0 : 0.0;
+
+    return index < _probabilities.size() ? _probabilities[index] : 0.0;
+}
@@ -0,0 +1,51 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_LOOTALIASTABLE_H
+#define ACORE_LOOTALIASTABLE_H
+
+#include "Define.h"
+#include <vector>
+
+// Alias table (Vose) over the outcomes of a loot group roll.
+// The chances are percentages checked in order, like LootGroup::Roll does with a single
+// roll in [0, 100): an entry is picked when the roll falls into its part of the running
+// total, and the roll misses every entry with whatever is left up to 100%.
+// Sampling costs one random number and no scan, whatever the group size.
+class LootAliasTable
+{
+public:
+    LootAliasTable() = default;
+    explicit LootAliasTable(std::vector<float> const& chances);
+
+    // Index of the picked entry, or GetMissIndex() when the roll misses all of them
+    [[nodiscard]] uint32 Sample() const;
+    // Same as above with the uniform random value in [0, 1) provided by the caller
+    [[nodiscard]] uint32 Sample(double roll) const;
+
+    [[nodiscard]] uint32 GetMissIndex() const { return _missIndex; }
+    // Chance of an outcome in [0, 1], as it follows from the chances the table was built from
+    [[nodiscard]] double GetProbability(uint32 index) const;
+
+private:
+    std::vector<double> _probabilities;
+    std::vector<double> _threshold;
+    std::vector<uint32> _alias;
+    uint32 _missIndex = 0;
+};
+
+#endif
@@ -21,6 +21,7 @@
 #include "Group.h"
 #include "ItemEnchantmentMgr.h"
 #include "Log.h"
+#include "LootAliasTable.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -111,11 +112,22 @@ public:
     LootStoreItemList* GetExplicitlyChancedItemList() { return &ExplicitlyChanced; }
     LootStoreItemList* GetEqualChancedItemList() { return &EqualChanced; }
     void CopyConditions(ConditionList conditions);
+    void Compile();                                     // Builds the sampling tables once the group is loaded
 private:
     LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
     LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
 
+    // Compiled form of the group, rebuilt by Compile() and dropped by AddEntry()
+    std::vector<LootStoreItem*> _explicitlyChanced;
+    std::vector<LootStoreItem*> _equalChanced;
+    std::vector<uint32> _itemIds;                       // sorted, for the duplicate drop check
+    LootAliasTable _aliasTable;
+    uint16 _lootMode = 0;                               // loot mode of every entry, 0 if they differ
+    uint8 _groupId = 0;
+    bool _compiled = false;
+
     LootStoreItem const* Roll(Loot& loot, Player const* player, LootStore const& store, uint16 lootMode) const;   // Rolls an item from the group, returns nullptr if all miss their chances
+    bool CanUseCompiledRoll(Loot const& loot, uint16 lootMode) const;
 
     // This class must never be copied - storing pointers
     LootGroup(LootGroup const&);
@@ -212,6 +224,9 @@ uint32 LootStore::LoadLootTable()
 
     Verify();                                           // Checks validity of the loot store
 
+    for (LootTemplateMap::const_iterator itr = m_LootTemplates.begin(); itr != m_LootTemplates.end(); ++itr)
+        itr->second->Compile();
+
     return count;
 }
 
@@ -1256,11 +1271,85 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
         ExplicitlyChanced.push_back(item);
     else
         EqualChanced.push_back(item);
+
+    _compiled = false;
+}
+
+void LootTemplate::LootGroup::Compile()
+{
+    _explicitlyChanced.assign(ExplicitlyChanced.begin(), ExplicitlyChanced.end());
+    _equalChanced.assign(EqualChanced.begin(), EqualChanced.end());
+
+    std::vector<float> chances;
+    chances.reserve(_explicitlyChanced.size());
+    for (LootStoreItem const* item : _explicitlyChanced)
+        chances.push_back(item->chance);
+
+    _aliasTable = LootAliasTable(chances);
+
+    _itemIds.clear();
+    _lootMode = 0;
+    _compiled = true;
+    bool first = true;
+    for (LootStoreItemList const* list : { &ExplicitlyChanced, &EqualChanced })
+    {
+        for (LootStoreItem const* item : *list)
+        {
+            if (first)
+            {
+                _lootMode = item->lootmode;
+                _groupId = item->groupid;
+                first = false;
+            }
+            else if (_lootMode != item->lootmode)
+                _lootMode = 0;
+
+            if (!item->reference)
+            {
+                // items without template are dropped by LootGroupInvalidSelector, let the full roll handle them
+                if (!sObjectMgr->GetItemTemplate(item->itemid))
+                    _compiled = false;
+
+                _itemIds.push_back(item->itemid);
+            }
+        }
+    }
+
+    std::sort(_itemIds.begin(), _itemIds.end());
+}
+
+// The compiled roll gives the same results as the full one as long as LootGroupInvalidSelector
+// can't remove any entry and no script changes the chances
+bool LootTemplate::LootGroup::CanUseCompiledRoll(Loot const& loot, uint16 lootMode) const
+{
+    if (!_compiled || !(_lootMode & lootMode))
+        return false;
+
+    for (LootItem const& item : loot.items)
+        if (item.groupid == _groupId && std::binary_search(_itemIds.begin(), _itemIds.end(), item.itemid))
+            return false;
+
+    return !sScriptMgr->HasItemRollHooks();
 }
 
 // Rolls an item from the group, returns nullptr if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, Player const* player, LootStore const& store, uint16 lootMode) const
 {
+    if (CanUseCompiledRoll(loot, lootMode))
+    {
+        uint32 index = _aliasTable.Sample();
+        if (index < _explicitlyChanced.size())
+            return _explicitlyChanced[index];
+
+        if (!sScriptMgr->OnBeforeLootEqualChanced(player, EqualChanced, loot, store))
+            return nullptr;
+
+        if (!_equalChanced.empty())
+            return _equalChanced[urand(0, _equalChanced.size() - 1)];
+
+        return nullptr;
+    }
+
     LootStoreItemList possibleLoot = ExplicitlyChanced;
     possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
 
@@ -1549,6 +1638,13 @@ void LootTemplate::AddEntry(LootStoreItem* item)
         Entries.push_back(item);
 }
 
+void LootTemplate::Compile()
+{
+    for (LootGroup* group : Groups)
+        if (group)
+            group->Compile();
+}
+
 void LootTemplate::CopyConditions(ConditionList conditions)
 {
     for (LootStoreItemList::iterator i = Entries.begin(); i != Entries.end(); ++i)
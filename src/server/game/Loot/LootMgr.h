@@ -252,6 +252,8 @@ public:
 
     // Adds an entry to the group (at loading stage)
     void AddEntry(LootStoreItem* item);
+    // Builds the sampling tables of the groups, entries added later are rolled the slow way until the next call
+    void Compile();
     // Rolls for every item in the template and adds the rolled items the the loot
     void Process(Loot& loot, LootStore const& store, uint16 lootMode, Player const* player, uint8 groupId = 0, bool isTopLevel = true) const;
     void CopyConditions(ConditionList conditions);
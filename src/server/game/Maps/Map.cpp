@@ -30,15 +30,19 @@
 #include "LFGMgr.h"
 #include "MapGrid.h"
 #include "MapInstanced.h"
+#include "MapMgr.h"
 #include "Metric.h"
 #include "MiscPackets.h"
+#include "MoveSpline.h"
 #include "Object.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Pet.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
+#include "StringConvert.h"
 #include "TC9Sidecar.h"
+#include "Tokenize.h"
 #include "Transport.h"
 #include "VMapFactory.h"
 #include "Vehicle.h"
@@ -81,8 +85,25 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
 
     _weatherUpdateTimer.SetInterval(1 * IN_MILLISECONDS);
     _corpseUpdateTimer.SetInterval(20 * MINUTE * IN_MILLISECONDS);
+    _terrainPrefetchTimer.SetInterval(1 * IN_MILLISECONDS);
 
     _poolData = sPoolMgr->InitPoolsForMap(this);
+
+    if (!Instanceable() && sWorld->getIntConfig(CONFIG_NUMTHREADS) > 1)
+    {
+        for (std::string_view mapId : Acore::Tokenize(sWorld->getStringConfig(CONFIG_MAP_UPDATE_PARALLEL_OBJECTS_MAPS), ' ', false))
+            if (Acore::StringTo<uint32>(mapId) == id)
+                _parallelObjectUpdateEnabled = true;
+
+        if (_parallelObjectUpdateEnabled)
+        {
+            _objectUpdateRegionSize = sWorld->getIntConfig(CONFIG_MAP_UPDATE_PARALLEL_OBJECTS_REGION_SIZE);
+            _objectUpdateGuardBand = float(sWorld->getIntConfig(CONFIG_MAP_UPDATE_PARALLEL_OBJECTS_GUARD_BAND));
+
+            uint32 regionsPerSide = (MAX_NUMBER_OF_GRIDS + _objectUpdateRegionSize - 1) / _objectUpdateRegionSize;
+            _objectUpdateRegions.resize(regionsPerSide * regionsPerSide);
+        }
+    }
 }
 
 // Hook called after map is created AND after added to map list
@@ -182,11 +203,24 @@ void Map::DeleteFromWorld(Player* player)
 
 void Map::EnsureGridCreated(GridCoord const& gridCoord)
 {
+    // creating a grid adds vmap and mmap tiles, which the region updates read without locking
+    if (_parallelObjectUpdateActive && !IsGridCreated(gridCoord))
+    {
+        DeferParallelObjectUpdate([this, gridCoord]() { EnsureGridCreated(gridCoord); });
+        return;
+    }
+
     _mapGridManager.CreateGrid(gridCoord.x_coord, gridCoord.y_coord);
 }
 
 bool Map::EnsureGridLoaded(Cell const& cell)
 {
+    if (_parallelObjectUpdateActive && !IsGridLoaded(GridCoord(cell.GridX(), cell.GridY())))
+    {
+        DeferParallelObjectUpdate([this, cell]() { EnsureGridLoaded(cell); });
+        return false;
+    }
+
     EnsureGridCreated(GridCoord(cell.GridX(), cell.GridY()));
 
     if (_mapGridManager.LoadGrid(cell.GridX(), cell.GridY()))
@@ -306,6 +340,8 @@ void Map::InitializeObject(GameObject*  /*obj*/)
 template<class T>
 bool Map::AddToMap(T* obj, bool checkTransport)
 {
+    auto guard = GuardParallelObjectUpdate();
+
     //TODO: Needs clean up. An object should not be added to map twice.
     if (obj->IsInWorld())
     {
@@ -332,6 +368,10 @@ bool Map::AddToMap(T* obj, bool checkTransport)
     else
         EnsureGridCreated(GridCoord(cell.GridX(), cell.GridY()));
 
+    // the grid is created by the merge phase of a parallel object update, the object is added after it
+    if (!IsGridCreated(GridCoord(cell.GridX(), cell.GridY())) && DeferParallelObjectUpdate([this, obj, checkTransport]() { AddToMap(obj, checkTransport); }))
+        return true;
+
     AddToGrid(obj, cell);
 
     //Must already be set before AddToMap. Usually during obj->Create.
@@ -525,6 +565,7 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
     UpdateWeather(t_diff);
     UpdateExpiredCorpses(t_diff);
+    UpdateTerrainPrefetch(t_diff);
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
@@ -543,6 +584,12 @@ void Map::UpdateNonPlayerObjects(uint32 const diff)
         _AddObjectToUpdateList(obj);
     _pendingAddUpdatableObjectList.clear();
 
+    if (_parallelObjectUpdateEnabled && sMapMgr->GetMapUpdater()->activated())
+    {
+        UpdateNonPlayerObjectsInRegions(diff);
+        return;
+    }
+
     if (_updatableObjectListRecheckTimer.Passed())
     {
         for (uint32 i = 0; i < _updatableObjectList.size();)
@@ -580,8 +627,146 @@ void Map::UpdateNonPlayerObjects(uint32 const diff)
     }
 }
 
+bool Map::CanUpdateInParallelRegion(WorldObject const* obj) const
+{
+    // Only idle creatures are region local: combat, vehicles, transports and player controlled
+    // units reach objects that may be anywhere on the map
+    Creature const* creature = obj->ToCreature();
+    if (!creature)
+        return false;
+
+    if (creature->IsInCombat() || creature->IsControlledByPlayer() || creature->IsCharmed() || creature->IsVehicle() ||
+        creature->GetVehicle() || creature->GetTransport() || creature->isActiveObject())
+        return false;
+
+    // Dead and respawning creatures relocate and reload their spawn, evading ones reset their threat and
+    // a spell being cast lands on its targets from the caster's update. C++ scripts may touch any object.
+    if (!creature->IsAlive() || creature->IsInEvadeMode() || creature->IsNonMeleeSpellCast(false) || creature->GetScriptId())
+        return false;
+
+    // Grids are only created and loaded outside of the parallel pass, keep creatures that could walk
+    // into a grid which is not loaded yet in the serial pass
+    for (float offsetX : { -_objectUpdateGuardBand, _objectUpdateGuardBand })
+        for (float offsetY : { -_objectUpdateGuardBand, _objectUpdateGuardBand })
+            if (!IsGridLoaded(Acore::ComputeGridCoord(creature->GetPositionX() + offsetX, creature->GetPositionY() + offsetY)))
+                return false;
+
+    return true;
+}
+
+bool Map::DeferParallelObjectUpdate(std::function<void()>&& action)
+{
+    if (!_parallelObjectUpdateActive)
+        return false;
+
+    std::lock_guard<std::recursive_mutex> guard(_parallelObjectUpdateLock);
+    _deferredObjectUpdates.push_back(std::move(action));
+    return true;
+}
+
+void Map::UpdateObjectRegion(void* context, uint32 index)
+{
+    Map* map = static_cast<Map*>(context);
+    auto const startTime = std::chrono::steady_clock::now();
+
+    for (WorldObject* obj : map->_objectUpdateRegions[map->_activeObjectUpdateRegions[index]])
+        if (obj->IsInWorld())
+            obj->Update(map->_parallelObjectUpdateDiff);
+
+    map->_parallelObjectUpdateWork.fetch_add(uint64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count()), std::memory_order_relaxed);
+}
+
+void Map::UpdateNonPlayerObjectsInRegions(uint32 const diff)
+{
+    float const regionLength = float(_objectUpdateRegionSize) * SIZE_OF_GRIDS;
+    uint32 const regionsPerSide = (MAX_NUMBER_OF_GRIDS + _objectUpdateRegionSize - 1) / _objectUpdateRegionSize;
+
+    // Partition: objects deep enough inside a region go to that region, the rest to the serial pass
+    for (WorldObject* obj : _updatableObjectList)
+    {
+        if (!obj->IsInWorld())
+            continue;
+
+        if (!CanUpdateInParallelRegion(obj))
+        {
+            _serialObjectUpdates.push_back(obj);
+            continue;
+        }
+
+        float const offsetX = (CENTER_GRID_ID * SIZE_OF_GRIDS - obj->GetPositionX()) / regionLength;
+        float const offsetY = (CENTER_GRID_ID * SIZE_OF_GRIDS - obj->GetPositionY()) / regionLength;
+        float const regionX = std::floor(offsetX);
+        float const regionY = std::floor(offsetY);
+        float const fractionX = offsetX - regionX;
+        float const fractionY = offsetY - regionY;
+        float const borderDistance = std::min({ fractionX, 1.0f - fractionX, fractionY, 1.0f - fractionY }) * regionLength;
+
+        if (borderDistance < _objectUpdateGuardBand || regionX < 0.0f || regionY < 0.0f || regionX >= regionsPerSide || regionY >= regionsPerSide)
+        {
+            _serialObjectUpdates.push_back(obj);
+            continue;
+        }
+
+        uint32 const regionIndex = uint32(regionX) * regionsPerSide + uint32(regionY);
+        std::vector<WorldObject*>& region = _objectUpdateRegions[regionIndex];
+        if (region.empty())
+            _activeObjectUpdateRegions.push_back(regionIndex);
+
+        region.push_back(obj);
+    }
+
+    auto const startTime = std::chrono::steady_clock::now();
+
+    _parallelObjectUpdateDiff = diff;
+    _parallelObjectUpdateWork = 0;
+    _parallelObjectUpdateActive = true;
+    sMapMgr->GetMapUpdater()->run_parallel(uint32(_activeObjectUpdateRegions.size()), &Map::UpdateObjectRegion, this);
+    _parallelObjectUpdateActive = false;
+
+    uint64 const wallTime = uint64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+
+    // Merge phase: the effects on other objects deferred by the regions in the order they were raised, then
+    // border and interacting objects. Cell moves, delayed visibility and removals queued during the parallel
+    // pass are applied by the regular serial steps of Map::Update.
+    for (std::function<void()>& action : _deferredObjectUpdates)
+        action();
+    _deferredObjectUpdates.clear();
+
+    for (WorldObject* obj : _serialObjectUpdates)
+        if (obj->IsInWorld())
+            obj->Update(diff);
+
+    if (_updatableObjectListRecheckTimer.Passed())
+    {
+        for (uint32 i = 0; i < _updatableObjectList.size();)
+        {
+            WorldObject* obj = _updatableObjectList[i];
+            if (obj->IsInWorld() && !obj->IsUpdateNeeded())
+                _RemoveObjectFromUpdateList(obj); // swapped with the last element, same index is checked again
+            else
+                ++i;
+        }
+        _updatableObjectListRecheckTimer.Reset();
+    }
+
+    if (wallTime && !_activeObjectUpdateRegions.empty())
+    {
+        METRIC_VALUE("map_parallel_object_update_speedup", double(_parallelObjectUpdateWork.load()) / double(wallTime),
+            METRIC_TAG("map_id", std::to_string(GetId())));
+        METRIC_VALUE("map_parallel_object_update_serial", uint64(_serialObjectUpdates.size()),
+            METRIC_TAG("map_id", std::to_string(GetId())));
+    }
+
+    for (uint32 regionIndex : _activeObjectUpdateRegions)
+        _objectUpdateRegions[regionIndex].clear();
+    _activeObjectUpdateRegions.clear();
+    _serialObjectUpdates.clear();
+}
+
 void Map::AddObjectToPendingUpdateList(WorldObject* obj)
 {
+    auto guard = GuardParallelObjectUpdate();
+
     if (!obj->CanBeAddedToMapUpdateList())
         return;
 
@@ -622,6 +807,8 @@ void Map::_RemoveObjectFromUpdateList(WorldObject* obj)
 
 void Map::RemoveObjectFromMapUpdateList(WorldObject* obj)
 {
+    auto guard = GuardParallelObjectUpdate();
+
     if (!obj->CanBeAddedToMapUpdateList())
         return;
 
@@ -744,6 +931,8 @@ void Map::AfterPlayerUnlinkFromMap()
 template<class T>
 void Map::RemoveFromMap(T* obj, bool remove)
 {
+    auto guard = GuardParallelObjectUpdate();
+
     obj->RemoveFromWorld();
 
     obj->RemoveFromGrid();
@@ -820,7 +1009,8 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float o)
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers();
     player->UpdatePositionData();
-    player->UpdateObjectVisibility(false);
+    // a move, unlike Player::UpdateObjectVisibility(false) this keeps the update incremental
+    player->AddToNotify(NOTIFY_VISIBILITY_CHANGED);
 }
 
 void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float o)
@@ -888,6 +1078,8 @@ void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float
 
 void Map::AddCreatureToMoveList(Creature* c)
 {
+    auto guard = GuardParallelObjectUpdate();
+
     if (c->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
         _creaturesToMove.push_back(c);
     c->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
@@ -901,6 +1093,8 @@ void Map::RemoveCreatureFromMoveList(Creature* c)
 
 void Map::AddGameObjectToMoveList(GameObject* go)
 {
+    auto guard = GuardParallelObjectUpdate();
+
     if (go->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
         _gameObjectsToMove.push_back(go);
     go->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
@@ -914,6 +1108,8 @@ void Map::RemoveGameObjectFromMoveList(GameObject* go)
 
 void Map::AddDynamicObjectToMoveList(DynamicObject* dynObj)
 {
+    auto guard = GuardParallelObjectUpdate();
+
     if (dynObj->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
         _dynamicObjectsToMove.push_back(dynObj);
     dynObj->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
@@ -1709,6 +1905,9 @@ void Map::SendObjectUpdates()
 {
     UpdateDataMapType update_players;
 
+    Object::ValuesUpdateCacheStats& cacheStats = Object::GetValuesUpdateCacheStats();
+    cacheStats = {};
+
     while (!_updateObjects.empty())
     {
         Object* obj = *_updateObjects.begin();
@@ -1718,6 +1917,13 @@ void Map::SendObjectUpdates()
         obj->BuildUpdate(update_players);
     }
 
+    if (cacheStats.Hits || cacheStats.Misses)
+    {
+        METRIC_VALUE("map_update_object_cache_hits", cacheStats.Hits, METRIC_TAG("map_id", std::to_string(GetId())));
+        METRIC_VALUE("map_update_object_cache_misses", cacheStats.Misses, METRIC_TAG("map_id", std::to_string(GetId())));
+        METRIC_VALUE("map_update_object_cache_bytes_saved", cacheStats.BytesSaved, METRIC_TAG("map_id", std::to_string(GetId())));
+    }
+
     WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
     for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
     {
@@ -1794,6 +2000,8 @@ void Map::DelayedUpdate(const uint32 t_diff)
 
 void Map::AddObjectToRemoveList(WorldObject* obj)
 {
+    auto guard = GuardParallelObjectUpdate();
+
     ASSERT(obj->GetMapId() == GetId() && obj->GetInstanceId() == GetInstanceId());
 
     obj->CleanupsBeforeDelete(false);                            // remove or simplify at least cross referenced links
@@ -1899,8 +2107,13 @@ void Map::UpdatePlayersRedirectKickEvent(uint32 diff)
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    if (m_mapRefMgr.IsEmpty())
+        return;
+
+    // one payload shared by every recipient socket instead of a copy per player
+    std::shared_ptr<WorldPacket const> sharedData = std::make_shared<WorldPacket const>(*data);
     for (MapRefMgr::const_iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
-        itr->GetSource()->SendDirectMessage(data);
+        itr->GetSource()->SendDirectMessage(sharedData);
 }
 
 template bool Map::AddToMap(Corpse*, bool);
@@ -3249,6 +3462,88 @@ void Map::UpdateWeather(uint32 const diff)
     _weatherUpdateTimer.Reset();
 }
 
+void Map::UpdateTerrainPrefetch(uint32 const diff)
+{
+    // instanceable maps load all their grids on creation
+    if (Instanceable() || !sMapMgr->GetTerrainPrefetcher()->IsActive())
+        return;
+
+    _terrainPrefetchTimer.Update(diff);
+    if (!_terrainPrefetchTimer.Passed())
+        return;
+
+    _terrainPrefetchTimer.Reset();
+
+    float const lookAhead = float(sWorld->getIntConfig(CONFIG_MAP_UPDATE_TERRAIN_PREFETCH_LOOKAHEAD));
+    if (lookAhead > 0.0f)
+        for (MapReference const& ref : m_mapRefMgr)
+            if (Player const* player = ref.GetSource())
+                if (player->IsInWorld())
+                    PrefetchTerrainAhead(player, lookAhead);
+
+    // prefetched grids nobody arrived at, the player turned around or logged out
+    _mapGridManager.RemoveExpiredTerrainPrefetches(uint32(lookAhead * 6 * IN_MILLISECONDS));
+}
+
+void Map::PrefetchTerrainAhead(Player const* player, float lookAhead)
+{
+    G3D::Vector2 from(player->GetPositionX(), player->GetPositionY());
+
+    // samples the path every half grid so no grid crossed on the way is skipped
+    auto prefetchAlong = [this](G3D::Vector2 const& start, G3D::Vector2 const& end)
+    {
+        float const length = (end - start).length();
+        uint32 const steps = uint32(length / (SIZE_OF_GRIDS * 0.5f)) + 1;
+        for (uint32 i = 1; i <= steps; ++i)
+        {
+            G3D::Vector2 const point = start + (end - start) * (float(i) / steps);
+            PrefetchTerrainAround(point.x, point.y);
+        }
+    };
+
+    if (!player->movespline->Finalized())
+    {
+        // taxi flights and other server driven movement: follow the remaining spline points,
+        // points of a spline on a transport are relative to the transport
+        Movement::MoveSpline const& moveSpline = *player->movespline;
+        if (!moveSpline.Initialized() || moveSpline.onTransport)
+            return;
+
+        Movement::MoveSpline::MySpline const& spline = moveSpline._Spline();
+        float remaining = moveSpline.Velocity() * lookAhead;
+        for (int32 i = moveSpline._currentSplineIdx() + 1; i <= spline.last() && remaining > 0.0f; ++i)
+        {
+            G3D::Vector2 to = spline.getPoint(i).xy();
+            float const length = (to - from).length();
+            if (length > remaining)
+                to = from + (to - from) * (remaining / length);
+
+            prefetchAlong(from, to);
+            remaining -= length;
+            from = to;
+        }
+    }
+    else if (player->isMoving())
+    {
+        // client driven movement: extrapolate current speed along the facing
+        float const distance = player->GetSpeed(player->IsFlying() ? MOVE_FLIGHT : MOVE_RUN) * lookAhead;
+        G3D::Vector2 const to = from + G3D::Vector2(std::cos(player->GetOrientation()), std::sin(player->GetOrientation())) * distance;
+        prefetchAlong(from, to);
+    }
+}
+
+void Map::PrefetchTerrainAround(float x, float y)
+{
+    // a grid is created as soon as it comes into visibility range of a player
+    float const range = GetVisibilityRange();
+    GridCoord const low = Acore::ComputeGridCoord(x + range, y + range);
+    GridCoord const high = Acore::ComputeGridCoord(x - range, y - range);
+    for (uint32 gridX = low.x_coord; gridX <= high.x_coord && gridX < MAX_NUMBER_OF_GRIDS; ++gridX)
+        for (uint32 gridY = low.y_coord; gridY <= high.y_coord && gridY < MAX_NUMBER_OF_GRIDS; ++gridY)
+            if (!_mapGridManager.IsGridCreated(gridX, gridY))
+                _mapGridManager.PrefetchGridTerrain(gridX, gridY);
+}
+
 void Map::PlayDirectSoundToMap(uint32 soundId, uint32 zoneId)
 {
     Map::PlayerList const& players = GetPlayers();
@@ -39,9 +39,14 @@
 #include "SpawnData.h"
 #include "Timer.h"
 #include "GridTerrainData.h"
+#include <array>
+#include <atomic>
 #include <bitset>
+#include <functional>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <shared_mutex>
 
@@ -503,6 +508,7 @@ public:
 
     void UpdateWeather(uint32 const diff);
     void UpdateExpiredCorpses(uint32 const diff);
+    void UpdateTerrainPrefetch(uint32 const diff);
 
     void PlayDirectSoundToMap(uint32 soundId, uint32 zoneId = 0);
     void SetZoneMusic(uint32 zoneId, uint32 musicId);
@@ -533,16 +539,41 @@ public:
 
     void AddUpdateObject(Object* obj)
     {
+        auto guard = GuardParallelObjectUpdate();
         _updateObjects.insert(obj);
     }
 
     void RemoveUpdateObject(Object* obj)
     {
+        auto guard = GuardParallelObjectUpdate();
         _updateObjects.erase(obj);
     }
 
+    void AddObjectForDelayedVisibility(Unit* unit)
+    {
+        auto guard = GuardParallelObjectUpdate();
+        i_objectsForDelayedVisibility.insert(unit);
+    }
+
+    [[nodiscard]] bool IsParallelObjectUpdateEnabled() const { return _parallelObjectUpdateEnabled; }
+    [[nodiscard]] bool IsParallelObjectUpdateActive() const { return _parallelObjectUpdateActive; }
+
+    // Effects of a region update on other objects (spell casts, creature text, script actions, grid loads)
+    // are queued and applied by the serial merge phase. Returns false outside of the parallel pass, the
+    // caller then applies the effect itself.
+    bool DeferParallelObjectUpdate(std::function<void()>&& action);
+
     size_t GetUpdatableObjectsCount() const { return _updatableObjectList.size(); }
 
+    // Moving average of the Map::Update wall time in microseconds, kept separately for full and
+    // session-only ticks. MapUpdater uses it to hand out the most expensive maps first.
+    [[nodiscard]] uint32 GetUpdateCostEstimate(bool fullUpdate) const { return _updateCostEstimate[fullUpdate ? 1 : 0]; }
+    void RecordUpdateCost(bool fullUpdate, uint32 costUs)
+    {
+        uint32& estimate = _updateCostEstimate[fullUpdate ? 1 : 0];
+        estimate = (estimate * 7 + costUs) / 8;
+    }
+
     virtual std::string GetDebugInfo() const;
 
     uint32 GetCreatedGridsCount();
@@ -645,6 +676,22 @@ private:
 
     void UpdateNonPlayerObjects(uint32 const diff);
 
+    // Opt-in intra-map parallelism (MapUpdate.ParallelObjects.*): idle creatures are bucketed by grid
+    // region and the regions are updated on the MapUpdater threads. Objects inside the guard band of a
+    // region border, and anything that may interact across regions, stay in the serial pass.
+    void UpdateNonPlayerObjectsInRegions(uint32 const diff);
+    bool CanUpdateInParallelRegion(WorldObject const* obj) const;
+    static void UpdateObjectRegion(void* context, uint32 index);
+
+    // Map wide bookkeeping reached from object updates is only serialized while regions run in parallel
+    std::unique_lock<std::recursive_mutex> GuardParallelObjectUpdate()
+    {
+        if (_parallelObjectUpdateActive)
+            return std::unique_lock<std::recursive_mutex>(_parallelObjectUpdateLock);
+
+        return {};
+    }
+
     void _AddObjectToUpdateList(WorldObject* obj);
     void _RemoveObjectFromUpdateList(WorldObject* obj);
 
@@ -681,6 +728,11 @@ private:
     uint32 _defaultLight;
 
     IntervalTimer _corpseUpdateTimer;
+    IntervalTimer _terrainPrefetchTimer;
+
+    // Queues terrain of the grids a player is predicted to reach within MapUpdate.TerrainPrefetch.LookAhead
+    void PrefetchTerrainAhead(Player const* player, float lookAhead);
+    void PrefetchTerrainAround(float x, float y);
 
     template<HighGuid high>
     inline ObjectGuidGeneratorBase& GetGuidSequenceGenerator()
@@ -709,6 +761,20 @@ private:
 
     TimeTrackerSmall _redirectKickTimer;
     TimeTrackerSmall _lastAnnounceRedirectKickTimer;
+
+    std::array<uint32, 2> _updateCostEstimate{};
+
+    bool _parallelObjectUpdateEnabled{false};
+    std::atomic<bool> _parallelObjectUpdateActive{false};
+    std::recursive_mutex _parallelObjectUpdateLock;
+    uint32 _parallelObjectUpdateDiff{0};
+    uint32 _objectUpdateRegionSize{1};
+    float _objectUpdateGuardBand{0.0f};
+    std::vector<std::vector<WorldObject*>> _objectUpdateRegions;
+    std::vector<uint32> _activeObjectUpdateRegions;
+    std::vector<WorldObject*> _serialObjectUpdates;
+    std::vector<std::function<void()>> _deferredObjectUpdates;
+    std::atomic<uint64> _parallelObjectUpdateWork{0};
 };
 
 enum InstanceResetMethod
@@ -27,6 +27,7 @@
 #include "WorldModel.h"
 
 #include <G3D/Vector3.h>
+#include <array>
 
 MapCollisionData::MapCollisionData(Map const& map, Map const* parentMap) :
     _map(map), _staticVMapData(map.GetId())
@@ -49,9 +50,19 @@ MapCollisionData::MapCollisionData(Map const& map, Map const* parentMap) :
     }
 }
 
+bool MapCollisionData::CanLoadVMapTiles() const
+{
+    return VMAP::VMapFactory::createOrGetVMapMgr()->isMapLoadingEnabled() && _staticVMapData._staticTree;
+}
+
+bool MapCollisionData::CanLoadMMapTiles() const
+{
+    return DisableMgr::IsPathfindingEnabled(&_map) && _mmapData._navMesh;
+}
+
 int MapCollisionData::LoadVMapTile(uint32 tileX, uint32 tileY)
 {
-    if (!VMAP::VMapFactory::createOrGetVMapMgr()->isMapLoadingEnabled() || !_staticVMapData._staticTree)
+    if (!CanLoadVMapTiles())
         return VMAP::VMAP_LOAD_RESULT_IGNORED;
 
     if (!_staticVMapData._staticTree->LoadMapTile(tileX, tileY))
@@ -60,11 +71,15 @@ int MapCollisionData::LoadVMapTile(uint32 tileX, uint32 tileY)
     return VMAP::VMAP_LOAD_RESULT_OK;
 }
 
-int MapCollisionData::LoadMMapTile(uint32 tileX, uint32 tileY)
+int MapCollisionData::LoadMMapTile(uint32 tileX, uint32 tileY, MMAP::MMapTileData* prefetchedTile)
 {
-    if (!DisableMgr::IsPathfindingEnabled(&_map) || !_mmapData._navMesh)
+    if (!CanLoadMMapTiles())
         return MMAP::MMAP_LOAD_RESULT_IGNORED;
 
+    // a prefetch that could not read the tile is retried here, the file may have been busy or replaced
+    if (prefetchedTile && prefetchedTile->Data)
+        return MMAP::MMapMgr::AddTile(_mmapData._navMesh.get(), _map.GetId(), tileX, tileY, *prefetchedTile);
+
     return MMAP::MMapMgr::LoadTile(_mmapData._navMesh.get(), _map.GetId(), tileX, tileY);
 }
 
@@ -174,10 +189,73 @@ bool DynamicVMapCollisionData::GetObjectHitPos(uint32 phasemask, float x1, float
     return result;
 }
 
-dtNavMeshQuery const* MMapData::GetNavMeshQuery()
+namespace
 {
-    if (_navMesh && !_navMeshQuery)
-        _navMeshQuery = MMAP::MMapMgr::CreateNavMeshQuery(_navMesh.get());
+    struct ThreadNavMeshQuery
+    {
+        MMAP::ManagedNavMeshQuery Query;
+        dtNavMesh const* NavMesh = nullptr;
+        uint32 MaxNodes = 0;
+    };
+
+    thread_local std::array<ThreadNavMeshQuery, AsUnderlyingType(MMAP::NavMeshQueryType::Max)> ThreadNavMeshQueries;
+
+    uint32 GetNavMeshQueryNodes(MMAP::NavMeshQueryType type)
+    {
+        uint32 maxNodes;
+        switch (type)
+        {
+            case MMAP::NavMeshQueryType::Chase:
+                maxNodes = sWorld->getIntConfig(CONFIG_MMAP_QUERY_NODES_CHASE);
+                break;
+            case MMAP::NavMeshQueryType::Flee:
+                maxNodes = sWorld->getIntConfig(CONFIG_MMAP_QUERY_NODES_FLEE);
+                break;
+            case MMAP::NavMeshQueryType::Roam:
+                maxNodes = sWorld->getIntConfig(CONFIG_MMAP_QUERY_NODES_ROAM);
+                break;
+            case MMAP::NavMeshQueryType::PointMove:
+                maxNodes = sWorld->getIntConfig(CONFIG_MMAP_QUERY_NODES_POINT_MOVE);
+                break;
+            case MMAP::NavMeshQueryType::Waypoint:
+                maxNodes = sWorld->getIntConfig(CONFIG_MMAP_QUERY_NODES_WAYPOINT);
+                break;
+            default:
+                maxNodes = sWorld->getIntConfig(CONFIG_MMAP_QUERY_NODES_DEFAULT);
+                break;
+        }
+
+        // detour node indices are 16 bit
+        return std::clamp<uint32>(maxNodes, 64, 65535);
+    }
+}
+
+dtNavMeshQuery const* MMapData::GetNavMeshQuery(dtNavMesh const* navMesh, MMAP::NavMeshQueryType type)
+{
+    if (!navMesh)
+        return nullptr;
+
+    ThreadNavMeshQuery& entry = ThreadNavMeshQueries[AsUnderlyingType(type)];
+    uint32 maxNodes = GetNavMeshQueryNodes(type);
+
+    // dtNavMeshQuery::init never shrinks the node pool, a changed budget needs a new query
+    if (!entry.Query || entry.MaxNodes != maxNodes)
+    {
+        entry.Query = MMAP::MMapMgr::CreateNavMeshQuery(navMesh, maxNodes);
+        entry.NavMesh = navMesh;
+        entry.MaxNodes = maxNodes;
+    }
+    else if (entry.NavMesh != navMesh)
+    {
+        // rebinding keeps the allocated node pools and only clears them
+        if (dtStatusFailed(entry.Query->init(navMesh, maxNodes)))
+        {
+            entry.Query.reset();
+            return nullptr;
+        }
+
+        entry.NavMesh = navMesh;
+    }
 
-    return _navMeshQuery.get();
+    return entry.Query.get();
 }
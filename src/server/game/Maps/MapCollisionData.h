@@ -60,13 +60,15 @@ class MMapData
 
 public:
     dtNavMesh const* GetNavMesh() const { return _navMesh.get(); }
-    dtNavMeshQuery const* GetNavMeshQuery();
+    dtNavMeshQuery const* GetNavMeshQuery(MMAP::NavMeshQueryType type = MMAP::NavMeshQueryType::Default) const { return GetNavMeshQuery(_navMesh.get(), type); }
+
+    // navMeshQuery is not thread safe, so every thread keeps one query per type and rebinds it to the requested nav mesh.
+    // The returned query must only be used on the calling thread.
+    static dtNavMeshQuery const* GetNavMeshQuery(dtNavMesh const* navMesh, MMAP::NavMeshQueryType type);
 
 protected:
     // _navMesh is a shared_ptr as it will point to a parent maps nav mesh (if exists) to save on memory
     std::shared_ptr<dtNavMesh> _navMesh;
-    // navMeshQuery is not thread safe and needs its own instance per map
-    MMAP::ManagedNavMeshQuery _navMeshQuery;
 };
 
 // Map collision data holders (dynamic&static vmap, mmaps)
@@ -76,8 +78,11 @@ public:
     MapCollisionData(Map const& map, Map const* parentMap);
     ~MapCollisionData() = default;
 
+    bool CanLoadVMapTiles() const;
+    bool CanLoadMMapTiles() const;
     int LoadVMapTile(uint32 tileX, uint32 tileY);
-    int LoadMMapTile(uint32 tileX, uint32 tileY);
+    // prefetchedTile, if given, holds the tile already read from disk
+    int LoadMMapTile(uint32 tileX, uint32 tileY, MMAP::MMapTileData* prefetchedTile = nullptr);
 
     DynamicVMapCollisionData& GetDynamicTree() { return _dynamicVMapData; }
     DynamicVMapCollisionData const& GetDynamicTree() const { return _dynamicVMapData; }
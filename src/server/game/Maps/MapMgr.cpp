@@ -60,6 +60,9 @@ void MapMgr::Initialize()
     // Start mtmaps if needed
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    if (uint32 prefetchThreads = sWorld->getIntConfig(CONFIG_MAP_UPDATE_TERRAIN_PREFETCH_THREADS))
+        m_terrainPrefetcher.Activate(prefetchThreads);
 }
 
 void MapMgr::InitializeVisibilityDistanceInfo()
@@ -327,6 +330,9 @@ bool MapMgr::IsValidMAP(uint32 mapid, bool startUp)
 
 void MapMgr::UnloadAll()
 {
+    if (m_terrainPrefetcher.IsActive())
+        m_terrainPrefetcher.Deactivate();
+
     for (MapMapType::iterator iter = i_maps.begin(); iter != i_maps.end();)
     {
         iter->second->UnloadAll();
@@ -22,6 +22,7 @@
 #include "Define.h"
 #include "Map.h"
 #include "MapInstanced.h"
+#include "GridTerrainPrefetcher.h"
 #include "MapUpdater.h"
 #include "Object.h"
 #include "Timer.h"
@@ -151,6 +152,7 @@ public:
     uint32 GenerateInstanceId();
 
     MapUpdater* GetMapUpdater() { return &m_updater; }
+    GridTerrainPrefetcher* GetTerrainPrefetcher() { return &m_terrainPrefetcher; }
 
     template<typename Worker>
     void DoForAllMaps(Worker&& worker);
@@ -176,6 +178,7 @@ private:
     InstanceIds _instanceIds;
     uint32 _nextInstanceId;
     MapUpdater m_updater;
+    GridTerrainPrefetcher m_terrainPrefetcher;
 };
 
 template<typename Worker>
@@ -22,94 +22,111 @@
 #include "Map.h"
 #include "MapMgr.h"
 #include "Metric.h"
+#include <algorithm>
+#include <chrono>
 
-class UpdateRequest
+namespace
 {
-public:
-    UpdateRequest() = default;
-    virtual ~UpdateRequest() = default;
-
-    virtual void call() = 0;
-};
+    // Identifies the MapUpdater worker running on the current thread, so tasks scheduled from inside
+    // a running task (MapInstanced scheduling its instances) go straight to the local queue.
+    thread_local MapUpdater const* t_owningUpdater = nullptr;
+    thread_local std::size_t t_workerIndex = 0;
+}
 
-class MapUpdateRequest : public UpdateRequest
+bool MapUpdater::WorkerQueue::PopFront(MapUpdateTask& task)
 {
-public:
-    MapUpdateRequest(Map& m, MapUpdater& u, uint32 d, uint32 sd)
-        : m_map(m), m_updater(u), m_diff(d), s_diff(sd)
-    {
-    }
+    std::lock_guard<std::mutex> guard(Lock);
+    if (Head >= Tasks.size())
+        return false;
 
-    void call() override
+    task = Tasks[Head++];
+    SubtractCost(task.Cost);
+    if (Head == Tasks.size())
     {
-        METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(m_map.GetId())));
-        m_map.Update(m_diff, s_diff);
-        m_updater.update_finished();
+        Tasks.clear(); // keeps capacity, no reallocation on the next tick
+        Head = 0;
     }
 
-private:
-    Map& m_map;
-    MapUpdater& m_updater;
-    uint32 m_diff;
-    uint32 s_diff;
-};
+    return true;
+}
 
-class MapPreloadRequest : public UpdateRequest
+bool MapUpdater::WorkerQueue::PopBack(MapUpdateTask& task)
 {
-public:
-    MapPreloadRequest(uint32 mapId, MapUpdater& updater)
-        : _mapId(mapId), _updater(updater)
-    {
-    }
+    std::lock_guard<std::mutex> guard(Lock);
+    if (Head >= Tasks.size())
+        return false;
 
-    void call() override
+    task = Tasks.back();
+    Tasks.pop_back();
+    SubtractCost(task.Cost);
+    if (Head == Tasks.size())
     {
-        Map* map = sMapMgr->CreateBaseMap(_mapId);
-        LOG_INFO("server.loading", ">> Loading All Grids For Map {} ({})", map->GetId(), map->GetMapName());
-        map->LoadAllGrids();
-        _updater.update_finished();
+        Tasks.clear();
+        Head = 0;
     }
 
-private:
-    uint32 _mapId;
-    MapUpdater& _updater;
-};
+    return true;
+}
+
+void MapUpdater::WorkerQueue::Push(MapUpdateTask const& task)
+{
+    std::lock_guard<std::mutex> guard(Lock);
+    Tasks.push_back(task);
+    QueuedCost.store(QueuedCost.load(std::memory_order_relaxed) + task.Cost, std::memory_order_relaxed);
+}
+
+void MapUpdater::WorkerQueue::SubtractCost(uint64 cost)
+{
+    uint64 queuedCost = QueuedCost.load(std::memory_order_relaxed);
+    QueuedCost.store(queuedCost - std::min(queuedCost, cost), std::memory_order_relaxed);
+}
 
-class LFGUpdateRequest : public UpdateRequest
+uint32 MapUpdater::WorkerQueue::RemoveJobTasks(MapUpdaterParallelJob const* job)
 {
-public:
-    LFGUpdateRequest(MapUpdater& u, uint32 d) : m_updater(u), m_diff(d) {}
+    std::lock_guard<std::mutex> guard(Lock);
+    for (std::size_t i = Head; i < Tasks.size(); ++i)
+        if (Tasks[i].Job == job)
+            SubtractCost(Tasks[i].Cost);
 
-    void call() override
+    auto itr = std::remove_if(Tasks.begin() + Head, Tasks.end(), [job](MapUpdateTask const& task) { return task.Job == job; });
+    uint32 removed = uint32(std::distance(itr, Tasks.end()));
+
+    Tasks.erase(itr, Tasks.end());
+    if (Head == Tasks.size())
     {
-        sLFGMgr->Update(m_diff, 1);
-        m_updater.update_finished();
+        Tasks.clear();
+        Head = 0;
     }
-private:
-    MapUpdater& m_updater;
-    uint32 m_diff;
-};
 
-MapUpdater::MapUpdater() : pending_requests(0), _cancelationToken(false)
+    return removed;
+}
+
+MapUpdater::MapUpdater() : pending_requests(0), _queuedTasks(0), _lfgUpdateCost(0), _cancelationToken(false)
 {
 }
 
 void MapUpdater::activate(std::size_t num_threads)
 {
+    _workerQueues.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i)
+        _workerQueues.push_back(std::make_unique<WorkerQueue>());
+
     _workerThreads.reserve(num_threads);
     for (std::size_t i = 0; i < num_threads; ++i)
     {
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this, i));
     }
 }
 
 void MapUpdater::deactivate()
 {
-    _cancelationToken = true;
-
     wait();  // This is where we wait for tasks to complete
 
-    _queue.Cancel();  // Cancel the queue to prevent further task processing
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _cancelationToken = true;
+    }
+    _workCondition.notify_all();
 
     // Join all worker threads
     for (auto& thread : _workerThreads)
@@ -119,10 +136,15 @@ void MapUpdater::deactivate()
             thread.join();
         }
     }
+
+    _workerThreads.clear();
+    _workerQueues.clear();
 }
 
 void MapUpdater::wait()
 {
+    dispatch_batch();
+
     std::unique_lock<std::mutex> guard(_lock);  // Guard lock for safe waiting
 
     // Wait until there are no pending requests
@@ -131,26 +153,170 @@ void MapUpdater::wait()
     });
 }
 
-void MapUpdater::schedule_task(UpdateRequest* request)
+void MapUpdater::schedule_task(MapUpdateTask const& task)
 {
     // Atomic increment for pending_requests
     pending_requests.fetch_add(1, std::memory_order_release);
-    _queue.Push(request);
+
+    // Scheduled by the world thread: hold it back until wait() so the whole tick can be ordered at once
+    if (t_owningUpdater != this)
+    {
+        _batch.push_back(task);
+        return;
+    }
+
+    // Scheduled from inside a running task, keep it local. Idle workers will steal it if needed.
+    _workerQueues[t_workerIndex]->Push(task);
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _queuedTasks.fetch_add(1, std::memory_order_release);
+    }
+    _workCondition.notify_one();
 }
 
 void MapUpdater::schedule_update(Map& map, uint32 diff, uint32 s_diff)
 {
-    schedule_task(new MapUpdateRequest(map, *this, diff, s_diff));
+    schedule_task({ MapUpdateTaskType::MapUpdate, &map, map.GetId(), diff, s_diff, map.GetUpdateCostEstimate(diff != 0), nullptr });
 }
 
 void MapUpdater::schedule_map_preload(uint32 mapid)
 {
-    schedule_task(new MapPreloadRequest(mapid, *this));
+    schedule_task({ MapUpdateTaskType::MapPreload, nullptr, mapid, 0, 0, 0, nullptr });
 }
 
 void MapUpdater::schedule_lfg_update(uint32 diff)
 {
-    schedule_task(new LFGUpdateRequest(*this, diff));
+    schedule_task({ MapUpdateTaskType::LFGUpdate, nullptr, 0, diff, 0, _lfgUpdateCost.load(std::memory_order_relaxed), nullptr });
+}
+
+void MapUpdater::run_parallel(uint32 count, void (*func)(void* context, uint32 index), void* context)
+{
+    if (t_owningUpdater != this || _workerQueues.size() < 2 || count < 2)
+    {
+        for (uint32 i = 0; i < count; ++i)
+            func(context, i);
+
+        return;
+    }
+
+    MapUpdaterParallelJob job;
+    job.Func = func;
+    job.Context = context;
+    job.Count = count;
+
+    // Helpers are not counted in pending_requests, the task calling us keeps the tick open until we return
+    uint32 helpers = uint32(std::min<std::size_t>(count, _workerQueues.size()) - 1);
+    job.OutstandingHelpers = helpers;
+
+    WorkerQueue& ownQueue = *_workerQueues[t_workerIndex];
+    for (uint32 i = 0; i < helpers; ++i)
+        ownQueue.Push({ MapUpdateTaskType::ParallelHelper, nullptr, 0, 0, 0, 0, &job });
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _queuedTasks.fetch_add(int(helpers), std::memory_order_release);
+    }
+    _workCondition.notify_all();
+
+    job.RunAll();
+
+    // Take back the helpers nobody picked up, then wait for the ones still running
+    if (uint32 reclaimed = ownQueue.RemoveJobTasks(&job))
+    {
+        _queuedTasks.fetch_sub(int(reclaimed), std::memory_order_acq_rel);
+        job.OutstandingHelpers.fetch_sub(reclaimed, std::memory_order_acq_rel);
+    }
+
+    while (job.OutstandingHelpers.load(std::memory_order_acquire))
+        std::this_thread::yield();
+}
+
+void MapUpdater::dispatch_batch()
+{
+    if (_batch.empty())
+        return;
+
+    // Longest-processing-time-first: hand out the most expensive tasks first, each one to the
+    // worker with the least queued work. The tick is then bounded by the slowest map, not by queue order.
+    std::stable_sort(_batch.begin(), _batch.end(), [](MapUpdateTask const& left, MapUpdateTask const& right)
+    {
+        return left.Cost > right.Cost;
+    });
+
+    for (MapUpdateTask const& task : _batch)
+    {
+        WorkerQueue* target = _workerQueues.front().get();
+        for (std::unique_ptr<WorkerQueue> const& queue : _workerQueues)
+            if (queue->QueuedCost.load(std::memory_order_relaxed) < target->QueuedCost.load(std::memory_order_relaxed))
+                target = queue.get();
+
+        target->Push(task);
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _queuedTasks.fetch_add(int(_batch.size()), std::memory_order_release);
+    }
+    _workCondition.notify_all();
+
+    _batch.clear();
+}
+
+bool MapUpdater::acquire_task(std::size_t workerIndex, MapUpdateTask& task)
+{
+    bool found = _workerQueues[workerIndex]->PopFront(task);
+
+    // Own queue drained, steal the cheapest remaining task from another worker
+    for (std::size_t i = 1; !found && i < _workerQueues.size(); ++i)
+        found = _workerQueues[(workerIndex + i) % _workerQueues.size()]->PopBack(task);
+
+    if (found)
+        _queuedTasks.fetch_sub(1, std::memory_order_acq_rel);
+
+    return found;
+}
+
+void MapUpdater::execute_task(MapUpdateTask const& task)
+{
+    auto const startTime = std::chrono::steady_clock::now();
+    auto elapsed = [startTime]()
+    {
+        return uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+    };
+
+    switch (task.Type)
+    {
+        case MapUpdateTaskType::MapUpdate:
+        {
+            {
+                METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(task.MapId)));
+                task.TargetMap->Update(task.Diff, task.SDiff);
+            }
+            task.TargetMap->RecordUpdateCost(task.Diff != 0, elapsed());
+            break;
+        }
+        case MapUpdateTaskType::MapPreload:
+        {
+            Map* map = sMapMgr->CreateBaseMap(task.MapId);
+            LOG_INFO("server.loading", ">> Loading All Grids For Map {} ({})", map->GetId(), map->GetMapName());
+            map->LoadAllGrids();
+            break;
+        }
+        case MapUpdateTaskType::LFGUpdate:
+        {
+            sLFGMgr->Update(task.Diff, 1);
+            _lfgUpdateCost.store((_lfgUpdateCost.load(std::memory_order_relaxed) * 7 + elapsed()) / 8, std::memory_order_relaxed);
+            break;
+        }
+        case MapUpdateTaskType::ParallelHelper:
+        {
+            task.Job->RunAll();
+            task.Job->OutstandingHelpers.fetch_sub(1, std::memory_order_release);
+            return; // part of a running task, not a pending request
+        }
+    }
+
+    update_finished();
 }
 
 bool MapUpdater::activated()
@@ -169,22 +335,27 @@ void MapUpdater::update_finished()
     }
 }
 
-void MapUpdater::WorkerThread()
+void MapUpdater::WorkerThread(std::size_t workerIndex)
 {
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
 
+    t_owningUpdater = this;
+    t_workerIndex = workerIndex;
+
     while (!_cancelationToken)
     {
-        UpdateRequest* request = nullptr;
-
-        _queue.WaitAndPop(request);  // Wait for and pop a request from the queue
-
-        if (!_cancelationToken && request)
+        MapUpdateTask task{};
+        if (acquire_task(workerIndex, task))
         {
-            request->call();  // Execute the request
-            delete request;  // Clean up after processing
+            execute_task(task);
+            continue;
         }
+
+        std::unique_lock<std::mutex> guard(_lock);
+        _workCondition.wait(guard, [this] {
+            return _queuedTasks.load(std::memory_order_acquire) > 0 || _cancelationToken;
+        });
     }
 }
@@ -19,13 +19,50 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Define.h"
-#include "PCQueue.h"
 #include <condition_variable>
 #include <thread>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 class Map;
-class UpdateRequest;
+
+enum class MapUpdateTaskType : uint8
+{
+    MapUpdate,
+    MapPreload,
+    LFGUpdate,
+    ParallelHelper
+};
+
+// Fork-join job shared by the caller and the helper tasks it queued, see MapUpdater::run_parallel
+struct MapUpdaterParallelJob
+{
+    void (*Func)(void* context, uint32 index);
+    void* Context;
+    uint32 Count;
+    std::atomic<uint32> Next{0};
+    std::atomic<uint32> OutstandingHelpers{0};
+
+    void RunAll()
+    {
+        for (uint32 index = Next.fetch_add(1, std::memory_order_relaxed); index < Count; index = Next.fetch_add(1, std::memory_order_relaxed))
+            Func(Context, index);
+    }
+};
+
+// Plain value task: queued by copy so scheduling a tick never touches the heap once the deques are warm
+struct MapUpdateTask
+{
+    MapUpdateTaskType Type;
+    Map* TargetMap;
+    uint32 MapId;
+    uint32 Diff;
+    uint32 SDiff;
+    uint32 Cost;    // estimated cost in microseconds, larger tasks are handed out first
+    MapUpdaterParallelJob* Job;
+};
 
 class MapUpdater
 {
@@ -33,10 +70,12 @@ public:
     MapUpdater();
     ~MapUpdater() = default;
 
-    void schedule_task(UpdateRequest* request);
     void schedule_update(Map& map, uint32 diff, uint32 s_diff);
     void schedule_map_preload(uint32 mapid);
     void schedule_lfg_update(uint32 diff);
+    // Runs func(context, 0..count-1) on the calling worker and any idle workers, returns once all are done.
+    // Called from outside a MapUpdater worker it simply runs serially.
+    void run_parallel(uint32 count, void (*func)(void* context, uint32 index), void* context);
     void wait();
     void activate(std::size_t num_threads);
     void deactivate();
@@ -44,13 +83,39 @@ public:
     void update_finished();
 
 private:
-    void WorkerThread();
-    ProducerConsumerQueue<UpdateRequest*> _queue;
+    // Per worker double ended queue. The owner pops from the front (most expensive task first),
+    // idle workers steal from the back (cheapest task) so a late heavy map is never stolen mid-run.
+    struct WorkerQueue
+    {
+        std::mutex Lock;
+        std::vector<MapUpdateTask> Tasks;
+        std::size_t Head = 0;
+        std::atomic<uint64> QueuedCost{0};      // written under Lock, read without it when dispatching
+
+        void SubtractCost(uint64 cost);
+
+        bool PopFront(MapUpdateTask& task);
+        bool PopBack(MapUpdateTask& task);
+        void Push(MapUpdateTask const& task);
+        uint32 RemoveJobTasks(MapUpdaterParallelJob const* job);
+    };
+
+    void schedule_task(MapUpdateTask const& task);
+    void dispatch_batch();
+    bool acquire_task(std::size_t workerIndex, MapUpdateTask& task);
+    void execute_task(MapUpdateTask const& task);
+    void WorkerThread(std::size_t workerIndex);
+
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::vector<MapUpdateTask> _batch;  // tasks scheduled by the world thread, dispatched in LPT order on wait()
     std::atomic<int> pending_requests;  // Use std::atomic for pending_requests to avoid lock contention
+    std::atomic<int> _queuedTasks;      // tasks sitting in a worker queue and not yet picked up
+    std::atomic<uint32> _lfgUpdateCost;  // moving average of the LFG update cost, in microseconds
     std::atomic<bool> _cancelationToken;  // Atomic flag for cancellation to avoid race conditions
     std::vector<std::thread> _workerThreads;
     std::mutex _lock; // Mutex and condition variable for synchronization
     std::condition_variable _condition;
+    std::condition_variable _workCondition;
 };
 
 #endif //_MAP_UPDATER_H_INCLUDED
@@ -51,6 +51,10 @@ public:
     static uint32 GetVisibilityNotifyDelay(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].visibilityNotifyDelay; }
     static uint32 GetAINotifyDelay(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].aiNotifyDelay; }
     static float GetReqMoveDistSq(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].requiredMoveDistanceSq; }
+
+    // incremental player updates only look at what the move changed, they keep the settings of the lowest load
+    static uint32 GetIncrementalVisibilityNotifyDelay(uint32 map_type) { return VisibilitySettings[0][map_type].visibilityNotifyDelay; }
+    static float GetIncrementalReqMoveDistSq(uint32 map_type) { return VisibilitySettings[0][map_type].requiredMoveDistanceSq; }
 protected:
     static uint8 visibilitySettingsIndex;
 };
@@ -130,7 +130,7 @@ void FleeingMovementGenerator<T>::SetTargetLocation(T* owner)
 
     if (!_path)
     {
-        _path = std::make_unique<PathGenerator>(owner);
+        _path = std::make_unique<PathGenerator>(owner, MMAP::NavMeshQueryType::Flee);
     }
     else
     {
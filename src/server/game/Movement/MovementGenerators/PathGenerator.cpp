@@ -123,18 +123,17 @@ namespace
 }
 
  ////////////////// PathGenerator //////////////////
-PathGenerator::PathGenerator(WorldObject const* owner) :
+PathGenerator::PathGenerator(WorldObject const* owner, MMAP::NavMeshQueryType queryType) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false), _forceDestination(false),
     _slopeCheck(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
     _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
-    _navMeshQuery(nullptr)
+    _navMeshQuery(nullptr), _queryType(queryType)
 {
     memset(_pathPolyRefs, 0, sizeof(_pathPolyRefs));
 
     //if (sDisableMgr->IsPathfindingEnabled(_sourceUnit->FindMap()))
     {
         _navMesh = _source->GetMap()->GetMapCollisionData().GetMMapData().GetNavMesh();
-        _navMeshQuery = _source->GetMap()->GetMapCollisionData().GetMMapData().GetNavMeshQuery();
     }
 
     CreateFilter();
@@ -167,6 +166,9 @@ bool PathGenerator::CalculatePath(float x, float y, float z, float destX, float
 
     _forceDestination = forceDest;
 
+    // queries are per thread, the path may be calculated on another thread than the previous one
+    _navMeshQuery = MMapData::GetNavMeshQuery(_navMesh, _queryType);
+
     // make sure navMesh works - we can run on map w/o mmap
     // check if the start and end point have a .mmtile loaded (can we pass via not loaded tile on the way?)
     Unit const* _sourceUnit = _source->ToUnit();
@@ -58,7 +58,7 @@ enum PathType
 class PathGenerator
 {
     public:
-        explicit PathGenerator(WorldObject const* owner);
+        explicit PathGenerator(WorldObject const* owner, MMAP::NavMeshQueryType queryType = MMAP::NavMeshQueryType::Default);
         ~PathGenerator();
 
         // Calculate the path from owner to given destination
@@ -146,7 +146,8 @@ class PathGenerator
 
         WorldObject const* const _source;       // the object that is moving
         dtNavMesh const* _navMesh;              // the nav mesh
-        dtNavMeshQuery const* _navMeshQuery;    // the nav mesh query used to find the path
+        dtNavMeshQuery const* _navMeshQuery;    // the calling thread's nav mesh query, refreshed on every CalculatePath
+        MMAP::NavMeshQueryType _queryType;      // selects the node budget of _navMeshQuery
 
         dtQueryFilterExt _filter;  // use single filter for all movements, update it when needed
 
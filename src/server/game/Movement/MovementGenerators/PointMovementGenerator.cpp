@@ -56,7 +56,7 @@ void PointMovementGenerator<T>::DoInitialize(T* unit)
         init.MovebyPath(m_precomputedPath);
     else if (_generatePath)
     {
-        PathGenerator path(unit);
+        PathGenerator path(unit, MMAP::NavMeshQueryType::PointMove);
         bool result = path.CalculatePath(i_x, i_y, i_z, _forceDestination);
         if (result && !(path.GetPathType() & PATHFIND_NOPATH) && path.GetPath().size() > 2)
         {
@@ -149,7 +149,7 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
         else // ground
         {
             if (!_pathGenerator)
-                _pathGenerator = std::make_unique<PathGenerator>(creature);
+                _pathGenerator = std::make_unique<PathGenerator>(creature, MMAP::NavMeshQueryType::Roam);
             else
                 _pathGenerator->Clear();
 
@@ -82,7 +82,7 @@ void ChaseMovementGenerator<T>::DistanceYourself(T* owner, float distance)
 {
     // make a new path if we have to...
     if (!i_path)
-        i_path = std::make_unique<PathGenerator>(owner);
+        i_path = std::make_unique<PathGenerator>(owner, MMAP::NavMeshQueryType::Chase);
 
     float x, y, z;
     GetTarget()->GetNearPoint(owner, x, y, z, owner->GetBoundaryRadius(), distance, GetTarget()->GetAngle(owner));
@@ -325,7 +325,7 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
 
             // make a new path if we have to...
             if (!i_path || moveToward != _movingTowards)
-                i_path = std::make_unique<PathGenerator>(owner);
+                i_path = std::make_unique<PathGenerator>(owner, MMAP::NavMeshQueryType::Chase);
             else
                 i_path->Clear();
 
@@ -662,7 +662,7 @@ bool FollowMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
         }
 
         if (!i_path)
-            i_path = std::make_unique<PathGenerator>(owner);
+            i_path = std::make_unique<PathGenerator>(owner, MMAP::NavMeshQueryType::Chase);
         else
             i_path->Clear();
 
@@ -227,6 +227,7 @@ void WaypointMovementGenerator<Creature>::StartMove(Creature* creature, bool rel
     bool const useTransportPath = creature->HasUnitMovementFlag(MOVEMENTFLAG_ONTRANSPORT) && creature->GetTransGUID();
 
     Movement::MoveSplineInit init(creature);
+    init.SetPathQueryType(MMAP::NavMeshQueryType::Waypoint);
     //! If the creature is on transport, we assume waypoints set in DB are already transport offsets
     if (useTransportPath)
         init.DisableTransportPathTransformations();
@@ -170,7 +170,7 @@ namespace Movement
         unit->SendMessageToSet(&data, true);
     }
 
-    MoveSplineInit::MoveSplineInit(Unit* m) : unit(m)
+    MoveSplineInit::MoveSplineInit(Unit* m) : unit(m), pathQueryType(MMAP::NavMeshQueryType::PointMove)
     {
         args.splineId = splineIdGen.NewId();
         args.TransformForTransport = unit->HasUnitMovementFlag(MOVEMENTFLAG_ONTRANSPORT) && unit->GetTransGUID();
@@ -203,7 +203,7 @@ namespace Movement
     {
         if (generatePath)
         {
-            PathGenerator path(unit);
+            PathGenerator path(unit, pathQueryType);
             bool result = path.CalculatePath(start.x, start.y, start.z, dest.x, dest.y, dest.z, forceDestination);
             if (result && !(path.GetPathType() & PATHFIND_NOPATH))
             {
@@ -222,7 +222,7 @@ namespace Movement
     {
         if (generatePath)
         {
-            PathGenerator path(unit);
+            PathGenerator path(unit, pathQueryType);
             bool result = path.CalculatePath(dest.x, dest.y, dest.z, forceDestination);
             if (result && !(path.GetPathType() & PATHFIND_NOPATH))
             {
@@ -108,6 +108,11 @@ namespace Movement
          */
         void SetFirstPointId(int32 pointId) { args.path_Idx_offset = pointId; }
 
+        /* Selects the pathfinding query (and its node budget) used by MoveTo when a path is generated.
+         * PointMove by default
+         */
+        void SetPathQueryType(MMAP::NavMeshQueryType queryType) { pathQueryType = queryType; }
+
         /* Enables CatmullRom spline interpolation mode(makes path smooth)
          * if not enabled linear spline mode will be choosen. Disabled by default
          */
@@ -152,6 +157,7 @@ namespace Movement
     protected:
         MoveSplineInitArgs args;
         Unit*  unit;
+        MMAP::NavMeshQueryType pathQueryType;
     };
 
     inline void MoveSplineInit::SetFly() { args.flags.EnableFlying(); }
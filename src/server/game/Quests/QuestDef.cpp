@@ -17,6 +17,7 @@
 
 #include "QuestDef.h"
 #include "Formulas.h"
+#include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "Player.h"
 #include "World.h"
@@ -325,9 +326,31 @@ uint32 Quest::CalculateHonorGain(uint8 level) const
     return honor;
 }
 
-void Quest::InitializeQueryData()
+WorldPacket Quest::BuildQueryData(LocaleConstant locale) const
 {
-    queryData.Initialize(SMSG_QUEST_QUERY_RESPONSE, 1);
+    std::string questTitle           = GetTitle();
+    std::string questDetails         = GetDetails();
+    std::string questObjectives      = GetObjectives();
+    std::string questAreaDescription = GetAreaDescription();
+    std::string questCompletedText   = GetCompletedText();
+
+    std::string questObjectiveText[QUEST_OBJECTIVES_COUNT];
+    for (uint32 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
+        questObjectiveText[i] = ObjectiveText[i];
+
+    if (QuestLocale const* localeData = sObjectMgr->GetQuestLocale(GetQuestId()))
+    {
+        ObjectMgr::GetLocaleString(localeData->Title, locale, questTitle);
+        ObjectMgr::GetLocaleString(localeData->Details, locale, questDetails);
+        ObjectMgr::GetLocaleString(localeData->Objectives, locale, questObjectives);
+        ObjectMgr::GetLocaleString(localeData->AreaDescription, locale, questAreaDescription);
+        ObjectMgr::GetLocaleString(localeData->CompletedText, locale, questCompletedText);
+
+        for (uint32 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
+            ObjectMgr::GetLocaleString(localeData->ObjectiveText[i], locale, questObjectiveText[i]);
+    }
+
+    WorldPacket queryData(SMSG_QUEST_QUERY_RESPONSE, 100);
 
     queryData << uint32(GetQuestId());                    // quest id
     queryData << uint32(GetQuestMethod());                // Accepted values: 0, 1 or 2. 0 == IsAutoComplete() (skip objectives/details)
@@ -350,7 +373,7 @@ void Quest::InitializeQueryData()
     if (HasFlag(QUEST_FLAGS_HIDDEN_REWARDS))
         queryData << uint32(0);                           // Hide money rewarded
     else
-        queryData << int32(GetRewOrReqMoney());           // reward money (below max lvl)
+        queryData << int32(GetRewOrReqMoney());           // reward money (below max lvl), patched per player at QUERY_DATA_MONEY_OFFSET
 
     queryData << uint32(GetRewMoneyMaxLevel());           // used in XP calculation at client
     queryData << uint32(GetRewSpell());                   // reward spell, this spell will display (icon) (casted if RewSpellCast == 0)
@@ -402,11 +425,11 @@ void Quest::InitializeQueryData()
     queryData << GetPOIy();
     queryData << GetPointOpt();
 
-    queryData << GetTitle();
-    queryData << GetObjectives();
-    queryData << GetDetails();
-    queryData << GetAreaDescription();
-    queryData << GetCompletedText();                                  // display in quest objectives window once all objectives are completed
+    queryData << questTitle;
+    queryData << questObjectives;
+    queryData << questDetails;
+    queryData << questAreaDescription;
+    queryData << questCompletedText;                                  // display in quest objectives window once all objectives are completed
 
     for (uint32 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
     {
@@ -427,5 +450,7 @@ void Quest::InitializeQueryData()
     }
 
     for (uint32 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
-        queryData << ObjectiveText[i];
+        queryData << questObjectiveText[i];
+
+    return queryData;
 }
@@ -18,6 +18,7 @@
 #ifndef AZEROTHCORE_QUEST_H
 #define AZEROTHCORE_QUEST_H
 
+#include "Common.h"
 #include "DBCEnums.h"
 #include "DatabaseEnv.h"
 #include "Define.h"
@@ -326,8 +327,9 @@ public:
     typedef std::vector<uint32> PrevChainQuests;
     PrevChainQuests prevChainQuests;
 
-    WorldPacket queryData; // pussywizard
-    void InitializeQueryData(); // pussywizard
+    // SMSG_QUEST_QUERY_RESPONSE for the given locale, the reward money is the level independent value
+    static constexpr std::size_t QUERY_DATA_MONEY_OFFSET = 13 * sizeof(uint32);
+    [[nodiscard]] WorldPacket BuildQueryData(LocaleConstant locale) const;
 
     void SetEventIdForQuest(uint16 eventId) { _eventIdForQuest = eventId; }
     [[nodiscard]] uint16 GetEventIdForQuest() const { return _eventIdForQuest; }
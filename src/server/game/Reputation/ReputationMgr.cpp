@@ -440,6 +440,7 @@ bool ReputationMgr::SetOneFactionReputation(FactionEntry const* factionEntry, fl
 
             if (new_rank != old_rank)
             {
+                _player->GetConditionCache().Invalidate();
                 sScriptMgr->OnPlayerReputationRankChange(_player, factionEntry->ID, new_rank, old_rank, _sendFactionIncreased);
             }
 
@@ -631,12 +632,7 @@ void ReputationMgr::SaveToDB(CharacterDatabaseTransaction trans)
     {
         if (itr->second.needSave)
         {
-            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_REPUTATION_BY_FACTION);
-            stmt->SetData(0, _player->GetGUID().GetCounter());
-            stmt->SetData(1, uint16(itr->second.ID));
-            trans->Append(stmt);
-
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_REPUTATION_BY_FACTION);
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_REPUTATION_BY_FACTION);
             stmt->SetData(0, _player->GetGUID().GetCounter());
             stmt->SetData(1, uint16(itr->second.ID));
             stmt->SetData(2, itr->second.Standing);
@@ -0,0 +1,195 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldPacketPool.h"
+#include "Metric.h"
+#include <mutex>
+
+namespace
+{
+    // Packets kept per pool; anything released beyond that is freed
+    constexpr std::size_t MaxPooledPackets = 4096;
+    // Storage above this is released instead of being kept for the next packet (see ByteBuffer::append growth steps)
+    constexpr std::size_t MaxRetainedCapacity = 10000;
+
+    struct PoolRegistry
+    {
+        std::mutex Lock;
+        std::vector<std::unique_ptr<WorldPacketPool>> Pools;
+    };
+
+    PoolRegistry& GetRegistry()
+    {
+        // Pools live until shutdown so packets can still be released after their network thread stopped
+        static PoolRegistry registry;
+        return registry;
+    }
+
+    thread_local WorldPacketPool* CurrentThreadPool = nullptr;
+}
+
+class PooledWorldPacket : public WorldPacket
+{
+public:
+    explicit PooledWorldPacket(WorldPacketPool* owner) : Owner(owner), Next(nullptr) { }
+
+    void Assign(uint16 opcode, uint8 const* data, std::size_t size, TimePoint receivedTime)
+    {
+        clear();
+        m_opcode = opcode;
+        m_receivedTime = receivedTime;
+        if (size)
+            append(data, size);
+    }
+
+    void Recycle()
+    {
+        clear();
+        if (_storage.capacity() > MaxRetainedCapacity)
+            _storage.shrink_to_fit();
+    }
+
+    WorldPacketPool* const Owner;
+    PooledWorldPacket* Next;
+};
+
+WorldPacketPool::WorldPacketPool(uint32 id) : _id(id), _returned(nullptr),
+    _acquired(0), _allocated(0), _remoteReleased(0), _pooled(0)
+{
+    _free.reserve(MaxPooledPackets);
+}
+
+WorldPacketPool::~WorldPacketPool()
+{
+    DrainReturned();
+    for (PooledWorldPacket* packet : _free)
+        delete packet;
+}
+
+WorldPacketPool& WorldPacketPool::ForCurrentThread()
+{
+    if (!CurrentThreadPool)
+    {
+        PoolRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> guard(registry.Lock);
+        registry.Pools.emplace_back(new WorldPacketPool(uint32(registry.Pools.size())));
+        CurrentThreadPool = registry.Pools.back().get();
+    }
+
+    return *CurrentThreadPool;
+}
+
+WorldPacketPool::Ptr WorldPacketPool::Acquire(uint16 opcode, uint8 const* data, std::size_t size, TimePoint receivedTime /*= TimePoint()*/)
+{
+    PooledWorldPacket* packet = Pop();
+    if (!packet)
+    {
+        DrainReturned();
+        packet = Pop();
+    }
+
+    if (!packet)
+    {
+        packet = new PooledWorldPacket(this);
+        _allocated.store(_allocated.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    _acquired.store(_acquired.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    packet->Assign(opcode, data, size, receivedTime);
+    return Ptr(packet);
+}
+
+void WorldPacketPool::Release(WorldPacket* packet)
+{
+    if (!packet)
+        return;
+
+    PooledWorldPacket* pooled = static_cast<PooledWorldPacket*>(packet);
+    pooled->Recycle();
+
+    WorldPacketPool* owner = pooled->Owner;
+    if (owner == CurrentThreadPool)
+    {
+        owner->Push(pooled);
+        return;
+    }
+
+    pooled->Next = owner->_returned.load(std::memory_order_relaxed);
+    while (!owner->_returned.compare_exchange_weak(pooled->Next, pooled, std::memory_order_release, std::memory_order_relaxed));
+
+    owner->_remoteReleased.fetch_add(1, std::memory_order_relaxed);
+}
+
+PooledWorldPacket* WorldPacketPool::Pop()
+{
+    if (_free.empty())
+        return nullptr;
+
+    PooledWorldPacket* packet = _free.back();
+    _free.pop_back();
+    _pooled.store(_free.size(), std::memory_order_relaxed);
+    return packet;
+}
+
+void WorldPacketPool::Push(PooledWorldPacket* packet)
+{
+    if (_free.size() >= MaxPooledPackets)
+    {
+        delete packet;
+        return;
+    }
+
+    _free.push_back(packet);
+    _pooled.store(_free.size(), std::memory_order_relaxed);
+}
+
+void WorldPacketPool::DrainReturned()
+{
+    PooledWorldPacket* packet = _returned.exchange(nullptr, std::memory_order_acquire);
+    while (packet)
+    {
+        PooledWorldPacket* next = packet->Next;
+        Push(packet);
+        packet = next;
+    }
+}
+
+WorldPacketPool::Statistics WorldPacketPool::GetStatistics() const
+{
+    Statistics stats;
+    stats.Acquired = _acquired.load(std::memory_order_relaxed);
+    stats.Allocated = _allocated.load(std::memory_order_relaxed);
+    stats.RemoteReleased = _remoteReleased.load(std::memory_order_relaxed);
+    stats.Pooled = _pooled.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void WorldPacketPool::LogMetrics()
+{
+    PoolRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> guard(registry.Lock);
+    for (std::unique_ptr<WorldPacketPool> const& pool : registry.Pools)
+    {
+        Statistics stats = pool->GetStatistics();
+        std::string poolId = std::to_string(pool->_id);
+        METRIC_VALUE("packet_pool_acquired", stats.Acquired, METRIC_TAG("pool", poolId));
+        METRIC_VALUE("packet_pool_allocated", stats.Allocated, METRIC_TAG("pool", poolId));
+        METRIC_VALUE("packet_pool_remote_released", stats.RemoteReleased, METRIC_TAG("pool", poolId));
+        METRIC_VALUE("packet_pool_pooled", stats.Pooled, METRIC_TAG("pool", poolId));
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WORLDPACKETPOOL_H_
+#define _WORLDPACKETPOOL_H_
+
+#include "WorldPacket.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+class PooledWorldPacket;
+
+/**
+ * Recycles the WorldPacket objects (and their storage) of received client packets.
+ *
+ * Every network thread owns one pool and acquires packets from it without locking.
+ * Packets are released by whichever thread processed them (world or map threads);
+ * releases from other threads go through a lock-free return stack that the owner
+ * drains once its local free list is empty.
+ */
+class WorldPacketPool
+{
+public:
+    struct Deleter
+    {
+        void operator()(WorldPacket* packet) const { WorldPacketPool::Release(packet); }
+    };
+
+    using Ptr = std::unique_ptr<WorldPacket, Deleter>;
+
+    WorldPacketPool(WorldPacketPool const&) = delete;
+    WorldPacketPool& operator=(WorldPacketPool const&) = delete;
+
+    /// Pool owned by the calling thread
+    static WorldPacketPool& ForCurrentThread();
+
+    /// Returns a packet holding a copy of @p size bytes from @p data
+    Ptr Acquire(uint16 opcode, uint8 const* data, std::size_t size, TimePoint receivedTime = TimePoint());
+
+    /// Gives back a packet obtained from Acquire(), from any thread
+    static void Release(WorldPacket* packet);
+
+    /// Reports allocation statistics of all pools as metrics
+    static void LogMetrics();
+
+    struct Statistics
+    {
+        uint64 Acquired = 0;        // total packets handed out
+        uint64 Allocated = 0;       // packets that had to be created because nothing was free
+        uint64 RemoteReleased = 0;  // packets given back by other threads
+        uint64 Pooled = 0;          // packets currently kept for reuse by the owner
+    };
+
+    [[nodiscard]] Statistics GetStatistics() const;
+
+    ~WorldPacketPool();
+
+private:
+    WorldPacketPool(uint32 id);
+
+    PooledWorldPacket* Pop();
+    void Push(PooledWorldPacket* packet);
+    void DrainReturned();
+
+    uint32 const _id;
+    std::vector<PooledWorldPacket*> _free;
+    std::atomic<PooledWorldPacket*> _returned;
+
+    std::atomic<uint64> _acquired;
+    std::atomic<uint64> _allocated;
+    std::atomic<uint64> _remoteReleased;
+    std::atomic<uint64> _pooled;
+};
+
+#endif
@@ -54,6 +54,7 @@
 #include "World.h"
 #include "WorldGlobals.h"
 #include "WorldPacket.h"
+#include "WorldPacketPool.h"
 #include "WorldSocket.h"
 #include "WorldState.h"
 #include <zlib.h>
@@ -183,7 +184,7 @@ WorldSession::~WorldSession()
     ///- empty incoming packet queue
     WorldPacket* packet = nullptr;
     while (_recvQueue.next(packet))
-        delete packet;
+        WorldPacketPool::Release(packet);
 
     LoginDatabase.Execute("UPDATE account SET online = 0 WHERE id = {};", GetAccountId());     // One-time query
 }
@@ -199,7 +200,7 @@ void WorldSession::UpdateAccountFlag(uint32 flag, bool remove /*= flase*/)
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_SET_ACCOUNT_FLAG);
     stmt->SetData(0, _accountFlags);
     stmt->SetData(1, GetAccountId());
-    LoginDatabase.Execute(stmt);
+    LoginDatabase.Execute(stmt, GetAccountId());
 }
 
 void WorldSession::ValidateAccountFlags()
@@ -299,13 +300,10 @@ ObjectGuid::LowType WorldSession::GetGuidLow() const
     return GetPlayer() ? GetPlayer()->GetGUID().GetCounter() : 0;
 }
 
-/// Send a packet to the client
-void WorldSession::SendPacket(WorldPacket const* packet)
-{
-    if (!m_Socket)
-        return;
-
 #if defined(ACORE_DEBUG)
+/// Network use statistic of both send paths
+static void CountSentPacket(WorldPacket const& packet)
+{
     // Code for network use statistic
     static uint64 sendPacketCount = 0;
     static uint64 sendPacketBytes = 0;
@@ -321,10 +319,10 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     if ((cur_time - lastTime) < 60)
     {
         sendPacketCount += 1;
-        sendPacketBytes += packet->size();
+        sendPacketBytes += packet.size();
 
         sendLastPacketCount += 1;
-        sendLastPacketBytes += packet->size();
+        sendLastPacketBytes += packet.size();
     }
     else
     {
@@ -337,10 +335,21 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 
         lastTime = cur_time;
         sendLastPacketCount = 1;
-        sendLastPacketBytes = packet->wpos();               // wpos is real written size
+        sendLastPacketBytes = packet.wpos();                // wpos is real written size
     }
+}
 #endif                                                      // !ACORE_DEBUG
 
+/// Send a packet to the client
+void WorldSession::SendPacket(WorldPacket const* packet)
+{
+    if (!m_Socket)
+        return;
+
+#if defined(ACORE_DEBUG)
+    CountSentPacket(*packet);
+#endif
+
     if (!sScriptMgr->CanPacketSend(this, *packet))
     {
         return;
@@ -349,6 +358,22 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     m_Socket->SendPacket(*packet);
 }
 
+/// Send a packet whose payload is shared with other sessions, the socket queues it without copying
+void WorldSession::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (!m_Socket)
+        return;
+
+#if defined(ACORE_DEBUG)
+    CountSentPacket(*packet);
+#endif
+
+    if (!sScriptMgr->CanPacketSend(this, *packet))
+        return;
+
+    m_Socket->SendPacket(packet);
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
@@ -548,7 +573,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         }
 
         if (deletePacket)
-            delete packet;
+            WorldPacketPool::Release(packet);
 
         deletePacket = true;
 
@@ -736,7 +761,7 @@ void WorldSession::LogoutPlayer(bool save, bool redirecting)
                         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_DESERTER_TRACK);
                         stmt->SetData(0, _player->GetGUID().GetCounter());
                         stmt->SetData(1, BG_DESERTION_TYPE_INVITE_LOGOUT);
-                        CharacterDatabase.Execute(stmt);
+                        CharacterDatabase.Execute(stmt, GetAccountId());
                     }
 
                     sScriptMgr->OnPlayerBattlegroundDesertion(_player, BG_DESERTION_TYPE_INVITE_LOGOUT);
@@ -856,7 +881,7 @@ void WorldSession::LogoutPlayer(bool save, bool redirecting)
         {
             CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ACCOUNT_ONLINE);
             stmt->SetData(0, GetAccountId());
-            CharacterDatabase.Execute(stmt);
+            CharacterDatabase.Execute(stmt, GetAccountId());
         }
     }
 
@@ -1015,7 +1040,7 @@ void WorldSession::SetAccountData(AccountDataType type, time_t tm, std::string c
     stmt->SetData(1, type);
     stmt->SetData(2, uint32(tm));
     stmt->SetData(3, data);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, GetAccountId());
 
     m_accountData[type].Time = tm;
     m_accountData[type].Data = data;
@@ -1562,7 +1587,7 @@ void WorldSession::InitializeSession()
         return;
     }
 
-    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(realmHolder)).AfterComplete([this, cacheVersion](SQLQueryHolderBase const& holder)
+    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(realmHolder, GetAccountId())).AfterComplete([this, cacheVersion](SQLQueryHolderBase const& holder)
     {
         InitializeSessionCallback(static_cast<AccountInfoQueryHolderPerRealm const&>(holder), cacheVersion);
     });
@@ -1614,7 +1639,7 @@ void WorldSession::HandleTC9PrepareForRedirect(WorldPacket& /*recvData*/)
 
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     player->SaveToDB(trans, false, true);
-    AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(trans)).AfterComplete([this](bool success)
+    AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(trans, GetAccountId())).AfterComplete([this](bool success)
     {
         WorldPacket data(TC9_SMSG_READY_FOR_REDIRECT, 1);
         data << uint8(!success); // 0 - Success, 1 - Failed.
@@ -1623,6 +1648,8 @@ void WorldSession::HandleTC9PrepareForRedirect(WorldPacket& /*recvData*/)
         if (!success)
         {
             LOG_ERROR("network", "Failed to save player, AccountId = {}", GetAccountId());
+            if (Player* player = GetPlayer())
+                player->InvalidateSaveSnapshot();
             return;
         }
 
@@ -440,6 +440,7 @@ public:
     bool ProcessMovementInfo(MovementInfo& movementInfo, Unit* mover, Player* plrMover, WorldPacket& recvData);
 
     void SendPacket(WorldPacket const* packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
     void SendPartyResult(PartyOperation operation, std::string const& member, PartyResult res, uint32 val = 0);
 
@@ -535,6 +536,7 @@ public:
     // May kick player on false depending on world config (handler should abort)
     bool DisallowHyperlinksAndMaybeKick(std::string_view str);
 
+    /// Takes a packet acquired from WorldPacketPool, it is released back to the pool after processing
     void QueuePacket(WorldPacket* new_packet);
     bool Update(uint32 diff, PacketFilter& updater);
 
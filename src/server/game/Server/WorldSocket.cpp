@@ -30,70 +30,186 @@
 #include "Realm.h"
 #include "ScriptMgr.h"
 #include "World.h"
+#include "WorldPacketPool.h"
 #include "WorldSession.h"
 #include "WorldSessionMgr.h"
 #include "RBAC.h"
 #include "zlib.h"
+#include <chrono>
 #include <memory>
+#include <vector>
+
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <ctime>
+#endif
 
 #include "ServerPktHeader.h"
 
 using boost::asio::ip::tcp;
 
-void compressBuff(void* dst, uint32* dst_size, void* src, int src_size)
-{
-    z_stream c_stream;
-
-    c_stream.zalloc = (alloc_func)0;
-    c_stream.zfree = (free_func)0;
-    c_stream.opaque = (voidpf)0;
+// payloads up to this size are copied into the coalescing send buffer, bigger ones are written by reference
+#define SEND_COPY_THRESHOLD 256
 
-    // default Z_BEST_SPEED (1)
-    int z_res = deflateInit(&c_stream, sWorld->getIntConfig(CONFIG_COMPRESSION));
-    if (z_res != Z_OK)
+namespace
+{
+    // CPU time used so far by the calling thread
+    std::chrono::nanoseconds GetThreadCpuTime()
     {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+        FILETIME creationTime, exitTime, kernelTime, userTime;
+        if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+            return {};
+
+        // 100 ns units
+        uint64 kernel = (uint64(kernelTime.dwHighDateTime) << 32) | kernelTime.dwLowDateTime;
+        uint64 user = (uint64(userTime.dwHighDateTime) << 32) | userTime.dwLowDateTime;
+        return std::chrono::nanoseconds((kernel + user) * 100);
+#else
+        timespec cpuTime;
+        if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime) != 0)
+            return {};
+
+        return std::chrono::seconds(cpuTime.tv_sec) + std::chrono::nanoseconds(cpuTime.tv_nsec);
+#endif
     }
 
-    c_stream.next_out = (Bytef*)dst;
-    c_stream.avail_out = *dst_size;
-    c_stream.next_in = (Bytef*)src;
-    c_stream.avail_in = (uInt)src_size;
-
-    z_res = deflate(&c_stream, Z_NO_FLUSH);
-    if (z_res != Z_OK)
+    // Reusable deflate context, one per network thread. Every SMSG_COMPRESSED_UPDATE_OBJECT must be a
+    // complete zlib stream on its own, so the stream is reset between packets instead of being
+    // initialized and torn down for each of them.
+    class UpdatePacketCompressor
     {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
+    public:
+        UpdatePacketCompressor()
+        {
+            _stream.zalloc = (alloc_func)0;
+            _stream.zfree = (free_func)0;
+            _stream.opaque = (voidpf)0;
+        }
 
-    if (c_stream.avail_in != 0)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate not greedy)");
-        *dst_size = 0;
-        return;
-    }
+        ~UpdatePacketCompressor()
+        {
+            if (_initialized)
+                deflateEnd(&_stream);
+        }
 
-    z_res = deflate(&c_stream, Z_FINISH);
-    if (z_res != Z_STREAM_END)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate should report Z_STREAM_END instead {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
+        UpdatePacketCompressor(UpdatePacketCompressor const&) = delete;
+        UpdatePacketCompressor& operator=(UpdatePacketCompressor const&) = delete;
 
-    z_res = deflateEnd(&c_stream);
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateEnd) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
+        // Compresses src into the internal scratch buffer, returns the compressed size or 0 on failure
+        uint32 Compress(uint8 const* src, uint32 srcSize)
+        {
+            if (!Prepare())
+                return 0;
+
+            uint32 bound = deflateBound(&_stream, srcSize);
+            if (_scratch.size() < bound)
+                _scratch.resize(bound);
+
+            _stream.next_out = _scratch.data();
+            _stream.avail_out = uInt(_scratch.size());
+            _stream.next_in = const_cast<Bytef*>(src);
+            _stream.avail_in = uInt(srcSize);
+
+            int z_res = deflate(&_stream, Z_FINISH);
+
+            if (z_res != Z_STREAM_END)
+            {
+                LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate should report Z_STREAM_END instead {} ({})", z_res, zError(z_res));
+                deflateEnd(&_stream);
+                _initialized = false;
+                return 0;
+            }
+
+            return uint32(_stream.total_out);
+        }
+
+        uint8 const* GetData() const { return _scratch.data(); }
+
+    private:
+        bool Prepare()
+        {
+            int level = GetLevel();
+
+            if (!_initialized)
+            {
+                int z_res = deflateInit(&_stream, level);
+                if (z_res != Z_OK)
+                {
+                    LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
+                    return false;
+                }
+
+                _initialized = true;
+                _level = level;
+                return true;
+            }
+
+            int z_res = deflateReset(&_stream);
+            if (z_res == Z_OK && level != _level)
+            {
+                z_res = deflateParams(&_stream, level, Z_DEFAULT_STRATEGY);
+                _level = level;
+            }
+
+            if (z_res != Z_OK)
+            {
+                LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateReset) Error code: {} ({})", z_res, zError(z_res));
+                deflateEnd(&_stream);
+                _initialized = false;
+                return false;
+            }
+
+            return true;
+        }
+
+        // Configured level, or with Compression.AutoTune the level adjusted every second from the CPU time
+        // this network thread used against the wall time: drop towards 1 above the CPU budget, climb back
+        // towards the configured level when the thread has headroom again.
+        int GetLevel()
+        {
+            int maxLevel = int(sWorld->getIntConfig(CONFIG_COMPRESSION));
+            if (!sWorld->getBoolConfig(CONFIG_COMPRESSION_AUTOTUNE))
+                return maxLevel;
+
+            if (!_tunedLevel)
+                _tunedLevel = maxLevel;
+
+            auto const now = std::chrono::steady_clock::now();
+            if (now - _windowStart >= std::chrono::seconds(1))
+            {
+                std::chrono::nanoseconds const cpuTime = GetThreadCpuTime();
+                double cpuShare = std::chrono::duration<double>(cpuTime - _windowCpuTime).count() / std::chrono::duration<double>(now - _windowStart).count();
+                double budget = sWorld->getIntConfig(CONFIG_COMPRESSION_AUTOTUNE_CPU_BUDGET) / 100.0;
 
-    *dst_size = c_stream.total_out;
+                if (cpuShare > budget && _tunedLevel > 1)
+                    --_tunedLevel;
+                else if (cpuShare < budget / 2 && _tunedLevel < maxLevel)
+                    ++_tunedLevel;
+
+                _windowStart = now;
+                _windowCpuTime = cpuTime;
+            }
+
+            return std::min(_tunedLevel, maxLevel);
+        }
+
+        z_stream _stream{};
+        bool _initialized = false;
+        int _level = 0;
+        int _tunedLevel = 0;
+        std::vector<uint8> _scratch;
+        std::chrono::steady_clock::time_point _windowStart = std::chrono::steady_clock::now();
+        std::chrono::nanoseconds _windowCpuTime = GetThreadCpuTime();
+    };
+
+    thread_local UpdatePacketCompressor updatePacketCompressor;
+}
+
+bool EncryptableAndCompressiblePacket::NeedsCompression() const
+{
+    return _payload->GetOpcode() == SMSG_UPDATE_OBJECT && _payload->size() > sWorld->getIntConfig(CONFIG_COMPRESSION_THRESHOLD);
 }
 
 void EncryptableAndCompressiblePacket::CompressIfNeeded()
@@ -101,21 +217,26 @@ void EncryptableAndCompressiblePacket::CompressIfNeeded()
     if (!NeedsCompression())
         return;
 
-    uint32 pSize = size();
-
-    uint32 destsize = compressBound(pSize);
-    ByteBuffer buf(destsize + sizeof(uint32));
-    buf.resize(destsize + sizeof(uint32));
+    uint32 pSize = _payload->size();
+    uint32 compressedSize = updatePacketCompressor.Compress(_payload->contents(), pSize);
 
-    buf.put<uint32>(0, pSize);
-    compressBuff(const_cast<uint8*>(buf.contents()) + sizeof(uint32), &destsize, (void*)contents(), pSize);
-    if (destsize == 0)
+    // not worth it, the client accepts the plain SMSG_UPDATE_OBJECT as well
+    if (compressedSize == 0 || compressedSize + sizeof(uint32) >= pSize)
         return;
 
-    buf.resize(destsize + sizeof(uint32));
+    // a payload shared with other sockets is never modified, compress into a private one instead
+    if (!_exclusivePayload)
+    {
+        std::shared_ptr<WorldPacket> payload = std::make_shared<WorldPacket>(SMSG_COMPRESSED_UPDATE_OBJECT, compressedSize + sizeof(uint32));
+        _exclusivePayload = payload.get();
+        _payload = std::move(payload);
+    }
 
-    ByteBuffer::operator=(std::move(buf));
-    SetOpcode(SMSG_COMPRESSED_UPDATE_OBJECT);
+    // rewrite in place, the packet storage already has the capacity
+    _exclusivePayload->resize(compressedSize + sizeof(uint32));
+    _exclusivePayload->put<uint32>(0, pSize);
+    _exclusivePayload->put(sizeof(uint32), updatePacketCompressor.GetData(), compressedSize);
+    _exclusivePayload->SetOpcode(SMSG_COMPRESSED_UPDATE_OBJECT);
 }
 
 WorldSocket::WorldSocket(IoContextTcpSocket&& socket)
@@ -168,42 +289,41 @@ bool WorldSocket::Update()
     EncryptableAndCompressiblePacket* queued;
     if (_bufferQueue.Dequeue(queued))
     {
-        // Allocate buffer only when it's needed but not on every Update() call.
-        MessageBuffer buffer(_sendBufferSize);
-        std::size_t currentPacketSize;
+        // Small packets are coalesced into one buffer, anything bigger is queued by reference behind its
+        // header so the whole queue goes out in a single vectored write without copying the payload.
+        MessageBuffer buffer(0);
         do
         {
             queued->CompressIfNeeded();
-            ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+            WorldPacket const& packet = queued->GetPacket();
+            ServerPktHeader header(packet.size() + 2, packet.GetOpcode());
             if (queued->NeedsEncryption())
                 _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-            currentPacketSize = queued->size() + header.getHeaderLength();
-
-            if (buffer.GetRemainingSpace() < currentPacketSize)
+            std::size_t currentPacketSize = packet.size() + header.getHeaderLength();
+            if (packet.size() <= SEND_COPY_THRESHOLD)
             {
-                QueuePacket(std::move(buffer));
-                buffer.Resize(_sendBufferSize);
-            }
+                if (buffer.GetRemainingSpace() < currentPacketSize)
+                {
+                    if (buffer.GetActiveSize() > 0)
+                        QueuePacket(std::move(buffer));
+
+                    buffer.Resize(std::max(_sendBufferSize, currentPacketSize));
+                }
 
-            if (buffer.GetRemainingSpace() >= currentPacketSize)
-            {
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!packet.empty())
+                    buffer.Write(packet.contents(), packet.size());
             }
-            else    // Single packet larger than current buffer size
+            else
             {
-                // Resize buffer to fit current packet
-                buffer.Resize(currentPacketSize);
-
-                // Grow future buffers to current packet size if still below limit
-                if (currentPacketSize <= 65536)
-                    _sendBufferSize = currentPacketSize;
+                if (buffer.GetActiveSize() > 0)
+                {
+                    QueuePacket(std::move(buffer));
+                    buffer.Resize(0);
+                }
 
-                buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                QueuePacket(header.header, header.getHeaderLength(), queued->GetPayload());
             }
 
             delete queued;
@@ -405,8 +525,11 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
     ClientPktHeader* header = reinterpret_cast<ClientPktHeader*>(_headerBuffer.GetReadPointer());
     OpcodeClient opcode = static_cast<OpcodeClient>(header->cmd);
 
-    WorldPacket packet(opcode, std::move(_packetBuffer));
-    WorldPacket* packetToQueue;
+    // Copy the payload into a recycled packet, _packetBuffer keeps its storage for the next one
+    TimePoint receivedTime = opcode == CMSG_TIME_SYNC_RESP ? GameTime::Now() : TimePoint();
+    WorldPacketPool::Ptr packetToQueue = WorldPacketPool::ForCurrentThread().Acquire(opcode, _packetBuffer.GetReadPointer(), _packetBuffer.GetActiveSize(), receivedTime);
+    WorldPacket& packet = *packetToQueue;
+    _packetBuffer.Reset();
 
     if (sPacketLog->CanLogPacket() && IsLoggingPackets())
         sPacketLog->LogPacket(packet, CLIENT_TO_SERVER, GetRemoteIpAddress(), GetRemotePort());
@@ -459,11 +582,7 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
             }
             LOG_ERROR("network", "WorldSocket::ReadDataHandler: client {} sent CMSG_KEEP_ALIVE without being authenticated", GetRemoteIpAddress().to_string());
             return ReadDataHandlerResult::Error;
-        case CMSG_TIME_SYNC_RESP:
-            packetToQueue = new WorldPacket(std::move(packet), GameTime::Now());
-            break;
         default:
-            packetToQueue = new WorldPacket(std::move(packet));
             break;
     }
 
@@ -474,7 +593,6 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
     if (!_worldSession)
     {
         LOG_ERROR("network.opcode", "ProcessIncoming: Client not authed opcode = {}", uint32(opcode));
-        delete packetToQueue;
         return ReadDataHandlerResult::Error;
     }
 
@@ -482,7 +600,6 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
     if (!handler)
     {
         LOG_ERROR("network.opcode", "No defined handler for opcode {} sent by {}", GetOpcodeNameForLogging(static_cast<OpcodeClient>(packetToQueue->GetOpcode())), _worldSession->GetPlayerInfo());
-        delete packetToQueue;
         return ReadDataHandlerResult::Error;
     }
 
@@ -492,8 +609,8 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
         _worldSession->ResetTimeOutTime(false);
     }
 
-    // Copy the packet to the heap before enqueuing
-    _worldSession->QueuePacket(packetToQueue);
+    // The session releases the packet back to the pool once it has been handled
+    _worldSession->QueuePacket(packetToQueue.release());
 
     return ReadDataHandlerResult::Ok;
 }
@@ -528,6 +645,17 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
 }
 
+void WorldSocket::SendPacket(std::shared_ptr<WorldPacket const> packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket() && IsLoggingPackets())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(std::move(packet), _authCrypt.IsInitialized()));
+}
+
 void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
 {
     std::shared_ptr<ClientAuthSession> authSession = std::make_shared<ClientAuthSession>();
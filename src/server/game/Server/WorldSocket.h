@@ -29,23 +29,38 @@
 
 using boost::asio::ip::tcp;
 
-class EncryptableAndCompressiblePacket : public WorldPacket
+/// Queued outgoing packet. The payload is refcounted so one packet can be queued on many sockets;
+/// it is only rewritten in place when this socket holds the sole copy.
+class EncryptableAndCompressiblePacket
 {
 public:
-    EncryptableAndCompressiblePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    EncryptableAndCompressiblePacket(WorldPacket const& packet, bool encrypt) : _encrypt(encrypt)
     {
+        std::shared_ptr<WorldPacket> payload = std::make_shared<WorldPacket>(packet);
+        _exclusivePayload = payload.get();
+        _payload = std::move(payload);
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    EncryptableAndCompressiblePacket(std::shared_ptr<WorldPacket const> packet, bool encrypt) : _payload(std::move(packet)), _exclusivePayload(nullptr), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    WorldPacket const& GetPacket() const { return *_payload; }
+    std::shared_ptr<WorldPacket const> const& GetPayload() const { return _payload; }
+
     bool NeedsEncryption() const { return _encrypt; }
 
-    bool NeedsCompression() const { return GetOpcode() == SMSG_UPDATE_OBJECT && size() > 100; }
+    bool NeedsCompression() const;
 
     void CompressIfNeeded();
 
     std::atomic<EncryptableAndCompressiblePacket*> SocketQueueLink;
 
 private:
+    std::shared_ptr<WorldPacket const> _payload;
+    WorldPacket* _exclusivePayload;
     bool _encrypt;
 };
 
@@ -82,6 +97,7 @@ public:
     bool Update() final;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
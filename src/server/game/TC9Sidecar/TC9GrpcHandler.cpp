@@ -138,7 +138,7 @@ RemoveItemsWithGuidsFromPlayerResponse ToCloud9GrpcHandler::RemoveItemsWithGuids
     if (itemsFound > 0)
     {
         player->SaveInventoryAndGoldToDB(trans);
-        CharacterDatabase.CommitTransaction(trans);
+        CharacterDatabase.CommitTransaction(trans, player->GetSession()->GetAccountId());
     }
 
     // Don't forget to delete on "that" side.
@@ -197,7 +197,7 @@ PlayerItemErrorCode ToCloud9GrpcHandler::AddExistingItemToPlayer(AddExistingItem
 
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     player->SaveInventoryAndGoldToDB(trans);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, player->GetSession()->GetAccountId());
 
     return PlayerItemErrorCodeNoError;
 }
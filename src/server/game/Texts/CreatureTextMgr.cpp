@@ -23,7 +23,9 @@
 #include "DatabaseEnv.h"
 #include "GameTime.h"
 #include "GridNotifiers.h"
+#include "Map.h"
 #include "MiscPackets.h"
+#include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Random.h"
 
@@ -259,6 +261,23 @@ uint32 CreatureTextMgr::SendChat(Creature* source, uint8 textGroup, WorldObject
     if (!source)
         return 0;
 
+    // the repeat state is shared by all maps, texts raised by a parallel region update are sent from its merge phase
+    if (Map* map = source->FindMap(); map && map->IsParallelObjectUpdateActive())
+    {
+        ObjectGuid const targetGUID = target ? target->GetGUID() : ObjectGuid::Empty;
+        ObjectGuid const srcPlrGUID = srcPlr ? srcPlr->GetGUID() : ObjectGuid::Empty;
+        if (map->DeferParallelObjectUpdate([this, source, textGroup, targetGUID, msgType, language, range, sound, teamId, gmOnly, srcPlrGUID]()
+        {
+            if (!source->IsInWorld())
+                return;
+
+            WorldObject const* target = targetGUID ? ObjectAccessor::GetWorldObject(*source, targetGUID) : nullptr;
+            Player* srcPlr = srcPlrGUID ? ObjectAccessor::GetPlayer(*source, srcPlrGUID) : nullptr;
+            SendChat(source, textGroup, target, msgType, language, range, sound, teamId, gmOnly, srcPlr);
+        }))
+            return 0;
+    }
+
     CreatureTextMap::const_iterator sList = mTextMap.find(source->GetEntry());
     if (sList == mTextMap.end())
     {
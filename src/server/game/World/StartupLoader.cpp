@@ -0,0 +1,199 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupLoader.h"
+#include "Errors.h"
+#include "Log.h"
+#include "Timer.h"
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+void StartupLoader::AddStage(std::string name, std::initializer_list<std::string_view> dependencies, LoadFunction load)
+{
+    std::size_t index = _stages.size();
+    Stage& stage = _stages.emplace_back();
+
+    for (std::string_view dependency : dependencies)
+    {
+        auto itr = std::find_if(_stages.begin(), _stages.begin() + index, [dependency](Stage const& other) { return other.Name == dependency; });
+        ASSERT(itr != _stages.begin() + index, "Startup stage {} depends on {} which is not declared before it", name, dependency);
+
+        std::size_t dependencyIndex = std::distance(_stages.begin(), itr);
+        stage.Dependencies.push_back(dependencyIndex);
+        _stages[dependencyIndex].Dependents.push_back(index);
+    }
+
+    stage.Name = std::move(name);
+    stage.Load = std::move(load);
+}
+
+void StartupLoader::Run(uint32 threads)
+{
+    _threads = std::max<uint32>(threads, 1);
+
+    uint32 startTime = getMSTime();
+    if (_threads == 1)
+        RunSerial();
+    else
+        RunParallel(_threads);
+
+    _elapsed = GetMSTimeDiffToNow(startTime);
+}
+
+void StartupLoader::RunSerial()
+{
+    uint32 runStart = getMSTime();
+    for (Stage& stage : _stages)
+    {
+        stage.StartTime = GetMSTimeDiffToNow(runStart);
+        uint32 stageStart = getMSTime();
+        stage.Load();
+        stage.Duration = GetMSTimeDiffToNow(stageStart);
+    }
+}
+
+void StartupLoader::RunParallel(uint32 threads)
+{
+    std::mutex lock;
+    std::condition_variable wakeUp;
+    std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> ready;
+    std::vector<std::size_t> pending(_stages.size());
+    std::size_t finished = 0;
+    std::exception_ptr error;
+
+    for (std::size_t i = 0; i < _stages.size(); ++i)
+    {
+        pending[i] = _stages[i].Dependencies.size();
+        if (!pending[i])
+            ready.push(i);
+    }
+
+    uint32 runStart = getMSTime();
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        while (true)
+        {
+            wakeUp.wait(guard, [&]() { return !ready.empty() || finished == _stages.size() || error; });
+            if (finished == _stages.size() || error)
+                return;
+
+            std::size_t index = ready.top();
+            ready.pop();
+            guard.unlock();
+
+            Stage& stage = _stages[index];
+            stage.StartTime = GetMSTimeDiffToNow(runStart);
+            uint32 stageStart = getMSTime();
+            std::exception_ptr stageError;
+            try
+            {
+                stage.Load();
+            }
+            catch (...)
+            {
+                stageError = std::current_exception();
+            }
+            stage.Duration = GetMSTimeDiffToNow(stageStart);
+
+            guard.lock();
+            if (stageError)
+                error = stageError;
+
+            ++finished;
+            for (std::size_t dependent : stage.Dependents)
+                if (!--pending[dependent])
+                    ready.push(dependent);
+
+            wakeUp.notify_all();
+        }
+    };
+
+    // the calling thread works as well
+    std::vector<std::thread> workers;
+    for (uint32 i = 1; i < threads; ++i)
+        workers.emplace_back(worker);
+
+    worker();
+
+    for (std::thread& thread : workers)
+        thread.join();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+std::vector<std::size_t> StartupLoader::GetCriticalPath() const
+{
+    if (_stages.empty())
+        return {};
+
+    // dependencies always precede their dependents, so one pass in declaration order is enough
+    std::vector<uint32> finish(_stages.size());
+    std::vector<std::size_t> previous(_stages.size(), _stages.size());
+    for (std::size_t i = 0; i < _stages.size(); ++i)
+    {
+        uint32 start = 0;
+        for (std::size_t dependency : _stages[i].Dependencies)
+        {
+            if (finish[dependency] >= start)
+            {
+                start = finish[dependency];
+                previous[i] = dependency;
+            }
+        }
+
+        finish[i] = start + _stages[i].Duration;
+    }
+
+    std::vector<std::size_t> path;
+    for (std::size_t i = std::distance(finish.begin(), std::max_element(finish.begin(), finish.end())); i < _stages.size(); i = previous[i])
+        path.push_back(i);
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+void StartupLoader::LogReport() const
+{
+    uint32 total = 0;
+    for (Stage const& stage : _stages)
+        total += stage.Duration;
+
+    LOG_INFO("server.loading", "Startup stages: {} stages in {} ms on {} thread(s), {} ms of loading in total", _stages.size(), _elapsed, _threads, total);
+    for (Stage const& stage : _stages)
+        LOG_INFO("server.loading", "    {:<32} start {:>7} ms   took {:>7} ms", stage.Name, stage.StartTime, stage.Duration);
+
+    std::vector<std::size_t> path = GetCriticalPath();
+    uint32 pathDuration = 0;
+    std::string pathNames;
+    for (std::size_t index : path)
+    {
+        pathDuration += _stages[index].Duration;
+        if (!pathNames.empty())
+            pathNames += " -> ";
+
+        pathNames += _stages[index].Name;
+    }
+
+    LOG_INFO("server.loading", "Startup critical path ({} ms): {}", pathDuration, pathNames);
+    LOG_INFO("server.loading", " ");
+}
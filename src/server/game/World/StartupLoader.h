@@ -0,0 +1,74 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _STARTUP_LOADER_H
+#define _STARTUP_LOADER_H
+
+#include "Define.h"
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Runs the world startup loaders as a dependency graph.
+ *
+ * Every stage names the stages it must run after. Dependencies may only refer to
+ * stages added earlier, so the graph is acyclic and the declaration order is a
+ * valid serial order. With one thread the stages run strictly in declaration order
+ * on the calling thread, otherwise each stage starts as soon as its dependencies
+ * have finished, earlier declared stages first.
+ */
+class AC_GAME_API StartupLoader
+{
+public:
+    typedef std::function<void()> LoadFunction;
+
+    struct Stage
+    {
+        std::string Name;
+        std::vector<std::size_t> Dependencies;
+        std::vector<std::size_t> Dependents;
+        LoadFunction Load;
+        uint32 StartTime = 0;                               // ms since Run() started
+        uint32 Duration = 0;
+    };
+
+    void AddStage(std::string name, std::initializer_list<std::string_view> dependencies, LoadFunction load);
+
+    void Run(uint32 threads);
+
+    // Stage indexes of the longest chain of dependent stages, weighted by their durations
+    std::vector<std::size_t> GetCriticalPath() const;
+
+    void LogReport() const;
+
+    std::vector<Stage> const& GetStages() const { return _stages; }
+    uint32 GetElapsed() const { return _elapsed; }
+    uint32 GetThreads() const { return _threads; }
+
+private:
+    void RunSerial();
+    void RunParallel(uint32 threads);
+
+    std::vector<Stage> _stages;
+    uint32 _elapsed = 0;
+    uint32 _threads = 1;
+};
+
+#endif
@@ -73,6 +73,7 @@
 #include "Player.h"
 #include "PlayerDump.h"
 #include "PoolMgr.h"
+#include "QueryResponseCache.h"
 #include "RaceMgr.h"
 #include "Realm.h"
 #include "ScriptMgr.h"
@@ -81,6 +82,7 @@
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
 #include "SpellMgr.h"
+#include "StartupLoader.h"
 #include "TaskScheduler.h"
 #include "TC9Sidecar.h"
 #include "TicketMgr.h"
@@ -98,6 +100,7 @@
 #include "WorldGlobals.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
+#include "WorldSnapshot.h"
 #include "WorldSessionMgr.h"
 #include "WorldState.h"
 #include "WorldStateDefines.h"
@@ -212,6 +215,8 @@ void World::LoadConfigSettings(bool reload)
         _timers[WUPDATE_AUTOBROADCAST].Reset();
     }
 
+    sQueryResponseCache->LoadConfig();
+
     if (getIntConfig(CONFIG_CLIENTCACHE_VERSION) == 0)
     {
         _worldConfig.OverwriteConfigValue<uint32>(CONFIG_CLIENTCACHE_VERSION, _dbClientCacheVersion);
@@ -300,599 +305,820 @@ void World::LoadConfigSettings(bool reload)
     sScriptMgr->OnAfterConfigLoad(reload);
 }
 
-/// Initialize the World
-void World::SetInitialWorldSettings()
+/// Declare the world data load stages and their dependencies
+void World::AddStartupStages(StartupLoader& loader)
 {
-    ///- Server startup begin
-    uint32 startupBegin = getMSTime();
+    loader.AddStage("DBCStores", { }, [this]()
+    {
+        ///- Load the DBC files
+        LOG_INFO("server.loading", "Initialize Data Stores...");
+        LoadDBCStores(_dataPath, getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
+        DetectDBCLang();
+    });
 
-    ///- Initialize the random number generator
-    srand((unsigned int)GameTime::GetGameTime().count());
+    loader.AddStage("M2Cameras", { "DBCStores" }, [this]()
+    {
+        // Load cinematic cameras
+        LoadM2Cameras(_dataPath);
+    });
 
-    ///- Initialize detour memory management
-    dtAllocSetCustom(dtCustomAlloc, dtCustomFree);
+    loader.AddStage("PlayerRaces", { "DBCStores" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Player race data...");
+        sRaceMgr->LoadRaces();
+    });
 
-    ///- Initialize VMapMgr function pointers (to untangle game/collision circular deps)
-    VMAP::VMapMgr2* vmmgr2 = VMAP::VMapFactory::createOrGetVMapMgr();
-    vmmgr2->GetLiquidFlagsPtr = &GetLiquidFlags;
-    vmmgr2->IsVMAPDisabledForPtr = &DisableMgr::IsVMAPDisabledFor;
+    loader.AddStage("IPLocation", { }, []()
+    {
+        // Load IP Location Database
+        sIPLocation->Load();
+    });
 
-    ///- Initialize config settings
-    LoadConfigSettings();
+    loader.AddStage("Graveyards", { "DBCStores" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Game Graveyard...");
+        sGraveyard->LoadGraveyardFromDB();
+    });
 
-    ///- Initialize Allowed Security Level
-    LoadDBAllowedSecurityLevel();
+    loader.AddStage("PlayerDumpTables", { }, []()
+    {
+        LOG_INFO("server.loading", "Initializing PlayerDump Tables...");
+        PlayerDump::InitializeTables();
+    });
 
-    ///- Init highest guids before any table loading to prevent using not initialized guids in some code.
-    sObjectMgr->SetHighestGuids();
+    loader.AddStage("AIRegistry", { }, []()
+    {
+        ///- Initilize static helper structures
+        AIRegistry::Initialize();
+    });
 
-    if (!sConfigMgr->isDryRun())
+    loader.AddStage("SpellInfo", { "DBCStores" }, []()
     {
-        ///- Check the existence of the map files for all starting areas.
-        if (!MapMgr::ExistMapAndVMap(MAP_EASTERN_KINGDOMS, -6240.32f, 331.033f)
-                || !MapMgr::ExistMapAndVMap(MAP_EASTERN_KINGDOMS, -8949.95f, -132.493f)
-                || !MapMgr::ExistMapAndVMap(MAP_KALIMDOR, -618.518f, -4251.67f)
-                || !MapMgr::ExistMapAndVMap(MAP_EASTERN_KINGDOMS, 1676.35f, 1677.45f)
-                || !MapMgr::ExistMapAndVMap(MAP_KALIMDOR, 10311.3f, 832.463f)
-                || !MapMgr::ExistMapAndVMap(MAP_KALIMDOR, -2917.58f, -257.98f)
-                || (getIntConfig(CONFIG_EXPANSION) && (
-                        !MapMgr::ExistMapAndVMap(MAP_OUTLAND, 10349.6f, -6357.29f) ||
-                        !MapMgr::ExistMapAndVMap(MAP_OUTLAND, -3961.64f, -13931.2f))))
-        {
-            LOG_ERROR("server.loading", "Failed to find map files for starting areas");
-            exit(1);
-        }
-    }
+        LOG_INFO("server.loading", "Loading SpellInfo Store...");
+        sSpellMgr->LoadSpellInfoStore();
 
-    ///- Initialize pool manager
-    sPoolMgr->Initialize();
+        LOG_INFO("server.loading", "Loading Spell Cooldown Overrides...");
+        sSpellMgr->LoadSpellCooldownOverrides();
 
-    ///- Initialize game event manager
-    sGameEventMgr->Initialize();
+        LOG_INFO("server.loading", "Loading SpellInfo Data Corrections...");
+        sSpellMgr->LoadSpellInfoCorrections();
 
-    ///- Loading strings. Getting no records means core load has to be canceled because no error message can be output.
-    LOG_INFO("server.loading", " ");
-    LOG_INFO("server.loading", "Loading Acore Strings...");
-    if (!sObjectMgr->LoadAcoreStrings())
-        exit(1);                                            // Error message displayed in function already
+        LOG_INFO("server.loading", "Loading Spell Rank Data...");
+        sSpellMgr->LoadSpellRanks();
 
-    LOG_INFO("server.loading", "Loading Module Strings...");
-    sObjectMgr->LoadModuleStrings();
-    LOG_INFO("server.loading", "Loading Module Strings Locale...");
-    sObjectMgr->LoadModuleStringsLocale();
+        LOG_INFO("server.loading", "Loading Spell Specific And Aura State...");
+        sSpellMgr->LoadSpellSpecificAndAuraState();
 
-    ///- Update the realm entry in the database with the realm type from the config file
-    //No SQL injection as values are treated as integers
+        LOG_INFO("server.loading", "Loading SkillLineAbilityMultiMap Data...");
+        sSpellMgr->LoadSkillLineAbilityMap();
 
-    // not send custom type REALM_FFA_PVP to realm list
-    uint32 server_type;
-    if (IsFFAPvPRealm())
-        server_type = REALM_TYPE_PVP;
-    else
-        server_type = getIntConfig(CONFIG_GAME_TYPE);
+        LOG_INFO("server.loading", "Loading SpellInfo Custom Attributes...");
+        sSpellMgr->LoadSpellInfoCustomAttributes();
 
-    uint32 realm_zone = getIntConfig(CONFIG_REALM_ZONE);
+        LOG_INFO("server.loading", "Loading Spell Jump Distances...");
+        sSpellMgr->LoadSpellJumpDistances();
 
-    LoginDatabase.Execute("UPDATE realmlist SET icon = {}, timezone = {} WHERE id = '{}'", server_type, realm_zone, realm.Id.Realm);      // One-time query
+        LOG_INFO("server.loading", "Loading SpellInfo Immunity infos...");
+        sSpellMgr->LoadSpellInfoImmunities();
+    });
 
-    ///- Custom Hook for loading DB items
-    sScriptMgr->OnLoadCustomDatabaseTable();
+    loader.AddStage("PlayerModels", { "DBCStores" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Player Totem models...");
+        sObjectMgr->LoadPlayerTotemModels();
 
-    ///- Load the DBC files
-    LOG_INFO("server.loading", "Initialize Data Stores...");
-    LoadDBCStores(_dataPath);
-    DetectDBCLang();
+        LOG_INFO("server.loading", "Loading Player Shapeshift models...");
+        sObjectMgr->LoadPlayerShapeshiftModels();
+    });
 
-    // Load cinematic cameras
-    LoadM2Cameras(_dataPath);
+    loader.AddStage("GameObjectModels", { "DBCStores" }, [this]()
+    {
+        LOG_INFO("server.loading", "Loading GameObject Models...");
+        LoadGameObjectModelList(_dataPath);
+    });
 
-    LOG_INFO("server.loading", "Loading Player race data...");
-    sRaceMgr->LoadRaces();
+    loader.AddStage("ScriptNames", { }, []()
+    {
+        LOG_INFO("server.loading", "Loading Script Names...");
+        sObjectMgr->LoadScriptNames();
+    });
 
-    // Load IP Location Database
-    sIPLocation->Load();
+    loader.AddStage("InstanceTemplate", { "DBCStores", "ScriptNames" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Instance Template...");
+        sObjectMgr->LoadInstanceTemplate();
+    });
 
-    LOG_INFO("server.loading", "Loading Game Graveyard...");
-    sGraveyard->LoadGraveyardFromDB();
+    loader.AddStage("CharacterCache", { }, []()
+    {
+        LOG_INFO("server.loading", "Loading Character Cache...");
+        sCharacterCache->LoadCharacterCacheStorage();
+    });
 
-    LOG_INFO("server.loading", "Initializing PlayerDump Tables...");
-    PlayerDump::InitializeTables();
+    loader.AddStage("Instances", { "InstanceTemplate" }, []()
+    {
+        // Must be called before `creature_respawn`/`gameobject_respawn` tables
+        LOG_INFO("server.loading", "Loading Instances...");
+        sInstanceSaveMgr->LoadInstances();
+    });
 
-    ///- Initilize static helper structures
-    AIRegistry::Initialize();
+    loader.AddStage("BroadcastTexts", { "DBCStores" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Broadcast Texts...");
+        sObjectMgr->LoadBroadcastTexts();
+        sObjectMgr->LoadBroadcastTextLocales();
+    });
 
-    LOG_INFO("server.loading", "Loading SpellInfo Store...");
-    sSpellMgr->LoadSpellInfoStore();
+    loader.AddStage("Locales", { "DBCStores" }, [this]()
+    {
+        LOG_INFO("server.loading", "Loading Localization Strings...");
+        uint32 oldMSTime = getMSTime();
+        sObjectMgr->LoadCreatureLocales();
+        sObjectMgr->LoadGameObjectLocales();
+        sObjectMgr->LoadItemLocales();
+        sObjectMgr->LoadItemSetNameLocales();
+        sObjectMgr->LoadQuestLocales();
+        sObjectMgr->LoadQuestOfferRewardLocale();
+        sObjectMgr->LoadQuestRequestItemsLocale();
+        sObjectMgr->LoadNpcTextLocales();
+        sObjectMgr->LoadPageTextLocales();
+        sObjectMgr->LoadGossipMenuItemsLocales();
+        sObjectMgr->LoadPointOfInterestLocales();
+        sObjectMgr->LoadPetNamesLocales();
+
+        sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
+        LOG_INFO("server.loading", ">> Localization Strings loaded in {} ms", GetMSTimeDiffToNow(oldMSTime));
+        LOG_INFO("server.loading", " ");
+    });
 
-    LOG_INFO("server.loading", "Loading Spell Cooldown Overrides...");
-    sSpellMgr->LoadSpellCooldownOverrides();
+    loader.AddStage("RBAC", { }, []()
+    {
+        LOG_INFO("server.loading", "Loading Account Roles and Permissions...");
+        sAccountMgr->LoadRBAC();
+    });
 
-    LOG_INFO("server.loading", "Loading SpellInfo Data Corrections...");
-    sSpellMgr->LoadSpellInfoCorrections();
+    loader.AddStage("PageTexts", { }, []()
+    {
+        LOG_INFO("server.loading", "Loading Page Texts...");
+        sObjectMgr->LoadPageTexts();
+    });
 
-    LOG_INFO("server.loading", "Loading Spell Rank Data...");
-    sSpellMgr->LoadSpellRanks();
+    loader.AddStage("GameObjectTemplates", { "SpellInfo", "ScriptNames", "PageTexts", "GameObjectModels", "AIRegistry" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Game Object Templates...");         // must be after LoadPageTexts
+        sObjectMgr->LoadGameObjectTemplate();
 
-    LOG_INFO("server.loading", "Loading Spell Specific And Aura State...");
-    sSpellMgr->LoadSpellSpecificAndAuraState();
+        LOG_INFO("server.loading", "Loading Game Object Template Addons...");
+        sObjectMgr->LoadGameObjectTemplateAddons();
 
-    LOG_INFO("server.loading", "Loading SkillLineAbilityMultiMap Data...");
-    sSpellMgr->LoadSkillLineAbilityMap();
+        LOG_INFO("server.loading", "Loading Transport Templates...");
+        sTransportMgr->LoadTransportTemplates();
+    });
 
-    LOG_INFO("server.loading", "Loading SpellInfo Custom Attributes...");
-    sSpellMgr->LoadSpellInfoCustomAttributes();
+    loader.AddStage("SpellData", { "SpellInfo" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Spell Required Data...");
+        sSpellMgr->LoadSpellRequired();
 
-    LOG_INFO("server.loading", "Loading Spell Jump Distances...");
-    sSpellMgr->LoadSpellJumpDistances();
+        LOG_INFO("server.loading", "Loading Spell Group Types...");
+        sSpellMgr->LoadSpellGroups();
 
-    LOG_INFO("server.loading", "Loading SpellInfo Immunity infos...");
-    sSpellMgr->LoadSpellInfoImmunities();
+        LOG_INFO("server.loading", "Loading Spell Learn Skills...");
+        sSpellMgr->LoadSpellLearnSkills();                           // must be after LoadSpellRanks
 
-    LOG_INFO("server.loading", "Loading Player Totem models...");
-    sObjectMgr->LoadPlayerTotemModels();
+        LOG_INFO("server.loading", "Loading Spell Proc Conditions and Data...");
+        sSpellMgr->LoadSpellProcs();
 
-    LOG_INFO("server.loading", "Loading Player Shapeshift models...");
-    sObjectMgr->LoadPlayerShapeshiftModels();
+        LOG_INFO("server.loading", "Loading Spell Bonus Data...");
+        sSpellMgr->LoadSpellBonuses();
 
-    LOG_INFO("server.loading", "Loading GameObject Models...");
-    LoadGameObjectModelList(_dataPath);
+        LOG_INFO("server.loading", "Loading Aggro Spells Definitions...");
+        sSpellMgr->LoadSpellThreats();
 
-    LOG_INFO("server.loading", "Loading Script Names...");
-    sObjectMgr->LoadScriptNames();
+        LOG_INFO("server.loading", "Loading Mixology Bonuses...");
+        sSpellMgr->LoadSpellMixology();
 
-    LOG_INFO("server.loading", "Loading Instance Template...");
-    sObjectMgr->LoadInstanceTemplate();
+        LOG_INFO("server.loading", "Loading Spell Group Stack Rules...");
+        sSpellMgr->LoadSpellGroupStackRules();
+    });
 
-    LOG_INFO("server.loading", "Loading Character Cache...");
-    sCharacterCache->LoadCharacterCacheStorage();
+    loader.AddStage("NpcTexts", { "BroadcastTexts" }, []()
+    {
+        LOG_INFO("server.loading", "Loading NPC Texts...");
+        sObjectMgr->LoadGossipText();
+    });
 
-    // Must be called before `creature_respawn`/`gameobject_respawn` tables
-    LOG_INFO("server.loading", "Loading Instances...");
-    sInstanceSaveMgr->LoadInstances();
+    loader.AddStage("Items", { "SpellData", "ScriptNames", "PageTexts", "GameObjectTemplates" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Enchant Spells Proc Datas...");
+        sSpellMgr->LoadSpellEnchantProcData();
 
-    LOG_INFO("server.loading", "Loading Broadcast Texts...");
-    sObjectMgr->LoadBroadcastTexts();
-    sObjectMgr->LoadBroadcastTextLocales();
+        LOG_INFO("server.loading", "Loading Item Random Enchantments Table...");
+        LoadRandomEnchantmentsTable();
 
-    LOG_INFO("server.loading", "Loading Localization Strings...");
-    uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadItemLocales();
-    sObjectMgr->LoadItemSetNameLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadQuestOfferRewardLocale();
-    sObjectMgr->LoadQuestRequestItemsLocale();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
-    sObjectMgr->LoadPetNamesLocales();
+        LOG_INFO("server.loading", "Loading Disables");
+        sDisableMgr->LoadDisables();                                  // must be before loading quests and items
 
-    sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
-    LOG_INFO("server.loading", ">> Localization Strings loaded in {} ms", GetMSTimeDiffToNow(oldMSTime));
-    LOG_INFO("server.loading", " ");
+        LOG_INFO("server.loading", "Loading Items...");                         // must be after LoadRandomEnchantmentsTable and LoadPageTexts
+        sObjectMgr->LoadItemTemplates();
 
-    LOG_INFO("server.loading", "Loading Account Roles and Permissions...");
-    sAccountMgr->LoadRBAC();
+        LOG_INFO("server.loading", "Loading Item Set Names...");                // must be after LoadItemPrototypes
+        sObjectMgr->LoadItemSetNames();
+    });
+
+    loader.AddStage("Creatures", { "Items", "GameObjectTemplates", "NpcTexts", "Instances", "CharacterCache", "PlayerModels", "PlayerRaces", "Graveyards", "AIRegistry" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Creature Model Based Info Data...");
+        sObjectMgr->LoadCreatureModelInfo();
 
-    LOG_INFO("server.loading", "Loading Page Texts...");
-    sObjectMgr->LoadPageTexts();
+        LOG_INFO("server.loading", "Loading Creature Custom IDs Config...");
+        sObjectMgr->LoadCreatureCustomIDs();
 
-    LOG_INFO("server.loading", "Loading Game Object Templates...");         // must be after LoadPageTexts
-    sObjectMgr->LoadGameObjectTemplate();
+        LOG_INFO("server.loading", "Loading Creature Templates...");
+        sObjectMgr->LoadCreatureTemplates();
 
-    LOG_INFO("server.loading", "Loading Game Object Template Addons...");
-    sObjectMgr->LoadGameObjectTemplateAddons();
+        LOG_INFO("server.loading", "Loading Equipment Templates...");           // must be after LoadCreatureTemplates
+        sObjectMgr->LoadEquipmentTemplates();
 
-    LOG_INFO("server.loading", "Loading Transport Templates...");
-    sTransportMgr->LoadTransportTemplates();
+        LOG_INFO("server.loading", "Loading Creature Template Addons...");
+        sObjectMgr->LoadCreatureTemplateAddons();
 
-    LOG_INFO("server.loading", "Loading Spell Required Data...");
-    sSpellMgr->LoadSpellRequired();
+        LOG_INFO("server.loading", "Loading Reputation Reward Rates...");
+        sObjectMgr->LoadReputationRewardRate();
 
-    LOG_INFO("server.loading", "Loading Spell Group Types...");
-    sSpellMgr->LoadSpellGroups();
+        LOG_INFO("server.loading", "Loading Creature Reputation OnKill Data...");
+        sObjectMgr->LoadReputationOnKill();
 
-    LOG_INFO("server.loading", "Loading Spell Learn Skills...");
-    sSpellMgr->LoadSpellLearnSkills();                           // must be after LoadSpellRanks
+        LOG_INFO("server.loading", "Loading Reputation Spillover Data..." );
+        sObjectMgr->LoadReputationSpilloverTemplate();
 
-    LOG_INFO("server.loading", "Loading Spell Proc Conditions and Data...");
-    sSpellMgr->LoadSpellProcs();
+        LOG_INFO("server.loading", "Loading Points Of Interest Data...");
+        sObjectMgr->LoadPointsOfInterest();
 
-    LOG_INFO("server.loading", "Loading Spell Bonus Data...");
-    sSpellMgr->LoadSpellBonuses();
+        LOG_INFO("server.loading", "Loading Creature Base Stats...");
+        sObjectMgr->LoadCreatureClassLevelStats();
 
-    LOG_INFO("server.loading", "Loading Aggro Spells Definitions...");
-    sSpellMgr->LoadSpellThreats();
+        LOG_INFO("server.loading", "Loading Spawn Group Templates...");
+        sObjectMgr->LoadSpawnGroupTemplates();
 
-    LOG_INFO("server.loading", "Loading Mixology Bonuses...");
-    sSpellMgr->LoadSpellMixology();
+        LOG_INFO("server.loading", "Loading Creature Data...");
+        sObjectMgr->LoadCreatures();
 
-    LOG_INFO("server.loading", "Loading Spell Group Stack Rules...");
-    sSpellMgr->LoadSpellGroupStackRules();
+        LOG_INFO("server.loading", "Loading Creature sparring...");
+        sObjectMgr->LoadCreatureSparring();
 
-    LOG_INFO("server.loading", "Loading NPC Texts...");
-    sObjectMgr->LoadGossipText();
+        LOG_INFO("server.loading", "Loading Temporary Summon Data...");
+        sObjectMgr->LoadTempSummons();                               // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
 
-    LOG_INFO("server.loading", "Loading Enchant Spells Proc Datas...");
-    sSpellMgr->LoadSpellEnchantProcData();
+        LOG_INFO("server.loading", "Loading Gameobject Summon Data...");
+        sObjectMgr->LoadGameObjectSummons();                         // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
 
-    LOG_INFO("server.loading", "Loading Item Random Enchantments Table...");
-    LoadRandomEnchantmentsTable();
+        LOG_INFO("server.loading", "Loading Pet Levelup Spells...");
+        sSpellMgr->LoadPetLevelupSpellMap();
 
-    LOG_INFO("server.loading", "Loading Disables");
-    sDisableMgr->LoadDisables();                                  // must be before loading quests and items
+        LOG_INFO("server.loading", "Loading Pet default Spells additional to Levelup Spells...");
+        sSpellMgr->LoadPetDefaultSpells();
 
-    LOG_INFO("server.loading", "Loading Items...");                         // must be after LoadRandomEnchantmentsTable and LoadPageTexts
-    sObjectMgr->LoadItemTemplates();
+        LOG_INFO("server.loading", "Loading Creature Addon Data...");
+        sObjectMgr->LoadCreatureAddons();                            // must be after LoadCreatureTemplates() and LoadCreatures()
 
-    LOG_INFO("server.loading", "Loading Item Set Names...");                // must be after LoadItemPrototypes
-    sObjectMgr->LoadItemSetNames();
+        LOG_INFO("server.loading", "Loading Creature Movement Overrides...");
+        sObjectMgr->LoadCreatureMovementOverrides(); // must be after LoadCreatures()
 
-    LOG_INFO("server.loading", "Loading Creature Model Based Info Data...");
-    sObjectMgr->LoadCreatureModelInfo();
+        LOG_INFO("server.loading", "Loading Gameobject Data...");
+        sObjectMgr->LoadGameobjects();
 
-    LOG_INFO("server.loading", "Loading Creature Custom IDs Config...");
-    sObjectMgr->LoadCreatureCustomIDs();
+        LOG_INFO("server.loading", "Loading Spawn Group Data...");
+        sObjectMgr->LoadSpawnGroups();                                 // must be after LoadCreatures() and LoadGameobjects()
 
-    LOG_INFO("server.loading", "Loading Creature Templates...");
-    sObjectMgr->LoadCreatureTemplates();
+        LOG_INFO("server.loading", "Loading GameObject Addon Data...");
+        sObjectMgr->LoadGameObjectAddons();                          // must be after LoadGameObjectTemplate() and LoadGameobjects()
 
-    LOG_INFO("server.loading", "Loading Equipment Templates...");           // must be after LoadCreatureTemplates
-    sObjectMgr->LoadEquipmentTemplates();
+        LOG_INFO("server.loading", "Loading GameObject Quest Items...");
+        sObjectMgr->LoadGameObjectQuestItems();
 
-    LOG_INFO("server.loading", "Loading Creature Template Addons...");
-    sObjectMgr->LoadCreatureTemplateAddons();
+        LOG_INFO("server.loading", "Loading Creature Quest Items...");
+        sObjectMgr->LoadCreatureQuestItems();
 
-    LOG_INFO("server.loading", "Loading Reputation Reward Rates...");
-    sObjectMgr->LoadReputationRewardRate();
+        LOG_INFO("server.loading", "Loading Creature Linked Respawn...");
+        sObjectMgr->LoadLinkedRespawn();                             // must be after LoadCreatures(), LoadGameObjects()
+    });
 
-    LOG_INFO("server.loading", "Loading Creature Reputation OnKill Data...");
-    sObjectMgr->LoadReputationOnKill();
+    loader.AddStage("Weather", { "Creatures" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Weather Data...");
+        WeatherMgr::LoadWeatherData();
+    });
 
-    LOG_INFO("server.loading", "Loading Reputation Spillover Data..." );
-    sObjectMgr->LoadReputationSpilloverTemplate();
+    loader.AddStage("Quests", { "Weather" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Quests...");
+        sObjectMgr->LoadQuests();                                    // must be loaded after DBCs, creature_template, item_template, gameobject tables
 
-    LOG_INFO("server.loading", "Loading Points Of Interest Data...");
-    sObjectMgr->LoadPointsOfInterest();
+        LOG_INFO("server.loading", "Checking Quest Disables");
+        sDisableMgr->CheckQuestDisables();                           // must be after loading quests
 
-    LOG_INFO("server.loading", "Loading Creature Base Stats...");
-    sObjectMgr->LoadCreatureClassLevelStats();
+        LOG_INFO("server.loading", "Loading Quest POI");
+        sObjectMgr->LoadQuestPOI();
 
-    LOG_INFO("server.loading", "Loading Spawn Group Templates...");
-    sObjectMgr->LoadSpawnGroupTemplates();
+        LOG_INFO("server.loading", "Loading Quests Starters and Enders...");
+        sObjectMgr->LoadQuestStartersAndEnders();                    // must be after quest load
 
-    LOG_INFO("server.loading", "Loading Creature Data...");
-    sObjectMgr->LoadCreatures();
+        LOG_INFO("server.loading", "Loading Quest Greetings...");
+        sObjectMgr->LoadQuestGreetings();                               // must be loaded after creature_template, gameobject_template tables
+        LOG_INFO("server.loading", "Loading Quest Greeting Locales...");
+        sObjectMgr->LoadQuestGreetingsLocales();                        // must be loaded after creature_template, gameobject_template tables, quest_greeting
 
-    LOG_INFO("server.loading", "Loading Creature sparring...");
-    sObjectMgr->LoadCreatureSparring();
+        LOG_INFO("server.loading", "Loading Quest Money Rewards...");
+        sObjectMgr->LoadQuestMoneyRewards();
+    });
 
-    LOG_INFO("server.loading", "Loading Temporary Summon Data...");
-    sObjectMgr->LoadTempSummons();                               // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
+    loader.AddStage("Pools", { "Quests" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Objects Pooling Data...");
+        sPoolMgr->LoadFromDB();
+    });
 
-    LOG_INFO("server.loading", "Loading Gameobject Summon Data...");
-    sObjectMgr->LoadGameObjectSummons();                         // must be after LoadCreatureTemplates() and LoadGameObjectTemplates()
+    loader.AddStage("GameEvents", { "Pools" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Game Event Data...");               // must be after loading pools fully
+        sGameEventMgr->LoadHolidayDates();                           // Must be after loading DBC
+        sGameEventMgr->LoadFromDB();                                 // Must be after loading holiday dates
+    });
 
-    LOG_INFO("server.loading", "Loading Pet Levelup Spells...");
-    sSpellMgr->LoadPetLevelupSpellMap();
+    loader.AddStage("Vehicles", { "GameEvents" }, []()
+    {
+        LOG_INFO("server.loading", "Loading UNIT_NPC_FLAG_SPELLCLICK Data..."); // must be after LoadQuests
+        sObjectMgr->LoadNPCSpellClickSpells();
 
-    LOG_INFO("server.loading", "Loading Pet default Spells additional to Levelup Spells...");
-    sSpellMgr->LoadPetDefaultSpells();
+        LOG_INFO("server.loading", "Loading Vehicle Template Accessories...");
+        sObjectMgr->LoadVehicleTemplateAccessories();                // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
 
-    LOG_INFO("server.loading", "Loading Creature Addon Data...");
-    sObjectMgr->LoadCreatureAddons();                            // must be after LoadCreatureTemplates() and LoadCreatures()
+        LOG_INFO("server.loading", "Loading Vehicle Accessories...");
+        sObjectMgr->LoadVehicleAccessories();                       // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
 
-    LOG_INFO("server.loading", "Loading Creature Movement Overrides...");
-    sObjectMgr->LoadCreatureMovementOverrides(); // must be after LoadCreatures()
+        LOG_INFO("server.loading", "Loading Vehicle Seat Addon Data...");
+        sObjectMgr->LoadVehicleSeatAddon();                         // must be after loading DBC
+    });
 
-    LOG_INFO("server.loading", "Loading Gameobject Data...");
-    sObjectMgr->LoadGameobjects();
+    loader.AddStage("SpellAreas", { "Vehicles" }, []()
+    {
+        LOG_INFO("server.loading", "Loading SpellArea Data...");                // must be after quest load
+        sSpellMgr->LoadSpellAreas();
+    });
 
-    LOG_INFO("server.loading", "Loading Spawn Group Data...");
-    sObjectMgr->LoadSpawnGroups();                                 // must be after LoadCreatures() and LoadGameobjects()
+    loader.AddStage("AreaTriggers", { "SpellAreas" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Area Trigger Definitions");
+        sObjectMgr->LoadAreaTriggers();
 
-    LOG_INFO("server.loading", "Loading GameObject Addon Data...");
-    sObjectMgr->LoadGameObjectAddons();                          // must be after LoadGameObjectTemplate() and LoadGameobjects()
+        LOG_INFO("server.loading", "Loading Area Trigger Teleport Definitions...");
+        sObjectMgr->LoadAreaTriggerTeleports();
 
-    LOG_INFO("server.loading", "Loading GameObject Quest Items...");
-    sObjectMgr->LoadGameObjectQuestItems();
+        LOG_INFO("server.loading", "Loading Access Requirements...");
+        sObjectMgr->LoadAccessRequirements();                        // must be after item template load
 
-    LOG_INFO("server.loading", "Loading Creature Quest Items...");
-    sObjectMgr->LoadCreatureQuestItems();
+        LOG_INFO("server.loading", "Loading Quest Area Triggers...");
+        sObjectMgr->LoadQuestAreaTriggers();                         // must be after LoadQuests
 
-    LOG_INFO("server.loading", "Loading Creature Linked Respawn...");
-    sObjectMgr->LoadLinkedRespawn();                             // must be after LoadCreatures(), LoadGameObjects()
+        LOG_INFO("server.loading", "Loading Tavern Area Triggers...");
+        sObjectMgr->LoadTavernAreaTriggers();
 
-    LOG_INFO("server.loading", "Loading Weather Data...");
-    WeatherMgr::LoadWeatherData();
+        LOG_INFO("server.loading", "Loading AreaTrigger Script Names...");
+        sObjectMgr->LoadAreaTriggerScripts();
+    });
 
-    LOG_INFO("server.loading", "Loading Quests...");
-    sObjectMgr->LoadQuests();                                    // must be loaded after DBCs, creature_template, item_template, gameobject tables
+    loader.AddStage("LFG", { "AreaTriggers" }, []()
+    {
+        LOG_INFO("server.loading", "Loading LFG Entrance Positions..."); // Must be after areatriggers
+        sLFGMgr->LoadLFGDungeons();
 
-    LOG_INFO("server.loading", "Checking Quest Disables");
-    sDisableMgr->CheckQuestDisables();                           // must be after loading quests
+        LOG_INFO("server.loading", "Loading Dungeon Boss Data...");
+        sObjectMgr->LoadInstanceEncounters();
 
-    LOG_INFO("server.loading", "Loading Quest POI");
-    sObjectMgr->LoadQuestPOI();
+        LOG_INFO("server.loading", "Loading LFG Rewards...");
+        sLFGMgr->LoadRewards();
+    });
 
-    LOG_INFO("server.loading", "Loading Quests Starters and Enders...");
-    sObjectMgr->LoadQuestStartersAndEnders();                    // must be after quest load
+    loader.AddStage("GraveyardZones", { "LFG" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Graveyard-Zone Links...");
+        sGraveyard->LoadGraveyardZones();
+    });
 
-    LOG_INFO("server.loading", "Loading Quest Greetings...");
-    sObjectMgr->LoadQuestGreetings();                               // must be loaded after creature_template, gameobject_template tables
-    LOG_INFO("server.loading", "Loading Quest Greeting Locales...");
-    sObjectMgr->LoadQuestGreetingsLocales();                        // must be loaded after creature_template, gameobject_template tables, quest_greeting
+    loader.AddStage("SpellTargets", { "GraveyardZones" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Spell Pet Auras...");
+        sSpellMgr->LoadSpellPetAuras();
 
-    LOG_INFO("server.loading", "Loading Quest Money Rewards...");
-    sObjectMgr->LoadQuestMoneyRewards();
+        LOG_INFO("server.loading", "Loading Spell Target Coordinates...");
+        sSpellMgr->LoadSpellTargetPositions();
 
-    LOG_INFO("server.loading", "Loading Objects Pooling Data...");
-    sPoolMgr->LoadFromDB();
+        LOG_INFO("server.loading", "Loading Spell Cone definitions...");
+        sSpellMgr->LoadSpellCones();
 
-    LOG_INFO("server.loading", "Loading Game Event Data...");               // must be after loading pools fully
-    sGameEventMgr->LoadHolidayDates();                           // Must be after loading DBC
-    sGameEventMgr->LoadFromDB();                                 // Must be after loading holiday dates
+        LOG_INFO("server.loading", "Loading Enchant Custom Attributes...");
+        sSpellMgr->LoadEnchantCustomAttr();
 
-    LOG_INFO("server.loading", "Loading UNIT_NPC_FLAG_SPELLCLICK Data..."); // must be after LoadQuests
-    sObjectMgr->LoadNPCSpellClickSpells();
+        LOG_INFO("server.loading", "Loading linked Spells...");
+        sSpellMgr->LoadSpellLinked();
+    });
 
-    LOG_INFO("server.loading", "Loading Vehicle Template Accessories...");
-    sObjectMgr->LoadVehicleTemplateAccessories();                // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
+    loader.AddStage("PlayerInfo", { "SpellTargets" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Player Create Data...");
+        sObjectMgr->LoadPlayerInfo();
 
-    LOG_INFO("server.loading", "Loading Vehicle Accessories...");
-    sObjectMgr->LoadVehicleAccessories();                       // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
+        LOG_INFO("server.loading", "Loading Exploration BaseXP Data...");
+        sObjectMgr->LoadExplorationBaseXP();
 
-    LOG_INFO("server.loading", "Loading Vehicle Seat Addon Data...");
-    sObjectMgr->LoadVehicleSeatAddon();                         // must be after loading DBC
+        LOG_INFO("server.loading", "Loading Pet Name Parts...");
+        sObjectMgr->LoadPetNames();
+    });
 
-    LOG_INFO("server.loading", "Loading SpellArea Data...");                // must be after quest load
-    sSpellMgr->LoadSpellAreas();
+    loader.AddStage("CharacterCleanup", { "PlayerInfo" }, []()
+    {
+        CharacterDatabaseCleaner::CleanDatabase();
+    });
 
-    LOG_INFO("server.loading", "Loading Area Trigger Definitions");
-    sObjectMgr->LoadAreaTriggers();
+    loader.AddStage("Pets", { "CharacterCleanup" }, []()
+    {
+        LOG_INFO("server.loading", "Loading The Max Pet Number...");
+        sObjectMgr->LoadPetNumber();
 
-    LOG_INFO("server.loading", "Loading Area Trigger Teleport Definitions...");
-    sObjectMgr->LoadAreaTriggerTeleports();
+        LOG_INFO("server.loading", "Loading Pet Level Stats...");
+        sObjectMgr->LoadPetLevelInfo();
+    });
 
-    LOG_INFO("server.loading", "Loading Access Requirements...");
-    sObjectMgr->LoadAccessRequirements();                        // must be after item template load
+    loader.AddStage("MailTemplates", { "Pets" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Player Level Dependent Mail Rewards...");
+        sObjectMgr->LoadMailLevelRewards();
 
-    LOG_INFO("server.loading", "Loading Quest Area Triggers...");
-    sObjectMgr->LoadQuestAreaTriggers();                         // must be after LoadQuests
+        LOG_INFO("server.loading", "Load Mail Server definitions...");
+        sServerMailMgr->LoadMailServerTemplates();
+    });
 
-    LOG_INFO("server.loading", "Loading Tavern Area Triggers...");
-    sObjectMgr->LoadTavernAreaTriggers();
+    loader.AddStage("LootTables", { "MailTemplates" }, []()
+    {
+        // Loot tables
+        LoadLootTables();
+    });
 
-    LOG_INFO("server.loading", "Loading AreaTrigger Script Names...");
-    sObjectMgr->LoadAreaTriggerScripts();
+    loader.AddStage("SkillTables", { "LootTables" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Skill Discovery Table...");
+        LoadSkillDiscoveryTable();
 
-    LOG_INFO("server.loading", "Loading LFG Entrance Positions..."); // Must be after areatriggers
-    sLFGMgr->LoadLFGDungeons();
+        LOG_INFO("server.loading", "Loading Skill Extra Item Table...");
+        LoadSkillExtraItemTable();
 
-    LOG_INFO("server.loading", "Loading Dungeon Boss Data...");
-    sObjectMgr->LoadInstanceEncounters();
+        LOG_INFO("server.loading", "Loading Skill Perfection Data Table...");
+        LoadSkillPerfectItemTable();
 
-    LOG_INFO("server.loading", "Loading LFG Rewards...");
-    sLFGMgr->LoadRewards();
+        LOG_INFO("server.loading", "Loading Skill Fishing Base Level Requirements...");
+        sObjectMgr->LoadFishingBaseSkillLevel();
+    });
 
-    LOG_INFO("server.loading", "Loading Graveyard-Zone Links...");
-    sGraveyard->LoadGraveyardZones();
+    loader.AddStage("Achievements", { "SkillTables" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Achievements...");
+        sAchievementMgr->LoadAchievementReferenceList();
+        LOG_INFO("server.loading", "Loading Achievement Criteria Lists...");
+        sAchievementMgr->LoadAchievementCriteriaList();
+        LOG_INFO("server.loading", "Loading Achievement Criteria Data...");
+        sAchievementMgr->LoadAchievementCriteriaData();
+        LOG_INFO("server.loading", "Loading Achievement Rewards...");
+        sAchievementMgr->LoadRewards();
+        LOG_INFO("server.loading", "Loading Achievement Reward Locales...");
+        sAchievementMgr->LoadRewardLocales();
+        LOG_INFO("server.loading", "Loading Completed Achievements...");
+        sAchievementMgr->LoadCompletedAchievements();
+    });
 
-    LOG_INFO("server.loading", "Loading Spell Pet Auras...");
-    sSpellMgr->LoadSpellPetAuras();
+    loader.AddStage("Auctions", { "Items", "CharacterCache" }, []()
+    {
+        ///- Load dynamic data tables from the database
+        LOG_INFO("server.loading", "Loading Item Auctions...");
+        sAuctionMgr->LoadAuctionItems();
+        LOG_INFO("server.loading", "Loading Auctions...");
+        sAuctionMgr->LoadAuctions();
+    });
 
-    LOG_INFO("server.loading", "Loading Spell Target Coordinates...");
-    sSpellMgr->LoadSpellTargetPositions();
+    loader.AddStage("Guilds", { "Items", "CharacterCache" }, []()
+    {
+        sGuildMgr->LoadGuilds();
+    });
 
-    LOG_INFO("server.loading", "Loading Spell Cone definitions...");
-    sSpellMgr->LoadSpellCones();
+    loader.AddStage("ArenaTeams", { "Guilds" }, []()
+    {
+        LOG_INFO("server.loading", "Loading ArenaTeams...");
+        sArenaTeamMgr->LoadArenaTeams();
+    });
 
-    LOG_INFO("server.loading", "Loading Enchant Custom Attributes...");
-    sSpellMgr->LoadEnchantCustomAttr();
+    loader.AddStage("Groups", { "ArenaTeams", "Instances", "LFG" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Groups...");
+        sGroupMgr->LoadGroups();
+    });
 
-    LOG_INFO("server.loading", "Loading linked Spells...");
-    sSpellMgr->LoadSpellLinked();
+    loader.AddStage("PlayerNames", { "Achievements" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Reserved Names...");
+        sObjectMgr->LoadReservedPlayerNamesDB();
+        sObjectMgr->LoadReservedPlayerNamesDBC(); // Needs to be after LoadReservedPlayerNamesDB()
 
-    LOG_INFO("server.loading", "Loading Player Create Data...");
-    sObjectMgr->LoadPlayerInfo();
+        LOG_INFO("server.loading", "Loading Profanity Names...");
+        sObjectMgr->LoadProfanityNamesFromDB();
+        sObjectMgr->LoadProfanityNamesFromDBC(); // Needs to be after LoadProfanityNamesFromDB()
 
-    LOG_INFO("server.loading", "Loading Exploration BaseXP Data...");
-    sObjectMgr->LoadExplorationBaseXP();
+        LOG_INFO("server.loading", "Loading Chat Filter...");
+        sObjectMgr->LoadChatFilter();
+    });
 
-    LOG_INFO("server.loading", "Loading Pet Name Parts...");
-    sObjectMgr->LoadPetNames();
+    loader.AddStage("GameObjectsForQuests", { "PlayerNames" }, []()
+    {
+        LOG_INFO("server.loading", "Loading GameObjects for Quests...");
+        sObjectMgr->LoadGameObjectForQuests();
+    });
 
-    CharacterDatabaseCleaner::CleanDatabase();
+    loader.AddStage("BattleMasters", { "GameObjectsForQuests" }, []()
+    {
+        LOG_INFO("server.loading", "Loading BattleMasters...");
+        sBattlegroundMgr->LoadBattleMastersEntry();
+    });
 
-    LOG_INFO("server.loading", "Loading The Max Pet Number...");
-    sObjectMgr->LoadPetNumber();
+    loader.AddStage("GameTele", { "BattleMasters" }, []()
+    {
+        LOG_INFO("server.loading", "Loading GameTeleports...");
+        sObjectMgr->LoadGameTele();
+    });
 
-    LOG_INFO("server.loading", "Loading Pet Level Stats...");
-    sObjectMgr->LoadPetLevelInfo();
+    loader.AddStage("Trainers", { "GameTele" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Trainers..."); // must be after LoadCreatureTemplates
+        sObjectMgr->LoadTrainers();
 
-    LOG_INFO("server.loading", "Loading Player Level Dependent Mail Rewards...");
-    sObjectMgr->LoadMailLevelRewards();
+        LOG_INFO("server.loading", "Loading Creature default trainers...");
+        sObjectMgr->LoadCreatureDefaultTrainers();
+    });
 
-    LOG_INFO("server.loading", "Load Mail Server definitions...");
-    sServerMailMgr->LoadMailServerTemplates();
+    loader.AddStage("Gossip", { "Trainers" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Gossip Menu...");
+        sObjectMgr->LoadGossipMenu();
 
-    // Loot tables
-    LoadLootTables();
+        LOG_INFO("server.loading", "Loading Gossip Menu Options...");
+        sObjectMgr->LoadGossipMenuItems();
+    });
 
-    LOG_INFO("server.loading", "Loading Skill Discovery Table...");
-    LoadSkillDiscoveryTable();
+    loader.AddStage("Vendors", { "Gossip" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Vendors...");
+        sObjectMgr->LoadVendors();                                   // must be after load CreatureTemplate and ItemTemplate
+    });
 
-    LOG_INFO("server.loading", "Loading Skill Extra Item Table...");
-    LoadSkillExtraItemTable();
+    loader.AddStage("Waypoints", { "Vendors" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Waypoints...");
+        sWaypointMgr->Load();
 
-    LOG_INFO("server.loading", "Loading Skill Perfection Data Table...");
-    LoadSkillPerfectItemTable();
+        LOG_INFO("server.loading", "Loading Waypoint Addons...");
+        sWaypointMgr->LoadWaypointAddons();
 
-    LOG_INFO("server.loading", "Loading Skill Fishing Base Level Requirements...");
-    sObjectMgr->LoadFishingBaseSkillLevel();
+        LOG_INFO("server.loading", "Loading SmartAI Waypoints...");
+        sSmartWaypointMgr->LoadFromDB();
+    });
 
-    LOG_INFO("server.loading", "Loading Achievements...");
-    sAchievementMgr->LoadAchievementReferenceList();
-    LOG_INFO("server.loading", "Loading Achievement Criteria Lists...");
-    sAchievementMgr->LoadAchievementCriteriaList();
-    LOG_INFO("server.loading", "Loading Achievement Criteria Data...");
-    sAchievementMgr->LoadAchievementCriteriaData();
-    LOG_INFO("server.loading", "Loading Achievement Rewards...");
-    sAchievementMgr->LoadRewards();
-    LOG_INFO("server.loading", "Loading Achievement Reward Locales...");
-    sAchievementMgr->LoadRewardLocales();
-    LOG_INFO("server.loading", "Loading Completed Achievements...");
-    sAchievementMgr->LoadCompletedAchievements();
+    loader.AddStage("Formations", { "Waypoints" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Creature Formations...");
+        sFormationMgr->LoadCreatureFormations();
+    });
 
-    ///- Load dynamic data tables from the database
-    LOG_INFO("server.loading", "Loading Item Auctions...");
-    sAuctionMgr->LoadAuctionItems();
-    LOG_INFO("server.loading", "Loading Auctions...");
-    sAuctionMgr->LoadAuctions();
+    loader.AddStage("WorldStates", { "Formations" }, []()
+    {
+        LOG_INFO("server.loading", "Loading WorldStates...");              // must be loaded before battleground, outdoor PvP and conditions
+        sWorldState->LoadWorldStates();
+    });
 
-    sGuildMgr->LoadGuilds();
+    loader.AddStage("Conditions", { "WorldStates" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Conditions...");
+        sConditionMgr->LoadConditions();
+    });
 
-    LOG_INFO("server.loading", "Loading ArenaTeams...");
-    sArenaTeamMgr->LoadArenaTeams();
+    loader.AddStage("FactionChange", { "Conditions" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Faction Change Achievement Pairs...");
+        sObjectMgr->LoadFactionChangeAchievements();
 
-    LOG_INFO("server.loading", "Loading Groups...");
-    sGroupMgr->LoadGroups();
+        LOG_INFO("server.loading", "Loading Faction Change Spell Pairs...");
+        sObjectMgr->LoadFactionChangeSpells();
 
-    LOG_INFO("server.loading", "Loading Reserved Names...");
-    sObjectMgr->LoadReservedPlayerNamesDB();
-    sObjectMgr->LoadReservedPlayerNamesDBC(); // Needs to be after LoadReservedPlayerNamesDB()
+        LOG_INFO("server.loading", "Loading Faction Change Item Pairs...");
+        sObjectMgr->LoadFactionChangeItems();
 
-    LOG_INFO("server.loading", "Loading Profanity Names...");
-    sObjectMgr->LoadProfanityNamesFromDB();
-    sObjectMgr->LoadProfanityNamesFromDBC(); // Needs to be after LoadProfanityNamesFromDB()
+        LOG_INFO("server.loading", "Loading Faction Change Reputation Pairs...");
+        sObjectMgr->LoadFactionChangeReputations();
 
-    LOG_INFO("server.loading", "Loading Chat Filter...");
-    sObjectMgr->LoadChatFilter();
+        LOG_INFO("server.loading", "Loading Faction Change Title Pairs...");
+        sObjectMgr->LoadFactionChangeTitles();
 
-    LOG_INFO("server.loading", "Loading GameObjects for Quests...");
-    sObjectMgr->LoadGameObjectForQuests();
+        LOG_INFO("server.loading", "Loading Faction Change Quest Pairs...");
+        sObjectMgr->LoadFactionChangeQuests();
+    });
 
-    LOG_INFO("server.loading", "Loading BattleMasters...");
-    sBattlegroundMgr->LoadBattleMastersEntry();
+    loader.AddStage("Tickets", { "FactionChange" }, []()
+    {
+        LOG_INFO("server.loading", "Loading GM Tickets...");
+        sTicketMgr->LoadTickets();
 
-    LOG_INFO("server.loading", "Loading GameTeleports...");
-    sObjectMgr->LoadGameTele();
+        LOG_INFO("server.loading", "Loading GM Surveys...");
+        sTicketMgr->LoadSurveys();
+    });
 
-    LOG_INFO("server.loading", "Loading Trainers..."); // must be after LoadCreatureTemplates
-    sObjectMgr->LoadTrainers();
+    loader.AddStage("Addons", { "Tickets" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Client Addons...");
+        AddonMgr::LoadFromDB();
+    });
 
-    LOG_INFO("server.loading", "Loading Creature default trainers...");
-    sObjectMgr->LoadCreatureDefaultTrainers();
+    loader.AddStage("Mail", { "Addons", "Auctions", "Guilds" }, []()
+    {
+        // pussywizard:
+        LOG_INFO("server.loading", "Deleting Invalid Mail Items...");
+        LOG_INFO("server.loading", " ");
+        CharacterDatabase.Execute("DELETE mi FROM mail_items mi LEFT JOIN item_instance ii ON mi.item_guid = ii.guid WHERE ii.guid IS NULL");
+        CharacterDatabase.Execute("DELETE mi FROM mail_items mi LEFT JOIN mail m ON mi.mail_id = m.id WHERE m.id IS NULL");
+        CharacterDatabase.Execute("UPDATE mail m LEFT JOIN mail_items mi ON m.id = mi.mail_id SET m.has_items=0 WHERE m.has_items<>0 AND mi.mail_id IS NULL");
+
+        ///- Handle outdated emails (delete/return)
+        LOG_INFO("server.loading", "Returning Old Mails...");
+        LOG_INFO("server.loading", " ");
+        sMailMgr->ReturnOrDeleteOldMails(false);
+    });
 
-    LOG_INFO("server.loading", "Loading Gossip Menu...");
-    sObjectMgr->LoadGossipMenu();
+    loader.AddStage("Autobroadcasts", { "Mail" }, []()
+    {
+        ///- Load AutoBroadCast
+        LOG_INFO("server.loading", "Loading Autobroadcasts...");
+        sAutobroadcastMgr->LoadAutobroadcasts();
+        sAutobroadcastMgr->LoadAutobroadcastsLocalized();
+    });
 
-    LOG_INFO("server.loading", "Loading Gossip Menu Options...");
-    sObjectMgr->LoadGossipMenuItems();
+    loader.AddStage("Motd", { "Autobroadcasts" }, []()
+    {
+        ///- Load Motd
+        LOG_INFO("server.loading", "Loading Motd...");
+        sMotdMgr->LoadMotd();
+    });
 
-    LOG_INFO("server.loading", "Loading Vendors...");
-    sObjectMgr->LoadVendors();                                   // must be after load CreatureTemplate and ItemTemplate
+    loader.AddStage("DBScripts", { "Motd" }, []()
+    {
+        ///- Load and initialize scripts
+        sObjectMgr->LoadSpellScripts();                              // must be after load Creature/Gameobject(Template/Data)
+        sObjectMgr->LoadEventScripts();                              // must be after load Creature/Gameobject(Template/Data)
+        sObjectMgr->LoadWaypointScripts();
 
-    LOG_INFO("server.loading", "Loading Waypoints...");
-    sWaypointMgr->Load();
+        LOG_INFO("server.loading", "Loading Spell Script Names...");
+        sObjectMgr->LoadSpellScriptNames();
+    });
 
-    LOG_INFO("server.loading", "Loading Waypoint Addons...");
-    sWaypointMgr->LoadWaypointAddons();
+    loader.AddStage("CreatureTexts", { "DBScripts" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Creature Texts...");
+        sCreatureTextMgr->LoadCreatureTexts();
 
-    LOG_INFO("server.loading", "Loading SmartAI Waypoints...");
-    sSmartWaypointMgr->LoadFromDB();
+        LOG_INFO("server.loading", "Loading Creature Text Options...");
+        sCreatureTextMgr->LoadCreatureTextOptions();
 
-    LOG_INFO("server.loading", "Loading Creature Formations...");
-    sFormationMgr->LoadCreatureFormations();
+        LOG_INFO("server.loading", "Loading Creature Text Locales...");
+        sCreatureTextMgr->LoadCreatureTextLocales();
+    });
 
-    LOG_INFO("server.loading", "Loading WorldStates...");              // must be loaded before battleground, outdoor PvP and conditions
-    sWorldState->LoadWorldStates();
+    loader.AddStage("ScriptMgr", { "CreatureTexts", "Auctions", "Groups" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Scripts...");
+        sScriptMgr->LoadDatabase();
+    });
 
-    LOG_INFO("server.loading", "Loading Conditions...");
-    sConditionMgr->LoadConditions();
+    loader.AddStage("SpellScriptValidation", { "ScriptMgr" }, []()
+    {
+        LOG_INFO("server.loading", "Validating Spell Scripts...");
+        sObjectMgr->ValidateSpellScripts();
+    });
 
-    LOG_INFO("server.loading", "Loading Faction Change Achievement Pairs...");
-    sObjectMgr->LoadFactionChangeAchievements();
+    loader.AddStage("SmartAI", { "SpellScriptValidation" }, []()
+    {
+        LOG_INFO("server.loading", "Loading SmartAI Scripts...");
+        sSmartScriptMgr->LoadSmartAIFromDB();
+    });
 
-    LOG_INFO("server.loading", "Loading Faction Change Spell Pairs...");
-    sObjectMgr->LoadFactionChangeSpells();
+    loader.AddStage("Calendar", { "SmartAI", "Guilds" }, []()
+    {
+        LOG_INFO("server.loading", "Loading Calendar Data...");
+        sCalendarMgr->LoadFromDB();
+    });
 
-    LOG_INFO("server.loading", "Loading Faction Change Item Pairs...");
-    sObjectMgr->LoadFactionChangeItems();
+    loader.AddStage("SpellInfoPrecomputedData", { "Calendar", "Locales", "RBAC", "M2Cameras", "IPLocation", "PlayerDumpTables", "AIRegistry" }, []()
+    {
+        LOG_INFO("server.loading", "Initializing SpellInfo Precomputed Data..."); // must be called after loading items, professions, spells and pretty much anything
+        LOG_INFO("server.loading", " ");
+        sObjectMgr->InitializeSpellInfoPrecomputedData();
+    });
+}
 
-    LOG_INFO("server.loading", "Loading Faction Change Reputation Pairs...");
-    sObjectMgr->LoadFactionChangeReputations();
+/// Initialize the World
+void World::SetInitialWorldSettings()
+{
+    ///- Server startup begin
+    uint32 startupBegin = getMSTime();
 
-    LOG_INFO("server.loading", "Loading Faction Change Title Pairs...");
-    sObjectMgr->LoadFactionChangeTitles();
+    ///- Initialize the random number generator
+    srand((unsigned int)GameTime::GetGameTime().count());
 
-    LOG_INFO("server.loading", "Loading Faction Change Quest Pairs...");
-    sObjectMgr->LoadFactionChangeQuests();
+    ///- Initialize detour memory management
+    dtAllocSetCustom(dtCustomAlloc, dtCustomFree);
 
-    LOG_INFO("server.loading", "Loading GM Tickets...");
-    sTicketMgr->LoadTickets();
+    ///- Initialize VMapMgr function pointers (to untangle game/collision circular deps)
+    VMAP::VMapMgr2* vmmgr2 = VMAP::VMapFactory::createOrGetVMapMgr();
+    vmmgr2->GetLiquidFlagsPtr = &GetLiquidFlags;
+    vmmgr2->IsVMAPDisabledForPtr = &DisableMgr::IsVMAPDisabledFor;
 
-    LOG_INFO("server.loading", "Loading GM Surveys...");
-    sTicketMgr->LoadSurveys();
+    ///- Initialize config settings
+    LoadConfigSettings();
 
-    LOG_INFO("server.loading", "Loading Client Addons...");
-    AddonMgr::LoadFromDB();
+    ///- Initialize Allowed Security Level
+    LoadDBAllowedSecurityLevel();
 
-    // pussywizard:
-    LOG_INFO("server.loading", "Deleting Invalid Mail Items...");
-    LOG_INFO("server.loading", " ");
-    CharacterDatabase.Execute("DELETE mi FROM mail_items mi LEFT JOIN item_instance ii ON mi.item_guid = ii.guid WHERE ii.guid IS NULL");
-    CharacterDatabase.Execute("DELETE mi FROM mail_items mi LEFT JOIN mail m ON mi.mail_id = m.id WHERE m.id IS NULL");
-    CharacterDatabase.Execute("UPDATE mail m LEFT JOIN mail_items mi ON m.id = mi.mail_id SET m.has_items=0 WHERE m.has_items<>0 AND mi.mail_id IS NULL");
+    ///- Init highest guids before any table loading to prevent using not initialized guids in some code.
+    sObjectMgr->SetHighestGuids();
 
-    ///- Handle outdated emails (delete/return)
-    LOG_INFO("server.loading", "Returning Old Mails...");
-    LOG_INFO("server.loading", " ");
-    sMailMgr->ReturnOrDeleteOldMails(false);
+    if (!sConfigMgr->isDryRun())
+    {
+        ///- Check the existence of the map files for all starting areas.
+        if (!MapMgr::ExistMapAndVMap(MAP_EASTERN_KINGDOMS, -6240.32f, 331.033f)
+                || !MapMgr::ExistMapAndVMap(MAP_EASTERN_KINGDOMS, -8949.95f, -132.493f)
+                || !MapMgr::ExistMapAndVMap(MAP_KALIMDOR, -618.518f, -4251.67f)
+                || !MapMgr::ExistMapAndVMap(MAP_EASTERN_KINGDOMS, 1676.35f, 1677.45f)
+                || !MapMgr::ExistMapAndVMap(MAP_KALIMDOR, 10311.3f, 832.463f)
+                || !MapMgr::ExistMapAndVMap(MAP_KALIMDOR, -2917.58f, -257.98f)
+                || (getIntConfig(CONFIG_EXPANSION) && (
+                        !MapMgr::ExistMapAndVMap(MAP_OUTLAND, 10349.6f, -6357.29f) ||
+                        !MapMgr::ExistMapAndVMap(MAP_OUTLAND, -3961.64f, -13931.2f))))
+        {
+            LOG_ERROR("server.loading", "Failed to find map files for starting areas");
+            exit(1);
+        }
+    }
 
-    ///- Load AutoBroadCast
-    LOG_INFO("server.loading", "Loading Autobroadcasts...");
-    sAutobroadcastMgr->LoadAutobroadcasts();
-    sAutobroadcastMgr->LoadAutobroadcastsLocalized();
+    ///- Initialize pool manager
+    sPoolMgr->Initialize();
 
-    ///- Load Motd
-    LOG_INFO("server.loading", "Loading Motd...");
-    sMotdMgr->LoadMotd();
+    ///- Initialize game event manager
+    sGameEventMgr->Initialize();
 
-    ///- Load and initialize scripts
-    sObjectMgr->LoadSpellScripts();                              // must be after load Creature/Gameobject(Template/Data)
-    sObjectMgr->LoadEventScripts();                              // must be after load Creature/Gameobject(Template/Data)
-    sObjectMgr->LoadWaypointScripts();
+    ///- Loading strings. Getting no records means core load has to be canceled because no error message can be output.
+    LOG_INFO("server.loading", " ");
+    LOG_INFO("server.loading", "Loading Acore Strings...");
+    if (!sObjectMgr->LoadAcoreStrings())
+        exit(1);                                            // Error message displayed in function already
 
-    LOG_INFO("server.loading", "Loading Spell Script Names...");
-    sObjectMgr->LoadSpellScriptNames();
+    LOG_INFO("server.loading", "Loading Module Strings...");
+    sObjectMgr->LoadModuleStrings();
+    LOG_INFO("server.loading", "Loading Module Strings Locale...");
+    sObjectMgr->LoadModuleStringsLocale();
 
-    LOG_INFO("server.loading", "Loading Creature Texts...");
-    sCreatureTextMgr->LoadCreatureTexts();
+    ///- Update the realm entry in the database with the realm type from the config file
+    //No SQL injection as values are treated as integers
 
-    LOG_INFO("server.loading", "Loading Creature Text Options...");
-    sCreatureTextMgr->LoadCreatureTextOptions();
+    // not send custom type REALM_FFA_PVP to realm list
+    uint32 server_type;
+    if (IsFFAPvPRealm())
+        server_type = REALM_TYPE_PVP;
+    else
+        server_type = getIntConfig(CONFIG_GAME_TYPE);
 
-    LOG_INFO("server.loading", "Loading Creature Text Locales...");
-    sCreatureTextMgr->LoadCreatureTextLocales();
+    uint32 realm_zone = getIntConfig(CONFIG_REALM_ZONE);
 
-    LOG_INFO("server.loading", "Loading Scripts...");
-    sScriptMgr->LoadDatabase();
+    LoginDatabase.Execute("UPDATE realmlist SET icon = {}, timezone = {} WHERE id = '{}'", server_type, realm_zone, realm.Id.Realm);      // One-time query
 
-    LOG_INFO("server.loading", "Validating Spell Scripts...");
-    sObjectMgr->ValidateSpellScripts();
+    ///- Custom Hook for loading DB items
+    sScriptMgr->OnLoadCustomDatabaseTable();
 
-    LOG_INFO("server.loading", "Loading SmartAI Scripts...");
-    sSmartScriptMgr->LoadSmartAIFromDB();
+    ///- Load the static and dynamic data tables. Stages are declared in the original
+    ///- load order; with Startup.Loader.Threads > 1, independent stages run concurrently.
+    if (getBoolConfig(CONFIG_WORLD_SNAPSHOT_ENABLE))
+        sWorldSnapshot->Open(_dataPath + std::string(getStringConfig(CONFIG_WORLD_SNAPSHOT_FILE)));
 
-    LOG_INFO("server.loading", "Loading Calendar Data...");
-    sCalendarMgr->LoadFromDB();
+    StartupLoader loader;
+    AddStartupStages(loader);
+    loader.Run(getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
+    loader.LogReport();
 
-    LOG_INFO("server.loading", "Initializing SpellInfo Precomputed Data..."); // must be called after loading items, professions, spells and pretty much anything
-    LOG_INFO("server.loading", " ");
-    sObjectMgr->InitializeSpellInfoPrecomputedData();
+    ///- Refresh the sections of the world snapshot that were loaded from the database
+    sWorldSnapshot->Save();
 
     LOG_INFO("server.loading", "Initialize Commands...");
     Acore::ChatCommands::LoadCommandMap();
@@ -1655,7 +1881,7 @@ void World::UpdateRealmCharCount(uint32 accountId)
 {
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_COUNT);
     stmt->SetData(0, accountId);
-    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&World::_UpdateRealmCharCount, this, std::placeholders::_1,accountId)));
+    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt, accountId).WithPreparedCallback(std::bind(&World::_UpdateRealmCharCount, this, std::placeholders::_1,accountId)));
 }
 
 void World::_UpdateRealmCharCount(PreparedQueryResult resultCharCount,uint32 accountId)
@@ -1675,7 +1901,7 @@ void World::_UpdateRealmCharCount(PreparedQueryResult resultCharCount,uint32 acc
     stmt->SetData(2, realm.Id.Realm);
     trans->Append(stmt);
 
-    LoginDatabase.CommitTransaction(trans);
+    LoginDatabase.CommitTransaction(trans, accountId);
 }
 
 void World::InitWeeklyQuestResetTime()
@@ -34,6 +34,7 @@
 #include <unordered_map>
 
 class Object;
+class StartupLoader;
 class WorldPacket;
 class WorldSocket;
 class SystemMgr;
@@ -278,6 +279,7 @@ private:
     LocaleConstant _defaultDbcLocale;                     // from config for one from loaded DBC locales
     uint32 _availableDbcLocaleMask;                       // by loaded DBC
     void DetectDBCLang();
+    void AddStartupStages(StartupLoader& loader);
     bool _allowMovement;
     std::string _dataPath;
 
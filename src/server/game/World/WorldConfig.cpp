@@ -150,6 +150,9 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_DURABILITY_LOSS_IN_PVP, "DurabilityLoss.InPvP", false);
 
     SetConfigValue<uint32>(CONFIG_COMPRESSION, "Compression", 1, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0 && value < 10; }, "> 0 && < 10");
+    SetConfigValue<uint32>(CONFIG_COMPRESSION_THRESHOLD, "Compression.Threshold", 100);
+    SetConfigValue<bool>(CONFIG_COMPRESSION_AUTOTUNE, "Compression.AutoTune", false);
+    SetConfigValue<uint32>(CONFIG_COMPRESSION_AUTOTUNE_CPU_BUDGET, "Compression.AutoTune.CpuBudget", 80, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0 && value <= 100; }, "> 0 && <= 100");
 
     SetConfigValue<bool>(CONFIG_ADDON_CHANNEL, "AddonChannel", true);
     SetConfigValue<bool>(CONFIG_CLEAN_CHARACTER_DB, "CleanCharacterDB", false);
@@ -297,6 +300,9 @@ void WorldConfig::BuildConfigCache()
 
     SetConfigValue<bool>(CONFIG_OBJECT_QUEST_MARKERS, "Visibility.ObjectQuestMarkers", true);
 
+    SetConfigValue<bool>(CONFIG_VISIBILITY_INCREMENTAL, "Visibility.Incremental.Enable", true);
+    SetConfigValue<uint32>(CONFIG_VISIBILITY_INCREMENTAL_FULL_UPDATE_INTERVAL, "Visibility.Incremental.FullUpdateInterval", 10000);
+
     SetConfigValue<uint32>(CONFIG_MAIL_DELIVERY_DELAY, "MailDeliveryDelay", HOUR);
 
     SetConfigValue<uint32>(CONFIG_UPTIME_UPDATE, "UpdateUptimeInterval", 10, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0; }, "> 0");
@@ -490,6 +496,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<uint32>(CONFIG_WATER_BREATH_TIMER, "WaterBreath.Timer", 180000, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0; }, "> 0");
 
     SetConfigValue<uint32>(CONFIG_CLIENTCACHE_VERSION, "ClientCacheVersion", 0);
+    SetConfigValue<bool>(CONFIG_CACHE_QUERY_RESPONSES, "QueryResponseCache.Enable", true);
 
     SetConfigValue<uint32>(CONFIG_GUILD_EVENT_LOG_COUNT, "Guild.EventLogRecordsCount", GUILD_EVENTLOG_MAX_RECORDS, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value <= GUILD_EVENTLOG_MAX_RECORDS; }, "<= GUILD_EVENTLOG_MAX_RECORDS");
     SetConfigValue<uint32>(CONFIG_GUILD_BANK_EVENT_LOG_COUNT, "Guild.BankEventLogRecordsCount", GUILD_BANKLOG_MAX_RECORDS, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value <= GUILD_BANKLOG_MAX_RECORDS; }, "<= GUILD_BANKLOG_MAX_RECORDS");
@@ -545,6 +552,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_RESPAWN_DYNAMIC_ESCORTNPC, "Respawn.DynamicEscortNPC", false);
     SetConfigValue<bool>(CONFIG_RESPAWN_FORCE_COMPATIBILITY_MODE, "Respawn.ForceCompatibilityMode", false);
 
+    SetConfigValue<bool>(CONFIG_MAP_TERRAIN_MEMORY_MAPPED, "MapTerrain.MemoryMapped", false);
     SetConfigValue<bool>(CONFIG_VMAP_INDOOR_CHECK, "vmap.enableIndoorCheck", true);
     SetConfigValue<bool>(CONFIG_VMAP_ENABLE_LOS, "vmap.enableLOS", true);
     SetConfigValue<bool>(CONFIG_VMAP_ENABLE_HEIGHT, "vmap.enableHeight", true);
@@ -569,6 +577,14 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_SHOW_MUTE_IN_WORLD, "ShowMuteInWorld", false);
     SetConfigValue<bool>(CONFIG_SHOW_BAN_IN_WORLD, "ShowBanInWorld", false);
     SetConfigValue<uint32>(CONFIG_NUMTHREADS, "MapUpdate.Threads", 1);
+    SetConfigValue<std::string>(CONFIG_MAP_UPDATE_PARALLEL_OBJECTS_MAPS, "MapUpdate.ParallelObjects.Maps", "");
+    SetConfigValue<uint32>(CONFIG_MAP_UPDATE_PARALLEL_OBJECTS_REGION_SIZE, "MapUpdate.ParallelObjects.RegionSize", 2, ConfigValueCache::Reloadable::No, [](uint32 const& value) { return value >= 1 && value <= 16; }, ">= 1 && <= 16");
+    SetConfigValue<uint32>(CONFIG_MAP_UPDATE_PARALLEL_OBJECTS_GUARD_BAND, "MapUpdate.ParallelObjects.GuardBand", 150);
+    SetConfigValue<uint32>(CONFIG_MAP_UPDATE_TERRAIN_PREFETCH_THREADS, "MapUpdate.TerrainPrefetch.Threads", 1, ConfigValueCache::Reloadable::No);
+    SetConfigValue<uint32>(CONFIG_MAP_UPDATE_TERRAIN_PREFETCH_LOOKAHEAD, "MapUpdate.TerrainPrefetch.LookAhead", 10);
+    SetConfigValue<uint32>(CONFIG_STARTUP_LOADER_THREADS, "Startup.Loader.Threads", 4, ConfigValueCache::Reloadable::No);
+    SetConfigValue<bool>(CONFIG_WORLD_SNAPSHOT_ENABLE, "WorldSnapshot.Enable", false, ConfigValueCache::Reloadable::No);
+    SetConfigValue<std::string>(CONFIG_WORLD_SNAPSHOT_FILE, "WorldSnapshot.File", "world.snapshot", ConfigValueCache::Reloadable::No);
     SetConfigValue<uint32>(CONFIG_MAX_RESULTS_LOOKUP_COMMANDS, "Command.LookupMaxResults", 0);
 
     // Warden
@@ -606,6 +622,12 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_PDUMP_NO_PATHS, "PlayerDump.DisallowPaths", true);
     SetConfigValue<bool>(CONFIG_PDUMP_NO_OVERWRITE, "PlayerDump.DisallowOverwrite", true);
     SetConfigValue<bool>(CONFIG_ENABLE_MMAPS, "MoveMaps.Enable", true);
+    SetConfigValue<uint32>(CONFIG_MMAP_QUERY_NODES_DEFAULT, "MoveMaps.QueryNodes.Default", 1024);
+    SetConfigValue<uint32>(CONFIG_MMAP_QUERY_NODES_CHASE, "MoveMaps.QueryNodes.Chase", 1024);
+    SetConfigValue<uint32>(CONFIG_MMAP_QUERY_NODES_FLEE, "MoveMaps.QueryNodes.Flee", 1024);
+    SetConfigValue<uint32>(CONFIG_MMAP_QUERY_NODES_ROAM, "MoveMaps.QueryNodes.Roam", 1024);
+    SetConfigValue<uint32>(CONFIG_MMAP_QUERY_NODES_POINT_MOVE, "MoveMaps.QueryNodes.PointMove", 1024);
+    SetConfigValue<uint32>(CONFIG_MMAP_QUERY_NODES_WAYPOINT, "MoveMaps.QueryNodes.Waypoint", 1024);
 
     // Wintergrasp
     SetConfigValue<uint32>(CONFIG_WINTERGRASP_ENABLE, "Wintergrasp.Enable", 1);
@@ -77,6 +77,7 @@ enum ServerConfigs
     CONFIG_OFFHAND_CHECK_AT_SPELL_UNLEARN,
     CONFIG_CREATURE_REPOSITION_AGAINST_NPCS,
     CONFIG_CREATURE_INSTANCE_TELEPORT_TO_UNREACHABLE_TARGET,
+    CONFIG_MAP_TERRAIN_MEMORY_MAPPED,
     CONFIG_VMAP_INDOOR_CHECK,
     CONFIG_VMAP_ENABLE_LOS,
     CONFIG_VMAP_ENABLE_HEIGHT,
@@ -166,6 +167,9 @@ enum ServerConfigs
     CONFIG_RESPAWN_DYNAMICRATE_GAMEOBJECT,
     CONFIG_RESPAWN_DYNAMICRATE_CREATURE,
     CONFIG_COMPRESSION,
+    CONFIG_COMPRESSION_THRESHOLD,
+    CONFIG_COMPRESSION_AUTOTUNE,
+    CONFIG_COMPRESSION_AUTOTUNE_CPU_BUDGET,
     CONFIG_INTERVAL_MAPUPDATE,
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
@@ -305,10 +309,27 @@ enum ServerConfigs
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_NUMTHREADS,
+    CONFIG_MAP_UPDATE_PARALLEL_OBJECTS_MAPS,
+    CONFIG_MAP_UPDATE_PARALLEL_OBJECTS_REGION_SIZE,
+    CONFIG_MAP_UPDATE_PARALLEL_OBJECTS_GUARD_BAND,
+    CONFIG_MAP_UPDATE_TERRAIN_PREFETCH_THREADS,
+    CONFIG_MAP_UPDATE_TERRAIN_PREFETCH_LOOKAHEAD,
+    CONFIG_STARTUP_LOADER_THREADS,
+    CONFIG_WORLD_SNAPSHOT_ENABLE,
+    CONFIG_WORLD_SNAPSHOT_FILE,
+    CONFIG_MMAP_QUERY_NODES_DEFAULT,
+    CONFIG_MMAP_QUERY_NODES_CHASE,
+    CONFIG_MMAP_QUERY_NODES_FLEE,
+    CONFIG_MMAP_QUERY_NODES_ROAM,
+    CONFIG_MMAP_QUERY_NODES_POINT_MOVE,
+    CONFIG_MMAP_QUERY_NODES_WAYPOINT,
+    CONFIG_VISIBILITY_INCREMENTAL,
+    CONFIG_VISIBILITY_INCREMENTAL_FULL_UPDATE_INTERVAL,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_MAX_ALLOWED_MMR_DROP,
     CONFIG_CLIENTCACHE_VERSION,
+    CONFIG_CACHE_QUERY_RESPONSES,
     CONFIG_GUILD_EVENT_LOG_COUNT,
     CONFIG_GUILD_BANK_EVENT_LOG_COUNT,
     CONFIG_MIN_LEVEL_STAT_SAVE,
@@ -32,6 +32,7 @@
 #include "MotdMgr.h"
 #include "ObjectMgr.h"
 #include "PoolMgr.h"
+#include "QueryResponseCache.h"
 #include "RBAC.h"
 #include "ScriptMgr.h"
 #include "ServerMailMgr.h"
@@ -96,6 +97,7 @@ public:
             { "creature_movement_override",     HandleReloadCreatureMovementOverrideCommand,    rbac::RBAC_PERM_COMMAND_RELOAD_CREATURE_MOVEMENT_OVERRIDE, Console::Yes},
             { "creature_onkill_reputation",     HandleReloadOnKillReputationCommand,           rbac::RBAC_PERM_COMMAND_RELOAD_CREATURE_ONKILL_REPUTATION, Console::Yes },
             { "creature_queststarter",         HandleReloadCreatureQuestStarterCommand,       rbac::RBAC_PERM_COMMAND_RELOAD_CREATURE_QUESTSTARTER, Console::Yes },
+            { "creature_questitem",            HandleReloadCreatureQuestItemCommand,          rbac::RBAC_PERM_COMMAND_RELOAD, Console::Yes },
             { "creature_template",             HandleReloadCreatureTemplateCommand,           rbac::RBAC_PERM_COMMAND_RELOAD_CREATURE_TEMPLATE, Console::Yes },
             { "disables",                      HandleReloadDisablesCommand,                   rbac::RBAC_PERM_COMMAND_RELOAD_DISABLES, Console::Yes },
             { "disenchant_loot_template",      HandleReloadLootTemplatesDisenchantCommand,    rbac::RBAC_PERM_COMMAND_RELOAD_DISENCHANT_LOOT_TEMPLATE, Console::Yes },
@@ -107,6 +109,7 @@ public:
             { "gameobject_questender",         HandleReloadGOQuestEnderCommand,               rbac::RBAC_PERM_COMMAND_RELOAD_GAMEOBJECT_QUESTENDER, Console::Yes },
             { "gameobject_loot_template",      HandleReloadLootTemplatesGameobjectCommand,    rbac::RBAC_PERM_COMMAND_RELOAD_GAMEOBJECT_QUEST_LOOT_TEMPLATE, Console::Yes },
             { "gameobject_queststarter",       HandleReloadGOQuestStarterCommand,             rbac::RBAC_PERM_COMMAND_RELOAD_GAMEOBJECT_QUESTSTARTER, Console::Yes },
+            { "gameobject_questitem",          HandleReloadGOQuestItemCommand,                rbac::RBAC_PERM_COMMAND_RELOAD, Console::Yes },
             { "gm_tickets",                    HandleReloadGMTicketsCommand,                  rbac::RBAC_PERM_COMMAND_RELOAD_GM_TICKETS, Console::Yes },
             { "gossip_menu",                   HandleReloadGossipMenuCommand,                 rbac::RBAC_PERM_COMMAND_RELOAD_GOSSIP_MENU, Console::Yes },
             { "gossip_menu_option",            HandleReloadGossipMenuOptionCommand,           rbac::RBAC_PERM_COMMAND_RELOAD_GOSSIP_MENU_OPTION, Console::Yes },
@@ -432,6 +435,7 @@ public:
         LOG_INFO("server.loading", "Reloading Broadcast texts...");
         sObjectMgr->LoadBroadcastTexts();
         sObjectMgr->LoadBroadcastTextLocales();
+        sQueryResponseCache->Invalidate(QUERY_CACHE_NPC_TEXT);
         handler->SendGlobalGMSysMessage("DB table `broadcast_text` reloaded.");
         return true;
     }
@@ -489,6 +493,8 @@ public:
             sObjectMgr->CheckCreatureTemplate(cInfo);
         }
 
+        sQueryResponseCache->Invalidate(QUERY_CACHE_CREATURE);
+
         handler->SendGlobalGMSysMessage("Creature template reloaded.");
         return true;
     }
@@ -553,6 +559,24 @@ public:
         return true;
     }
 
+    static bool HandleReloadGOQuestItemCommand(ChatHandler* handler)
+    {
+        LOG_INFO("server.loading", "Loading Gameobject Quest Items... (`gameobject_questitem`)");
+        sObjectMgr->LoadGameObjectQuestItems();
+        sQueryResponseCache->Invalidate(QUERY_CACHE_GAMEOBJECT);
+        handler->SendGlobalGMSysMessage("DB table `gameobject_questitem` reloaded.");
+        return true;
+    }
+
+    static bool HandleReloadCreatureQuestItemCommand(ChatHandler* handler)
+    {
+        LOG_INFO("server.loading", "Loading Creature Quest Items... (`creature_questitem`)");
+        sObjectMgr->LoadCreatureQuestItems();
+        sQueryResponseCache->Invalidate(QUERY_CACHE_CREATURE);
+        handler->SendGlobalGMSysMessage("DB table `creature_questitem` reloaded.");
+        return true;
+    }
+
     static bool HandleReloadQuestAreaTriggersCommand(ChatHandler* handler)
     {
         LOG_INFO("server.loading", "Reloading Quest Area Triggers...");
@@ -576,6 +600,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Quest Templates...");
         sObjectMgr->LoadQuests();
+        sQueryResponseCache->Invalidate(QUERY_CACHE_QUEST);
         handler->SendGlobalGMSysMessage("DB table `quest_template` (quest definitions) reloaded.");
 
         /// dependent also from `gameobject` but this table not reloaded anyway
@@ -983,6 +1008,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Page Texts...");
         sObjectMgr->LoadPageTexts();
+        sQueryResponseCache->Invalidate(QUERY_CACHE_PAGE_TEXT);
         handler->SendGlobalGMSysMessage("DB table `page_texts` reloaded.");
         handler->SendGlobalGMSysMessage("You need to delete your client cache or change the cache number in config in order for your players see the changes.");
         return true;
@@ -1116,6 +1142,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Creature Template Locale...");
         sObjectMgr->LoadCreatureLocales();
+        sQueryResponseCache->Invalidate(QUERY_CACHE_CREATURE);
         handler->SendGlobalGMSysMessage("DB table `creature_template_locale` reloaded.");
         return true;
     }
@@ -1132,6 +1159,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Gameobject Template Locale ... ");
         sObjectMgr->LoadGameObjectLocales();
+        sQueryResponseCache->Invalidate(QUERY_CACHE_GAMEOBJECT);
         handler->SendGlobalGMSysMessage("DB table `gameobject_template_locale` reloaded.");
         return true;
     }
@@ -1148,6 +1176,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Item Template Locale ... ");
         sObjectMgr->LoadItemLocales();
+        sQueryResponseCache->Invalidate(QUERY_CACHE_ITEM);
         handler->SendGlobalGMSysMessage("DB table `item_template_locale` reloaded.");
         return true;
     }
@@ -1164,6 +1193,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading NPC Text Locale ... ");
         sObjectMgr->LoadNpcTextLocales();
+        sQueryResponseCache->Invalidate(QUERY_CACHE_NPC_TEXT);
         handler->SendGlobalGMSysMessage("DB table `npc_text_locale` reloaded.");
         return true;
     }
@@ -1172,6 +1202,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Page Text Locale ... ");
         sObjectMgr->LoadPageTextLocales();
+        sQueryResponseCache->Invalidate(QUERY_CACHE_PAGE_TEXT);
         handler->SendGlobalGMSysMessage("DB table `page_text_locale` reloaded.");
         handler->SendGlobalGMSysMessage("You need to delete your client cache or change the cache number in config in order for your players see the changes.");
         return true;
@@ -1189,6 +1220,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Locales Quest ... ");
         sObjectMgr->LoadQuestLocales();
+        sQueryResponseCache->Invalidate(QUERY_CACHE_QUEST);
         handler->SendGlobalGMSysMessage("DB table `quest_template_locale` reloaded.");
         return true;
     }
@@ -18,13 +18,15 @@
 #include "DBCStore.h"
 #include "DBCDatabaseLoader.h"
 
-DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _indexTableSize(0)
+DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _dataTableMapped(false), _indexTableSize(0)
 {
 }
 
 DBCStorageBase::~DBCStorageBase()
 {
-    delete[] _dataTable;
+    if (!_dataTableMapped)
+        delete[] _dataTable;
+
     for (char* strings : _stringPool)
         delete[] strings;
 }
@@ -41,12 +43,14 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
 
     _fieldCount = dbc.GetCols();
 
-    // load raw non-string data
+    // load raw non-string data, used in place if the file has the structure layout
+    _dataTableMapped = dbc.HasNativeLayout(_fileFormat);
     _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
 
     // load strings from dbc data
-    if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
-        _stringPool.push_back(stringBlock);
+    dbc.AutoProduceStrings(_fileFormat, _dataTable);
+    if (_dataTableMapped || strchr(_fileFormat, FT_STRING))
+        _mappedFiles.push_back(dbc.ReleaseFile());
 
     // error in dbc file at loading if nullptr
     return indexTable != nullptr;
@@ -65,8 +69,11 @@ bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
         return false;
 
     // load strings from another locale dbc data
-    if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
-        _stringPool.push_back(stringBlock);
+    if (strchr(_fileFormat, FT_STRING))
+    {
+        dbc.AutoProduceStrings(_fileFormat, _dataTable);
+        _mappedFiles.push_back(dbc.ReleaseFile());
+    }
 
     return true;
 }
@@ -21,7 +21,9 @@
 #include "Common.h"
 #include "DBCStorageIterator.h"
 #include "Errors.h"
+#include "MappedFile.h"
 #include <cstring>
+#include <memory>
 #include <vector>
 
 /// Interface class for common access
@@ -46,7 +48,9 @@ protected:
     uint32 _fieldCount;
     char const* _fileFormat;
     char* _dataTable;
+    bool _dataTableMapped;                                  // records used in place from the mapped file
     std::vector<char*> _stringPool;
+    std::vector<std::unique_ptr<MappedFile>> _mappedFiles;  // DBC files records and strings point into
     uint32 _indexTableSize;
 };
 
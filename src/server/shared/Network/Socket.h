@@ -18,18 +18,24 @@
 #ifndef __SOCKET_H__
 #define __SOCKET_H__
 
+#include "ByteBuffer.h"
+#include "Errors.h"
 #include "Log.h"
 #include "MessageBuffer.h"
+#include <array>
 #include <atomic>
+#include <boost/asio/buffer.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <deque>
 #include <memory>
-#include <queue>
 #include <type_traits>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+#define WRITE_GATHER_MAX_BUFFERS 64
 #ifdef BOOST_ASIO_HAS_IOCP
 #define AC_SOCKET_USE_IOCP
 #endif
@@ -63,6 +69,72 @@ enum ProxyHeaderAddressFamilyAndProtocol {
     PROXY_HEADER_ADDRESS_FAMILY_AND_PROTOCOL_TCP_V6 = 0x21,
 };
 
+/// Single entry of the socket write queue. Either owns its bytes (MessageBuffer) or is a small inline
+/// header followed by a refcounted payload that may be shared with other sockets, so broadcasts are
+/// written straight from the original packet storage.
+class SocketWriteBuffer
+{
+public:
+    static constexpr std::size_t MaxHeaderSize = 8;
+
+    explicit SocketWriteBuffer(MessageBuffer&& buffer) : _buffer(std::move(buffer)), _headerSize(0), _headerPos(0), _payloadPos(0) { }
+
+    SocketWriteBuffer(uint8 const* header, std::size_t headerSize, std::shared_ptr<ByteBuffer const> payload)
+        : _buffer(0), _headerSize(uint8(headerSize)), _headerPos(0), _payload(std::move(payload)), _payloadPos(0)
+    {
+        ASSERT(headerSize <= MaxHeaderSize);
+        memcpy(_header.data(), header, headerSize);
+    }
+
+    /// Appends the unsent parts of this entry to a buffer sequence, returns false when it did not fit
+    bool AppendTo(std::vector<boost::asio::const_buffer>& buffers) const
+    {
+        std::size_t needed = (_headerPos < _headerSize ? 1 : 0) + (GetPayloadRemaining() ? 1 : 0) + (_buffer.GetActiveSize() ? 1 : 0);
+        if (buffers.size() + needed > WRITE_GATHER_MAX_BUFFERS)
+            return false;
+
+        if (_buffer.GetActiveSize())
+            buffers.emplace_back(const_cast<MessageBuffer&>(_buffer).GetReadPointer(), _buffer.GetActiveSize());
+
+        if (_headerPos < _headerSize)
+            buffers.emplace_back(_header.data() + _headerPos, _headerSize - _headerPos);
+
+        if (std::size_t remaining = GetPayloadRemaining())
+            buffers.emplace_back(_payload->contents() + _payloadPos, remaining);
+
+        return true;
+    }
+
+    /// Marks up to bytes as sent, returns how many of them belonged to this entry
+    std::size_t Consume(std::size_t bytes)
+    {
+        std::size_t consumed = std::min<std::size_t>(bytes, _buffer.GetActiveSize());
+        _buffer.ReadCompleted(consumed);
+
+        std::size_t headerPart = std::min<std::size_t>(bytes - consumed, _headerSize - _headerPos);
+        _headerPos += uint8(headerPart);
+        consumed += headerPart;
+
+        std::size_t payloadPart = std::min<std::size_t>(bytes - consumed, GetPayloadRemaining());
+        _payloadPos += payloadPart;
+        consumed += payloadPart;
+
+        return consumed;
+    }
+
+    [[nodiscard]] bool IsEmpty() const { return !_buffer.GetActiveSize() && _headerPos == _headerSize && !GetPayloadRemaining(); }
+
+private:
+    [[nodiscard]] std::size_t GetPayloadRemaining() const { return _payload ? _payload->size() - _payloadPos : 0; }
+
+    MessageBuffer _buffer;
+    std::array<uint8, MaxHeaderSize> _header;
+    uint8 _headerSize;
+    uint8 _headerPos;
+    std::shared_ptr<ByteBuffer const> _payload;
+    std::size_t _payloadPos;
+};
+
 template<class T>
 class Socket : public std::enable_shared_from_this<T>
 {
@@ -158,7 +230,17 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.emplace_back(std::move(buffer));
+
+#ifdef AC_SOCKET_USE_IOCP
+        AsyncProcessQueue();
+#endif
+    }
+
+    /// Queues a header followed by a payload without copying the payload, which may be shared with other sockets
+    void QueuePacket(uint8 const* header, std::size_t headerSize, std::shared_ptr<ByteBuffer const> payload)
+    {
+        _writeQueue.emplace_back(header, headerSize, std::move(payload));
 
 #ifdef AC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -211,8 +293,8 @@ protected:
         _isWritingAsync = true;
 
 #ifdef AC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()), std::bind(&Socket<T>::WriteHandler,
+        GatherWriteBuffers();
+        _socket.async_write_some(_writeBuffers, std::bind(&Socket<T>::WriteHandler,
             this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
 #else
         _socket.async_wait(boost::asio::socket_base::wait_write, [self = this->shared_from_this()](boost::system::error_code error)
@@ -234,6 +316,30 @@ protected:
     }
 
 private:
+    /// Collects as much of the write queue as fits in one vectored write, returns the number of bytes gathered
+    std::size_t GatherWriteBuffers()
+    {
+        _writeBuffers.clear();
+        for (SocketWriteBuffer const& queued : _writeQueue)
+            if (!queued.AppendTo(_writeBuffers))
+                break;
+
+        return boost::asio::buffer_size(_writeBuffers);
+    }
+
+    /// Drops everything that was fully written from the front of the queue
+    void ConsumeWriteQueue(std::size_t bytes)
+    {
+        while (!_writeQueue.empty())
+        {
+            bytes -= _writeQueue.front().Consume(bytes);
+            if (!_writeQueue.front().IsEmpty())
+                break;
+
+            _writeQueue.pop_front();
+        }
+    }
+
     void ReadHandlerInternal(boost::system::error_code error, std::size_t transferredBytes)
     {
         if (error)
@@ -365,10 +471,7 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            ConsumeWriteQueue(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -392,12 +495,10 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        std::size_t bytesToSend = GatherWriteBuffers();
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(_writeBuffers, error);
 
         if (error)
         {
@@ -406,7 +507,7 @@ private:
                 return AsyncProcessQueue();
             }
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
 
             if (_state.load() == SocketState::Closing && _writeQueue.empty())
             {
@@ -417,7 +518,7 @@ private:
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
 
             if (_state.load() == SocketState::Closing && _writeQueue.empty())
             {
@@ -426,13 +527,11 @@ private:
 
             return false;
         }
-        else if (bytesSent < bytesToSend) // now n > 0
-        {
-            queuedMessage.ReadCompleted(bytesSent);
-            return AsyncProcessQueue();
-        }
 
-        _writeQueue.pop();
+        ConsumeWriteQueue(bytesSent);
+
+        if (bytesSent < bytesToSend) // now n > 0
+            return AsyncProcessQueue();
 
         if (_state.load() == SocketState::Closing && _writeQueue.empty())
         {
@@ -449,7 +548,8 @@ private:
     uint16 _remotePort;
 
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<SocketWriteBuffer> _writeQueue;
+    std::vector<boost::asio::const_buffer> _writeBuffers;
 
     std::atomic<SocketState> _state;
 
@@ -17,6 +17,7 @@
 
 #include "RealmList.h"
 #include "DatabaseEnv.h"
+#include "IoContext.h"
 #include "Log.h"
 #include "QueryResult.h"
 #include "Resolver.h"
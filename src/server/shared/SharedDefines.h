@@ -1123,6 +1123,7 @@ enum SpellCastResult : uint8
     SPELL_FAILED_TARGET_CANNOT_BE_RESURRECTED = 186,
     SPELL_FAILED_UNKNOWN = 187, // actually doesn't exist in client
 
+    SPELL_CAST_DEFERRED = 254, // custom value, cast from the merge phase of a parallel region update and not checked yet, must not be sent to client
     SPELL_CAST_OK = 255 // custom value, must not be sent to client
 };
 
@@ -1378,13 +1378,14 @@ AC_API_EXPORT EnumText EnumUtils<SpellCastResult>::ToString(SpellCastResult valu
         case SPELL_FAILED_PET_CAN_RENAME: return { "SPELL_FAILED_PET_CAN_RENAME", "SPELL_FAILED_PET_CAN_RENAME", "" };
         case SPELL_FAILED_TARGET_CANNOT_BE_RESURRECTED: return { "SPELL_FAILED_TARGET_CANNOT_BE_RESURRECTED", "SPELL_FAILED_TARGET_CANNOT_BE_RESURRECTED", "" };
         case SPELL_FAILED_UNKNOWN: return { "SPELL_FAILED_UNKNOWN", "SPELL_FAILED_UNKNOWN", "actually doesn't exist in client" };
+        case SPELL_CAST_DEFERRED: return { "SPELL_CAST_DEFERRED", "SPELL_CAST_DEFERRED", "custom value, cast from the merge phase of a parallel region update and not checked yet, must not be sent to client" };
         case SPELL_CAST_OK: return { "SPELL_CAST_OK", "SPELL_CAST_OK", "custom value, must not be sent to client" };
         default: throw std::out_of_range("value");
     }
 }
 
 template <>
-AC_API_EXPORT std::size_t EnumUtils<SpellCastResult>::Count() { return 189; }
+AC_API_EXPORT std::size_t EnumUtils<SpellCastResult>::Count() { return 190; }
 
 template <>
 AC_API_EXPORT SpellCastResult EnumUtils<SpellCastResult>::FromIndex(std::size_t index)
@@ -1579,7 +1580,8 @@ AC_API_EXPORT SpellCastResult EnumUtils<SpellCastResult>::FromIndex(std::size_t
         case 185: return SPELL_FAILED_PET_CAN_RENAME;
         case 186: return SPELL_FAILED_TARGET_CANNOT_BE_RESURRECTED;
         case 187: return SPELL_FAILED_UNKNOWN;
-        case 188: return SPELL_CAST_OK;
+        case 188: return SPELL_CAST_DEFERRED;
+        case 189: return SPELL_CAST_OK;
         default: throw std::out_of_range("index");
     }
 }
@@ -1777,7 +1779,8 @@ AC_API_EXPORT std::size_t EnumUtils<SpellCastResult>::ToIndex(SpellCastResult va
         case SPELL_FAILED_PET_CAN_RENAME: return 185;
         case SPELL_FAILED_TARGET_CANNOT_BE_RESURRECTED: return 186;
         case SPELL_FAILED_UNKNOWN: return 187;
-        case SPELL_CAST_OK: return 188;
+        case SPELL_CAST_DEFERRED: return 188;
+        case SPELL_CAST_OK: return 189;
         default: throw std::out_of_range("value");
     }
 }
@@ -0,0 +1,378 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file EventSchedulerBenchmark.cpp
+ * @brief Compares EventMap and EventProcessor with their former multimap storage
+ *
+ * Both workloads run once against a copy of the multimap based implementations
+ * the timing wheel replaced and once against EventMap and EventProcessor. The
+ * order of all executed and aborted events is hashed, so the two runs have to
+ * produce the same checksum besides being timed.
+ *
+ * boss scripts: creatures with ~10 EventMap events repeated every 5 to 30 seconds,
+ *               some of them delaying or cancelling an event group
+ * auras:        units with short lived periodic EventProcessor events, some of
+ *               them cancelled by group or killed on death
+ *
+ * Usage: event_benchmark [simulated seconds]
+ * Every workload runs three times, the fastest run is reported.
+ * Returns 1 when the legacy and the timing wheel runs executed different events.
+ */
+
+#include "EventMap.h"
+#include "EventProcessor.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr uint32 UPDATE_DIFF = 50;
+
+    class LegacyEventMap
+    {
+        struct Event
+        {
+            uint32 Id;
+            uint32 GroupMask;
+        };
+
+    public:
+        void Update(uint32 time) { _time += time; }
+
+        void ScheduleEvent(uint32 eventId, Milliseconds time, uint32 group = 0u)
+        {
+            _eventMap.emplace(_time + time.count(), Event{ eventId, group ? 1u << (group - 1u) : 0u });
+        }
+
+        void Repeat(Milliseconds time)
+        {
+            _eventMap.emplace(_time + time.count(), _lastEvent);
+        }
+
+        uint32 ExecuteEvent()
+        {
+            auto itr = _eventMap.begin();
+            if (itr == _eventMap.end() || itr->first > _time)
+                return 0;
+
+            _lastEvent = itr->second;
+            _eventMap.erase(itr);
+            return _lastEvent.Id;
+        }
+
+        void DelayEvents(Milliseconds delay, uint32 group)
+        {
+            std::multimap<uint64, Event> delayed;
+            for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+            {
+                if (itr->second.GroupMask & (1u << (group - 1u)))
+                {
+                    delayed.emplace(itr->first + delay.count(), itr->second);
+                    itr = _eventMap.erase(itr);
+                    continue;
+                }
+
+                ++itr;
+            }
+
+            _eventMap.insert(delayed.begin(), delayed.end());
+        }
+
+        void CancelEventGroup(uint32 group)
+        {
+            for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+            {
+                if (itr->second.GroupMask & (1u << (group - 1u)))
+                {
+                    _eventMap.erase(itr);
+                    itr = _eventMap.begin();
+                    continue;
+                }
+
+                ++itr;
+            }
+        }
+
+    private:
+        uint64 _time{ 0 };
+        std::multimap<uint64, Event> _eventMap;
+        Event _lastEvent{ 0, 0 };
+    };
+
+    // only running events, which is all the aura workload creates
+    class LegacyEventProcessor
+    {
+        // BasicEvent keeps its group private to EventProcessor
+        typedef std::multimap<uint64, std::pair<BasicEvent*, uint8>> EventList;
+
+    public:
+        ~LegacyEventProcessor() { KillAllEvents(true); }
+
+        void Update(uint32 p_time)
+        {
+            m_time += p_time;
+
+            EventList::iterator i;
+            while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+            {
+                BasicEvent* event = i->second.first;
+                m_events.erase(i);
+
+                if (event->Execute(m_time, p_time))
+                    delete event;
+            }
+        }
+
+        void AddEventAtOffset(BasicEvent* event, Milliseconds offset, uint8 eventGroup = 0)
+        {
+            m_events.emplace(m_time + offset.count(), std::make_pair(event, eventGroup));
+        }
+
+        void KillAllEvents(bool /*force*/)
+        {
+            for (auto const& [time, event] : m_events)
+            {
+                event.first->Abort(m_time);
+                delete event.first;
+            }
+
+            m_events.clear();
+        }
+
+        void CancelEventGroup(uint8 group)
+        {
+            for (auto itr = m_events.begin(); itr != m_events.end();)
+            {
+                if (itr->second.second != group)
+                {
+                    ++itr;
+                    continue;
+                }
+
+                itr->second.first->Abort(m_time);
+                delete itr->second.first;
+                itr = m_events.erase(itr);
+            }
+        }
+
+    private:
+        uint64 m_time{ 0 };
+        EventList m_events;
+    };
+
+    struct Checksum
+    {
+        uint64 Hash{ 1469598103934665603ull };
+        uint64 Count{ 0 };
+
+        void Add(uint64 value)
+        {
+            Hash = (Hash ^ value) * 1099511628211ull;
+            ++Count;
+        }
+    };
+
+    struct Result
+    {
+        double Seconds;
+        Checksum Events;
+    };
+
+    enum BossEvents
+    {
+        EVENT_CLEAVE = 1,
+        EVENT_FEAR,
+        EVENT_ENRAGE,
+        // summon and phase events of group 1 and 2
+        EVENT_FIRST_GROUP_EVENT = 4,
+        EVENT_MAX = 11
+    };
+
+    template<class Map>
+    Result RunBossScripts(uint32 creatures, uint32 seconds)
+    {
+        std::mt19937 rng(42);
+        auto randMs = [&rng](uint32 min, uint32 max) { return Milliseconds(std::uniform_int_distribution<uint32>(min, max)(rng)); };
+
+        std::vector<Map> maps(creatures);
+        for (Map& events : maps)
+            for (uint32 eventId = 1; eventId < EVENT_MAX; ++eventId)
+                events.ScheduleEvent(eventId, randMs(5000, 30000), eventId >= EVENT_FIRST_GROUP_EVENT ? 1 + eventId % 2 : 0);
+
+        Result result{ 0.0, {} };
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 tick = 0; tick < seconds * 1000 / UPDATE_DIFF; ++tick)
+        {
+            for (uint32 i = 0; i < creatures; ++i)
+            {
+                Map& events = maps[i];
+                events.Update(UPDATE_DIFF);
+                while (uint32 eventId = events.ExecuteEvent())
+                {
+                    result.Events.Add((uint64(tick) << 40) | (uint64(i) << 8) | eventId);
+                    switch (eventId)
+                    {
+                        case EVENT_FEAR:
+                            events.DelayEvents(randMs(1000, 3000), 1);
+                            events.Repeat(randMs(5000, 30000));
+                            break;
+                        case EVENT_ENRAGE:
+                            events.CancelEventGroup(2);
+                            for (uint32 groupEvent = EVENT_FIRST_GROUP_EVENT + 1; groupEvent < EVENT_MAX; groupEvent += 2)
+                                events.ScheduleEvent(groupEvent, randMs(5000, 30000), 2);
+                            events.Repeat(randMs(5000, 30000));
+                            break;
+                        default:
+                            events.Repeat(randMs(5000, 30000));
+                            break;
+                    }
+                }
+            }
+        }
+
+        result.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+    template<class Processor>
+    class AuraTickEvent : public BasicEvent
+    {
+    public:
+        AuraTickEvent(Processor& events, Checksum& checksum, uint64 id, uint32 period, uint32 ticks, uint8 group)
+            : _events(events), _checksum(checksum), _id(id), _period(period), _ticks(ticks), _group(group) { }
+
+        bool Execute(uint64 e_time, uint32 /*p_time*/) override
+        {
+            _checksum.Add((e_time << 24) ^ _id);
+            if (!--_ticks)
+                return true;
+
+            _events.AddEventAtOffset(this, Milliseconds(_period), _group);
+            return false;
+        }
+
+        void Abort(uint64 e_time) override
+        {
+            _checksum.Add((e_time << 24) ^ _id ^ 0xFFFFFF);
+        }
+
+    private:
+        Processor& _events;
+        Checksum& _checksum;
+        uint64 _id;
+        uint32 _period;
+        uint32 _ticks;
+        uint8 _group;
+    };
+
+    template<class Processor>
+    Result RunAuras(uint32 units, uint32 seconds)
+    {
+        std::mt19937 rng(7);
+        auto rand = [&rng](uint32 min, uint32 max) { return std::uniform_int_distribution<uint32>(min, max)(rng); };
+
+        Result result{ 0.0, {} };
+        std::vector<std::unique_ptr<Processor>> processors;
+        for (uint32 i = 0; i < units; ++i)
+            processors.push_back(std::make_unique<Processor>());
+
+        uint64 nextId = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 tick = 0; tick < seconds * 1000 / UPDATE_DIFF; ++tick)
+        {
+            for (uint32 i = 0; i < units; ++i)
+            {
+                Processor& events = *processors[i];
+
+                // a few new auras, spell hits and delayed casts each tick
+                for (uint32 added = rand(0, 3); added; --added)
+                {
+                    uint8 group = uint8(rand(0, 2));
+                    events.AddEventAtOffset(new AuraTickEvent<Processor>(events, result.Events, ++nextId, rand(100, 2000), rand(1, 8), group),
+                        Milliseconds(rand(0, 1500)), group);
+                }
+
+                // leaving combat, death
+                uint32 roll = rand(0, 999);
+                if (roll < 20)
+                    events.CancelEventGroup(1);
+                else if (roll < 22)
+                    events.KillAllEvents(false);
+
+                events.Update(UPDATE_DIFF);
+            }
+        }
+
+        result.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        processors.clear();
+        return result;
+    }
+
+    // every run executes the same events, the fastest one is the least disturbed
+    template<class Run>
+    Result RunBest(Run run)
+    {
+        Result best = run();
+        for (uint32 i = 1; i < 3; ++i)
+        {
+            Result result = run();
+            if (result.Seconds < best.Seconds)
+                best = result;
+        }
+
+        return best;
+    }
+
+    void Report(char const* name, Result const& legacy, Result const& wheel)
+    {
+        std::printf("%-14s %10llu %12.1f %12.1f %7.2fx\n", name, (unsigned long long)wheel.Events.Count,
+            legacy.Seconds * 1e9 / legacy.Events.Count, wheel.Seconds * 1e9 / wheel.Events.Count, legacy.Seconds / wheel.Seconds);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32 seconds = 120;
+    if (argc > 1)
+        seconds = std::max(1, std::atoi(argv[1]));
+
+    std::printf("%-14s %10s %12s %12s %8s\n", "workload", "events", "legacy ns", "wheel ns", "speedup");
+
+    Result legacyBoss = RunBest([seconds]() { return RunBossScripts<LegacyEventMap>(2000, seconds); });
+    Result wheelBoss = RunBest([seconds]() { return RunBossScripts<EventMap>(2000, seconds); });
+    Report("boss scripts", legacyBoss, wheelBoss);
+
+    Result legacyAuras = RunBest([seconds]() { return RunAuras<LegacyEventProcessor>(500, seconds); });
+    Result wheelAuras = RunBest([seconds]() { return RunAuras<EventProcessor>(500, seconds); });
+    Report("auras", legacyAuras, wheelAuras);
+
+    if (legacyBoss.Events.Hash != wheelBoss.Events.Hash || legacyBoss.Events.Count != wheelBoss.Events.Count
+        || legacyAuras.Events.Hash != wheelAuras.Events.Hash || legacyAuras.Events.Count != wheelAuras.Events.Count)
+    {
+        std::printf("The timing wheel executed different events than the multimap\n");
+        return 1;
+    }
+
+    return 0;
+}
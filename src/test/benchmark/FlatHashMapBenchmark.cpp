@@ -0,0 +1,166 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file FlatHashMapBenchmark.cpp
+ * @brief Compares Acore::FlatHashMap with std::unordered_map on GUID keys
+ *
+ * Both maps are filled with the raw guids of creatures of one map, then looked
+ * up and churned the way visibility containers are when objects leave and
+ * enter sight. The memory per entry is counted by the allocator, the time per
+ * insert, find and erase+insert is reported.
+ *
+ * Usage: flat_map_benchmark [operations per map size]
+ * Returns 1 when the two maps found a different number of lookups.
+ */
+
+#include "FlatHashMap.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    std::size_t AllocatedBytes = 0;
+
+    template<class T>
+    struct CountingAllocator
+    {
+        typedef T value_type;
+
+        CountingAllocator() = default;
+        template<class U> CountingAllocator(CountingAllocator<U> const&) { }
+
+        T* allocate(std::size_t n)
+        {
+            AllocatedBytes += n * sizeof(T);
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n)
+        {
+            AllocatedBytes -= n * sizeof(T);
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        template<class U> bool operator==(CountingAllocator<U> const&) const { return true; }
+    };
+
+    typedef std::pair<uint64 const, void*> NodeValue;
+    typedef std::unordered_map<uint64, void*, std::hash<uint64>, std::equal_to<uint64>, CountingAllocator<NodeValue>> NodeMap;
+    typedef Acore::FlatHashMap<uint64, void*, std::hash<uint64>, std::equal_to<uint64>, CountingAllocator<std::pair<uint64, void*>>> FlatMap;
+
+    // Raw values of creature guids of one map, sequential counters below the high part like ObjectGuid::GetRawValue()
+    uint64 MakeGuid(uint32 counter)
+    {
+        return (uint64(0xF130) << 48) | (uint64(1234) << 24) | counter;
+    }
+
+    struct Result
+    {
+        double BytesPerEntry;
+        double InsertNs;
+        double FindNs;
+        double ChurnNs;
+        uint64 Found;
+    };
+
+    template<class Map>
+    Result Run(uint32 count, uint32 rounds)
+    {
+        std::vector<uint64> guids;
+        for (uint32 i = 0; i < count; ++i)
+            guids.push_back(MakeGuid(i * 7));
+
+        std::mt19937 rng(count);
+        std::vector<uint64> lookups;
+        for (uint32 i = 0; i < count * 4; ++i)
+            lookups.push_back(guids[rng() % count]);
+
+        std::size_t memory = 0;
+        uint64 found = 0;
+        std::chrono::nanoseconds insertTime(0), findTime(0), churnTime(0);
+        for (uint32 round = 0; round < rounds; ++round)
+        {
+            Map map;
+
+            auto start = std::chrono::steady_clock::now();
+            for (uint64 guid : guids)
+                map.insert({ guid, nullptr });
+            insertTime += std::chrono::steady_clock::now() - start;
+
+            memory = AllocatedBytes;
+
+            start = std::chrono::steady_clock::now();
+            for (uint64 guid : lookups)
+                found += map.find(guid) != map.end();
+            findTime += std::chrono::steady_clock::now() - start;
+
+            // visibility churn, objects leaving and entering sight
+            start = std::chrono::steady_clock::now();
+            for (uint32 i = 0; i < count; ++i)
+            {
+                map.erase(guids[i]);
+                map.insert({ guids[i] + 1, nullptr });
+            }
+            churnTime += std::chrono::steady_clock::now() - start;
+        }
+
+        double operations = double(count) * rounds;
+        return { memory / double(count), insertTime.count() / operations, findTime.count() / (operations * 4), churnTime.count() / operations, found };
+    }
+
+    void Report(char const* name, uint32 count, Result const& result)
+    {
+        std::printf("%-20s %8u %12.1f %10.1f %10.1f %10.1f\n", name, count, result.BytesPerEntry, result.InsertNs, result.FindNs, result.ChurnNs);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32 operations = argc > 1 ? uint32(std::strtoul(argv[1], nullptr, 10)) : 2000000;
+
+    std::printf("%-20s %8s %12s %10s %10s %10s\n", "map", "entries", "bytes/entry", "insert ns", "find ns", "churn ns");
+
+    bool failed = false;
+    for (uint32 count : { 16, 128, 1024, 16384 })
+    {
+        uint32 rounds = std::max<uint32>(1, operations / count);
+
+        Result node = Run<NodeMap>(count, rounds);
+        Result flat = Run<FlatMap>(count, rounds);
+        Report("std::unordered_map", count, node);
+        Report("Acore::FlatHashMap", count, flat);
+
+        if (node.Found != flat.Found)
+            failed = true;
+    }
+
+    if (failed)
+    {
+        std::printf("The maps found a different number of lookups\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,256 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LootSimulationBenchmark.cpp
+ * @brief Simulates loot group rolls for typical template shapes
+ *
+ * Every template is rolled the way LootGroup::Roll did before loot groups were
+ * compiled (list copy, invalid entry filtering, linear scan of the chances) and
+ * with the compiled alias tables. The drop rates of both are compared to the
+ * rates following from the template and the time per loot is reported.
+ *
+ * Usage: loot_benchmark [loots per template]
+ * Returns 1 when a drop rate is off by more than 5 standard deviations.
+ */
+
+#include "Containers.h"
+#include "LootAliasTable.h"
+#include "Random.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct BenchLootItem
+    {
+        uint32 ItemId;
+        float Chance;                           // 0 for equal chanced entries
+        uint16 LootMode;
+    };
+
+    struct BenchLootGroup
+    {
+        std::list<BenchLootItem*> ExplicitlyChanced;
+        std::list<BenchLootItem*> EqualChanced;
+
+        std::vector<BenchLootItem*> CompiledExplicitlyChanced;
+        std::vector<BenchLootItem*> CompiledEqualChanced;
+        LootAliasTable AliasTable;
+    };
+
+    struct BenchLootTemplate
+    {
+        std::string Name;
+        std::vector<BenchLootItem> Items;
+        std::vector<BenchLootGroup> Groups;
+    };
+
+    // groups of (explicit chances, equal chanced entry count)
+    BenchLootTemplate CreateTemplate(std::string name, std::vector<std::pair<std::vector<float>, uint32>> const& groups)
+    {
+        BenchLootTemplate lootTemplate;
+        lootTemplate.Name = std::move(name);
+
+        std::size_t itemCount = 0;
+        for (auto const& [chances, equalChanced] : groups)
+            itemCount += chances.size() + equalChanced;
+
+        // items never move once the groups point into them
+        lootTemplate.Items.reserve(itemCount);
+        lootTemplate.Groups.resize(groups.size());
+
+        uint32 itemId = 1;
+        for (std::size_t i = 0; i < groups.size(); ++i)
+        {
+            BenchLootGroup& group = lootTemplate.Groups[i];
+            std::vector<float> chances;
+            for (float chance : groups[i].first)
+            {
+                group.ExplicitlyChanced.push_back(&lootTemplate.Items.emplace_back(BenchLootItem{ itemId++, chance, 1 }));
+                chances.push_back(chance);
+            }
+
+            for (uint32 j = 0; j < groups[i].second; ++j)
+                group.EqualChanced.push_back(&lootTemplate.Items.emplace_back(BenchLootItem{ itemId++, 0.0f, 1 }));
+
+            group.CompiledExplicitlyChanced.assign(group.ExplicitlyChanced.begin(), group.ExplicitlyChanced.end());
+            group.CompiledEqualChanced.assign(group.EqualChanced.begin(), group.EqualChanced.end());
+            group.AliasTable = LootAliasTable(chances);
+        }
+
+        return lootTemplate;
+    }
+
+    // Drop rate of every item following from the template
+    std::vector<double> GetExpectedRates(BenchLootTemplate const& lootTemplate)
+    {
+        std::vector<double> rates(lootTemplate.Items.size() + 1, 0.0);
+        for (BenchLootGroup const& group : lootTemplate.Groups)
+        {
+            uint32 index = 0;
+            for (BenchLootItem const* item : group.CompiledExplicitlyChanced)
+                rates[item->ItemId] = group.AliasTable.GetProbability(index++);
+
+            double const miss = group.AliasTable.GetProbability(group.AliasTable.GetMissIndex());
+            for (BenchLootItem const* item : group.CompiledEqualChanced)
+                rates[item->ItemId] = miss / group.CompiledEqualChanced.size();
+        }
+
+        return rates;
+    }
+
+    BenchLootItem const* LegacyRoll(BenchLootGroup const& group, std::vector<uint32> const& loot, uint16 lootMode)
+    {
+        auto invalid = [&](BenchLootItem const* item)
+        {
+            return !(item->LootMode & lootMode) || std::find(loot.begin(), loot.end(), item->ItemId) != loot.end();
+        };
+
+        std::list<BenchLootItem*> possibleLoot = group.ExplicitlyChanced;
+        possibleLoot.remove_if(invalid);
+
+        if (!possibleLoot.empty())
+        {
+            float roll = (float)rand_chance();
+            for (BenchLootItem* item : possibleLoot)
+            {
+                if (item->Chance >= 100.0f)
+                    return item;
+
+                roll -= item->Chance;
+                if (roll < 0)
+                    return item;
+            }
+        }
+
+        possibleLoot = group.EqualChanced;
+        possibleLoot.remove_if(invalid);
+        if (!possibleLoot.empty())
+            return Acore::Containers::SelectRandomContainerElement(possibleLoot);
+
+        return nullptr;
+    }
+
+    BenchLootItem const* CompiledRoll(BenchLootGroup const& group)
+    {
+        uint32 index = group.AliasTable.Sample();
+        if (index < group.CompiledExplicitlyChanced.size())
+            return group.CompiledExplicitlyChanced[index];
+
+        if (!group.CompiledEqualChanced.empty())
+            return group.CompiledEqualChanced[urand(0, group.CompiledEqualChanced.size() - 1)];
+
+        return nullptr;
+    }
+
+    struct SimulationResult
+    {
+        double NanosecondsPerLoot;
+        double MaxDeviation;                    // in standard deviations
+    };
+
+    template<class Roll>
+    SimulationResult Simulate(BenchLootTemplate const& lootTemplate, std::vector<double> const& expected, uint32 loots, Roll&& roll)
+    {
+        std::vector<uint32> drops(expected.size(), 0);
+        std::vector<uint32> loot;
+        loot.reserve(lootTemplate.Groups.size());
+
+        auto const start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < loots; ++i)
+        {
+            loot.clear();
+            for (BenchLootGroup const& group : lootTemplate.Groups)
+                if (BenchLootItem const* item = roll(group, loot))
+                    loot.push_back(item->ItemId);
+
+            for (uint32 itemId : loot)
+                ++drops[itemId];
+        }
+        auto const elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+
+        double maxDeviation = 0.0;
+        for (std::size_t itemId = 1; itemId < expected.size(); ++itemId)
+        {
+            double const p = expected[itemId];
+            double const sigma = std::sqrt(std::max(p * (1.0 - p), 1e-12) / loots);
+            maxDeviation = std::max(maxDeviation, std::abs(double(drops[itemId]) / loots - p) / sigma);
+        }
+
+        return { elapsed.count() / loots, maxDeviation };
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32 loots = argc > 1 ? uint32(std::strtoul(argv[1], nullptr, 10)) : 1000000;
+    if (!loots)
+        loots = 1000000;
+
+    std::vector<BenchLootTemplate> templates;
+
+    // trash mob: a few rare greens and a large grey pool
+    templates.push_back(CreateTemplate("trash", { { { 1.0f, 0.5f, 0.2f, 0.1f }, 40 }, { { 30.0f, 10.0f }, 0 } }));
+
+    // raid boss: tier tokens and epic pools, every group drops
+    std::vector<float> epics(10, 10.0f);
+    templates.push_back(CreateTemplate("raid boss", { { epics, 0 }, { epics, 0 }, { epics, 0 }, { { 50.0f, 50.0f }, 0 } }));
+
+    // world drop reference: hundreds of tiny chances and an equal chanced tail
+    std::vector<float> worldDrops(300, 0.05f);
+    templates.push_back(CreateTemplate("world drop", { { worldDrops, 200 } }));
+
+    // AoE farming: many small groups, usually one drop each
+    std::vector<std::pair<std::vector<float>, uint32>> farmGroups(8, { { 25.0f, 25.0f, 5.0f }, 6 });
+    templates.push_back(CreateTemplate("aoe farming", farmGroups));
+
+    std::printf("%-12s %10s %12s %12s %8s %10s %10s\n", "template", "loots", "legacy ns", "compiled ns", "speedup", "legacy dev", "compiled dev");
+
+    bool failed = false;
+    for (BenchLootTemplate const& lootTemplate : templates)
+    {
+        std::vector<double> const expected = GetExpectedRates(lootTemplate);
+
+        SimulationResult const legacy = Simulate(lootTemplate, expected, loots, [](BenchLootGroup const& group, std::vector<uint32> const& loot)
+        {
+            return LegacyRoll(group, loot, 1);
+        });
+        SimulationResult const compiled = Simulate(lootTemplate, expected, loots, [](BenchLootGroup const& group, std::vector<uint32> const& /*loot*/)
+        {
+            return CompiledRoll(group);
+        });
+
+        std::printf("%-12s %10u %12.1f %12.1f %7.1fx %9.2fs %9.2fs\n", lootTemplate.Name.c_str(), loots,
+            legacy.NanosecondsPerLoot, compiled.NanosecondsPerLoot, legacy.NanosecondsPerLoot / compiled.NanosecondsPerLoot,
+            legacy.MaxDeviation, compiled.MaxDeviation);
+
+        if (legacy.MaxDeviation > 5.0 || compiled.MaxDeviation > 5.0)
+            failed = true;
+    }
+
+    if (failed)
+        std::printf("Drop rates differ from the template by more than 5 standard deviations\n");
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file VisibilityRelocationBenchmark.cpp
+ * @brief Relocation visibility updates of players walking through a crowded zone
+ *
+ * Creatures are spawned into the grids of a test map. Two players walk the same
+ * path. One is updated the way full relocation updates do, by a
+ * PlayerRelocationNotifier over every cell in sight range. The other one is
+ * updated by a PlayerRelocationDeltaNotifier through Cell::VisitObjectsDelta
+ * from its last visibility update position. The time per relocation of both is
+ * reported, and after every step both clients have to see the same creatures.
+ *
+ * Usage: visibility_benchmark [relocations]
+ * Returns 1 when the clients of both players see different creatures.
+ */
+
+#include "CellImpl.h"
+#include "GridNotifiers.h"
+#include "GridNotifiersImpl.h"
+#include "TestCreature.h"
+#include "TestMap.h"
+#include "TestPlayer.h"
+#include "WorldMock.h"
+#include "WorldSession.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace testing;
+
+namespace
+{
+    constexpr float ZONE_SIZE = 1000.0f;
+    constexpr float STEP = 1.5f;
+
+    TestPlayer* CreatePlayer(TestMap* map, ObjectGuid::LowType guidLow)
+    {
+        WorldSession* session = new WorldSession(guidLow, "Benchmark", 0, nullptr, SEC_PLAYER, EXPANSION_WRATH_OF_THE_LICH_KING,
+            0, LOCALE_enUS, 0, false, false, 0);
+        session->InitRBACDataForTest();
+
+        TestPlayer* player = new TestPlayer(session);
+        player->ForceInitValues(guidLow);
+        session->SetPlayer(player);
+        player->SetSession(session);
+        player->SetMap(map);
+        player->Relocate(0.0f, 0.0f, 0.0f, 0.0f);
+        player->AddToWorld();
+        return player;
+    }
+
+    std::vector<TestCreature*> SpawnCreatures(TestMap* map, uint32 count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> coord(-ZONE_SIZE / 2, ZONE_SIZE / 2);
+
+        std::vector<TestCreature*> creatures;
+        for (uint32 i = 0; i < count; ++i)
+        {
+            TestCreature* creature = new TestCreature();
+            creature->ForceInitValues(i + 1, 1);
+            creature->SetTestMap(map);
+            creature->SetAlive(true);
+            creature->SetPhase(1);
+            creature->Relocate(coord(rng), coord(rng), 0.0f, 0.0f);
+
+            // TestCreature::AddToWorld does nothing, the creature is linked into its grid cell only
+            map->AddToMap<Creature>(creature);
+            creature->SetInWorld(true);
+            creatures.push_back(creature);
+        }
+
+        return creatures;
+    }
+
+    void UpdateFull(Player* player)
+    {
+        Position const& sightPosition = player->GetSightPosition();
+
+        Acore::PlayerRelocationNotifier notifier(*player);
+        Cell::VisitObjects(sightPosition.GetPositionX(), sightPosition.GetPositionY(), player->GetMap(), notifier, player->GetSightRange());
+        notifier.SendToSelf();
+
+        player->SetVisibilityUpdatePosition(true);
+    }
+
+    void UpdateIncremental(Player* player)
+    {
+        Position const& sightPosition = player->GetSightPosition();
+        Position const lastPosition = player->GetVisibilityUpdatePosition();
+
+        Acore::PlayerRelocationDeltaNotifier notifier(*player, lastPosition);
+        Cell::VisitObjectsDelta(sightPosition.GetPositionX(), sightPosition.GetPositionY(), lastPosition.GetPositionX(), lastPosition.GetPositionY(),
+            player->GetMap(), notifier, player->GetSightRange());
+        notifier.SendToSelf();
+
+        player->SetVisibilityUpdatePosition(false);
+    }
+
+    struct Result
+    {
+        double FullNs;
+        double IncrementalNs;
+        double Visible;
+        uint32 Mismatches;
+    };
+
+    Result Walk(uint32 creatureCount, uint32 relocations)
+    {
+        TestMap* map = new TestMap();
+        for (float x = -ZONE_SIZE / 2; x <= ZONE_SIZE / 2 + SIZE_OF_GRIDS; x += SIZE_OF_GRIDS)
+            for (float y = -ZONE_SIZE / 2; y <= ZONE_SIZE / 2 + SIZE_OF_GRIDS; y += SIZE_OF_GRIDS)
+                map->LoadGrid(x, y);
+
+        std::mt19937 rng(creatureCount);
+        std::vector<TestCreature*> creatures = SpawnCreatures(map, creatureCount, rng);
+
+        TestPlayer* full = CreatePlayer(map, 1);
+        TestPlayer* incremental = CreatePlayer(map, 2);
+        UpdateFull(full);
+        UpdateFull(incremental);
+
+        std::uniform_real_distribution<float> turn(-0.3f, 0.3f);
+        std::chrono::nanoseconds fullTime(0);
+        std::chrono::nanoseconds incrementalTime(0);
+        uint64 visible = 0;
+        uint32 mismatches = 0;
+
+        Position position(0.0f, 0.0f, 0.0f, 0.0f);
+        for (uint32 i = 0; i < relocations; ++i)
+        {
+            float orientation = position.GetOrientation() + turn(rng);
+            position.Relocate(position.GetPositionX() + STEP * std::cos(orientation), position.GetPositionY() + STEP * std::sin(orientation), 0.0f, orientation);
+
+            // keep walking inside the zone
+            if (std::abs(position.GetPositionX()) > 400.0f || std::abs(position.GetPositionY()) > 400.0f)
+                position.SetOrientation(orientation + float(M_PI));
+
+            full->Relocate(position);
+            incremental->Relocate(position);
+
+            auto start = std::chrono::steady_clock::now();
+            UpdateFull(full);
+            auto middle = std::chrono::steady_clock::now();
+            UpdateIncremental(incremental);
+            auto end = std::chrono::steady_clock::now();
+
+            fullTime += middle - start;
+            incrementalTime += end - middle;
+
+            for (TestCreature const* creature : creatures)
+            {
+                bool const seen = full->HaveAtClient(creature);
+                visible += seen;
+                mismatches += seen != incremental->HaveAtClient(creature);
+            }
+        }
+
+        // players, creatures and the map are left to the end of the process, their destructors need a world
+        return { double(fullTime.count()) / relocations, double(incrementalTime.count()) / relocations, double(visible) / relocations, mismatches };
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32 relocations = argc > 1 ? uint32(std::strtoul(argv[1], nullptr, 10)) : 20000;
+
+    TestMap::EnsureDBC();
+
+    NiceMock<WorldMock>* worldMock = new NiceMock<WorldMock>();
+    sWorld.reset(worldMock);
+
+    static std::string emptyString;
+    ON_CALL(*worldMock, GetDataPath()).WillByDefault(ReturnRef(emptyString));
+    ON_CALL(*worldMock, GetRealmName()).WillByDefault(ReturnRef(emptyString));
+    ON_CALL(*worldMock, GetDefaultDbcLocale()).WillByDefault(Return(LOCALE_enUS));
+    ON_CALL(*worldMock, getRate(_)).WillByDefault(Return(1.0f));
+    ON_CALL(*worldMock, getBoolConfig(_)).WillByDefault(Return(false));
+    ON_CALL(*worldMock, getIntConfig(_)).WillByDefault(Return(0));
+    ON_CALL(*worldMock, getFloatConfig(_)).WillByDefault(Return(0.0f));
+    ON_CALL(*worldMock, GetPlayerSecurityLimit()).WillByDefault(Return(SEC_PLAYER));
+
+    std::printf("%-10s %12s %10s %14s %8s %10s\n", "creatures", "relocations", "full ns", "incremental ns", "speedup", "visible");
+
+    bool failed = false;
+    for (uint32 creatures : { 100, 500, 2000 })
+    {
+        Result result = Walk(creatures, relocations);
+        std::printf("%-10u %12u %10.0f %14.0f %7.1fx %10.1f\n", creatures, relocations, result.FullNs, result.IncrementalNs,
+            result.FullNs / result.IncrementalNs, result.Visible);
+
+        if (result.Mismatches)
+        {
+            std::printf("%u times a creature was seen by only one of the players\n", result.Mismatches);
+            failed = true;
+        }
+    }
+
+    return failed ? 1 : 0;
+}
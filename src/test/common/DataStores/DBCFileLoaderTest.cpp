@@ -0,0 +1,150 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DBCFileLoader.h"
+#include "gtest/gtest.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+    class DBCFileLoaderTest : public ::testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            for (std::string const& fileName : _files)
+                std::filesystem::remove(fileName);
+        }
+
+        // fields are 4 byte each, the string block starts with the empty string
+        std::string WriteDBC(std::string const& name, uint32 fieldCount, std::vector<std::vector<uint32>> const& records, std::string const& strings)
+        {
+            std::string fileName = (std::filesystem::temp_directory_path() / name).string();
+            std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+
+            uint32 header[5] = { 0x43424457, uint32(records.size()), fieldCount, fieldCount * 4, uint32(strings.size()) };
+            file.write(reinterpret_cast<char const*>(header), sizeof(header));
+            for (std::vector<uint32> const& record : records)
+                file.write(reinterpret_cast<char const*>(record.data()), record.size() * sizeof(uint32));
+
+            file.write(strings.data(), strings.size());
+            _files.push_back(fileName);
+            return fileName;
+        }
+
+        std::vector<std::string> _files;
+    };
+
+    struct NativeEntry
+    {
+        uint32 ID;
+        uint32 Value;
+        float Scale;
+    };
+
+#pragma pack(push, 1)
+    struct StringEntry
+    {
+        uint32 ID;
+        char const* Name;
+    };
+#pragma pack(pop)
+}
+
+TEST_F(DBCFileLoaderTest, NativeLayoutIsUsedInPlace)
+{
+    float scale = 1.5f;
+    uint32 scaleBits;
+    std::memcpy(&scaleBits, &scale, sizeof(scaleBits));
+    std::string fileName = WriteDBC("dbc_loader_native.dbc", 3, { { 5, 50, scaleBits }, { 2, 20, scaleBits } }, std::string(1, '\0'));
+
+    DBCFileLoader dbc;
+    ASSERT_TRUE(dbc.Load(fileName.c_str(), "nif"));
+    EXPECT_TRUE(dbc.HasNativeLayout("nif"));
+    EXPECT_FALSE(dbc.HasNativeLayout("nix"));
+
+    uint32 count = 0;
+    char** indexTable = nullptr;
+    char* dataTable = dbc.AutoProduceData("nif", count, indexTable);
+    ASSERT_NE(dataTable, nullptr);
+    ASSERT_EQ(count, 6u);
+
+    std::unique_ptr<MappedFile> file = dbc.ReleaseFile();
+    ASSERT_TRUE(file);
+    EXPECT_EQ(reinterpret_cast<uint8 const*>(dataTable), file->GetData() + 20);
+
+    NativeEntry const* entry = reinterpret_cast<NativeEntry const*>(indexTable[5]);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->ID, 5u);
+    EXPECT_EQ(entry->Value, 50u);
+    EXPECT_EQ(entry->Scale, 1.5f);
+    EXPECT_EQ(indexTable[3], nullptr);
+
+    // records are copy on write, fixups do not reach the file
+    reinterpret_cast<NativeEntry*>(indexTable[2])->Value = 99;
+    EXPECT_EQ(reinterpret_cast<NativeEntry const*>(indexTable[2])->Value, 99u);
+    delete[] indexTable;
+    file.reset();
+
+    DBCFileLoader reloaded;
+    ASSERT_TRUE(reloaded.Load(fileName.c_str(), "nif"));
+    EXPECT_EQ(reloaded.getRecord(1).getUInt(1), 20u);
+}
+
+TEST_F(DBCFileLoaderTest, StringsPointIntoMappedFile)
+{
+    std::string strings("\0first\0second\0", 14);
+    std::string fileName = WriteDBC("dbc_loader_strings.dbc", 2, { { 1, 1 }, { 2, 7 }, { 3, 0 } }, strings);
+
+    DBCFileLoader dbc;
+    ASSERT_TRUE(dbc.Load(fileName.c_str(), "ns"));
+    EXPECT_FALSE(dbc.HasNativeLayout("ns"));
+
+    uint32 count = 0;
+    char** indexTable = nullptr;
+    char* dataTable = dbc.AutoProduceData("ns", count, indexTable);
+    ASSERT_NE(dataTable, nullptr);
+    dbc.AutoProduceStrings("ns", dataTable);
+
+    std::unique_ptr<MappedFile> file = dbc.ReleaseFile();
+    ASSERT_TRUE(file);
+
+    StringEntry const* first = reinterpret_cast<StringEntry const*>(indexTable[1]);
+    StringEntry const* second = reinterpret_cast<StringEntry const*>(indexTable[2]);
+    StringEntry const* empty = reinterpret_cast<StringEntry const*>(indexTable[3]);
+    EXPECT_STREQ(first->Name, "first");
+    EXPECT_STREQ(second->Name, "second");
+    EXPECT_STREQ(empty->Name, "");
+
+    uint8 const* stringBlock = file->GetData() + 20 + 3 * 8;
+    EXPECT_EQ(reinterpret_cast<uint8 const*>(first->Name), stringBlock + 1);
+
+    delete[] indexTable;
+    delete[] dataTable;
+}
+
+TEST_F(DBCFileLoaderTest, RejectsTruncatedFile)
+{
+    std::string fileName = WriteDBC("dbc_loader_truncated.dbc", 2, { { 1, 1 } }, std::string(1, '\0'));
+    std::filesystem::resize_file(fileName, 24);
+
+    DBCFileLoader dbc;
+    EXPECT_FALSE(dbc.Load(fileName.c_str(), "ni"));
+}
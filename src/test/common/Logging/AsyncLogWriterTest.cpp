@@ -0,0 +1,201 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AsyncLogWriter.h"
+#include "LogMessage.h"
+#include "LogRingBuffer.h"
+#include "gtest/gtest.h"
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    enum TestEnum : uint8
+    {
+        TEST_ENUM_VALUE = 7
+    };
+
+    uint8 format_as(TestEnum value) { return value; }
+
+    struct CapturedMessage
+    {
+        LogLevel Level;
+        std::string Type;
+        std::string Text;
+        std::string Param1;
+    };
+
+    class AsyncLogWriterTest : public ::testing::Test
+    {
+    protected:
+        std::unique_ptr<AsyncLogWriter> CreateWriter(std::size_t bufferSize)
+        {
+            return std::make_unique<AsyncLogWriter>(bufferSize,
+                [this](LogMessage* message) { _messages.push_back({ message->level, message->type, message->text, message->param1 }); },
+                [this]() { ++_flushes; });
+        }
+
+        std::vector<CapturedMessage> _messages;
+        uint32 _flushes = 0;
+    };
+}
+
+TEST(LogRingBufferTest, WrapsAround)
+{
+    LogRingBuffer ring(4096);
+    ASSERT_EQ(ring.GetCapacity(), 4096u);
+
+    // 1000 byte entries do not divide the capacity, so every few entries the producer has to wrap
+    for (uint32 i = 0; i < 64; ++i)
+    {
+        uint8* entry = ring.Reserve(1000);
+        ASSERT_NE(entry, nullptr);
+        uint32 size = 1000;
+        std::memcpy(entry, &size, sizeof(size));
+        std::memcpy(entry + sizeof(size), &i, sizeof(i));
+        ring.Commit();
+
+        uint8 const* read = ring.Peek();
+        ASSERT_NE(read, nullptr);
+        uint32 value;
+        std::memcpy(&value, read + sizeof(size), sizeof(value));
+        EXPECT_EQ(value, i);
+        ring.Release();
+        EXPECT_EQ(ring.Peek(), nullptr);
+    }
+
+    EXPECT_TRUE(ring.IsEmpty());
+}
+
+TEST(LogRingBufferTest, RefusesWhenFull)
+{
+    LogRingBuffer ring(4096);
+    for (uint32 i = 0; i < 4; ++i)
+    {
+        uint8* entry = ring.Reserve(1024);
+        ASSERT_NE(entry, nullptr);
+        uint32 size = 1024;
+        std::memcpy(entry, &size, sizeof(size));
+        ring.Commit();
+    }
+
+    EXPECT_EQ(ring.Reserve(8), nullptr);
+
+    ASSERT_NE(ring.Peek(), nullptr);
+    ring.Release();
+    EXPECT_NE(ring.Reserve(1024), nullptr);
+}
+
+TEST_F(AsyncLogWriterTest, DeferredFormattingMatchesStringFormat)
+{
+    std::unique_ptr<AsyncLogWriter> writer = CreateWriter(64 * 1024);
+
+    std::string name = "Arthas";
+    std::string_view zone = "Icecrown";
+    char const* title = "the Lich King";
+    writer->Write(LOG_LEVEL_INFO, "server", "{} {} in {} ({}, {:.2f}, {}, {})", name, title, zone, 80, 1.5f, TEST_ENUM_VALUE, true);
+    writer->WriteText(LOG_LEVEL_ERROR, "commands.gm", "preformatted", "42");
+    writer->Write(LOG_LEVEL_WARN, "server", "{} {}", 1);
+    writer->Stop();
+
+    ASSERT_EQ(_messages.size(), 3u);
+    EXPECT_EQ(_messages[0].Level, LOG_LEVEL_INFO);
+    EXPECT_EQ(_messages[0].Type, "server");
+    EXPECT_EQ(_messages[0].Text, Acore::StringFormat("{} {} in {} ({}, {:.2f}, {}, {})", name, title, zone, 80, 1.5f, TEST_ENUM_VALUE, true));
+
+    EXPECT_EQ(_messages[1].Type, "commands.gm");
+    EXPECT_EQ(_messages[1].Text, "preformatted");
+    EXPECT_EQ(_messages[1].Param1, "42");
+
+    // Format errors are reported the same way as with synchronous logging
+    EXPECT_EQ(_messages[2].Text, Acore::StringFormat("{} {}", 1));
+    EXPECT_GT(_flushes, 0u);
+}
+
+TEST_F(AsyncLogWriterTest, MergesThreadsInCallOrder)
+{
+    std::unique_ptr<AsyncLogWriter> writer = CreateWriter(1024 * 1024);
+
+    constexpr uint32 ThreadCount = 4;
+    constexpr uint32 MessagesPerThread = 2000;
+
+    std::vector<std::thread> threads;
+    for (uint32 t = 0; t < ThreadCount; ++t)
+    {
+        threads.emplace_back([&writer, t]()
+        {
+            for (uint32 i = 0; i < MessagesPerThread; ++i)
+                writer->Write(LOG_LEVEL_DEBUG, "network", "{} {}", t, i);
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    writer->Stop();
+
+    // Rings of exited threads must still be drained
+    std::vector<uint32> next(ThreadCount, 0);
+    uint32 total = 0;
+    for (CapturedMessage const& message : _messages)
+    {
+        if (message.Type != "network")
+            continue;
+
+        uint32 t, i;
+        ASSERT_EQ(std::sscanf(message.Text.c_str(), "%u %u", &t, &i), 2);
+        ASSERT_LT(t, ThreadCount);
+        // Dropped messages leave gaps but never reorder a thread's messages
+        EXPECT_GE(i, next[t]);
+        next[t] = i + 1;
+        ++total;
+    }
+
+    EXPECT_EQ(total + writer->GetDroppedCount(), ThreadCount * MessagesPerThread);
+}
+
+TEST_F(AsyncLogWriterTest, CountsAndReportsDroppedMessages)
+{
+    std::unique_ptr<AsyncLogWriter> writer = CreateWriter(4096);
+
+    {
+        std::unique_lock<std::mutex> suspended = writer->Suspend();
+        for (uint32 i = 0; i < 1000; ++i)
+            writer->Write(LOG_LEVEL_INFO, "server", "message {}", i);
+    }
+
+    uint64 dropped = writer->GetDroppedCount();
+    EXPECT_GT(dropped, 0u);
+
+    writer->Stop();
+
+    ASSERT_FALSE(_messages.empty());
+    EXPECT_EQ(_messages.size() - 1 + dropped, 1000u);
+    EXPECT_EQ(_messages.back().Level, LOG_LEVEL_WARN);
+    EXPECT_NE(_messages.back().Text.find(std::to_string(dropped) + " messages dropped"), std::string::npos);
+
+    // Messages logged after Stop() are written synchronously instead of being queued
+    std::size_t const written = _messages.size();
+    writer->Write(LOG_LEVEL_INFO, "server", "late {}", 1);
+    writer->WriteText(LOG_LEVEL_ERROR, "commands.gm", "later", "42");
+    ASSERT_EQ(_messages.size(), written + 2);
+    EXPECT_EQ(_messages[written].Text, "late 1");
+    EXPECT_EQ(_messages[written + 1].Text, "later");
+    EXPECT_EQ(_messages[written + 1].Param1, "42");
+    EXPECT_EQ(writer->GetDroppedCount(), dropped);
+}
@@ -0,0 +1,146 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventMap.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    enum Events
+    {
+        EVENT_FIREBALL = 1,
+        EVENT_FROSTBOLT,
+        EVENT_BERSERK,
+        EVENT_SUMMON,
+        EVENT_PHASE_TWO_ONLY
+    };
+
+    std::vector<uint32> ExecuteAll(EventMap& events)
+    {
+        std::vector<uint32> executed;
+        while (uint32 eventId = events.ExecuteEvent())
+            executed.push_back(eventId);
+
+        return executed;
+    }
+}
+
+TEST(EventMapTest, EventsOfTheSameTimeRunInScheduleOrder)
+{
+    EventMap events;
+    events.ScheduleEvent(EVENT_FROSTBOLT, 2s);
+    events.ScheduleEvent(EVENT_FIREBALL, 1s);
+    events.ScheduleEvent(EVENT_BERSERK, 2s);
+    events.ScheduleEvent(EVENT_SUMMON, 10min);
+
+    events.Update(999);
+    EXPECT_EQ(events.ExecuteEvent(), 0u);
+
+    events.Update(1);
+    EXPECT_EQ(ExecuteAll(events), std::vector<uint32>({ EVENT_FIREBALL }));
+
+    events.Update(1000);
+    EXPECT_EQ(ExecuteAll(events), std::vector<uint32>({ EVENT_FROSTBOLT, EVENT_BERSERK }));
+
+    EXPECT_EQ(events.GetTimeUntilEvent(EVENT_SUMMON), 10min - 2s);
+    EXPECT_FALSE(events.HasTimeUntilEvent(EVENT_FIREBALL));
+
+    events.Update(10min);
+    EXPECT_EQ(ExecuteAll(events), std::vector<uint32>({ EVENT_SUMMON }));
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, RepeatAndReschedule)
+{
+    EventMap events;
+    events.ScheduleEvent(EVENT_FIREBALL, 1s);
+    events.ScheduleEvent(EVENT_FROSTBOLT, 3s);
+
+    events.Update(1s);
+    EXPECT_EQ(events.ExecuteEvent(), uint32(EVENT_FIREBALL));
+    events.Repeat(2s);
+
+    events.RescheduleEvent(EVENT_FROSTBOLT, 5s);
+    EXPECT_EQ(events.GetTimeUntilEvent(EVENT_FIREBALL), 2s);
+    EXPECT_EQ(events.GetTimeUntilEvent(EVENT_FROSTBOLT), 5s);
+
+    events.Update(5s);
+    EXPECT_EQ(ExecuteAll(events), std::vector<uint32>({ EVENT_FIREBALL, EVENT_FROSTBOLT }));
+}
+
+TEST(EventMapTest, EventsOfOtherPhasesAreDropped)
+{
+    EventMap events;
+    events.SetPhase(1);
+    events.ScheduleEvent(EVENT_PHASE_TWO_ONLY, 1s, 0, 2);
+    events.ScheduleEvent(EVENT_FIREBALL, 1s, 0, 1);
+    events.ScheduleEvent(EVENT_FROSTBOLT, 1s);
+
+    events.Update(1s);
+    EXPECT_EQ(ExecuteAll(events), std::vector<uint32>({ EVENT_FIREBALL, EVENT_FROSTBOLT }));
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, GroupsAndDelays)
+{
+    EventMap events;
+    events.ScheduleEvent(EVENT_FIREBALL, 1s, 1);
+    events.ScheduleEvent(EVENT_FROSTBOLT, 2s, 1);
+    events.ScheduleEvent(EVENT_BERSERK, 2s, 2);
+    events.ScheduleEvent(EVENT_SUMMON, 3s);
+
+    // delayed events run after the events already scheduled for the same time
+    events.DelayEvents(1s, 1);
+    EXPECT_EQ(events.GetTimeUntilEvent(EVENT_FIREBALL), 2s);
+    events.Update(3s);
+    EXPECT_EQ(ExecuteAll(events), std::vector<uint32>({ EVENT_BERSERK, EVENT_FIREBALL, EVENT_SUMMON, EVENT_FROSTBOLT }));
+
+    events.ScheduleEvent(EVENT_FIREBALL, 1s, 1);
+    events.ScheduleEvent(EVENT_FROSTBOLT, 10s, 1);
+    events.ScheduleEvent(EVENT_BERSERK, 1s, 2);
+    events.DelayEventsToMax(5s, 1);
+    EXPECT_EQ(events.GetTimeUntilEvent(EVENT_FIREBALL), 5s);
+    EXPECT_EQ(events.GetTimeUntilEvent(EVENT_FROSTBOLT), 10s);
+
+    events.DelayEvents(2s);
+    EXPECT_EQ(events.GetTimeUntilEvent(EVENT_BERSERK), 3s);
+
+    events.CancelEventGroup(1);
+    EXPECT_FALSE(events.HasTimeUntilEvent(EVENT_FIREBALL));
+    EXPECT_FALSE(events.HasTimeUntilEvent(EVENT_FROSTBOLT));
+    EXPECT_TRUE(events.HasTimeUntilEvent(EVENT_BERSERK));
+
+    events.CancelEvent(EVENT_BERSERK);
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, ResetClearsEventsAndTime)
+{
+    EventMap events;
+    events.SetPhase(2);
+    events.Update(1h);
+    events.ScheduleEvent(EVENT_FIREBALL, 1s);
+
+    events.Reset();
+    EXPECT_TRUE(events.Empty());
+    EXPECT_EQ(events.GetPhaseMask(), 0u);
+
+    events.ScheduleEvent(EVENT_FROSTBOLT, 1s);
+    EXPECT_EQ(events.GetTimeUntilEvent(EVENT_FROSTBOLT), 1s);
+    events.Update(1s);
+    EXPECT_EQ(events.ExecuteEvent(), uint32(EVENT_FROSTBOLT));
+}
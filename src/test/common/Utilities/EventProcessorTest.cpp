@@ -0,0 +1,116 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventProcessor.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    class RecordingEvent : public BasicEvent
+    {
+    public:
+        RecordingEvent(std::vector<uint32>& log, uint32 id) : _log(log), _id(id) { }
+
+        bool Execute(uint64 /*e_time*/, uint32 /*p_time*/) override
+        {
+            _log.push_back(_id);
+            return true;
+        }
+
+        void Abort(uint64 /*e_time*/) override
+        {
+            _log.push_back(1000 + _id);
+        }
+
+    private:
+        std::vector<uint32>& _log;
+        uint32 _id;
+    };
+}
+
+TEST(EventProcessorTest, EventsOfTheSameTimeRunInInsertionOrder)
+{
+    std::vector<uint32> log;
+    EventProcessor events;
+    events.AddEventAtOffset(new RecordingEvent(log, 1), 100ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 2), 50ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 3), 100ms);
+    events.AddEventAtOffset([&log]() { log.push_back(4); }, 100ms);
+
+    events.Update(99);
+    EXPECT_EQ(log, std::vector<uint32>({ 2 }));
+
+    events.Update(1);
+    EXPECT_EQ(log, std::vector<uint32>({ 2, 1, 3, 4 }));
+    EXPECT_FALSE(events.HasEvents());
+}
+
+TEST(EventProcessorTest, EventsAddedWhileUpdatingRunInTheSameUpdate)
+{
+    std::vector<uint32> log;
+    EventProcessor events;
+    events.AddEventAtOffset([&]()
+    {
+        log.push_back(1);
+        events.AddEventAtOffset(new RecordingEvent(log, 2), 0ms);
+        events.AddEventAtOffset(new RecordingEvent(log, 3), 1ms);
+    }, 10ms);
+
+    events.Update(10);
+    EXPECT_EQ(log, std::vector<uint32>({ 1, 2 }));
+
+    events.Update(1);
+    EXPECT_EQ(log, std::vector<uint32>({ 1, 2, 3 }));
+}
+
+TEST(EventProcessorTest, ModifyEventTime)
+{
+    std::vector<uint32> log;
+    EventProcessor events;
+    RecordingEvent* first = new RecordingEvent(log, 1);
+    events.AddEventAtOffset(first, 100ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 2), 60s);
+
+    events.ModifyEventTime(first, 120s);
+    events.Update(60000);
+    EXPECT_EQ(log, std::vector<uint32>({ 2 }));
+
+    events.Update(60000);
+    EXPECT_EQ(log, std::vector<uint32>({ 2, 1 }));
+
+    // not queued by this processor
+    RecordingEvent other(log, 3);
+    events.ModifyEventTime(&other, 1s);
+    EXPECT_FALSE(events.HasEvents());
+}
+
+TEST(EventProcessorTest, CancelAndKillAbortInExecutionOrder)
+{
+    std::vector<uint32> log;
+    EventProcessor events;
+    events.AddEventAtOffset(new RecordingEvent(log, 1), 300ms, 1);
+    events.AddEventAtOffset(new RecordingEvent(log, 2), 100ms, 1);
+    events.AddEventAtOffset(new RecordingEvent(log, 3), 200ms);
+    events.AddEventAtOffset(new RecordingEvent(log, 4), 50ms);
+
+    events.CancelEventGroup(1);
+    EXPECT_EQ(log, std::vector<uint32>({ 1002, 1001 }));
+
+    events.KillAllEvents(false);
+    EXPECT_EQ(log, std::vector<uint32>({ 1002, 1001, 1004, 1003 }));
+    EXPECT_FALSE(events.HasEvents());
+}
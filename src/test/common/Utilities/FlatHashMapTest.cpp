@@ -0,0 +1,120 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FlatHashMap.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <unordered_map>
+
+namespace
+{
+    // Raw values of creature guids of one map, sequential counters below the high part like ObjectGuid::GetRawValue()
+    uint64 MakeGuid(uint32 counter)
+    {
+        return (uint64(0xF130) << 48) | (uint64(1234) << 24) | counter;
+    }
+
+    typedef Acore::FlatHashMap<uint64, uint32> TestMap;
+}
+
+TEST(FlatHashMapTest, InsertFindErase)
+{
+    TestMap map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(MakeGuid(1)), map.end());
+
+    EXPECT_TRUE(map.insert({ MakeGuid(1), 10 }).second);
+    EXPECT_TRUE(map.try_emplace(MakeGuid(2), 20).second);
+    map[MakeGuid(3)] = 30;
+
+    EXPECT_FALSE(map.insert({ MakeGuid(1), 11 }).second);
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.find(MakeGuid(1))->second, 10u);
+    EXPECT_EQ(map[MakeGuid(3)], 30u);
+    EXPECT_TRUE(map.contains(MakeGuid(2)));
+    EXPECT_EQ(map.count(MakeGuid(4)), 0u);
+
+    EXPECT_EQ(map.erase(MakeGuid(2)), 1u);
+    EXPECT_EQ(map.erase(MakeGuid(2)), 0u);
+    EXPECT_FALSE(map.contains(MakeGuid(2)));
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.find(MakeGuid(3))->second, 30u);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(MakeGuid(1)));
+    EXPECT_TRUE(map.insert({ MakeGuid(1), 12 }).second);
+    EXPECT_EQ(map.find(MakeGuid(1))->second, 12u);
+}
+
+TEST(FlatHashMapTest, EraseWhileIterating)
+{
+    TestMap map;
+    for (uint32 i = 0; i < 1000; ++i)
+        map[MakeGuid(i)] = i;
+
+    uint32 visited = 0;
+    for (TestMap::iterator itr = map.begin(); itr != map.end();)
+    {
+        ++visited;
+        if (itr->second % 3)
+            itr = map.erase(itr);
+        else
+            ++itr;
+    }
+
+    EXPECT_EQ(visited, 1000u);
+    EXPECT_EQ(map.size(), 334u);
+    for (uint32 i = 0; i < 1000; ++i)
+        EXPECT_EQ(map.contains(MakeGuid(i)), i % 3 == 0);
+}
+
+TEST(FlatHashMapTest, MatchesUnorderedMap)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<uint32> key(0, 4000);
+    std::uniform_int_distribution<uint32> operation(0, 9);
+
+    TestMap map;
+    std::unordered_map<uint64, uint32> reference;
+    for (uint32 i = 0; i < 200000; ++i)
+    {
+        uint64 guid = MakeGuid(key(rng));
+        switch (operation(rng))
+        {
+            case 0: case 1: case 2: case 3:
+                EXPECT_EQ(map.insert({ guid, i }).second, reference.insert({ guid, i }).second);
+                break;
+            case 4: case 5: case 6:
+                EXPECT_EQ(map.erase(guid), reference.erase(guid));
+                break;
+            default:
+            {
+                auto itr = reference.find(guid);
+                auto flatItr = map.find(guid);
+                ASSERT_EQ(flatItr != map.end(), itr != reference.end());
+                if (itr != reference.end())
+                    EXPECT_EQ(flatItr->second, itr->second);
+                break;
+            }
+        }
+    }
+
+    ASSERT_EQ(map.size(), reference.size());
+    for (auto const& [guid, value] : map)
+        EXPECT_EQ(reference.at(guid), value);
+}
@@ -0,0 +1,186 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TimingWheel.h"
+#include "gtest/gtest.h"
+#include <map>
+#include <random>
+
+namespace
+{
+    typedef Acore::TimingWheel<uint32> TestWheel;
+
+    // Pops every ready value in order
+    std::vector<uint32> PopReady(TestWheel& wheel)
+    {
+        std::vector<uint32> values;
+        for (TestWheel::Handle handle = wheel.Front(); handle != TestWheel::INVALID_HANDLE; handle = wheel.Front())
+        {
+            values.push_back(wheel.Get(handle));
+            wheel.Erase(handle);
+        }
+
+        return values;
+    }
+}
+
+TEST(TimingWheelTest, SameTimeKeepsInsertionOrder)
+{
+    TestWheel wheel;
+    wheel.Insert(5000, 1);
+    wheel.Insert(100, 2);
+    wheel.Insert(5000, 3);
+    wheel.Insert(40000, 4);                                 // beyond the wheel, waits in the far list
+    wheel.Insert(5000, 5);
+
+    wheel.Advance(4999);
+    EXPECT_EQ(PopReady(wheel), std::vector<uint32>({ 2 }));
+
+    wheel.Advance(5000);
+    EXPECT_EQ(PopReady(wheel), std::vector<uint32>({ 1, 3, 5 }));
+
+    wheel.Advance(100000);
+    EXPECT_EQ(PopReady(wheel), std::vector<uint32>({ 4 }));
+    EXPECT_TRUE(wheel.Empty());
+}
+
+TEST(TimingWheelTest, PastValuesAreReadyImmediately)
+{
+    TestWheel wheel(1000);
+    wheel.Insert(1000, 1);
+    wheel.Insert(10, 2);
+    wheel.Insert(1000, 3);
+
+    EXPECT_EQ(PopReady(wheel), std::vector<uint32>({ 2, 1, 3 }));
+}
+
+TEST(TimingWheelTest, RescheduleKeepsOrCountsAsNewInsertion)
+{
+    TestWheel wheel;
+    TestWheel::Handle first = wheel.Insert(100, 1);
+    TestWheel::Handle second = wheel.Insert(200, 2);
+    wheel.Insert(300, 3);
+
+    wheel.Reschedule(first, 300, false);
+    wheel.Reschedule(second, 300, true);
+
+    wheel.Advance(300);
+    EXPECT_EQ(PopReady(wheel), std::vector<uint32>({ 2, 3, 1 }));
+}
+
+// Random inserts, erases, reschedules and advances checked against a std::multimap keyed by (time, sequence)
+TEST(TimingWheelTest, MatchesOrderedMap)
+{
+    std::mt19937_64 random(7);
+    TestWheel wheel;
+    std::map<std::pair<uint64, uint64>, uint32> expected;   // (time, sequence) -> value
+    std::map<uint32, std::pair<TestWheel::Handle, std::pair<uint64, uint64>>> scheduled;
+    uint64 now = 0;
+    uint64 sequence = 0;
+    uint32 nextValue = 0;
+
+    auto randomDelay = [&]() -> uint64
+    {
+        switch (random() % 4)
+        {
+            case 0: return random() % 64;                   // spell and aura events
+            case 1: return random() % 5000;
+            case 2: return random() % 60000;                // boss timers
+            default: return random() % 2000000;             // beyond the wheel
+        }
+    };
+
+    for (uint32 step = 0; step < 200000; ++step)
+    {
+        switch (random() % 8)
+        {
+            case 0:
+            case 1:
+            case 2:
+            {
+                // also insert in the past now and then
+                uint64 time = random() % 16 ? now + randomDelay() : now - std::min<uint64>(now, random() % 100);
+                uint32 value = nextValue++;
+                TestWheel::Handle handle = wheel.Insert(time, value);
+                expected.emplace(std::make_pair(time, sequence), value);
+                scheduled.emplace(value, std::make_pair(handle, std::make_pair(time, sequence)));
+                ++sequence;
+                break;
+            }
+            case 3:
+            {
+                if (scheduled.empty())
+                    break;
+
+                auto itr = scheduled.lower_bound(uint32(random() % nextValue));
+                if (itr == scheduled.end())
+                    itr = scheduled.begin();
+
+                wheel.Erase(itr->second.first);
+                expected.erase(itr->second.second);
+                scheduled.erase(itr);
+                break;
+            }
+            case 4:
+            {
+                if (scheduled.empty())
+                    break;
+
+                auto itr = scheduled.lower_bound(uint32(random() % nextValue));
+                if (itr == scheduled.end())
+                    itr = scheduled.begin();
+
+                bool keepOrder = random() % 2;
+                uint64 time = now + randomDelay();
+                std::pair<uint64, uint64> key(time, keepOrder ? itr->second.second.second : sequence++);
+                wheel.Reschedule(itr->second.first, time, keepOrder);
+                expected.erase(itr->second.second);
+                expected.emplace(key, itr->first);
+                itr->second.second = key;
+                break;
+            }
+            default:
+            {
+                now += random() % 8 ? random() % 200 : random() % 100000;
+                wheel.Advance(now);
+
+                std::vector<uint32> expectedReady;
+                while (!expected.empty() && expected.begin()->first.first <= now)
+                {
+                    expectedReady.push_back(expected.begin()->second);
+                    scheduled.erase(expected.begin()->second);
+                    expected.erase(expected.begin());
+                }
+
+                ASSERT_EQ(PopReady(wheel), expectedReady) << "step " << step;
+                break;
+            }
+        }
+
+        ASSERT_EQ(wheel.Size(), expected.size());
+    }
+
+    std::vector<uint32> expectedOrder;
+    for (auto const& [key, value] : expected)
+        expectedOrder.push_back(value);
+
+    std::vector<uint32> order;
+    for (TestWheel::Handle handle : wheel.GetOrderedHandles())
+        order.push_back(wheel.Get(handle));
+
+    EXPECT_EQ(order, expectedOrder);
+}
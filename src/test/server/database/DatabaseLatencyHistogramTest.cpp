@@ -0,0 +1,49 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DatabaseLatencyHistogram.h"
+#include "gtest/gtest.h"
+
+TEST(DatabaseLatencyHistogramTest, BucketsAreInclusiveUpperBounds)
+{
+    EXPECT_EQ(DatabaseLatencyHistogram::GetBucket(0us), 0u);
+    EXPECT_EQ(DatabaseLatencyHistogram::GetBucket(1ms), 0u);
+    EXPECT_EQ(DatabaseLatencyHistogram::GetBucket(1001us), 1u);
+    EXPECT_EQ(DatabaseLatencyHistogram::GetBucket(250ms), DatabaseLatencyHistogram::BUCKET_COUNT - 2);
+    EXPECT_EQ(DatabaseLatencyHistogram::GetBucket(1h), DatabaseLatencyHistogram::BUCKET_COUNT - 1);
+
+    EXPECT_EQ(DatabaseLatencyHistogram::GetBucketLabel(0), "1");
+    EXPECT_EQ(DatabaseLatencyHistogram::GetBucketLabel(DatabaseLatencyHistogram::BUCKET_COUNT - 1), "inf");
+}
+
+TEST(DatabaseLatencyHistogramTest, TakeResetsCounts)
+{
+    DatabaseLatencyHistogram histogram;
+    histogram.Add(500us);
+    histogram.Add(3ms);
+    histogram.Add(4ms);
+    histogram.Add(10s);
+
+    DatabaseLatencyHistogram::Counts counts = histogram.Take();
+    EXPECT_EQ(counts[0], 1u);
+    EXPECT_EQ(counts[DatabaseLatencyHistogram::GetBucket(3ms)], 2u);
+    EXPECT_EQ(counts[DatabaseLatencyHistogram::BUCKET_COUNT - 1], 1u);
+
+    counts = histogram.Take();
+    for (uint64 count : counts)
+        EXPECT_EQ(count, 0u);
+}
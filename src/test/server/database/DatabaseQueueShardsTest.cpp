@@ -0,0 +1,181 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DatabaseQueueShards.h"
+#include "DatabaseWorker.h"
+#include "SQLOperation.h"
+#include "gtest/gtest.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Records which worker thread executed it, in execution order
+class RecordingOperation : public SQLOperation
+{
+public:
+    struct Record
+    {
+        uint64 Key;
+        uint32 Sequence;
+        std::thread::id Thread;
+    };
+
+    struct Log
+    {
+        std::mutex Lock;
+        std::vector<Record> Records;
+    };
+
+    RecordingOperation(Log& log, uint64 key, uint32 sequence) : _log(log), _key(key), _sequence(sequence) { }
+
+    bool Execute() override
+    {
+        std::lock_guard<std::mutex> guard(_log.Lock);
+        _log.Records.push_back({ _key, _sequence, std::this_thread::get_id() });
+        return true;
+    }
+
+private:
+    Log& _log;
+    uint64 _key;
+    uint32 _sequence;
+};
+
+// One worker per shard like DatabaseWorkerPool, without a connection
+std::vector<std::unique_ptr<DatabaseWorker>> StartWorkers(DatabaseQueueShards& shards)
+{
+    std::vector<std::unique_ptr<DatabaseWorker>> workers;
+    for (std::size_t i = 0; i < shards.GetCount(); ++i)
+        workers.push_back(std::make_unique<DatabaseWorker>(shards.GetQueue(i), nullptr));
+
+    return workers;
+}
+}
+
+TEST(DatabaseQueueShardsTest, KeyedOperationsStayOnOneShard)
+{
+    RecordingOperation::Log log;
+    DatabaseQueueShards shards(4);
+
+    for (uint32 sequence = 0; sequence < 100; ++sequence)
+        for (uint64 key = 1; key <= 8; ++key)
+            EXPECT_EQ(shards.Enqueue(new RecordingOperation(log, key, sequence), key), key % 4);
+
+    std::vector<std::unique_ptr<DatabaseWorker>> workers = StartWorkers(shards);
+    shards.Shutdown();
+    workers.clear();
+
+    // every key ran on a single worker, in the order it was enqueued
+    ASSERT_EQ(log.Records.size(), 800u);
+    std::map<uint64, RecordingOperation::Record> last;
+    for (RecordingOperation::Record const& record : log.Records)
+    {
+        auto [itr, inserted] = last.try_emplace(record.Key, record);
+        if (inserted)
+            continue;
+
+        EXPECT_EQ(itr->second.Thread, record.Thread);
+        EXPECT_LT(itr->second.Sequence, record.Sequence);
+        itr->second = record;
+    }
+
+    // keys of different shards ran on different workers
+    EXPECT_NE(last[1].Thread, last[2].Thread);
+    EXPECT_EQ(last[1].Thread, last[5].Thread);
+}
+
+TEST(DatabaseQueueShardsTest, UnkeyedOperationsAreSpreadRoundRobin)
+{
+    RecordingOperation::Log log;
+    DatabaseQueueShards shards(3);
+
+    for (uint32 sequence = 0; sequence < 9; ++sequence)
+        EXPECT_EQ(shards.Enqueue(new RecordingOperation(log, 0, sequence), 0), sequence % 3);
+
+    for (std::size_t i = 0; i < shards.GetCount(); ++i)
+        EXPECT_EQ(shards.Size(i), 3u);
+
+    EXPECT_EQ(shards.Size(), 9u);
+}
+
+TEST(DatabaseQueueShardsTest, EnqueueToEachReachesEveryWorkerOnce)
+{
+    RecordingOperation::Log log;
+    DatabaseQueueShards shards(4);
+
+    // what KeepAlive uses to ping every connection
+    uint32 sequence = 0;
+    shards.EnqueueToEach([&]() { return new RecordingOperation(log, 0, sequence++); });
+
+    for (std::size_t i = 0; i < shards.GetCount(); ++i)
+        EXPECT_EQ(shards.Size(i), 1u);
+
+    std::vector<std::unique_ptr<DatabaseWorker>> workers = StartWorkers(shards);
+    shards.Shutdown();
+    workers.clear();
+
+    ASSERT_EQ(log.Records.size(), 4u);
+    for (std::size_t i = 0; i < log.Records.size(); ++i)
+        for (std::size_t j = i + 1; j < log.Records.size(); ++j)
+            EXPECT_NE(log.Records[i].Thread, log.Records[j].Thread);
+}
+
+TEST(DatabaseQueueShardsTest, ShutdownDrainsAllQueues)
+{
+    RecordingOperation::Log log;
+    DatabaseQueueShards shards(4);
+    std::vector<std::unique_ptr<DatabaseWorker>> workers = StartWorkers(shards);
+
+    for (uint32 sequence = 0; sequence < 2000; ++sequence)
+        shards.Enqueue(new RecordingOperation(log, sequence % 7, sequence), sequence % 7);
+
+    // like DatabaseWorkerPool::Close, the workers finish the queued operations before they stop
+    shards.Shutdown();
+    workers.clear();
+
+    EXPECT_EQ(log.Records.size(), 2000u);
+    EXPECT_EQ(shards.Size(), 0u);
+}
+
+TEST(DatabaseQueueShardsTest, OperationsRecordTheirLatencyInTheirShard)
+{
+    RecordingOperation::Log log;
+    DatabaseQueueShards shards(2);
+
+    shards.Enqueue(new RecordingOperation(log, 1, 0), 1);
+    shards.Enqueue(new RecordingOperation(log, 1, 1), 1);
+
+    std::vector<std::unique_ptr<DatabaseWorker>> workers = StartWorkers(shards);
+    shards.Shutdown();
+    workers.clear();
+
+    auto total = [](DatabaseLatencyHistogram::Counts const& counts)
+    {
+        uint64 sum = 0;
+        for (uint64 count : counts)
+            sum += count;
+
+        return sum;
+    };
+
+    EXPECT_EQ(total(shards.GetLatency(0).Take()), 0u);
+    EXPECT_EQ(total(shards.GetLatency(1).Take()), 2u);
+}
@@ -0,0 +1,271 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuctionSearchIndex.h"
+#include "ItemTemplate.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+
+namespace
+{
+    class AuctionSearchIndexTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            std::wstring const names[] = { L"copper ore", L"copper bar", L"linen cloth", L"runecloth", L"greatsword of the monkey", L"arcanite bar", L"potion" };
+
+            _templates.resize(64);
+            for (uint32 i = 0; i < _templates.size(); ++i)
+            {
+                ItemTemplate& proto = _templates[i];
+                proto.ItemId = i + 1;
+                proto.Class = i % 5;
+                proto.SubClass = i % 3;
+                proto.InventoryType = i % 7 == 0 ? INVTYPE_ROBE : (i % 7 == 1 ? INVTYPE_CHEST : INVTYPE_NON_EQUIP);
+                proto.Quality = i % MAX_ITEM_QUALITY;
+                proto.RequiredLevel = (i * 7) % 81;
+                _names.push_back(names[i % std::size(names)]);
+            }
+        }
+
+        std::shared_ptr<SearchableAuctionEntry> CreateAuction(uint32 id, uint32 templateIndex, uint32 buyout)
+        {
+            std::shared_ptr<SearchableAuctionEntry> entry = std::make_shared<SearchableAuctionEntry>();
+            entry->Id = id;
+            entry->buyout = buyout;
+            entry->bid = 0;
+            entry->startbid = buyout / 2;
+            entry->expire_time = 0;
+            entry->listFaction = AuctionHouseFaction::Neutral;
+            entry->item.entry = _templates[templateIndex].ItemId;
+            entry->item.randomPropertyId = 0;
+            entry->item.count = 1;
+            entry->item.itemTemplate = &_templates[templateIndex];
+            for (std::wstring& name : entry->item.itemName)
+                name = _names[templateIndex];
+
+            return entry;
+        }
+
+        static AuctionHouseSearchInfo CreateSearch()
+        {
+            AuctionHouseSearchInfo searchInfo;
+            searchInfo.listfrom = 0;
+            searchInfo.levelmin = 0;
+            searchInfo.levelmax = 0;
+            searchInfo.usable = false;
+            searchInfo.inventoryType = 0xffffffff;
+            searchInfo.itemClass = 0xffffffff;
+            searchInfo.itemSubClass = 0xffffffff;
+            searchInfo.quality = 0xffffffff;
+            searchInfo.getAll = false;
+            return searchInfo;
+        }
+
+        static std::vector<uint32> GetIds(SortableAuctionEntriesList const& entries)
+        {
+            std::vector<uint32> ids;
+            for (SearchableAuctionEntry const* entry : entries)
+                ids.push_back(entry->Id);
+
+            std::sort(ids.begin(), ids.end());
+            return ids;
+        }
+
+        std::vector<uint32> BruteForce(AuctionSearchIndex const& index, AuctionHouseSearchInfo const& searchInfo) const
+        {
+            std::vector<uint32> ids;
+            for (auto const& [id, entry] : index.GetEntries())
+                if (AuctionSearchIndex::Matches(*entry, searchInfo, _playerInfo))
+                    ids.push_back(id);
+
+            std::sort(ids.begin(), ids.end());
+            return ids;
+        }
+
+        std::vector<ItemTemplate> _templates;
+        std::vector<std::wstring> _names;
+        AuctionHousePlayerInfo _playerInfo{ ObjectGuid(), 0, 0, 0, {} };
+    };
+}
+
+TEST_F(AuctionSearchIndexTest, IndexedSearchMatchesFullScan)
+{
+    AuctionSearchIndex index;
+    std::mt19937 random(1234);
+    for (uint32 id = 1; id <= 3000; ++id)
+        index.Add(CreateAuction(id, random() % _templates.size(), random() % 10000));
+
+    for (uint32 id = 1; id <= 3000; id += 7)
+        index.Remove(id);
+
+    std::wstring const searchedNames[] = { L"", L"c", L"ba", L"cop", L"copper", L"cloth", L"monkey", L"xyz", L"e b" };
+    for (uint32 i = 0; i < 500; ++i)
+    {
+        AuctionHouseSearchInfo searchInfo = CreateSearch();
+        if (random() % 2)
+            searchInfo.itemClass = random() % 6;
+        if (random() % 3 == 0)
+            searchInfo.itemSubClass = random() % 4;
+        if (random() % 3 == 0)
+            searchInfo.inventoryType = random() % 2 ? INVTYPE_CHEST : INVTYPE_NON_EQUIP;
+        if (random() % 3 == 0)
+            searchInfo.quality = random() % MAX_ITEM_QUALITY;
+        if (random() % 3 == 0)
+        {
+            searchInfo.levelmin = random() % 80 + 1;
+            searchInfo.levelmax = random() % 2 ? 0 : searchInfo.levelmin + random() % 20;
+        }
+        searchInfo.wsearchedname = searchedNames[random() % std::size(searchedNames)];
+
+        EXPECT_EQ(GetIds(index.Search(searchInfo, _playerInfo, MAX_AUCTIONS_PER_PAGE)), BruteForce(index, searchInfo));
+    }
+}
+
+TEST_F(AuctionSearchIndexTest, PagesAreSortedIncrementally)
+{
+    AuctionSearchIndex index;
+    std::mt19937 random(42);
+    for (uint32 id = 1; id <= 1000; ++id)
+        index.Add(CreateAuction(id, random() % _templates.size(), random() % 100000));
+
+    AuctionHouseSearchInfo searchInfo = CreateSearch();
+    AuctionSortInfo sortInfo;
+    sortInfo.sortOrder = AUCTION_SORT_BUYOUT_2;
+    sortInfo.isDesc = false;
+    searchInfo.sorting.push_back(sortInfo);
+
+    std::vector<uint32> expected;
+    for (auto const& [id, entry] : index.GetEntries())
+        expected.push_back(entry->buyout);
+    std::sort(expected.begin(), expected.end(), std::greater<uint32>());
+
+    for (uint32 page = 0; page < 4; ++page)
+    {
+        std::size_t const sortedCount = (page + 1) * MAX_AUCTIONS_PER_PAGE;
+        SortableAuctionEntriesList const& entries = index.Search(searchInfo, _playerInfo, sortedCount);
+        ASSERT_EQ(entries.size(), expected.size());
+        for (std::size_t i = 0; i < sortedCount; ++i)
+            ASSERT_EQ(entries[i]->buyout, expected[i]) << "position " << i;
+    }
+
+    EXPECT_EQ(index.GetStatistics().ViewHits, 3u);
+}
+
+TEST_F(AuctionSearchIndexTest, UpdatesInvalidateMatchingViews)
+{
+    AuctionSearchIndex index;
+    index.Add(CreateAuction(1, 0, 100));   // class 0, "copper ore"
+    index.Add(CreateAuction(2, 1, 100));   // class 1, "copper bar"
+
+    AuctionHouseSearchInfo searchInfo = CreateSearch();
+    searchInfo.itemClass = 0;
+
+    EXPECT_EQ(GetIds(index.Search(searchInfo, _playerInfo, MAX_AUCTIONS_PER_PAGE)), std::vector<uint32>({ 1 }));
+
+    // Not matching the view, it stays cached
+    index.Add(CreateAuction(3, 1, 100));
+    EXPECT_EQ(GetIds(index.Search(searchInfo, _playerInfo, MAX_AUCTIONS_PER_PAGE)), std::vector<uint32>({ 1 }));
+    EXPECT_EQ(index.GetStatistics().ViewHits, 1u);
+
+    // Matching additions and removals rebuild it
+    index.Add(CreateAuction(4, 5, 100));
+    EXPECT_EQ(GetIds(index.Search(searchInfo, _playerInfo, MAX_AUCTIONS_PER_PAGE)), std::vector<uint32>({ 1, 4 }));
+    index.Remove(1);
+    EXPECT_EQ(GetIds(index.Search(searchInfo, _playerInfo, MAX_AUCTIONS_PER_PAGE)), std::vector<uint32>({ 4 }));
+    EXPECT_EQ(index.GetStatistics().ViewHits, 1u);
+
+    // Name index built by the first name search follows later changes
+    AuctionHouseSearchInfo nameSearch = CreateSearch();
+    nameSearch.wsearchedname = L"copper";
+    EXPECT_EQ(GetIds(index.Search(nameSearch, _playerInfo, MAX_AUCTIONS_PER_PAGE)), std::vector<uint32>({ 2, 3 }));
+    index.Remove(2);
+    index.Remove(3);
+    index.Add(CreateAuction(5, 7, 100));
+    EXPECT_EQ(GetIds(index.Search(nameSearch, _playerInfo, MAX_AUCTIONS_PER_PAGE)), std::vector<uint32>({ 5 }));
+}
+
+TEST_F(AuctionSearchIndexTest, ViewsAreEvictedByTotalEntries)
+{
+    AuctionSearchIndex index(10);
+    for (uint32 id = 1; id <= 20; ++id)
+        index.Add(CreateAuction(id, id % 5, 100));   // 4 auctions per item class
+
+    auto search = [&](uint32 itemClass)
+    {
+        AuctionHouseSearchInfo searchInfo = CreateSearch();
+        searchInfo.itemClass = itemClass;
+        return GetIds(index.Search(searchInfo, _playerInfo, MAX_AUCTIONS_PER_PAGE)).size();
+    };
+
+    EXPECT_EQ(search(0), 4u);
+    EXPECT_EQ(search(1), 4u);
+    EXPECT_EQ(index.GetCachedViewEntryCount(), 8u);
+
+    // class 0 becomes the most recently used view, so class 1 is evicted for class 2
+    EXPECT_EQ(search(0), 4u);
+    EXPECT_EQ(search(2), 4u);
+    EXPECT_EQ(index.GetCachedViewCount(), 2u);
+    EXPECT_EQ(index.GetCachedViewEntryCount(), 8u);
+    EXPECT_EQ(index.GetStatistics().ViewHits, 1u);
+
+    EXPECT_EQ(search(0), 4u);
+    EXPECT_EQ(index.GetStatistics().ViewHits, 2u);
+    EXPECT_EQ(search(1), 4u);
+    EXPECT_EQ(index.GetStatistics().ViewHits, 2u);
+
+    // results larger than the whole cache are not cached
+    EXPECT_EQ(search(0xffffffff), 20u);
+    EXPECT_EQ(index.GetCachedViewCount(), 2u);
+    EXPECT_LE(index.GetCachedViewEntryCount(), 10u);
+}
+
+TEST_F(AuctionSearchIndexTest, InvalidationKeepsEvictionOrderConsistent)
+{
+    AuctionSearchIndex index(8);
+    for (uint32 id = 1; id <= 20; ++id)
+        index.Add(CreateAuction(id, id % 5, 100));
+
+    auto search = [&](uint32 itemClass)
+    {
+        AuctionHouseSearchInfo searchInfo = CreateSearch();
+        searchInfo.itemClass = itemClass;
+        index.Search(searchInfo, _playerInfo, MAX_AUCTIONS_PER_PAGE);
+    };
+
+    search(0);
+    search(1);
+
+    // a bid applied by another index sharing the entry only drops the matching view
+    index.InvalidateAuction(5);                     // class 0
+    EXPECT_EQ(index.GetCachedViewCount(), 1u);
+    EXPECT_EQ(index.GetCachedViewEntryCount(), 4u);
+
+    // the dropped view must not be evicted a second time
+    search(2);
+    search(3);
+    search(4);
+    EXPECT_EQ(index.GetCachedViewCount(), 2u);
+    EXPECT_EQ(index.GetCachedViewEntryCount(), 8u);
+
+    index.UpdateBid(4, 50, ObjectGuid());           // class 4
+    EXPECT_EQ(index.GetEntries().at(4)->bid, 50u);
+    EXPECT_EQ(index.GetCachedViewCount(), 1u);
+    EXPECT_EQ(index.GetCachedViewEntryCount(), 4u);
+}
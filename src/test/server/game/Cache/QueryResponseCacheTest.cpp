@@ -0,0 +1,120 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QueryResponseCache.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    WorldPacket BuildResponse(uint32 entry, LocaleConstant locale, uint32& builds)
+    {
+        ++builds;
+        WorldPacket data(SMSG_CREATURE_QUERY_RESPONSE, 8);
+        data << uint32(entry);
+        data << uint32(locale);
+        return data;
+    }
+
+    class QueryResponseCacheTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override { sQueryResponseCache->InvalidateAll(); }
+        void TearDown() override { sQueryResponseCache->InvalidateAll(); }
+    };
+}
+
+TEST_F(QueryResponseCacheTest, BuildsOncePerEntryAndLocale)
+{
+    uint32 builds = 0;
+    auto get = [&](uint32 entry, LocaleConstant locale)
+    {
+        return sQueryResponseCache->Get(QUERY_CACHE_CREATURE, entry, locale, [&]() { return BuildResponse(entry, locale, builds); });
+    };
+
+    QueryResponseCache::Response first = get(1, LOCALE_enUS);
+    EXPECT_EQ(get(1, LOCALE_enUS), first);
+    EXPECT_EQ(builds, 1u);
+
+    QueryResponseCache::Response german = get(1, LOCALE_deDE);
+    EXPECT_NE(german, first);
+    EXPECT_EQ(german->read<uint32>(4), uint32(LOCALE_deDE));
+
+    EXPECT_NE(get(2, LOCALE_enUS), first);
+    EXPECT_EQ(builds, 3u);
+
+    // types are cached separately
+    sQueryResponseCache->Get(QUERY_CACHE_ITEM, 1, LOCALE_enUS, [&]() { return BuildResponse(1, LOCALE_enUS, builds); });
+    EXPECT_EQ(builds, 4u);
+}
+
+TEST_F(QueryResponseCacheTest, InvalidateRebuilds)
+{
+    uint32 builds = 0;
+    auto get = [&]()
+    {
+        return sQueryResponseCache->Get(QUERY_CACHE_QUEST, 10, LOCALE_enUS, [&]() { return BuildResponse(10, LOCALE_enUS, builds); });
+    };
+
+    QueryResponseCache::Response before = get();
+    sQueryResponseCache->Invalidate(QUERY_CACHE_CREATURE);
+    EXPECT_EQ(get(), before);
+
+    sQueryResponseCache->Invalidate(QUERY_CACHE_QUEST);
+    QueryResponseCache::Response after = get();
+    EXPECT_NE(after, before);
+    EXPECT_EQ(builds, 2u);
+
+    // responses handed out before the invalidation stay valid
+    EXPECT_EQ(before->read<uint32>(0), 10u);
+}
+
+TEST_F(QueryResponseCacheTest, ResponseBuiltDuringInvalidationIsNotCached)
+{
+    uint32 builds = 0;
+    QueryResponseCache::Response stale = sQueryResponseCache->Get(QUERY_CACHE_PAGE_TEXT, 5, LOCALE_enUS, [&]()
+    {
+        // a reload finishing while the response is being built
+        sQueryResponseCache->Invalidate(QUERY_CACHE_PAGE_TEXT);
+        return BuildResponse(5, LOCALE_enUS, builds);
+    });
+
+    QueryResponseCache::Response fresh = sQueryResponseCache->Get(QUERY_CACHE_PAGE_TEXT, 5, LOCALE_enUS, [&]() { return BuildResponse(5, LOCALE_enUS, builds); });
+    EXPECT_NE(fresh, stale);
+    EXPECT_EQ(builds, 2u);
+}
+
+TEST_F(QueryResponseCacheTest, VariantsAreCachedSeparately)
+{
+    uint32 builds = 0;
+    auto get = [&](uint32 entry, uint32 variant)
+    {
+        return sQueryResponseCache->Get(QUERY_CACHE_QUEST, entry, LOCALE_enUS, variant, [&]() { return BuildResponse(entry, LOCALE_enUS, builds); });
+    };
+
+    QueryResponseCache::Response shared = sQueryResponseCache->Get(QUERY_CACHE_QUEST, 10, LOCALE_enUS, [&]() { return BuildResponse(10, LOCALE_enUS, builds); });
+    EXPECT_EQ(get(10, 0), shared);
+
+    QueryResponseCache::Response variant = get(10, 80);
+    EXPECT_NE(variant, shared);
+    EXPECT_EQ(get(10, 80), variant);
+    EXPECT_NE(get(11, 80), variant);
+    EXPECT_EQ(builds, 3u);
+
+    sQueryResponseCache->Invalidate(QUERY_CACHE_QUEST);
+    EXPECT_NE(get(10, 80), variant);
+    EXPECT_EQ(builds, 4u);
+}
@@ -0,0 +1,163 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldSnapshot.h"
+#include "gtest/gtest.h"
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    struct TestRecord
+    {
+        uint32 Id;
+        float Value;
+        uint16 Map;
+        uint8 Flags;
+    };
+
+    WorldSnapshot::Key MakeKey(uint8 seed)
+    {
+        WorldSnapshot::Key key = { };
+        key.fill(seed);
+        return key;
+    }
+
+    class WorldSnapshotTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            _fileName = (std::filesystem::temp_directory_path() / ("world_snapshot_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + ".snapshot")).string();
+            std::filesystem::remove(_fileName);
+        }
+
+        void TearDown() override
+        {
+            std::filesystem::remove(_fileName);
+        }
+
+        void WriteCreatures(WorldSnapshot::Key const& key, std::vector<TestRecord> const& records)
+        {
+            sWorldSnapshot->Open(_fileName);
+            sWorldSnapshot->Write(WORLD_SNAPSHOT_CREATURES, key, records, { "", "npc_first", "npc_second" });
+            sWorldSnapshot->Save();
+        }
+
+        std::string _fileName;
+    };
+}
+
+TEST_F(WorldSnapshotTest, MissingFileHasNoSections)
+{
+    sWorldSnapshot->Open(_fileName);
+
+    std::span<TestRecord const> records;
+    std::vector<std::string_view> strings;
+    EXPECT_FALSE(sWorldSnapshot->Read(WORLD_SNAPSHOT_CREATURES, MakeKey(1), records, strings));
+
+    sWorldSnapshot->Save();
+    EXPECT_FALSE(std::filesystem::exists(_fileName));
+}
+
+TEST_F(WorldSnapshotTest, RoundTrip)
+{
+    std::vector<TestRecord> written = { { 1, 1.5f, 0, 1 }, { 2, -3.0f, 571, 0 }, { 3, 0.0f, 1, 1 } };
+    WriteCreatures(MakeKey(1), written);
+    ASSERT_TRUE(std::filesystem::exists(_fileName));
+
+    sWorldSnapshot->Open(_fileName);
+    std::span<TestRecord const> records;
+    std::vector<std::string_view> strings;
+    ASSERT_TRUE(sWorldSnapshot->Read(WORLD_SNAPSHOT_CREATURES, MakeKey(1), records, strings));
+
+    ASSERT_EQ(records.size(), written.size());
+    for (std::size_t i = 0; i < written.size(); ++i)
+    {
+        EXPECT_EQ(records[i].Id, written[i].Id);
+        EXPECT_EQ(records[i].Value, written[i].Value);
+        EXPECT_EQ(records[i].Map, written[i].Map);
+        EXPECT_EQ(records[i].Flags, written[i].Flags);
+    }
+
+    EXPECT_EQ(strings, (std::vector<std::string_view>{ "", "npc_first", "npc_second" }));
+    sWorldSnapshot->Save();
+}
+
+TEST_F(WorldSnapshotTest, DifferentKeyIsStale)
+{
+    WriteCreatures(MakeKey(1), { { 1, 1.0f, 0, 0 } });
+
+    sWorldSnapshot->Open(_fileName);
+    std::span<TestRecord const> records;
+    std::vector<std::string_view> strings;
+    EXPECT_FALSE(sWorldSnapshot->Read(WORLD_SNAPSHOT_CREATURES, MakeKey(2), records, strings));
+
+    // the stale section is dropped even if it is not written again
+    sWorldSnapshot->Save();
+    sWorldSnapshot->Open(_fileName);
+    EXPECT_FALSE(sWorldSnapshot->Read(WORLD_SNAPSHOT_CREATURES, MakeKey(1), records, strings));
+    sWorldSnapshot->Save();
+}
+
+TEST_F(WorldSnapshotTest, RecordSizeMismatchIsStale)
+{
+    WriteCreatures(MakeKey(1), { { 1, 1.0f, 0, 0 } });
+
+    sWorldSnapshot->Open(_fileName);
+    std::span<uint64 const> records;
+    std::vector<std::string_view> strings;
+    EXPECT_FALSE(sWorldSnapshot->Read(WORLD_SNAPSHOT_CREATURES, MakeKey(1), records, strings));
+    sWorldSnapshot->Save();
+}
+
+TEST_F(WorldSnapshotTest, KeepsValidSectionsWhenRewriting)
+{
+    WriteCreatures(MakeKey(1), { { 1, 1.0f, 0, 0 }, { 2, 2.0f, 0, 0 } });
+
+    // creatures are not requested, gameobjects are written
+    sWorldSnapshot->Open(_fileName);
+    sWorldSnapshot->Write(WORLD_SNAPSHOT_GAMEOBJECTS, MakeKey(3), std::vector<TestRecord>{ { 7, 7.0f, 0, 0 } }, { });
+    sWorldSnapshot->Save();
+
+    sWorldSnapshot->Open(_fileName);
+    std::span<TestRecord const> creatures;
+    std::span<TestRecord const> gameobjects;
+    std::vector<std::string_view> strings;
+    ASSERT_TRUE(sWorldSnapshot->Read(WORLD_SNAPSHOT_CREATURES, MakeKey(1), creatures, strings));
+    EXPECT_EQ(creatures.size(), 2u);
+    EXPECT_EQ(strings.size(), 3u);
+    ASSERT_TRUE(sWorldSnapshot->Read(WORLD_SNAPSHOT_GAMEOBJECTS, MakeKey(3), gameobjects, strings));
+    ASSERT_EQ(gameobjects.size(), 1u);
+    EXPECT_EQ(gameobjects[0].Id, 7u);
+    EXPECT_TRUE(strings.empty());
+    sWorldSnapshot->Save();
+}
+
+TEST_F(WorldSnapshotTest, RejectsCorruptFile)
+{
+    WriteCreatures(MakeKey(1), { { 1, 1.0f, 0, 0 } });
+
+    // truncate in the middle of the section table
+    std::filesystem::resize_file(_fileName, 24);
+
+    sWorldSnapshot->Open(_fileName);
+    std::span<TestRecord const> records;
+    std::vector<std::string_view> strings;
+    EXPECT_FALSE(sWorldSnapshot->Read(WORLD_SNAPSHOT_CREATURES, MakeKey(1), records, strings));
+    sWorldSnapshot->Save();
+}
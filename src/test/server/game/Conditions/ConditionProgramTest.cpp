@@ -0,0 +1,275 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ConditionMgr.h"
+#include "DBCStores.h"
+#include "ReputationMgr.h"
+#include "TestPlayer.h"
+#include "TestMap.h"
+#include "WorldSession.h"
+#include "WorldMock.h"
+#include "SharedDefines.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <string>
+
+using namespace testing;
+
+namespace
+{
+constexpr uint32 TestFactionId = 60001;
+constexpr int32 TestReputationListId = 200;
+constexpr uint32 TestAchievementId = 60002;
+constexpr uint32 TestQuestId = 60003;
+
+class ConditionTestPlayer : public TestPlayer
+{
+public:
+    using TestPlayer::TestPlayer;
+
+    void SetRaceAndClass(uint8 race, uint8 playerClass)
+    {
+        m_realRace = race;
+        m_race = race;
+        SetByteValue(UNIT_FIELD_BYTES_0, 0, race);
+        SetByteValue(UNIT_FIELD_BYTES_0, 1, playerClass);
+    }
+};
+
+class ConditionProgramTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        TestMap::EnsureDBC();
+
+        originalWorld = sWorld.release();
+        worldMock = new NiceMock<WorldMock>();
+        sWorld.reset(worldMock);
+
+        static std::string emptyString;
+        ON_CALL(*worldMock, GetDataPath()).WillByDefault(ReturnRef(emptyString));
+        ON_CALL(*worldMock, GetRealmName()).WillByDefault(ReturnRef(emptyString));
+        ON_CALL(*worldMock, GetDefaultDbcLocale()).WillByDefault(Return(LOCALE_enUS));
+        ON_CALL(*worldMock, getRate(_)).WillByDefault(Return(1.0f));
+        ON_CALL(*worldMock, getBoolConfig(_)).WillByDefault(Return(false));
+        ON_CALL(*worldMock, getIntConfig(_)).WillByDefault(Return(0));
+        ON_CALL(*worldMock, getFloatConfig(_)).WillByDefault(Return(0.0f));
+        ON_CALL(*worldMock, GetPlayerSecurityLimit()).WillByDefault(Return(SEC_PLAYER));
+
+        session = new WorldSession(1, "player", 0, nullptr, SEC_PLAYER, EXPANSION_WRATH_OF_THE_LICH_KING,
+            0, LOCALE_enUS, 0, false, false, 0);
+        session->InitRBACDataForTest();
+
+        player = new ConditionTestPlayer(session);
+        player->ForceInitValues();
+        player->SetRaceAndClass(RACE_HUMAN, CLASS_WARRIOR);
+        session->SetPlayer(player);
+        player->SetSession(session);
+    }
+
+    void TearDown() override
+    {
+        sConditionMgr->LoadConditionsForTest({ }, { });
+
+        // Intentional leaks of session/player to avoid database access in destructors.
+        IWorld* currentWorld = sWorld.release();
+        delete currentWorld;
+        worldMock = nullptr;
+
+        sWorld.reset(originalWorld);
+        originalWorld = nullptr;
+        session = nullptr;
+        player = nullptr;
+    }
+
+    static Condition* MakeCondition(int32 sourceEntry, uint32 elseGroup, uint32 typeMask)
+    {
+        Condition* cond = new Condition();
+        cond->SourceType = CONDITION_SOURCE_TYPE_SPELL;
+        cond->SourceEntry = sourceEntry;
+        cond->ElseGroup = elseGroup;
+        cond->ConditionType = CONDITION_TYPE_MASK;
+        cond->ConditionValue1 = typeMask;
+        return cond;
+    }
+
+    static Condition* MakeReference(int32 sourceEntry, uint32 elseGroup, uint32 referenceId)
+    {
+        Condition* cond = new Condition();
+        cond->SourceType = CONDITION_SOURCE_TYPE_SPELL;
+        cond->SourceEntry = sourceEntry;
+        cond->ElseGroup = elseGroup;
+        cond->ReferenceId = referenceId;
+        return cond;
+    }
+
+    // Conditions met by the test player and failed by it
+    static Condition* Met(int32 sourceEntry, uint32 elseGroup) { return MakeCondition(sourceEntry, elseGroup, TYPEMASK_PLAYER); }
+    static Condition* Failed(int32 sourceEntry, uint32 elseGroup) { return MakeCondition(sourceEntry, elseGroup, TYPEMASK_GAMEOBJECT); }
+
+    bool Evaluate(int32 sourceEntry, Condition const** lastFailedCondition = nullptr)
+    {
+        ConditionProgram const* program = sConditionMgr->GetConditionProgramForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL, sourceEntry);
+        EXPECT_NE(program, nullptr);
+
+        ConditionSourceInfo sourceInfo(player);
+        bool const result = sConditionMgr->IsObjectMeetToConditions(sourceInfo, program);
+        if (lastFailedCondition)
+            *lastFailedCondition = sourceInfo.mLastFailedCondition;
+
+        return result;
+    }
+
+    IWorld* originalWorld = nullptr;
+    NiceMock<WorldMock>* worldMock = nullptr;
+    WorldSession* session = nullptr;
+    ConditionTestPlayer* player = nullptr;
+};
+
+// cppcheck-suppress syntaxError
+TEST_F(ConditionProgramTest, ConditionsOfOneElseGroupAreAnded)
+{
+    Condition* failed = Failed(2, 0);
+    sConditionMgr->LoadConditionsForTest({ }, { Met(1, 0), Met(1, 0), Met(2, 0), failed, Met(2, 0) });
+
+    EXPECT_TRUE(Evaluate(1));
+
+    Condition const* lastFailed = nullptr;
+    EXPECT_FALSE(Evaluate(2, &lastFailed));
+    EXPECT_EQ(lastFailed, failed);
+}
+
+TEST_F(ConditionProgramTest, ElseGroupsAreOred)
+{
+    sConditionMgr->LoadConditionsForTest({ }, { Met(1, 0), Failed(1, 0), Met(1, 1), Met(1, 1), Failed(2, 0), Met(2, 3) });
+
+    EXPECT_TRUE(Evaluate(1));
+    EXPECT_TRUE(Evaluate(2));
+}
+
+TEST_F(ConditionProgramTest, InterleavedElseGroupsKeepListOrder)
+{
+    // the groups are spread over the source list, the failed condition reported is the last one in that list
+    Condition* firstFailed = Failed(1, 1);
+    Condition* lastFailed = Failed(1, 0);
+    sConditionMgr->LoadConditionsForTest({ }, { firstFailed, Met(1, 0), lastFailed, Met(1, 1), Met(2, 1), Failed(2, 0), Met(2, 1) });
+
+    Condition const* reported = nullptr;
+    EXPECT_FALSE(Evaluate(1, &reported));
+    EXPECT_EQ(reported, lastFailed);
+
+    EXPECT_TRUE(Evaluate(2));
+}
+
+TEST_F(ConditionProgramTest, ReferencesAreExpanded)
+{
+    Condition* referencedFailure = Failed(0, 0);
+    std::map<uint32, ConditionList> references;
+    references[100] = { Met(0, 0), referencedFailure };
+    references[101] = { Met(0, 0), Met(0, 0) };
+
+    sConditionMgr->LoadConditionsForTest(references, { Met(1, 0), MakeReference(1, 0, 100), MakeReference(2, 0, 101), Met(2, 0),
+        MakeReference(3, 0, 100), MakeReference(3, 1, 101) });
+
+    Condition const* reported = nullptr;
+    EXPECT_FALSE(Evaluate(1, &reported));
+    EXPECT_EQ(reported, referencedFailure);
+
+    EXPECT_TRUE(Evaluate(2));
+    EXPECT_TRUE(Evaluate(3));
+}
+
+TEST_F(ConditionProgramTest, CyclicReferencesAreIgnored)
+{
+    std::map<uint32, ConditionList> references;
+    references[200] = { MakeReference(0, 0, 201), Met(0, 0) };
+    references[201] = { MakeReference(0, 0, 200), Met(0, 0) };
+    references[202] = { MakeReference(0, 0, 202), Failed(0, 0) };
+
+    sConditionMgr->LoadConditionsForTest(references, { MakeReference(1, 0, 200), MakeReference(2, 0, 201), MakeReference(3, 0, 202) });
+
+    // the reference closing the cycle is dropped, the rest of the templates is still checked
+    EXPECT_TRUE(Evaluate(1));
+    EXPECT_TRUE(Evaluate(2));
+    EXPECT_FALSE(Evaluate(3));
+}
+
+TEST_F(ConditionProgramTest, QuestRewardInvalidatesCache)
+{
+    Condition cond;
+    PlayerConditionCache& cache = player->GetConditionCache();
+    auto rewarded = [&]() { return player->IsQuestRewarded(TestQuestId); };
+
+    EXPECT_FALSE(cache.Evaluate(&cond, rewarded));
+
+    // unchanged player state, the stored result is reused
+    EXPECT_FALSE(cache.Evaluate(&cond, []() { return true; }));
+
+    player->SetRewardedQuest(TestQuestId);
+    EXPECT_TRUE(cache.Evaluate(&cond, rewarded));
+
+    player->RemoveRewardedQuest(TestQuestId, false);
+    EXPECT_FALSE(cache.Evaluate(&cond, rewarded));
+}
+
+TEST_F(ConditionProgramTest, CompletedAchievementInvalidatesCache)
+{
+    Condition cond;
+    cond.ConditionType = CONDITION_ACHIEVEMENT;
+    cond.ConditionValue1 = TestAchievementId;
+
+    ConditionSourceInfo sourceInfo(player);
+    EXPECT_FALSE(cond.Meets(sourceInfo));
+
+    AchievementEntry achievement = { };
+    achievement.ID = TestAchievementId;
+    achievement.requiredFaction = -1;
+    achievement.mapID = -1;
+    achievement.flags = ACHIEVEMENT_FLAG_HIDDEN;
+    player->CompletedAchievement(&achievement);
+
+    ASSERT_TRUE(player->HasAchieved(TestAchievementId));
+    EXPECT_TRUE(cond.Meets(sourceInfo));
+}
+
+TEST_F(ConditionProgramTest, ReputationRankChangeInvalidatesCache)
+{
+    FactionEntry* faction = new FactionEntry();
+    faction->ID = TestFactionId;
+    faction->reputationListID = TestReputationListId;
+    sFactionStore.SetEntry(TestFactionId, faction);
+    player->GetReputationMgr().LoadFromDB(PreparedQueryResult());
+
+    Condition cond;
+    cond.ConditionType = CONDITION_REPUTATION_RANK;
+    cond.ConditionValue1 = TestFactionId;
+    cond.ConditionValue2 = 1 << REP_FRIENDLY;
+
+    ConditionSourceInfo sourceInfo(player);
+    EXPECT_FALSE(cond.Meets(sourceInfo));
+
+    player->GetReputationMgr().SetReputation(faction, 3000.0f);
+    ASSERT_EQ(player->GetReputationMgr().GetRank(faction), REP_FRIENDLY);
+    EXPECT_TRUE(cond.Meets(sourceInfo));
+
+    player->GetReputationMgr().SetReputation(faction, 0.0f);
+    EXPECT_FALSE(cond.Meets(sourceInfo));
+
+    sFactionStore.SetEntry(TestFactionId, nullptr);
+}
+}
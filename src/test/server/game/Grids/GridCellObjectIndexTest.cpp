@@ -0,0 +1,232 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridCellObjectIndex.h"
+#include "GridDefines.h"
+#include "TestCreature.h"
+#include "TestMap.h"
+#include "WorldMock.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+
+using namespace testing;
+
+namespace
+{
+
+class GridCellObjectIndexTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        _previousWorld = std::move(sWorld);
+        _worldMock = new NiceMock<WorldMock>();
+
+        ON_CALL(*_worldMock, getIntConfig(_)).WillByDefault(Return(0));
+        ON_CALL(*_worldMock, getFloatConfig(_)).WillByDefault(Return(1.0f));
+        ON_CALL(*_worldMock, getBoolConfig(_)).WillByDefault(Return(false));
+        static std::string emptyString;
+        ON_CALL(*_worldMock, GetDataPath()).WillByDefault(ReturnRef(emptyString));
+
+        sWorld.reset(_worldMock);
+
+        TestMap::EnsureDBC();
+        _map = new TestMap();
+    }
+
+    void TearDown() override
+    {
+        for (TestCreature* creature : _creatures)
+            delete creature;
+
+        delete _map;
+        sWorld = std::move(_previousWorld);
+    }
+
+    TestCreature* SpawnCreature(float x, float y, uint32 phaseMask = 1)
+    {
+        TestCreature* creature = new TestCreature();
+        creature->SetupForCombatTest(_map, _creatures.size() + 1, 12345);
+        creature->SetPhase(phaseMask);
+        creature->SetFloatValue(UNIT_FIELD_COMBATREACH, 0.0f);
+        creature->Relocate(x, y, 0.0f);
+        _creatures.push_back(creature);
+        return creature;
+    }
+
+    std::vector<WorldObject*> Select(GridCellObjectIndex const& index, GridCellObjectIndexFilter const& filter)
+    {
+        std::vector<GridCellObjectIndexCandidate> candidates;
+        index.Select(filter, candidates);
+
+        std::vector<WorldObject*> result;
+        for (GridCellObjectIndexCandidate const& candidate : candidates)
+            result.push_back(candidate.Object);
+
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    static GridCellObjectIndexFilter RangeFilter(float x, float y, float range)
+    {
+        GridCellObjectIndexFilter filter;
+        filter.RangeTypeMask = GRID_MAP_TYPE_MASK_CREATURE;
+        filter.X = x;
+        filter.Y = y;
+        filter.Range = range;
+        return filter;
+    }
+
+    std::unique_ptr<IWorld> _previousWorld;
+    NiceMock<WorldMock>* _worldMock = nullptr;
+    TestMap* _map = nullptr;
+    std::vector<TestCreature*> _creatures;
+};
+
+std::vector<WorldObject*> Objects(std::vector<WorldObject*> objects)
+{
+    std::sort(objects.begin(), objects.end());
+    return objects;
+}
+
+TEST_F(GridCellObjectIndexTest, InsertAndRemove)
+{
+    GridCellObjectIndex index;
+    TestCreature* first = SpawnCreature(0.0f, 0.0f);
+    TestCreature* second = SpawnCreature(1.0f, 0.0f);
+    TestCreature* third = SpawnCreature(2.0f, 0.0f);
+
+    index.Insert(first);
+    index.Insert(second);
+    index.Insert(third);
+    EXPECT_EQ(index.Size(), 3u);
+    EXPECT_EQ(first->GetGridCellIndex(), &index);
+
+    // the last object is swapped into the removed slot and must still be found there
+    first->RemoveFromGridCellIndex();
+    EXPECT_EQ(index.Size(), 2u);
+    EXPECT_EQ(first->GetGridCellIndex(), nullptr);
+
+    third->Relocate(50.0f, 0.0f, 0.0f);
+    EXPECT_EQ(Select(index, RangeFilter(0.0f, 0.0f, 5.0f)), Objects({ second }));
+
+    third->RemoveFromGridCellIndex();
+    second->RemoveFromGridCellIndex();
+    EXPECT_EQ(index.Size(), 0u);
+}
+
+TEST_F(GridCellObjectIndexTest, DestructorDetachesObjects)
+{
+    TestCreature* creature = SpawnCreature(0.0f, 0.0f);
+
+    {
+        GridCellObjectIndex index;
+        index.Insert(creature);
+    }
+
+    EXPECT_EQ(creature->GetGridCellIndex(), nullptr);
+}
+
+TEST_F(GridCellObjectIndexTest, RangeFollowsRelocation)
+{
+    GridCellObjectIndex index;
+    TestCreature* creature = SpawnCreature(3.0f, 4.0f);
+    index.Insert(creature);
+
+    EXPECT_EQ(Select(index, RangeFilter(0.0f, 0.0f, 5.0f)), Objects({ creature }));
+    EXPECT_TRUE(Select(index, RangeFilter(0.0f, 0.0f, 4.9f)).empty());
+
+    creature->Relocate(30.0f, 0.0f, 0.0f);
+    EXPECT_TRUE(Select(index, RangeFilter(0.0f, 0.0f, 5.0f)).empty());
+    EXPECT_EQ(Select(index, RangeFilter(28.0f, 0.0f, 5.0f)), Objects({ creature }));
+}
+
+TEST_F(GridCellObjectIndexTest, RangeAddsCombatReach)
+{
+    GridCellObjectIndex index;
+    TestCreature* creature = SpawnCreature(10.0f, 0.0f);
+    index.Insert(creature);
+
+    GridCellObjectIndexFilter filter = RangeFilter(0.0f, 0.0f, 8.0f);
+    filter.AddObjectSize = true;
+    EXPECT_TRUE(Select(index, filter).empty());
+
+    creature->SetFloatValue(UNIT_FIELD_COMBATREACH, 3.0f);
+    EXPECT_EQ(Select(index, filter), Objects({ creature }));
+
+    filter.AddObjectSize = false;
+    EXPECT_TRUE(Select(index, filter).empty());
+}
+
+TEST_F(GridCellObjectIndexTest, RangeOnlyAppliesToRangeTypes)
+{
+    GridCellObjectIndex index;
+    TestCreature* creature = SpawnCreature(100.0f, 0.0f);
+    index.Insert(creature);
+
+    GridCellObjectIndexFilter filter = RangeFilter(0.0f, 0.0f, 5.0f);
+    filter.RangeTypeMask = GRID_MAP_TYPE_MASK_PLAYER;
+    EXPECT_EQ(Select(index, filter), Objects({ creature }));
+
+    filter.TypeMask = GRID_MAP_TYPE_MASK_PLAYER | GRID_MAP_TYPE_MASK_GAMEOBJECT;
+    EXPECT_TRUE(Select(index, filter).empty());
+}
+
+TEST_F(GridCellObjectIndexTest, PhaseFilter)
+{
+    GridCellObjectIndex index;
+    TestCreature* phaseOne = SpawnCreature(0.0f, 0.0f, 1);
+    TestCreature* phaseTwo = SpawnCreature(0.0f, 0.0f, 2);
+    TestCreature* phaseBoth = SpawnCreature(0.0f, 0.0f, 3);
+    index.Insert(phaseOne);
+    index.Insert(phaseTwo);
+    index.Insert(phaseBoth);
+
+    GridCellObjectIndexFilter filter;
+    filter.CheckPhase = true;
+    filter.PhaseMask = 1;
+    EXPECT_EQ(Select(index, filter), Objects({ phaseOne, phaseBoth }));
+
+    phaseTwo->SetPhase(1);
+    EXPECT_EQ(Select(index, filter), Objects({ phaseOne, phaseTwo, phaseBoth }));
+
+    filter.CheckPhase = false;
+    filter.PhaseMask = 4;
+    EXPECT_EQ(Select(index, filter).size(), 3u);
+}
+
+TEST_F(GridCellObjectIndexTest, SelectMatchesEveryObjectOnce)
+{
+    // enough objects to cover both the vectorized body and the scalar tail
+    GridCellObjectIndex index;
+    std::vector<WorldObject*> expected;
+    for (uint32 i = 0; i < 23; ++i)
+    {
+        TestCreature* creature = SpawnCreature(float(i), 0.0f, (i % 3) ? 1 : 2);
+        index.Insert(creature);
+        if (i <= 10 && (i % 3))
+            expected.push_back(creature);
+    }
+
+    GridCellObjectIndexFilter filter = RangeFilter(0.0f, 0.0f, 10.0f);
+    filter.CheckPhase = true;
+    filter.PhaseMask = 1;
+    EXPECT_EQ(Select(index, filter), Objects(expected));
+}
+
+}
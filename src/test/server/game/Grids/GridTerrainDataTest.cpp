@@ -0,0 +1,166 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridDefines.h"
+#include "GridTerrainData.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <vector>
+
+namespace
+{
+    // Writes a map file with a per cell area map and float heights, optionally cut short. The height
+    // function takes the position in v9 vertices along x and y, v8 holds the value at cell centers.
+    std::string WriteTestMapFile(char const* name, std::function<float(float, float)> const& height, std::size_t truncateTo = 0)
+    {
+        map_fileheader header{};
+        header.mapMagic = MapMagic.asUInt;
+        header.versionMagic = MapVersionMagic;
+
+        map_areaHeader areaHeader{};
+        areaHeader.fourcc = MapAreaMagic.asUInt;
+        std::vector<uint16> areaMap(16 * 16);
+        for (std::size_t i = 0; i < areaMap.size(); ++i)
+            areaMap[i] = uint16(i);
+
+        map_heightHeader heightHeader{};
+        heightHeader.fourcc = MapHeightMagic.asUInt;
+        heightHeader.gridHeight = height(0.0f, 0.0f);
+        heightHeader.gridMaxHeight = height(0.0f, 0.0f);
+        std::vector<float> heights;
+        heights.reserve(129 * 129 + 128 * 128);
+        for (uint32 x = 0; x < 129; ++x)
+            for (uint32 y = 0; y < 129; ++y)
+                heights.push_back(height(float(x), float(y)));
+        for (uint32 x = 0; x < 128; ++x)
+            for (uint32 y = 0; y < 128; ++y)
+                heights.push_back(height(x + 0.5f, y + 0.5f));
+
+        header.areaMapOffset = sizeof(header);
+        header.areaMapSize = uint32(sizeof(areaHeader) + areaMap.size() * sizeof(uint16));
+        header.heightMapOffset = header.areaMapOffset + header.areaMapSize;
+        header.heightMapSize = uint32(sizeof(heightHeader) + heights.size() * sizeof(float));
+
+        std::vector<char> contents;
+        auto append = [&contents](void const* data, std::size_t size)
+        {
+            char const* bytes = static_cast<char const*>(data);
+            contents.insert(contents.end(), bytes, bytes + size);
+        };
+        append(&header, sizeof(header));
+        append(&areaHeader, sizeof(areaHeader));
+        append(areaMap.data(), areaMap.size() * sizeof(uint16));
+        append(&heightHeader, sizeof(heightHeader));
+        append(heights.data(), heights.size() * sizeof(float));
+        if (truncateTo)
+            contents.resize(truncateTo);
+
+        std::string fileName = (std::filesystem::temp_directory_path() / name).string();
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), contents.size());
+        return fileName;
+    }
+
+    std::string WriteTestMapFile(char const* name, float height, std::size_t truncateTo = 0)
+    {
+        return WriteTestMapFile(name, [height](float, float) { return height; }, truncateTo);
+    }
+
+    // slopes differ along x and y, so swapped or misplaced vertices show up as a wrong height
+    float SlopedHeight(float x, float y)
+    {
+        return 3.0f + 0.5f * x - 0.25f * y;
+    }
+
+    // world coordinates of a position given in v9 vertices inside the grid at the map center
+    float VertexToWorld(float vertex)
+    {
+        return -vertex * SIZE_OF_GRIDS / MAP_RESOLUTION;
+    }
+
+    // world coordinates that end up in area map cell [3][5]
+    float const AreaCellX = -0.21875f * SIZE_OF_GRIDS;
+    float const AreaCellY = -0.34375f * SIZE_OF_GRIDS;
+}
+
+TEST(GridTerrainDataTest, ReadIntoMemory)
+{
+    std::string fileName = WriteTestMapFile("ac_terrain_test_heap.map", 42.0f);
+
+    GridTerrainData terrainData;
+    ASSERT_EQ(terrainData.Load(fileName, false), TerrainMapDataReadResult::Success);
+    EXPECT_FLOAT_EQ(terrainData.getHeight(AreaCellX, AreaCellY), 42.0f);
+    EXPECT_EQ(terrainData.getArea(AreaCellX, AreaCellY), 3 * 16 + 5);
+
+    std::remove(fileName.c_str());
+}
+
+TEST(GridTerrainDataTest, MemoryMapped)
+{
+    std::string fileName = WriteTestMapFile("ac_terrain_test_mapped.map", -17.5f);
+
+    {
+        GridTerrainData terrainData;
+        ASSERT_EQ(terrainData.Load(fileName, true), TerrainMapDataReadResult::Success);
+        EXPECT_FLOAT_EQ(terrainData.getHeight(AreaCellX, AreaCellY), -17.5f);
+        EXPECT_EQ(terrainData.getArea(AreaCellX, AreaCellY), 3 * 16 + 5);
+    }
+
+    std::remove(fileName.c_str());
+}
+
+TEST(GridTerrainDataTest, VariedHeights)
+{
+    std::string fileName = WriteTestMapFile("ac_terrain_test_sloped.map", &SlopedHeight);
+
+    for (bool memoryMapped : { false, true })
+    {
+        GridTerrainData terrainData;
+        ASSERT_EQ(terrainData.Load(fileName, memoryMapped), TerrainMapDataReadResult::Success);
+
+        // points inside each of the four triangles of a cell and on cells far apart
+        for (auto [x, y] : { std::pair(10.25f, 5.5f), std::pair(10.8f, 5.3f), std::pair(77.6f, 100.125f), std::pair(3.1f, 64.9f), std::pair(126.7f, 1.2f) })
+            EXPECT_NEAR(terrainData.getHeight(VertexToWorld(x), VertexToWorld(y)), SlopedHeight(x, y), 0.01f) << "vertex " << x << ", " << y << (memoryMapped ? " mapped" : "");
+    }
+
+    std::remove(fileName.c_str());
+}
+
+TEST(GridTerrainDataTest, TruncatedHeightData)
+{
+    // cut in the middle of the v9 heights
+    std::string fileName = WriteTestMapFile("ac_terrain_test_truncated.map", 1.0f, sizeof(map_fileheader) + sizeof(map_areaHeader) + 512 + sizeof(map_heightHeader) + 1000);
+
+    GridTerrainData heapData;
+    EXPECT_EQ(heapData.Load(fileName, false), TerrainMapDataReadResult::InvalidHeightData);
+
+    GridTerrainData mappedData;
+    EXPECT_EQ(mappedData.Load(fileName, true), TerrainMapDataReadResult::InvalidHeightData);
+
+    std::remove(fileName.c_str());
+}
+
+TEST(GridTerrainDataTest, MissingFile)
+{
+    GridTerrainData terrainData;
+    EXPECT_EQ(terrainData.Load((std::filesystem::temp_directory_path() / "ac_terrain_test_missing.map").string(), true), TerrainMapDataReadResult::NotFound);
+}
@@ -0,0 +1,159 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CellImpl.h"
+#include "GridNotifiers.h"
+#include "gtest/gtest.h"
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+constexpr float SIGHT_RANGE = 100.0f;
+
+// Objects bucketed by cell, as stored in the grids
+typedef std::unordered_map<uint32, std::vector<Position>> CellObjects;
+
+CellObjects BucketByCell(std::vector<Position> const& objects)
+{
+    CellObjects cells;
+    for (Position const& object : objects)
+    {
+        CellCoord cell = Acore::ComputeCellCoord(object.GetPositionX(), object.GetPositionY());
+        cells[cell.GetId()].push_back(object);
+    }
+
+    return cells;
+}
+
+// Objects of a viewer moving from last to now whose in range state changed, but which the incremental
+// relocation notifier would not update
+uint32 CountMissed(CellObjects const& cells, Position const& last, Position const& now)
+{
+    CellArea area = Cell::CalculateCellArea(now.GetPositionX(), now.GetPositionY(), SIGHT_RANGE);
+    CellArea lastArea = Cell::CalculateCellArea(last.GetPositionX(), last.GetPositionY(), SIGHT_RANGE);
+
+    uint32 missed = 0;
+    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+    {
+        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+        {
+            CellCoord cell(x, y);
+            auto itr = cells.find(cell.GetId());
+            if (itr == cells.end() || !lastArea.Contains(cell))
+                continue;
+
+            for (Position const& object : itr->second)
+                if (object.IsInDist2d(&last, SIGHT_RANGE) != object.IsInDist2d(&now, SIGHT_RANGE)
+                    && !Acore::CrossesSightRange(last, object, now, object, SIGHT_RANGE))
+                    ++missed;
+        }
+    }
+
+    return missed;
+}
+
+std::vector<Position> SpawnObjects(uint32 count, float zoneSize, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> coord(-zoneSize / 2, zoneSize / 2);
+
+    std::vector<Position> objects;
+    for (uint32 i = 0; i < count; ++i)
+        objects.emplace_back(coord(rng), coord(rng), 0.0f);
+
+    return objects;
+}
+
+}
+
+TEST(VisibilityDeltaTest, CrossesSightRange)
+{
+    Position center(0.0f, 0.0f, 0.0f);
+
+    EXPECT_FALSE(Acore::CrossesSightRange(center, Position(10.0f, 0.0f), center, Position(20.0f, 0.0f), SIGHT_RANGE));
+    EXPECT_FALSE(Acore::CrossesSightRange(center, Position(150.0f, 0.0f), center, Position(0.0f, 150.0f), SIGHT_RANGE));
+    EXPECT_TRUE(Acore::CrossesSightRange(center, Position(95.0f, 0.0f), center, Position(105.0f, 0.0f), SIGHT_RANGE));
+    EXPECT_TRUE(Acore::CrossesSightRange(center, Position(0.0f, 105.0f), center, Position(0.0f, 95.0f), SIGHT_RANGE));
+
+    // same comparison as WorldObject::IsWithinSightRange, the edge itself is out of range
+    EXPECT_TRUE(Acore::CrossesSightRange(center, Position(100.0f, 0.0f), center, Position(99.0f, 0.0f), SIGHT_RANGE));
+}
+
+TEST(VisibilityDeltaTest, CrossesSightRangeBothMoving)
+{
+    // since their last notify the viewer moved 5 yards and the target 10 yards away from each other. Tested
+    // against the current position of the other one, neither of their notifies sees the target leave the range
+    Position viewerLast(0.0f, 0.0f, 0.0f);
+    Position viewerNow(-5.0f, 0.0f, 0.0f);
+    Position targetLast(95.0f, 0.0f, 0.0f);
+    Position targetNow(105.0f, 0.0f, 0.0f);
+
+    EXPECT_FALSE(Acore::CrossesSightRange(viewerLast, targetNow, viewerNow, targetNow, SIGHT_RANGE));
+    EXPECT_FALSE(Acore::CrossesSightRange(viewerNow, targetLast, viewerNow, targetNow, SIGHT_RANGE));
+    EXPECT_TRUE(Acore::CrossesSightRange(viewerLast, targetLast, viewerNow, targetNow, SIGHT_RANGE));
+
+    // the target notifies first and sees the viewer at its last notify, the viewer's own notify has nothing left to do
+    EXPECT_TRUE(Acore::CrossesSightRange(viewerLast, targetLast, viewerLast, targetNow, SIGHT_RANGE));
+    EXPECT_FALSE(Acore::CrossesSightRange(viewerLast, targetNow, viewerNow, targetNow, SIGHT_RANGE));
+
+    // moving the same way keeps the distance
+    EXPECT_FALSE(Acore::CrossesSightRange(viewerLast, targetLast, Position(50.0f, 0.0f), Position(145.0f, 0.0f), SIGHT_RANGE));
+}
+
+TEST(VisibilityDeltaTest, CellAreaContains)
+{
+    CellArea area(CellCoord(10, 20), CellCoord(12, 23));
+
+    EXPECT_TRUE(area.Contains(CellCoord(10, 20)));
+    EXPECT_TRUE(area.Contains(CellCoord(12, 23)));
+    EXPECT_TRUE(area.Contains(CellCoord(11, 22)));
+    EXPECT_FALSE(area.Contains(CellCoord(9, 21)));
+    EXPECT_FALSE(area.Contains(CellCoord(13, 21)));
+    EXPECT_FALSE(area.Contains(CellCoord(11, 19)));
+    EXPECT_FALSE(area.Contains(CellCoord(11, 24)));
+}
+
+TEST(VisibilityDeltaTest, EnteredCellsWereOutOfRange)
+{
+    std::mt19937 rng(12345);
+    std::vector<Position> objects = SpawnObjects(2000, 1000.0f, rng);
+    CellObjects cells = BucketByCell(objects);
+    std::uniform_real_distribution<float> step(-30.0f, 30.0f);
+
+    Position last(0.0f, 0.0f, 0.0f);
+    for (uint32 i = 0; i < 200; ++i)
+    {
+        Position now(last.GetPositionX() + step(rng), last.GetPositionY() + step(rng), 0.0f);
+        CellArea lastArea = Cell::CalculateCellArea(last.GetPositionX(), last.GetPositionY(), SIGHT_RANGE);
+
+        for (Position const& object : objects)
+        {
+            // the sight range never reaches out of the cell area visited around the viewer
+            if (object.IsInDist2d(&now, SIGHT_RANGE))
+                EXPECT_TRUE(Cell::CalculateCellArea(now.GetPositionX(), now.GetPositionY(), SIGHT_RANGE).Contains(Acore::ComputeCellCoord(object.GetPositionX(), object.GetPositionY())));
+
+            // objects of entered cells were out of range before, they are all new to the viewer
+            if (!lastArea.Contains(Acore::ComputeCellCoord(object.GetPositionX(), object.GetPositionY())))
+                EXPECT_FALSE(object.IsInDist2d(&last, SIGHT_RANGE));
+        }
+
+        EXPECT_EQ(CountMissed(cells, last, now), 0u);
+        last = now;
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LootAliasTable.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    // Reference: the linear roll of LootGroup::Roll over a roll in [0, 100)
+    uint32 LinearRoll(std::vector<float> const& chances, float roll)
+    {
+        for (uint32 i = 0; i < chances.size(); ++i)
+        {
+            if (chances[i] >= 100.0f)
+                return i;
+
+            roll -= chances[i];
+            if (roll < 0)
+                return i;
+        }
+
+        return chances.size();
+    }
+
+    // Frequencies of every outcome over an evenly spaced sweep of the random value
+    std::vector<double> Sweep(std::vector<float> const& chances, bool alias)
+    {
+        constexpr uint32 Steps = 1000000;
+
+        LootAliasTable table(chances);
+        std::vector<double> frequencies(chances.size() + 1, 0.0);
+        for (uint32 i = 0; i < Steps; ++i)
+        {
+            double const roll = (i + 0.5) / Steps;
+            ++frequencies[alias ? table.Sample(roll) : LinearRoll(chances, float(roll * 100.0))];
+        }
+
+        for (double& frequency : frequencies)
+            frequency /= Steps;
+
+        return frequencies;
+    }
+
+    void ExpectSameDistribution(std::vector<float> const& chances)
+    {
+        LootAliasTable table(chances);
+        std::vector<double> const expected = Sweep(chances, false);
+        std::vector<double> const actual = Sweep(chances, true);
+
+        ASSERT_EQ(table.GetMissIndex(), chances.size());
+        for (uint32 i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_NEAR(table.GetProbability(i), expected[i], 1e-5) << "outcome " << i;
+            EXPECT_NEAR(actual[i], expected[i], 1e-5) << "outcome " << i;
+        }
+    }
+}
+
+TEST(LootAliasTableTest, EmptyGroupAlwaysMisses)
+{
+    LootAliasTable table{ std::vector<float>() };
+    EXPECT_EQ(table.GetMissIndex(), 0u);
+    EXPECT_EQ(table.Sample(0.0), 0u);
+    EXPECT_EQ(table.Sample(0.999), 0u);
+    EXPECT_DOUBLE_EQ(table.GetProbability(0), 1.0);
+}
+
+TEST(LootAliasTableTest, MatchesLinearRoll)
+{
+    ExpectSameDistribution({ 10.0f, 20.0f, 30.0f });
+    ExpectSameDistribution({ 0.5f, 0.25f, 1.0f, 12.5f, 3.0f });
+    ExpectSameDistribution({ 12.5f, 12.5f, 12.5f, 12.5f, 12.5f, 12.5f, 12.5f, 12.5f });
+}
+
+TEST(LootAliasTableTest, ChancesOverHundredAreTruncated)
+{
+    // the second entry only gets what the first leaves, the third nothing
+    ExpectSameDistribution({ 60.0f, 60.0f, 10.0f });
+    // a guaranteed entry takes whatever is left when it is reached
+    ExpectSameDistribution({ 30.0f, 100.0f, 50.0f });
+
+    LootAliasTable table({ 60.0f, 60.0f, 10.0f });
+    EXPECT_NEAR(table.GetProbability(1), 0.4, 1e-9);
+    EXPECT_DOUBLE_EQ(table.GetProbability(2), 0.0);
+    EXPECT_DOUBLE_EQ(table.GetProbability(table.GetMissIndex()), 0.0);
+}
+
+TEST(LootAliasTableTest, RandomSamplingStaysInRange)
+{
+    LootAliasTable table({ 5.0f, 15.0f, 25.0f });
+    std::vector<uint32> counts(4, 0);
+    for (uint32 i = 0; i < 100000; ++i)
+    {
+        uint32 const index = table.Sample();
+        ASSERT_LE(index, table.GetMissIndex());
+        ++counts[index];
+    }
+
+    EXPECT_NEAR(counts[0] / 100000.0, 0.05, 0.01);
+    EXPECT_NEAR(counts[3] / 100000.0, 0.55, 0.01);
+}
@@ -0,0 +1,99 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldPacketPool.h"
+#include "gtest/gtest.h"
+#include <array>
+#include <thread>
+#include <vector>
+
+TEST(WorldPacketPoolTest, CopiesPayloadAndOpcode)
+{
+    WorldPacketPool& pool = WorldPacketPool::ForCurrentThread();
+
+    std::array<uint8, 6> payload = { 1, 2, 3, 4, 5, 6 };
+    TimePoint received = std::chrono::steady_clock::now();
+    WorldPacketPool::Ptr packet = pool.Acquire(0x1DA, payload.data(), payload.size(), received);
+
+    EXPECT_EQ(packet->GetOpcode(), 0x1DA);
+    EXPECT_EQ(packet->GetReceivedTime(), received);
+    ASSERT_EQ(packet->size(), payload.size());
+    EXPECT_EQ(packet->rpos(), 0u);
+    EXPECT_EQ(packet->read<uint32>(), 0x04030201u);
+
+    WorldPacketPool::Ptr empty = pool.Acquire(0x1DC, nullptr, 0);
+    EXPECT_TRUE(empty->empty());
+}
+
+TEST(WorldPacketPoolTest, ReusesReleasedPackets)
+{
+    WorldPacketPool& pool = WorldPacketPool::ForCurrentThread();
+    uint8 byte = 42;
+
+    WorldPacket* first = pool.Acquire(1, &byte, 1).release();
+    WorldPacketPool::Release(first);
+
+    WorldPacketPool::Statistics before = pool.GetStatistics();
+    WorldPacketPool::Ptr second = pool.Acquire(2, &byte, 1);
+    WorldPacketPool::Statistics after = pool.GetStatistics();
+
+    EXPECT_EQ(second.get(), first);
+    EXPECT_EQ(second->GetOpcode(), 2);
+    EXPECT_EQ(second->size(), 1u);
+    EXPECT_EQ(after.Acquired, before.Acquired + 1);
+    EXPECT_EQ(after.Allocated, before.Allocated);
+}
+
+TEST(WorldPacketPoolTest, ReturnsPacketsReleasedByOtherThreads)
+{
+    constexpr std::size_t PacketCount = 64;
+
+    WorldPacketPool* owner = nullptr;
+    std::vector<WorldPacket*> packets;
+
+    // Acquire on a "network" thread, release on this one
+    std::thread network([&]()
+    {
+        owner = &WorldPacketPool::ForCurrentThread();
+        uint8 byte = 7;
+        for (std::size_t i = 0; i < PacketCount; ++i)
+            packets.push_back(owner->Acquire(uint16(i), &byte, 1).release());
+    });
+    network.join();
+
+    ASSERT_NE(owner, &WorldPacketPool::ForCurrentThread());
+
+    WorldPacketPool::Statistics before = owner->GetStatistics();
+    EXPECT_EQ(before.Allocated, PacketCount);
+
+    for (WorldPacket* packet : packets)
+        WorldPacketPool::Release(packet);
+
+    WorldPacketPool::Statistics after = owner->GetStatistics();
+    EXPECT_EQ(after.RemoteReleased, before.RemoteReleased + PacketCount);
+
+    // The owner picks the returned packets up instead of allocating new ones
+    std::thread reuse([&]()
+    {
+        uint8 byte = 7;
+        for (std::size_t i = 0; i < PacketCount; ++i)
+            WorldPacketPool::Release(owner->Acquire(1, &byte, 1).release());
+    });
+    reuse.join();
+
+    EXPECT_EQ(owner->GetStatistics().Allocated, PacketCount);
+}
@@ -0,0 +1,141 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupLoader.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    void AddOrderedStages(StartupLoader& loader, std::vector<std::string>& order, std::mutex& lock)
+    {
+        auto record = [&order, &lock](std::string name)
+        {
+            return [&order, &lock, name]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                std::lock_guard<std::mutex> guard(lock);
+                order.push_back(name);
+            };
+        };
+
+        loader.AddStage("A", { }, record("A"));
+        loader.AddStage("B", { }, record("B"));
+        loader.AddStage("C", { "A" }, record("C"));
+        loader.AddStage("D", { "B", "C" }, record("D"));
+        loader.AddStage("E", { }, record("E"));
+        loader.AddStage("F", { "D", "E" }, record("F"));
+    }
+
+    std::size_t IndexOf(std::vector<std::string> const& order, std::string const& name)
+    {
+        return std::distance(order.begin(), std::find(order.begin(), order.end(), name));
+    }
+}
+
+TEST(StartupLoaderTest, SerialRunsInDeclarationOrder)
+{
+    StartupLoader loader;
+    std::vector<std::string> order;
+    std::mutex lock;
+    AddOrderedStages(loader, order, lock);
+
+    loader.Run(1);
+
+    EXPECT_EQ(order, (std::vector<std::string>{ "A", "B", "C", "D", "E", "F" }));
+    EXPECT_EQ(loader.GetThreads(), 1u);
+}
+
+TEST(StartupLoaderTest, ParallelRespectsDependencies)
+{
+    for (uint32 threads : { 2u, 4u, 8u })
+    {
+        StartupLoader loader;
+        std::vector<std::string> order;
+        std::mutex lock;
+        AddOrderedStages(loader, order, lock);
+
+        loader.Run(threads);
+
+        ASSERT_EQ(order.size(), 6u);
+        EXPECT_LT(IndexOf(order, "A"), IndexOf(order, "C"));
+        EXPECT_LT(IndexOf(order, "B"), IndexOf(order, "D"));
+        EXPECT_LT(IndexOf(order, "C"), IndexOf(order, "D"));
+        EXPECT_LT(IndexOf(order, "D"), IndexOf(order, "F"));
+        EXPECT_LT(IndexOf(order, "E"), IndexOf(order, "F"));
+    }
+}
+
+TEST(StartupLoaderTest, IndependentStagesOverlap)
+{
+    StartupLoader loader;
+    std::atomic<uint32> running = 0;
+    std::atomic<uint32> peak = 0;
+    auto stage = [&]()
+    {
+        uint32 now = ++running;
+        uint32 seen = peak;
+        while (now > seen && !peak.compare_exchange_weak(seen, now));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        --running;
+    };
+
+    for (std::string name : { "A", "B", "C", "D" })
+        loader.AddStage(name, { }, stage);
+
+    loader.Run(4);
+
+    EXPECT_GT(peak.load(), 1u);
+}
+
+TEST(StartupLoaderTest, CriticalPathFollowsLongestChain)
+{
+    StartupLoader loader;
+    auto sleep = [](uint32 ms) { return [ms]() { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }; };
+
+    loader.AddStage("Short", { }, sleep(1));
+    loader.AddStage("Long", { }, sleep(40));
+    loader.AddStage("AfterShort", { "Short" }, sleep(1));
+    loader.AddStage("Join", { "AfterShort", "Long" }, sleep(1));
+    loader.AddStage("Side", { "Short" }, sleep(1));
+
+    loader.Run(2);
+
+    std::vector<std::size_t> path = loader.GetCriticalPath();
+    ASSERT_EQ(path.size(), 2u);
+    EXPECT_EQ(loader.GetStages()[path[0]].Name, "Long");
+    EXPECT_EQ(loader.GetStages()[path[1]].Name, "Join");
+    EXPECT_GE(loader.GetStages()[path[0]].Duration, 40u);
+}
+
+TEST(StartupLoaderTest, ParallelRethrowsStageError)
+{
+    StartupLoader loader;
+    bool dependentRan = false;
+
+    loader.AddStage("Fails", { }, []() { throw std::runtime_error("load failed"); });
+    loader.AddStage("Dependent", { "Fails" }, [&dependentRan]() { dependentRan = true; });
+
+    EXPECT_THROW(loader.Run(2), std::runtime_error);
+    EXPECT_FALSE(dependentRan);
+}